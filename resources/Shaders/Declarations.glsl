@@ -55,6 +55,9 @@
   THE_ATTRIBUTE vec3 occNormal;
   THE_ATTRIBUTE vec4 occTexCoord;
   THE_ATTRIBUTE vec4 occVertColor;
+#ifdef THE_HAS_INSTANCING
+  THE_ATTRIBUTE mat4 occInstanceMatrix; //!< per-instance transformation (hardware instancing)
+#endif
 #elif defined(FRAGMENT_SHADER)
   #if (__VERSION__ >= 130)
     #ifdef OCC_ENABLE_draw_buffers
@@ -130,6 +133,14 @@ uniform mat4 occWorldViewMatrixInverseTranspose;  //!< Transpose of the inverse
 uniform mat4 occProjectionMatrixInverseTranspose; //!< Transpose of the inverse of the projection  matrix
 uniform mat4 occModelWorldMatrixInverseTranspose; //!< Transpose of the inverse of the model-world matrix
 
+#if defined(THE_HAS_INSTANCING) && defined(VERTEX_SHADER)
+mat4 occInstanceMatrixInverseTranspose(); //!< Transpose of the inverse of the per-instance transformation
+
+// apply per-instance transformation on top of model-world matrix
+#define occModelWorldMatrix                 (occModelWorldMatrix * occInstanceMatrix)
+#define occModelWorldMatrixInverseTranspose (occModelWorldMatrixInverseTranspose * occInstanceMatrixInverseTranspose())
+#endif
+
 #if defined(THE_IS_PBR)
 uniform sampler2D   occEnvLUT;             //!< Environment Lookup Table
 uniform sampler2D   occDiffIBLMapSHCoeffs; //!< Packed diffuse (irradiance) IBL map's spherical harmonics coefficients
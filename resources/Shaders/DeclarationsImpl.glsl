@@ -113,6 +113,22 @@ float occMaterial_Shininess(in bool theIsFront) { return theIsFront ? occCommonM
 vec3  occMaterial_Ambient(in bool theIsFront)   { return theIsFront ? occCommonMaterial[3].rgb : occCommonMaterial[7].rgb; }
 #endif
 
+#if defined(THE_HAS_INSTANCING) && defined(VERTEX_SHADER)
+mat4 occInstanceMatrixInverseTranspose()
+{
+  // cofactor matrix divided by determinant; translation does not affect directions
+  vec3 aCol0 = occInstanceMatrix[0].xyz;
+  vec3 aCol1 = occInstanceMatrix[1].xyz;
+  vec3 aCol2 = occInstanceMatrix[2].xyz;
+  vec3 aCof0 = cross (aCol1, aCol2);
+  float aDet = dot (aCol0, aCof0);
+  return mat4 (vec4 (aCof0 / aDet, 0.0),
+               vec4 (cross (aCol2, aCol0) / aDet, 0.0),
+               vec4 (cross (aCol0, aCol1) / aDet, 0.0),
+               vec4 (0.0, 0.0, 0.0, 1.0));
+}
+#endif
+
 // 2D texture coordinates transformation
 vec2  occTextureTrsf_Translation(void) { return occTexTrsf2d[0].xy; }
 vec2  occTextureTrsf_Scale(void)       { return occTexTrsf2d[0].zw; }
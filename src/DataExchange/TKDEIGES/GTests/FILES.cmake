@@ -3,4 +3,6 @@ set(OCCT_TKDEIGES_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDEIGES_GTests_FILES
     IGESExportTest.cxx
+    IGESFile_Read_Test.cxx
+    IGESToBRep_Reader_Test.cxx
 )
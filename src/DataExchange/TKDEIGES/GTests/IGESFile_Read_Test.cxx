@@ -0,0 +1,108 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IGESFile_Read.hxx>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <IGESControl_Writer.hxx>
+#include <IGESData_IGESModel.hxx>
+#include <IGESSelect_WorkLibrary.hxx>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+//! Returns a platform-independent temp file path for tests.
+std::filesystem::path getTempFile()
+{
+  return std::filesystem::temp_directory_path() / "occt_igesfile_read_test.igs";
+}
+
+//! Writes the box into IGES text.
+std::string writeBox(const bool theIsFnes, int& theNbEntities)
+{
+  IGESControl_Writer aWriter("MM", 0);
+  aWriter.AddShape(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aWriter.ComputeModel();
+  theNbEntities = aWriter.Model()->NbEntities();
+
+  std::ostringstream aStream;
+  aWriter.Write(aStream, theIsFnes);
+  return aStream.str();
+}
+
+//! Reads IGES text through a temporary file and returns the number of loaded entities.
+int readText(const std::string& theText, const bool theIsFnes, int& theStatus)
+{
+  const std::filesystem::path aPath = getTempFile();
+  {
+    std::ofstream aFile(aPath, std::ios::binary);
+    aFile << theText;
+  }
+  std::string aName = aPath.string();
+
+  occ::handle<IGESData_IGESModel> aModel = new IGESData_IGESModel;
+  theStatus = theIsFnes
+                ? IGESFile_ReadFNES(aName.data(), aModel, IGESSelect_WorkLibrary::DefineProtocol())
+                : IGESFile_Read(aName.data(), aModel, IGESSelect_WorkLibrary::DefineProtocol());
+  std::filesystem::remove(aPath);
+  return aModel->NbEntities();
+}
+} // namespace
+
+// Check that the file with LF line ends is read completely.
+TEST(IGESFile_ReadTest, LineFeedEnds)
+{
+  int               aNbEntities = 0, aStatus = -1;
+  const std::string aText       = writeBox(false, aNbEntities);
+  ASSERT_GT(aNbEntities, 0);
+  EXPECT_EQ(readText(aText, false, aStatus), aNbEntities);
+  EXPECT_EQ(aStatus, 0);
+}
+
+// Check that the file having only CR characters as line ends is read completely.
+TEST(IGESFile_ReadTest, CarriageReturnEnds)
+{
+  int         aNbEntities = 0, aStatus = -1;
+  std::string aText       = writeBox(false, aNbEntities);
+  std::replace(aText.begin(), aText.end(), '\n', '\r');
+  EXPECT_EQ(readText(aText, false, aStatus), aNbEntities);
+  EXPECT_EQ(aStatus, 0);
+}
+
+// Check that the file without line end after the last line is read completely.
+TEST(IGESFile_ReadTest, NoTrailingLineEnd)
+{
+  int         aNbEntities = 0, aStatus = -1;
+  std::string aText       = writeBox(false, aNbEntities);
+  while (!aText.empty() && (aText.back() == '\n' || aText.back() == '\r'))
+  {
+    aText.pop_back();
+  }
+  EXPECT_EQ(readText(aText, false, aStatus), aNbEntities);
+  EXPECT_EQ(aStatus, 0);
+}
+
+// Check that the file written in FNES mode is read completely.
+TEST(IGESFile_ReadTest, FnesMode)
+{
+  int               aNbEntities = 0, aStatus = -1;
+  const std::string aText       = writeBox(true, aNbEntities);
+  EXPECT_EQ(readText(aText, true, aStatus), aNbEntities);
+  EXPECT_EQ(aStatus, 0);
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IGESToBRep_Reader.hxx>
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <GProp_GProps.hxx>
+#include <IGESBasic_SingularSubfigure.hxx>
+#include <IGESBasic_SubfigureDef.hxx>
+#include <IGESControl_Writer.hxx>
+#include <IGESData_IGESModel.hxx>
+#include <IGESGeom_Line.hxx>
+#include <TCollection_HAsciiString.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns number of faces in the shape.
+int nbFaces(const TopoDS_Shape& theShape)
+{
+  int aNb = 0;
+  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+
+//! Returns area of the shape.
+double area(const TopoDS_Shape& theShape)
+{
+  GProp_GProps aProps;
+  BRepGProp::SurfaceProperties(theShape, aProps);
+  return aProps.Mass();
+}
+
+//! Returns the first edge of the shape.
+TopoDS_Edge firstEdge(const TopoDS_Shape& theShape)
+{
+  TopExp_Explorer anExp(theShape, TopAbs_EDGE);
+  return anExp.More() ? TopoDS::Edge(anExp.Current()) : TopoDS_Edge();
+}
+
+//! Translates root entities of the model.
+TopoDS_Shape transferRoots(const occ::handle<IGESData_IGESModel>& theModel,
+                           const bool                             theToRunParallel,
+                           int&                                   theNbShapes)
+{
+  IGESToBRep_Reader aReader;
+  aReader.SetModel(theModel);
+  aReader.SetRunParallel(theToRunParallel);
+  aReader.TransferRoots();
+  theNbShapes = aReader.NbShapes();
+  return aReader.OneShape();
+}
+
+//! Creates the model with two subfigure instances sharing the same definition.
+occ::handle<IGESData_IGESModel> createSharedSubfigureModel()
+{
+  occ::handle<IGESGeom_Line> aLine = new IGESGeom_Line;
+  aLine->Init(gp_XYZ(0.0, 0.0, 0.0), gp_XYZ(10.0, 0.0, 0.0));
+  occ::handle<NCollection_HArray1<occ::handle<IGESData_IGESEntity>>> anEntities =
+    new NCollection_HArray1<occ::handle<IGESData_IGESEntity>>(1, 1);
+  anEntities->SetValue(1, aLine);
+  occ::handle<IGESBasic_SubfigureDef> aDef = new IGESBasic_SubfigureDef;
+  aDef->Init(0, new TCollection_HAsciiString("LINE"), anEntities);
+
+  IGESControl_Writer aWriter("MM", 0);
+  for (int anInstIter = 0; anInstIter < 2; ++anInstIter)
+  {
+    occ::handle<IGESBasic_SingularSubfigure> anInst = new IGESBasic_SingularSubfigure;
+    anInst->Init(aDef, gp_XYZ(0.0, 10.0 * anInstIter, 0.0), false, 1.0);
+    aWriter.AddEntity(anInst);
+  }
+  aWriter.ComputeModel();
+  return aWriter.Model();
+}
+} // namespace
+
+// Check that parallel translation of trimmed surfaces gives the same result as sequential one.
+TEST(IGESToBRep_ReaderTest, RunParallel_MatchesSequential)
+{
+  IGESControl_Writer aWriter("MM", 0);
+  aWriter.AddShape(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aWriter.AddShape(BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape());
+  aWriter.ComputeModel();
+
+  int                aNbSeqShapes = 0, aNbParShapes = 0;
+  const TopoDS_Shape aSeqShape = transferRoots(aWriter.Model(), false, aNbSeqShapes);
+  const TopoDS_Shape aParShape = transferRoots(aWriter.Model(), true, aNbParShapes);
+
+  EXPECT_GT(aNbSeqShapes, 1);
+  EXPECT_EQ(aNbParShapes, aNbSeqShapes);
+  EXPECT_EQ(nbFaces(aParShape), nbFaces(aSeqShape));
+  EXPECT_NEAR(area(aParShape), area(aSeqShape), 1.0e-6 * area(aSeqShape));
+}
+
+// Check that roots sharing entities are translated by the same thread
+// and keep sharing the translated sub-shapes as in sequential mode.
+TEST(IGESToBRep_ReaderTest, RunParallel_SharedEntitiesTranslatedOnce)
+{
+  const occ::handle<IGESData_IGESModel> aModel = createSharedSubfigureModel();
+  for (int aModeIter = 0; aModeIter < 2; ++aModeIter)
+  {
+    IGESToBRep_Reader aReader;
+    aReader.SetModel(aModel);
+    aReader.SetRunParallel(aModeIter == 1);
+    aReader.TransferRoots();
+    ASSERT_EQ(aReader.NbShapes(), 2);
+
+    const TopoDS_Edge anEdge1 = firstEdge(aReader.Shape(1));
+    const TopoDS_Edge anEdge2 = firstEdge(aReader.Shape(2));
+    ASSERT_FALSE(anEdge1.IsNull());
+    ASSERT_FALSE(anEdge2.IsNull());
+    EXPECT_TRUE(anEdge1.IsPartner(anEdge2));
+    EXPECT_FALSE(anEdge1.IsSame(anEdge2));
+  }
+}
+
+// Check that tolerance used by parallel translation matches the sequential one.
+TEST(IGESToBRep_ReaderTest, RunParallel_UsedTolerance)
+{
+  IGESControl_Writer aWriter("MM", 0);
+  aWriter.AddShape(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aWriter.AddShape(BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape());
+  aWriter.ComputeModel();
+
+  IGESToBRep_Reader aSeqReader;
+  aSeqReader.SetModel(aWriter.Model());
+  aSeqReader.TransferRoots();
+
+  IGESToBRep_Reader aParReader;
+  aParReader.SetModel(aWriter.Model());
+  aParReader.SetRunParallel(true);
+  aParReader.TransferRoots();
+
+  EXPECT_DOUBLE_EQ(aParReader.UsedTolerance(), aSeqReader.UsedTolerance());
+}
@@ -26,7 +26,9 @@ void IGESFile_Check2 (int mode,char * code, int num, char * str);
 
 /*  #include "structiges.c"    ...  done by analiges which uses it  ...  */
 void iges_initfile();
-int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes);
+int  iges_loadfile (FILE* lefic);
+void iges_freefile();
+int  iges_lire (int *numsec, char ligne[100], int modefnes);
 void iges_newparam(int typarg,int longval, char *parval);
 void iges_param(int *Pstat,char *ligne,char c_separ,char c_fin,int lonlin);
 void iges_Dsect (int *Dstat,int numsec,char* ligne);
@@ -61,11 +63,15 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
   if (nomfic[0] != '\0') 
     lefic = OSD_OpenFile(nomfic,"r");
   if (lefic == NULL) return -1;    /*  file could not be opened  */
+  /*  the whole file is loaded in memory, lines are then read from there  */
+  j = iges_loadfile(lefic);
+  fclose(lefic);
+  if (j != 0) return -1;
   for (i = 1; i < 6; i++) lesect[i] = 0;
   for (j = 0; j < 100; j++) ligne[j] = 0;
   for(;;) {
     numl ++;
-    i = iges_lire(lefic,&numsec,ligne,modefnes);
+    i = iges_lire(&numsec,ligne,modefnes);
     if (i <= 0 || i < i0) {
       if (i  == 0) break;
       /* Sending of message : Syntax error */
@@ -77,7 +83,7 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
 
       if (i0 == 0)
       {
-        fclose(lefic);
+        iges_freefile();
         return -1;
       }
       lesect[i0] ++;
@@ -124,7 +130,7 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
   }
   
 
-  fclose (lefic);
+  iges_freefile();
 
   return 0;
 }
@@ -49,7 +49,9 @@ extern "C"
   struct dirpart* iges_get_curp(void);
 
   void iges_initfile();
-  int  iges_lire(FILE* lefic, int* numsec, char line[100], int modefnes);
+  int  iges_loadfile(FILE* lefic);
+  void iges_freefile();
+  int  iges_lire(int* numsec, char line[100], int modefnes);
   void iges_newparam(int typarg, int longval, char* parval);
   void iges_param(int* Pstat, char* line, char c_separ, char c_fin, int lonlin);
   void iges_Dsect(int* Dstat, int numsec, char* line);
@@ -14,6 +14,7 @@
 */
 
 #include "igesread.h"
+#include <stdlib.h>
 #include <string.h>
 /*    Basic routine for reading an IGES file
 
@@ -31,9 +32,88 @@
 */
 
 static int iges_fautrelire = 0;
-int  iges_lire (FILE* lefic, int *numsec, char line[100], int modefnes)
-/*int iges_lire (lefic,numsec,line,modefnes)*/
-/*FILE* lefic; int *numsec; char line[100]; int modefnes;*/
+
+/*    Content of the file being read: it is loaded at once by iges_loadfile,
+      then lines are taken from memory by iges_getline (which behaves as fgets)
+      instead of issuing one stdio call per line                            */
+static char*  iges_filebuf = NULL;
+static size_t iges_filelen = 0;
+static size_t iges_filepos = 0;
+static int    iges_fileeof = 0;
+
+int iges_loadfile (FILE* lefic)
+{
+  size_t sizebuf = 65536, nbread;
+  long   posbeg  = ftell (lefic);
+  iges_freefile();
+  /*  the buffer is sized once for regular files; it grows only for streams
+      which cannot be positioned (like stdin), or if the file grows meanwhile  */
+  if (posbeg >= 0 && fseek (lefic, 0L, SEEK_END) == 0) {
+    long posend = ftell (lefic);
+    if (fseek (lefic, posbeg, SEEK_SET) != 0) return -1;
+    if (posend >= posbeg) sizebuf = (size_t) (posend - posbeg) + 1;
+  }
+  iges_filebuf = (char*) malloc (sizebuf);
+  if (iges_filebuf == NULL) return -1;
+  for (;;) {
+    nbread = fread (iges_filebuf + iges_filelen, 1, sizebuf - iges_filelen, lefic);
+    iges_filelen += nbread;
+    if (iges_filelen < sizebuf) break;    /* end of file (or read error) */
+    {
+      char* newbuf = (char*) realloc (iges_filebuf, sizebuf * 2);
+      if (newbuf == NULL) {  iges_freefile();  return -1;  }
+      iges_filebuf = newbuf;  sizebuf *= 2;
+    }
+  }
+  return 0;
+}
+
+void iges_freefile()
+{
+  free (iges_filebuf);
+  iges_filebuf = NULL;
+  iges_filelen = iges_filepos = 0;
+  iges_fileeof = 0;
+}
+
+/*    Same as fgets on the loaded file: reads at most n-1 characters,
+      stops after a newline, sets the end-of-file flag when data is exhausted */
+static char* iges_getline (char* line, int n)
+{
+  int i = 0;
+  while (i < n - 1) {
+    char c;
+    if (iges_filepos >= iges_filelen) {
+      iges_fileeof = 1;
+      break;
+    }
+    c = iges_filebuf[iges_filepos++];
+    line[i++] = c;
+    if (c == '\n') break;
+  }
+  if (i == 0 && n > 1) return NULL;
+  line[i] = '\0';
+  return line;
+}
+
+/*    Same as sscanf(str,"%d",val): skips blanks, reads optional sign and digits */
+static int iges_readint (const char* str, int* val)
+{
+  int sign = 1, res = 0, nbdig = 0;
+  while (*str == ' ' || (*str >= '\t' && *str <= '\r'))
+    str ++;
+  if (*str == '-' || *str == '+') {
+    if (*str == '-') sign = -1;
+    str ++;
+  }
+  for (; *str >= '0' && *str <= '9'; str ++, nbdig ++)
+    res = res * 10 + (*str - '0');
+  if (nbdig == 0) return 0;
+  *val = sign * res;
+  return 1;
+}
+
+int  iges_lire (int *numsec, char line[100], int modefnes)
 {
   int i,result; char typesec;
 /*  int length;*/
@@ -45,18 +125,18 @@ int  iges_lire (FILE* lefic, int *numsec, char line[100], int modefnes)
     line[0] = '\0'; 
     if(modefnes)
     {
-      if (fgets(line,99,lefic) == NULL) /*for kept compatibility with fnes*/
+      if (iges_getline(line,99) == NULL) /*for kept compatibility with fnes*/
         return 0;
     }
     else
     {
       /* PTV: 21.03.2002 it is necessary for files that have only `\r` but no `\n`
               example file is 919-001-T02-04-CP-VL.iges */
-      while ( fgets ( line, 2, lefic ) && ( line[0] == '\r' || line[0] == '\n' ) )
+      while ( iges_getline ( line, 2 ) && ( line[0] == '\r' || line[0] == '\n' ) )
       {
       }
       
-      if (fgets(&line[1],80,lefic) == NULL)
+      if (iges_getline(&line[1],80) == NULL)
         return 0;
     }
     
@@ -66,15 +146,15 @@ int  iges_lire (FILE* lefic, int *numsec, char line[100], int modefnes)
       
       if(modefnes)
       {
-        if (fgets(line,99,lefic) == NULL) /*for kept compatibility with fnes*/
+        if (iges_getline(line,99) == NULL) /*for kept compatibility with fnes*/
           return 0;
       }
       else
       {
-        while ( fgets ( line, 2, lefic ) && ( line[0] == '\r' || line[0] == '\n' ) )
+        while ( iges_getline ( line, 2 ) && ( line[0] == '\r' || line[0] == '\n' ) )
         {
         }
-        if (fgets(&line[1],80,lefic) == NULL)
+        if (iges_getline(&line[1],80) == NULL)
           return 0;
       }
     }
@@ -86,7 +166,7 @@ int  iges_lire (FILE* lefic, int *numsec, char line[100], int modefnes)
     }
   }
 
-  if (feof(lefic))
+  if (iges_fileeof)
     return 0;
 
   {//0x1A is END_OF_FILE for OS DOS and WINDOWS. For other OS we set this rule forcefully.
@@ -100,9 +180,9 @@ int  iges_lire (FILE* lefic, int *numsec, char line[100], int modefnes)
 
   iges_fautrelire = 0;
   if (line[0] == '\0' || line[0] == '\n' || line[0] == '\r')
-    return iges_lire(lefic,numsec,line,modefnes); /* 0 */
+    return iges_lire(numsec,line,modefnes); /* 0 */
 
-  if (sscanf(&line[73],"%d",&result) == 1) {
+  if (iges_readint(&line[73],&result) == 1) {
     *numsec = result;
     typesec = line[72];
     switch (typesec) {
@@ -146,7 +226,7 @@ int  iges_lire (FILE* lefic, int *numsec, char line[100], int modefnes)
   // find the number start
   while (line[i] >= '0' && line[i] <= '9' && i > 0)
     i--;
-  if (sscanf(&line[i + 1],"%d",&result) != 1)
+  if (iges_readint(&line[i + 1],&result) != 1)
     return -1;
   *numsec = result;
   // find type of line
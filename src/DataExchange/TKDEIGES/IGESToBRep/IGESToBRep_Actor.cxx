@@ -85,7 +85,8 @@ static void TrimTolerances(const TopoDS_Shape& theShape, const double theToleran
 
 IGESToBRep_Actor::IGESToBRep_Actor()
     : thecontinuity(0),
-      theeps(0.0001)
+      theeps(0.0001),
+      myToPrepareForTransfer(true)
 {
 }
 
@@ -163,7 +164,10 @@ occ::handle<Transfer_Binder> IGESToBRep_Actor::Transfer(
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressScope aPS(theProgress, "Transfer stage", 2);
 
-    XSAlgo_ShapeProcessor::PrepareForTransfer();
+    if (myToPrepareForTransfer)
+    {
+      XSAlgo_ShapeProcessor::PrepareForTransfer();
+    }
     IGESToBRep_CurveAndSurface CAS;
     CAS.SetModel(mymodel);
     CAS.SetContinuity(thecontinuity);
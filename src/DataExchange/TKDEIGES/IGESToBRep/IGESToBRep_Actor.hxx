@@ -61,12 +61,21 @@ public:
   //! the file or from statics
   Standard_EXPORT double UsedTolerance() const;
 
+  //! Sets the flag to reset the global length unit from static parameters before transfer;
+  //! TRUE by default. It is disabled for actors translating entities in parallel threads,
+  //! when the unit is set once by the caller beforehand.
+  void SetPrepareForTransfer(const bool theToPrepare) { myToPrepareForTransfer = theToPrepare; }
+
+  //! Returns TRUE if the global length unit is reset before transfer.
+  bool ToPrepareForTransfer() const { return myToPrepareForTransfer; }
+
   DEFINE_STANDARD_RTTIEXT(IGESToBRep_Actor, Transfer_ActorOfTransientProcess)
 
 private:
   occ::handle<Interface_InterfaceModel> themodel;
   int                                   thecontinuity;
   double                                theeps;
+  bool                                  myToPrepareForTransfer;
 };
 
 #endif // _IGESToBRep_Actor_HeaderFile
@@ -31,11 +31,15 @@
 #include <IGESToBRep_Reader.hxx>
 #include <Interface_CheckIterator.hxx>
 #include <Interface_CheckTool.hxx>
+#include <Interface_EntityIterator.hxx>
+#include <Interface_Graph.hxx>
 #include <Interface_ShareFlags.hxx>
 #include <Interface_Static.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_Msg.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
@@ -104,12 +108,149 @@ static void TrimTolerances(const TopoDS_Shape& theShape, const double theToleran
                         std::max(theTolerance, Interface_Static::RVal("read.maxprecision.val")));
   }
 }
+//! Functor translating groups of root entities in parallel threads.
+//! Roots of different groups share no entities, so each group gets its own
+//! transient process, while roots of one group are translated sequentially
+//! by the same thread to translate their common entities only once.
+class RootTransferFunctor
+{
+public:
+  //! Main constructor.
+  RootTransferFunctor(const occ::handle<IGESData_IGESModel>&                       theModel,
+                      const occ::handle<IGESToBRep_Actor>&                         theActor,
+                      const occ::handle<Message_Messenger>&                        theMessenger,
+                      const NCollection_Array1<occ::handle<IGESData_IGESEntity>>& theRoots,
+                      const NCollection_Array1<NCollection_Sequence<int>>&        theGroups,
+                      NCollection_LinearVector<Message_ProgressRange>&             theRanges,
+                      const OSD_ThreadPool::Launcher&                              theLauncher)
+      : myModel(theModel),
+        myMessenger(theMessenger),
+        myRoots(theRoots),
+        myGroups(theGroups),
+        myRanges(theRanges),
+        myActors(theLauncher.LowerThreadIndex(), theLauncher.UpperThreadIndex()),
+        myProcs(theGroups.Lower(), theGroups.Upper()),
+        myShapes(theRoots.Lower(), theRoots.Upper()),
+        myIsFailed(theRoots.Lower(), theRoots.Upper())
+  {
+    myIsFailed.Init(false);
+    // the first thread uses the main actor to keep its used tolerance up to date
+    myActors.SetValue(myActors.Lower(), theActor);
+    for (int aThreadIter = myActors.Lower() + 1; aThreadIter <= myActors.Upper(); ++aThreadIter)
+    {
+      occ::handle<IGESToBRep_Actor> anActor = new IGESToBRep_Actor;
+      anActor->SetModel(theModel);
+      anActor->SetContinuity(theActor->GetContinuity());
+      anActor->SetShapeFixParameters(theActor->GetShapeFixParameters());
+      if (theActor->GetProcessingFlags().second)
+      {
+        anActor->SetProcessingFlags(theActor->GetProcessingFlags().first);
+      }
+      myActors.SetValue(aThreadIter, anActor);
+    }
+    // global length unit is set once by the caller and should not be reset concurrently
+    for (int aThreadIter = myActors.Lower(); aThreadIter <= myActors.Upper(); ++aThreadIter)
+    {
+      myActors.Value(aThreadIter)->SetPrepareForTransfer(false);
+    }
+  }
+
+  //! Restores the global length unit handling of the main actor.
+  ~RootTransferFunctor() { myActors.Value(myActors.Lower())->SetPrepareForTransfer(true); }
+
+  //! Translates the group of roots with specified index within [0, NbGroups) range.
+  void operator()(int theThreadIndex, int theGroupIndex) const
+  {
+    const NCollection_Sequence<int>&     aGroup  = myGroups.Value(theGroupIndex + 1);
+    const occ::handle<IGESToBRep_Actor>& anActor = myActors.Value(theThreadIndex);
+
+    occ::handle<Transfer_TransientProcess> aProc = new Transfer_TransientProcess(64);
+    aProc->SetMessenger(myMessenger);
+    aProc->SetErrorHandle(true);
+    aProc->SetRootManagement(true);
+    aProc->SetModel(myModel);
+    aProc->SetActor(anActor);
+    myProcs.SetValue(theGroupIndex + 1, aProc);
+    for (NCollection_Sequence<int>::Iterator aRootIter(aGroup); aRootIter.More(); aRootIter.Next())
+    {
+      const int                               aRootIndex = aRootIter.Value();
+      const occ::handle<IGESData_IGESEntity>& anEnt      = myRoots.Value(aRootIndex);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        aProc->Transfer(anEnt, myRanges[aRootIndex - 1]);
+        TopoDS_Shape         aShape = TransferBRep::ShapeResult(aProc, anEnt);
+        ShapeExtend_Explorer aSBE;
+        if (!aShape.IsNull() && aSBE.ShapeType(aShape, true) != TopAbs_SHAPE)
+        {
+          EncodeRegul(aShape);
+          TrimTolerances(aShape, anActor->UsedTolerance());
+        }
+        myShapes.SetValue(aRootIndex, aShape);
+      }
+      catch (Standard_Failure const&)
+      {
+        myIsFailed.SetValue(aRootIndex, true);
+      }
+    }
+  }
+
+  //! Returns the transient process of the group within [1, NbGroups] range.
+  const occ::handle<Transfer_TransientProcess>& Process(const int theGroupIndex) const
+  {
+    return myProcs.Value(theGroupIndex);
+  }
+
+  //! Returns the shape translated from the root within [1, NbRoots] range.
+  const TopoDS_Shape& Shape(const int theIndex) const { return myShapes.Value(theIndex); }
+
+  //! Returns TRUE if translation of the root within [1, NbRoots] range has failed.
+  bool IsFailed(const int theIndex) const { return myIsFailed.Value(theIndex); }
+
+  //! Returns the maximal tolerance used by actors of all threads.
+  double UsedTolerance() const
+  {
+    double aTolerance = 0.0;
+    for (int aThreadIter = myActors.Lower(); aThreadIter <= myActors.Upper(); ++aThreadIter)
+    {
+      aTolerance = std::max(aTolerance, myActors.Value(aThreadIter)->UsedTolerance());
+    }
+    return aTolerance;
+  }
+
+private:
+  occ::handle<IGESData_IGESModel>                                    myModel;
+  occ::handle<Message_Messenger>                                     myMessenger;
+  const NCollection_Array1<occ::handle<IGESData_IGESEntity>>&        myRoots;
+  const NCollection_Array1<NCollection_Sequence<int>>&               myGroups;
+  NCollection_LinearVector<Message_ProgressRange>&                   myRanges;
+  NCollection_Array1<occ::handle<IGESToBRep_Actor>>                  myActors;
+  mutable NCollection_Array1<occ::handle<Transfer_TransientProcess>> myProcs;
+  mutable NCollection_Array1<TopoDS_Shape>                           myShapes;
+  mutable NCollection_Array1<bool>                                   myIsFailed;
+};
+
+//=======================================================================
+// function : findGroup
+// purpose  : Returns the representative root of the group (union-find)
+//=======================================================================
+static int findGroup(NCollection_Array1<int>& theParents, int theRoot)
+{
+  while (theParents.Value(theRoot) != theRoot)
+  {
+    theParents.ChangeValue(theRoot) = theParents.Value(theParents.Value(theRoot));
+    theRoot                         = theParents.Value(theRoot);
+  }
+  return theRoot;
+}
 } // namespace
 
 //=============================================================================
 
 IGESToBRep_Reader::IGESToBRep_Reader()
-    : theDone(false)
+    : theDone(false),
+      myUsedTolerance(0.0),
+      myIsRunParallel(false)
 {
   if (protocol.IsNull())
   {
@@ -336,6 +477,7 @@ void IGESToBRep_Reader::TransferRoots(const bool                   onlyvisible,
   c.Start(); // Initialisation du CHRONO
   theDone = false;
   theShapes.Clear();
+  myUsedTolerance = 0.0;
 
   int level = theProc->TraceLevel();
   theProc->SetErrorHandle(true);
@@ -373,6 +515,9 @@ void IGESToBRep_Reader::TransferRoots(const bool                   onlyvisible,
   // sln 11.06.2002 OCC448
   Interface_Static::SetIVal("read.iges.onlyvisible", onlyvisible);
 
+  NCollection_Sequence<occ::handle<IGESData_IGESEntity>> aParallelRoots;
+  NCollection_LinearVector<Message_ProgressRange>        aParallelRanges;
+
   Message_ProgressScope PS(theProgress, "Root", nb);
   for (int i = 1; i <= nb && PS.More(); i++)
   {
@@ -390,7 +535,13 @@ void IGESToBRep_Reader::TransferRoots(const bool                   onlyvisible,
       TF->Send(msg2070, Message_Info);
     }
     // on ajoute un traitement pour ne prendre que les entites visibles
-    if (!onlyvisible || ent->BlankStatus() == 0)
+    if ((!onlyvisible || ent->BlankStatus() == 0) && myIsRunParallel)
+    {
+      // translated below in parallel threads
+      aParallelRoots.Append(ent);
+      aParallelRanges.Append(aRange);
+    }
+    else if (!onlyvisible || ent->BlankStatus() == 0)
     {
       TopoDS_Shape shape;
       theDone = true;
@@ -426,6 +577,12 @@ void IGESToBRep_Reader::TransferRoots(const bool                   onlyvisible,
       }
     }
   }
+  if (!aParallelRoots.IsEmpty())
+  {
+    theDone = true;
+    transferRootsParallel(aParallelRoots, aParallelRanges);
+  }
+
   char t[20];
   t[0] = '\0';
   double second, cpu;
@@ -450,10 +607,146 @@ void IGESToBRep_Reader::TransferRoots(const bool                   onlyvisible,
 
 //=============================================================================
 
+void IGESToBRep_Reader::transferRootsParallel(
+  const NCollection_Sequence<occ::handle<IGESData_IGESEntity>>& theRoots,
+  NCollection_LinearVector<Message_ProgressRange>&               theRanges)
+{
+  const int                                            aNbRoots = theRoots.Length();
+  NCollection_Array1<occ::handle<IGESData_IGESEntity>> aRoots(1, aNbRoots);
+  {
+    int aRootIndex = 1;
+    for (NCollection_Sequence<occ::handle<IGESData_IGESEntity>>::Iterator aRootIter(theRoots);
+         aRootIter.More();
+         aRootIter.Next(), ++aRootIndex)
+    {
+      aRoots.SetValue(aRootIndex, aRootIter.Value());
+    }
+  }
+
+  // roots sharing entities at any level are joined into one group translated by single thread,
+  // so that the common entities are translated only once as in sequential mode
+  const occ::handle<Interface_Protocol> aProtocol = protocol; // to avoid ambiguity
+  Interface_Graph                       aGraph(theModel, aProtocol);
+  NCollection_Array1<int>               anEntityRoots(1, theModel->NbEntities());
+  NCollection_Array1<int>               aParents(1, aNbRoots);
+  anEntityRoots.Init(0);
+  for (int aRootIter = 1; aRootIter <= aNbRoots; ++aRootIter)
+  {
+    aParents.SetValue(aRootIter, aRootIter);
+    NCollection_Sequence<int> aStack;
+    aStack.Append(theModel->Number(aRoots.Value(aRootIter)));
+    while (!aStack.IsEmpty())
+    {
+      const int anEntity = aStack.Last();
+      aStack.Remove(aStack.Length());
+      const int anEntityRoot = anEntityRoots.Value(anEntity);
+      if (anEntityRoot == aRootIter)
+      {
+        continue;
+      }
+      else if (anEntityRoot != 0)
+      {
+        // the entity and its shared ones are already reached from another root
+        const int aGroup1 = findGroup(aParents, anEntityRoot);
+        const int aGroup2 = findGroup(aParents, aRootIter);
+        aParents.SetValue(std::max(aGroup1, aGroup2), std::min(aGroup1, aGroup2));
+        continue;
+      }
+      anEntityRoots.SetValue(anEntity, aRootIter);
+      for (Interface_EntityIterator aSharedIter = aGraph.Shareds(theModel->Value(anEntity));
+           aSharedIter.More();
+           aSharedIter.Next())
+      {
+        aStack.Append(theModel->Number(aSharedIter.Value()));
+      }
+    }
+  }
+
+  // groups are numbered in the order of their first roots
+  NCollection_Array1<int> aRootGroups(1, aNbRoots);
+  int                     aNbGroups = 0;
+  for (int aRootIter = 1; aRootIter <= aNbRoots; ++aRootIter)
+  {
+    const int aGroupRoot = findGroup(aParents, aRootIter);
+    aRootGroups.SetValue(aRootIter,
+                         aGroupRoot == aRootIter ? ++aNbGroups : aRootGroups.Value(aGroupRoot));
+  }
+  NCollection_Array1<NCollection_Sequence<int>> aGroups(1, aNbGroups);
+  for (int aRootIter = 1; aRootIter <= aNbRoots; ++aRootIter)
+  {
+    aGroups.ChangeValue(aRootGroups.Value(aRootIter)).Append(aRootIter);
+  }
+
+  // the global length unit is set here once, actors do not reset it within parallel threads
+  XSAlgo_ShapeProcessor::PrepareForTransfer();
+
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const int aNbThreads = std::min(aNbGroups, aThreadPool->NbDefaultThreadsToLaunch());
+  OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+  RootTransferFunctor      aFunctor(theModel,
+                                    theActor,
+                                    theProc->Messenger(),
+                                    aRoots,
+                                    aGroups,
+                                    theRanges,
+                                    aLauncher);
+  aLauncher.Perform(0, aNbGroups, aFunctor);
+  myUsedTolerance = aFunctor.UsedTolerance();
+
+  // merge bindings of groups, which are disjoint, and then results in the order of roots
+  for (int aGroupIter = 1; aGroupIter <= aNbGroups; ++aGroupIter)
+  {
+    const occ::handle<Transfer_TransientProcess>& aProc = aFunctor.Process(aGroupIter);
+    if (aProc.IsNull())
+    {
+      continue;
+    }
+    for (int aMapIter = 1; aMapIter <= aProc->NbMapped(); ++aMapIter)
+    {
+      const occ::handle<Standard_Transient>& aStart = aProc->Mapped(aMapIter);
+      if (theProc->Find(aStart).IsNull())
+      {
+        theProc->Bind(aStart, aProc->MapItem(aMapIter));
+      }
+    }
+  }
+
+  occ::handle<Message_Messenger> TF = theProc->Messenger();
+  ShapeExtend_Explorer           SBE;
+  for (int aRootIter = 1; aRootIter <= aNbRoots; ++aRootIter)
+  {
+    const occ::handle<Transfer_TransientProcess>& aProc =
+      aFunctor.Process(aRootGroups.Value(aRootIter));
+    if (!aProc.IsNull() && aProc->RootIndex(aRoots.Value(aRootIter)) != 0)
+    {
+      theProc->SetRoot(aRoots.Value(aRootIter));
+    }
+
+    const TopoDS_Shape& aShape = aFunctor.Shape(aRootIter);
+    if (aFunctor.IsFailed(aRootIter))
+    {
+      Message_Msg msg1005("IGES_1005");
+      TF->Send(msg1005, Message_Info);
+    }
+    else if (aShape.IsNull())
+    {
+      Message_Msg msg2076("IGES_2076");
+      TF->Send(msg2076, Message_Info);
+    }
+    else if (SBE.ShapeType(aShape, true) != TopAbs_SHAPE)
+    {
+      theShapes.Append(aShape);
+    }
+  }
+}
+
+//=============================================================================
+
 bool IGESToBRep_Reader::Transfer(const int num, const Message_ProgressRange& theProgress)
 {
   occ::handle<Message_Messenger> TF = theProc->Messenger();
   theDone                           = false;
+  myUsedTolerance                   = 0.0;
   if (theModel.IsNull())
   {
     Message_Msg msg2031("IGES_2031");
@@ -607,7 +900,7 @@ bool IGESToBRep_Reader::Transfer(const int num, const Message_ProgressRange& the
 
 double IGESToBRep_Reader::UsedTolerance() const
 {
-  return theActor->UsedTolerance();
+  return std::max(theActor->UsedTolerance(), myUsedTolerance);
 }
 
 //=============================================================================
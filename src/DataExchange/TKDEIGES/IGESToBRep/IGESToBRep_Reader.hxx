@@ -25,10 +25,12 @@
 #include <Standard_Integer.hxx>
 #include <Standard_CString.hxx>
 #include <TopoDS_Shape.hxx>
+#include <NCollection_LinearVector.hxx>
 #include <NCollection_Sequence.hxx>
 #include <XSAlgo_ShapeProcessor.hxx>
 
 struct DE_ShapeFixParameters;
+class IGESData_IGESEntity;
 class IGESData_IGESModel;
 class IGESToBRep_Actor;
 class Transfer_TransientProcess;
@@ -84,6 +86,17 @@ public:
     const bool                   onlyvisible = true,
     const Message_ProgressRange& theProgress = Message_ProgressRange());
 
+  //! Sets the flag to translate independent root entities in parallel threads
+  //! within TransferRoots(); FALSE by default.
+  //! Roots sharing entities at any level are joined into one group translated by single thread,
+  //! and only groups having no common entities are translated concurrently, each with its own
+  //! transient process. The results are merged in the order of roots, so that the output
+  //! does not depend on the number of threads.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if root entities are translated in parallel threads.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
   //! Transfers an Entity given its rank in the Model (Root or not)
   //! Returns True if it is recognized as Geom-Topol.
   //! (But it can have failed : see IsDone)
@@ -95,7 +108,8 @@ public:
 
   //! Returns the Tolerance which has been actually used, converted
   //! in millimeters
-  //! (either that from File or that from Session, according the mode)
+  //! (either that from File or that from Session, according the mode).
+  //! After parallel translation, the maximal value among all threads is returned.
   Standard_EXPORT double UsedTolerance() const;
 
   //! Returns the number of shapes produced by the translation.
@@ -153,6 +167,12 @@ private:
   //! If parameters haven't yet been provided, initializes them with default values.
   void InitializeMissingParameters();
 
+  //! Splits the root entities into groups without common entities, translates the groups
+  //! in parallel threads and merges the results in the order of roots.
+  void transferRootsParallel(
+    const NCollection_Sequence<occ::handle<IGESData_IGESEntity>>& theRoots,
+    NCollection_LinearVector<Message_ProgressRange>&               theRanges);
+
 private:
   occ::handle<IGESData_IGESModel>        theModel;
   bool                                   theDone;
@@ -163,6 +183,8 @@ private:
   XSAlgo_ShapeProcessor::ParameterMap myShapeProcParams; //!< Parameters for shape processing.
   XSAlgo_ShapeProcessor::ProcessingFlags myShapeProcFlags; //!< Flags defining operations to be performed on shapes.
   // clang-format on
+  double myUsedTolerance; //!< Maximal tolerance used by actors of parallel threads
+  bool   myIsRunParallel; //!< Flag to translate root entities in parallel threads
 };
 
 #endif // _IGESToBRep_Reader_HeaderFile
@@ -91,7 +91,8 @@ public:
     bool ReadFillDoc = true; //!< Flag for fill document from shape sequence
     bool ReadFillIncomplete = true; //!< Flag for fill the document with partially retrieved data even if reader has failed with error
     // clang-format on
-    int ReadMemoryLimitMiB = -1; //!< Memory usage limit
+    int  ReadMemoryLimitMiB = -1;    //!< Memory usage limit
+    bool ReadParallel       = false; //!< Flag to parse file content in parallel threads
     // Writing
     TCollection_AsciiString WriteComment; //!< Export special comment
     TCollection_AsciiString WriteAuthor;  //!< Author of exported file name
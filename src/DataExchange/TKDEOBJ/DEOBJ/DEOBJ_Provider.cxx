@@ -84,6 +84,7 @@ bool DEOBJ_Provider::Read(const TCollection_AsciiString&       thePath,
   aReader.SetDocument(theDocument);
   aReader.SetRootPrefix(aNode->InternalParameters.ReadRootPrefix);
   aReader.SetMemoryLimitMiB(aNode->InternalParameters.ReadMemoryLimitMiB);
+  aReader.SetParallel(aNode->InternalParameters.ReadParallel);
   if (!aReader.Perform(thePath, theProgress))
   {
     Message::SendFail() << "Error in the DEOBJ_ConfigurationNode during reading the file "
@@ -197,6 +198,7 @@ bool DEOBJ_Provider::Read(const TCollection_AsciiString& thePath,
   aSimpleReader.SetCreateShapes(aNode->InternalParameters.ReadCreateShapes);
   aSimpleReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
   aSimpleReader.SetMemoryLimit(aNode->InternalParameters.ReadMemoryLimitMiB);
+  aSimpleReader.SetParallel(aNode->InternalParameters.ReadParallel);
   if (!aSimpleReader.Read(thePath, theProgress))
   {
     Message::SendFail() << "Error in the DEOBJ_ConfigurationNode during reading the file "
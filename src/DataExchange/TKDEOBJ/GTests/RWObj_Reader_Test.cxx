@@ -0,0 +1,215 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWObj_TriangulationReader.hxx>
+
+#include <BRep_Tool.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+namespace
+{
+//! Generates OBJ file with a grid of quads split into several groups.
+//! The file size exceeds parallel reader chunk to be split into several chunks.
+std::string generateObj(const int theNbRows, const int theNbCols)
+{
+  std::ostringstream aStream;
+  aStream << "# generated grid\r\n# second comment line\n\n";
+  for (int aRow = 0; aRow <= theNbRows; ++aRow)
+  {
+    if (aRow % 64 == 0)
+    {
+      aStream << "o Object" << aRow << "\n";
+    }
+    else if (aRow % 16 == 0)
+    {
+      aStream << "g Group" << aRow << "\ns " << (aRow % 32 == 0 ? "1" : "off") << "\n";
+    }
+    for (int aCol = 0; aCol <= theNbCols; ++aCol)
+    {
+      aStream << "v " << aCol * 0.125 << " " << aRow * 0.25 << " " << (aRow + aCol) % 7 << "\n";
+      aStream << "vt " << double(aCol) / theNbCols << " " << double(aRow) / theNbRows << "\n";
+      aStream << "vn 0 0 1\n";
+    }
+    if (aRow == 0)
+    {
+      continue;
+    }
+
+    const int aRowUpper = aRow * (theNbCols + 1) + 1;
+    const int aRowLower = aRowUpper - (theNbCols + 1);
+    for (int aCol = 0; aCol < theNbCols; ++aCol)
+    {
+      const int aNodes[4] = {aRowLower + aCol,
+                             aRowLower + aCol + 1,
+                             aRowUpper + aCol + 1,
+                             aRowUpper + aCol};
+      if (aCol % 5 == 0)
+      {
+        // negative indices relative to the last vertex
+        const int aNbVerts = (aRow + 1) * (theNbCols + 1);
+        aStream << "f";
+        for (int aNodeIter = 0; aNodeIter < 4; ++aNodeIter)
+        {
+          const int aNode = aNodes[aNodeIter] - aNbVerts - 1;
+          aStream << " " << aNode << "/" << aNode << "/" << aNode;
+        }
+        aStream << "\n";
+      }
+      else if (aCol % 5 == 1)
+      {
+        // line continuation and Windows line ending
+        aStream << "f " << aNodes[0] << "//" << aNodes[0] << " " << aNodes[1] << "//" << aNodes[1]
+                << " \\\n"
+                << aNodes[2] << "//" << aNodes[2] << " " << aNodes[3] << "//" << aNodes[3]
+                << "\r\n";
+      }
+      else
+      {
+        aStream << "f " << aNodes[0] << "/" << aNodes[0] << " " << aNodes[1] << "/" << aNodes[1]
+                << " " << aNodes[2] << "/" << aNodes[2] << "\n";
+        aStream << "f " << aNodes[0] << " " << aNodes[2] << " " << aNodes[3] << "\n";
+      }
+    }
+  }
+  // polygon to be triangulated
+  const int aNbCols1 = theNbCols + 1;
+  aStream << "f 1 2 " << aNbCols1 + 3 << " " << aNbCols1 + 2 << " " << aNbCols1 + 1 << "\n";
+  return aStream.str();
+}
+
+//! Reads OBJ data into the shape.
+TopoDS_Shape readObj(const std::string& theData,
+                     const bool         theToParallel,
+                     const bool         theToCreateShapes,
+                     int&               theNbNodes,
+                     int&               theNbElems)
+{
+  std::istringstream        aStream(theData);
+  RWObj_TriangulationReader aReader;
+  aReader.SetParallel(theToParallel);
+  aReader.SetCreateShapes(theToCreateShapes);
+  EXPECT_TRUE(aReader.Read(aStream, "grid.obj", Message_ProgressRange()));
+  EXPECT_STREQ(aReader.FileComments().ToCString(), "generated grid\nsecond comment line");
+  theNbNodes = aReader.NbProbeNodes();
+  theNbElems = aReader.NbProbeElems();
+  return aReader.ResultShape();
+}
+
+//! Collects triangulations of shape faces.
+NCollection_DynamicArray<occ::handle<Poly_Triangulation>> faceTriangulations(
+  const TopoDS_Shape& theShape)
+{
+  NCollection_DynamicArray<occ::handle<Poly_Triangulation>> aTris;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    TopLoc_Location aLoc;
+    aTris.Append(BRep_Tool::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc));
+  }
+  return aTris;
+}
+
+//! Checks that triangulations are equal.
+void compareTriangulations(const occ::handle<Poly_Triangulation>& theTris1,
+                           const occ::handle<Poly_Triangulation>& theTris2)
+{
+  ASSERT_FALSE(theTris1.IsNull());
+  ASSERT_FALSE(theTris2.IsNull());
+  ASSERT_EQ(theTris1->NbNodes(), theTris2->NbNodes());
+  ASSERT_EQ(theTris1->NbTriangles(), theTris2->NbTriangles());
+  ASSERT_EQ(theTris1->HasNormals(), theTris2->HasNormals());
+  ASSERT_EQ(theTris1->HasUVNodes(), theTris2->HasUVNodes());
+  for (int aNodeIter = 1; aNodeIter <= theTris1->NbNodes(); ++aNodeIter)
+  {
+    EXPECT_TRUE(theTris1->Node(aNodeIter).IsEqual(theTris2->Node(aNodeIter), 0.0));
+    if (theTris1->HasUVNodes())
+    {
+      EXPECT_TRUE(theTris1->UVNode(aNodeIter).IsEqual(theTris2->UVNode(aNodeIter), 0.0));
+    }
+  }
+  for (int aTriIter = 1; aTriIter <= theTris1->NbTriangles(); ++aTriIter)
+  {
+    int aNodes1[3], aNodes2[3];
+    theTris1->Triangle(aTriIter).Get(aNodes1[0], aNodes1[1], aNodes1[2]);
+    theTris2->Triangle(aTriIter).Get(aNodes2[0], aNodes2[1], aNodes2[2]);
+    EXPECT_EQ(aNodes1[0], aNodes2[0]);
+    EXPECT_EQ(aNodes1[1], aNodes2[1]);
+    EXPECT_EQ(aNodes1[2], aNodes2[2]);
+  }
+}
+} // namespace
+
+TEST(RWObj_ReaderTest, ParallelRead_MatchesSequential)
+{
+  const std::string aData = generateObj(160, 400);
+  ASSERT_GT(aData.size(), size_t(2 * 1024 * 1024));
+
+  int                aNbNodesSeq = 0, aNbElemsSeq = 0, aNbNodesPar = 0, aNbElemsPar = 0;
+  const TopoDS_Shape aShapeSeq = readObj(aData, false, true, aNbNodesSeq, aNbElemsSeq);
+  const TopoDS_Shape aShapePar = readObj(aData, true, true, aNbNodesPar, aNbElemsPar);
+  EXPECT_EQ(aNbNodesSeq, 161 * 401);
+  EXPECT_EQ(aNbNodesSeq, aNbNodesPar);
+  EXPECT_EQ(aNbElemsSeq, aNbElemsPar);
+
+  const NCollection_DynamicArray<occ::handle<Poly_Triangulation>> aTrisSeq =
+    faceTriangulations(aShapeSeq);
+  const NCollection_DynamicArray<occ::handle<Poly_Triangulation>> aTrisPar =
+    faceTriangulations(aShapePar);
+  ASSERT_GT(aTrisSeq.Length(), 1);
+  ASSERT_EQ(aTrisSeq.Length(), aTrisPar.Length());
+  for (int aFaceIter = 0; aFaceIter < aTrisSeq.Length(); ++aFaceIter)
+  {
+    compareTriangulations(aTrisSeq.Value(aFaceIter), aTrisPar.Value(aFaceIter));
+  }
+}
+
+TEST(RWObj_ReaderTest, ParallelRead_SingleTriangulation)
+{
+  const std::string aData = generateObj(32, 64);
+
+  int                aNbNodesSeq = 0, aNbElemsSeq = 0, aNbNodesPar = 0, aNbElemsPar = 0;
+  const TopoDS_Shape aShapeSeq = readObj(aData, false, false, aNbNodesSeq, aNbElemsSeq);
+  const TopoDS_Shape aShapePar = readObj(aData, true, false, aNbNodesPar, aNbElemsPar);
+  EXPECT_EQ(aNbElemsSeq, aNbElemsPar);
+
+  const NCollection_DynamicArray<occ::handle<Poly_Triangulation>> aTrisSeq =
+    faceTriangulations(aShapeSeq);
+  const NCollection_DynamicArray<occ::handle<Poly_Triangulation>> aTrisPar =
+    faceTriangulations(aShapePar);
+  ASSERT_EQ(aTrisSeq.Length(), 1);
+  ASSERT_EQ(aTrisPar.Length(), 1);
+  compareTriangulations(aTrisSeq.First(), aTrisPar.First());
+}
+
+TEST(RWObj_ReaderTest, ParallelRead_InvalidIndex)
+{
+  // element referring vertex defined after it should be rejected in both modes
+  const std::string aData = "v 0 0 0\nv 1 0 0\nf 1 2 3\nv 0 1 0\nf 1 2 3\n";
+  for (int aModeIter = 0; aModeIter < 2; ++aModeIter)
+  {
+    std::istringstream        aStream(aData);
+    RWObj_TriangulationReader aReader;
+    aReader.SetParallel(aModeIter == 1);
+    aReader.SetCreateShapes(false);
+    EXPECT_TRUE(aReader.Read(aStream, "invalid.obj", Message_ProgressRange()));
+    const occ::handle<Poly_Triangulation> aTris = aReader.GetTriangulation();
+    ASSERT_FALSE(aTris.IsNull());
+    EXPECT_EQ(aTris->NbTriangles(), 1) << "Parallel mode: " << aModeIter;
+  }
+}
@@ -19,7 +19,8 @@ IMPLEMENT_STANDARD_RTTIEXT(RWObj_CafReader, RWMesh_CafReader)
 //=================================================================================================
 
 RWObj_CafReader::RWObj_CafReader()
-    : myIsSinglePrecision(false)
+    : myIsSinglePrecision(false),
+      myToParallel(false)
 {
   // myCoordSysConverter.SetInputLengthUnit (-1.0); // length units are undefined within OBJ file
   //  OBJ format does not define coordinate system (apart from mentioning that it is right-handed),
@@ -95,6 +96,7 @@ bool RWObj_CafReader::performMesh(std::istream&                  theStream,
 {
   occ::handle<RWObj_TriangulationReader> aCtx = createReaderContext();
   aCtx->SetSinglePrecision(myIsSinglePrecision);
+  aCtx->SetParallel(myToParallel);
   aCtx->SetCreateShapes(true);
   aCtx->SetShapeReceiver(this);
   aCtx->SetTransformation(myCoordSysConverter);
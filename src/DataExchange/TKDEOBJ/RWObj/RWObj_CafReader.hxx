@@ -31,6 +31,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision(bool theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
 
+  //! Return flag to parse file content in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup flag to parse file content in parallel threads (see RWObj_Reader::SetParallel()).
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
   //! Read the mesh from specified file.
   Standard_EXPORT bool performMesh(std::istream&                  theStream,
@@ -58,6 +64,7 @@ protected:
   // clang-format off
   bool myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
   // clang-format on
+  bool myToParallel; //!< flag to parse file content in parallel threads
 };
 
 #endif // _RWObj_CafReader_HeaderFile
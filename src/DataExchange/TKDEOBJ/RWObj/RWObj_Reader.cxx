@@ -24,6 +24,7 @@
 #include <Message_ProgressScope.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_Timer.hxx>
 #include <Standard_CLocaleSentry.hxx>
@@ -62,6 +63,239 @@ static bool isClockwisePolygon(const occ::handle<BRepMesh_DataStructureOfDelaun>
   }
   return aPtSum < 0.0;
 }
+
+//! Parse nodes of "f" record as (vertex, UV, normal) indices starting from 0;
+//! negative (relative) indices are kept as is.
+static void readFaceNodes(const char*                                      thePos,
+                          NCollection_LinearVector<NCollection_Vec3<int>>& theNodes)
+{
+  char* aNext = nullptr;
+  for (;;)
+  {
+    NCollection_Vec3<int> a3Indices(-1, -1, -1);
+    a3Indices[0] = int(strtol(thePos, &aNext, 10) - 1);
+    if (aNext == thePos)
+    {
+      break;
+    }
+
+    // parse UV index
+    thePos = aNext;
+    if (*thePos == '/')
+    {
+      ++thePos;
+      if (*thePos != '/')
+      {
+        a3Indices[1] = int(strtol(thePos, &aNext, 10) - 1);
+        thePos       = aNext;
+      }
+
+      // parse Normal index
+      if (*thePos == '/')
+      {
+        ++thePos;
+        if (!IsSpace(*thePos))
+        {
+          a3Indices[2] = int(strtol(thePos, &aNext, 10) - 1);
+          thePos       = aNext;
+        }
+      }
+    }
+    theNodes.Append(a3Indices);
+
+    if (*thePos == '\n' || *thePos == '\0')
+    {
+      break;
+    }
+
+    if (*thePos != ' ')
+    {
+      ++thePos;
+    }
+  }
+}
+
+// The length of chunk parsed by a single thread (in bytes)
+static const size_t THE_CHUNK_SIZE = 1024 * 1024;
+
+//! Return TRUE if the line break at specified position continues the line
+//! (multi-line syntax with backslash at the end of line).
+static bool isContinuedLine(const char* theNewLine, const char* theBegin)
+{
+  const char* aPos = theNewLine - 1;
+  if (aPos >= theBegin && *aPos == '\r')
+  {
+    --aPos;
+  }
+  return aPos >= theBegin && *aPos == '\\';
+}
+
+//! Find the first complete line end at or after specified position.
+//! @return position after the line break or theEnd if not found
+static char* findLineEnd(char* theBegin, char* thePos, char* theEnd)
+{
+  while (thePos < theEnd)
+  {
+    char* aNewLine = (char*)::memchr(thePos, '\n', theEnd - thePos);
+    if (aNewLine == nullptr)
+    {
+      return theEnd;
+    }
+    if (!isContinuedLine(aNewLine, theBegin))
+    {
+      return aNewLine + 1;
+    }
+    thePos = aNewLine + 1;
+  }
+  return theEnd;
+}
+
+//! Find the end of the last complete line within the buffer.
+//! @return position after the line break or theBegin if not found
+static char* findLastLineEnd(char* theBegin, char* theEnd)
+{
+  for (char* aPos = theEnd - 1; aPos >= theBegin; --aPos)
+  {
+    if (*aPos == '\n' && !isContinuedLine(aPos, theBegin))
+    {
+      return aPos + 1;
+    }
+  }
+  return theBegin;
+}
+
+//! Split the line starting at specified position in place:
+//! lines continued with backslash are joined with a gap,
+//! the line break is replaced by null character.
+//! Buffer should have one extra byte after theEnd for null-termination of the last line.
+//! @return position of the next line
+static char* splitLine(char* theLine, char* theEnd)
+{
+  char* aWrite = theLine;
+  for (char* aRead = theLine;;)
+  {
+    char* aNewLine = (char*)::memchr(aRead, '\n', theEnd - aRead);
+    char* aSegEnd  = aNewLine != nullptr ? aNewLine : theEnd;
+    char* aNext    = aNewLine != nullptr ? aNewLine + 1 : theEnd;
+    if (aNewLine != nullptr && aSegEnd > aRead && aSegEnd[-1] == '\r')
+    {
+      --aSegEnd;
+    }
+    const bool isContinued = aNewLine != nullptr && aSegEnd > aRead && aSegEnd[-1] == '\\';
+    if (aWrite != aRead)
+    {
+      std::memmove(aWrite, aRead, aSegEnd - aRead);
+    }
+    aWrite += aSegEnd - aRead;
+    if (!isContinued)
+    {
+      *aWrite = '\0';
+      return aNext;
+    }
+    aWrite[-1] = ' ';
+    aRead      = aNext;
+  }
+}
+
+//! Record of the chunk which should be handled sequentially.
+struct ObjChunkRecord
+{
+  const char* Line;     //!< line of the record or NULL for "f" record
+  int         LineNb;   //!< line number within the chunk (starting from 1)
+  int         NbVerts;  //!< number of chunk vertices preceding the record
+  int         NbNorms;  //!< number of chunk normals preceding the record
+  int         NbTexels; //!< number of chunk texture coordinates preceding the record
+  int         NbNodes;  //!< number of nodes of "f" record
+};
+
+//! Chunk of OBJ file parsed by a single thread.
+struct ObjChunk
+{
+  char*                                             Begin = nullptr;
+  char*                                             End   = nullptr;
+  NCollection_LinearVector<gp_XYZ>                  Verts;
+  NCollection_LinearVector<NCollection_Vec3<float>> Norms;
+  NCollection_LinearVector<NCollection_Vec2<float>> Texels;
+  NCollection_LinearVector<NCollection_Vec3<int>>   FaceNodes;
+  NCollection_LinearVector<ObjChunkRecord>          Records;
+  int                                               NbLines = 0;
+
+  //! Release parsed data.
+  void Clear()
+  {
+    Verts.Clear();
+    Norms.Clear();
+    Texels.Clear();
+    FaceNodes.Clear();
+    Records.Clear();
+    NbLines = 0;
+  }
+};
+
+//! Functor parsing vertex attributes and element indices of chunks.
+class ObjChunkParser
+{
+public:
+  ObjChunkParser(NCollection_LinearVector<ObjChunk>&     theChunks,
+                 const RWMesh_CoordinateSystemConverter& theCSTrsf)
+      : myChunks(theChunks),
+        myCSTrsf(theCSTrsf)
+  {
+  }
+
+  void operator()(int theIndex) const
+  {
+    ObjChunk& aChunk = myChunks[theIndex];
+    char*     aNext  = nullptr;
+    for (char* aLine = aChunk.Begin; aLine < aChunk.End;)
+    {
+      char* aNextLine = splitLine(aLine, aChunk.End);
+      ++aChunk.NbLines;
+      if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar(aLine[1]))
+      {
+        gp_XYZ& anXYZ = aChunk.Verts.Appended();
+        RWObj_Tools::ReadVec3(aLine + 2, aNext, anXYZ);
+        myCSTrsf.TransformPosition(anXYZ);
+      }
+      else if (aLine[0] == 'v' && aLine[1] == 'n' && RWObj_Tools::isSpaceChar(aLine[2]))
+      {
+        NCollection_Vec3<float>& aNorm = aChunk.Norms.Appended();
+        RWObj_Tools::ReadVec3(aLine + 3, aNext, aNorm);
+        myCSTrsf.TransformNormal(aNorm);
+      }
+      else if (aLine[0] == 'v' && aLine[1] == 't' && RWObj_Tools::isSpaceChar(aLine[2]))
+      {
+        NCollection_Vec2<float>& anUV = aChunk.Texels.Appended();
+        const char*              aPos = aLine + 3;
+        anUV.x()                      = (float)Strtod(aPos, &aNext);
+        aPos                          = aNext;
+        anUV.y()                      = (float)Strtod(aPos, &aNext);
+      }
+      else if (*aLine != '\0')
+      {
+        const bool      isFace  = aLine[0] == 'f' && RWObj_Tools::isSpaceChar(aLine[1]);
+        ObjChunkRecord& aRecord = aChunk.Records.Appended();
+        aRecord.Line            = isFace ? nullptr : aLine;
+        aRecord.LineNb          = aChunk.NbLines;
+        aRecord.NbVerts         = (int)aChunk.Verts.Size();
+        aRecord.NbNorms         = (int)aChunk.Norms.Size();
+        aRecord.NbTexels        = (int)aChunk.Texels.Size();
+        aRecord.NbNodes         = 0;
+        if (isFace)
+        {
+          const size_t aNbNodesBefore = aChunk.FaceNodes.Size();
+          readFaceNodes(aLine + 2, aChunk.FaceNodes);
+          aRecord.NbNodes = int(aChunk.FaceNodes.Size() - aNbNodesBefore);
+        }
+      }
+      aLine = aNextLine;
+    }
+  }
+
+private:
+  NCollection_LinearVector<ObjChunk>&     myChunks;
+  const RWMesh_CoordinateSystemConverter& myCSTrsf;
+};
 } // namespace
 
 //=================================================================================================
@@ -73,7 +307,8 @@ RWObj_Reader::RWObj_Reader()
       myNbProbeNodes(0),
       myNbProbeElems(0),
       myNbElemsBig(0),
-      myToAbort(false)
+      myToAbort(false),
+      myToParallel(false)
 {
 }
 
@@ -121,6 +356,11 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     return false;
   }
 
+  if (myToParallel && !theToProbe)
+  {
+    return readParallel(theStream, aFileLen, theProgress);
+  }
+
   Standard_ReadLineBuffer aBuffer(THE_BUFFER_SIZE);
   aBuffer.SetMultilineMode(true);
 
@@ -161,17 +401,7 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     {
       if (isStart)
       {
-        TCollection_AsciiString aComment(aLine + 1);
-        aComment.LeftAdjust();
-        aComment.RightAdjust();
-        if (!aComment.IsEmpty())
-        {
-          if (!myFileComments.IsEmpty())
-          {
-            myFileComments += "\n";
-          }
-          myFileComments += aComment;
-        }
+        pushComment(aLine + 1);
       }
       continue;
     }
@@ -217,34 +447,176 @@ bool RWObj_Reader::read(std::istream&                  theStream,
       ++myNbProbeElems;
       pushIndices(aLine + 2);
     }
-    else if (aLine[0] == 'g' && IsSpace(aLine[1]))
+    else
     {
-      pushGroup(aLine + 2);
+      pushRecord(aLine);
     }
-    else if (aLine[0] == 's' && IsSpace(aLine[1]))
+
+    if (!checkMemory())
     {
-      pushSmoothGroup(aLine + 2);
+      addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+      return false;
     }
-    else if (aLine[0] == 'o' && IsSpace(aLine[1]))
+  }
+
+  finishRead(theToProbe);
+  return true;
+}
+
+//=================================================================================================
+
+bool RWObj_Reader::readParallel(std::istream&                theStream,
+                                const int64_t                theFileLen,
+                                const Message_ProgressRange& theProgress)
+{
+  const int    aNbThreads   = std::max(OSD_Parallel::NbLogicalProcessors(), 1);
+  const size_t aBlockSize   = THE_CHUNK_SIZE * aNbThreads * 4;
+  const int    aNbMiBTotal  = int(theFileLen / (1024 * 1024));
+  int          aNbMiBPassed = 0;
+  int64_t      aPosition    = 0;
+
+  Message_ProgressScope              aPS(theProgress, "Reading text OBJ file", aNbMiBTotal);
+  NCollection_LinearVector<char>     aBlock;
+  NCollection_LinearVector<ObjChunk> aChunks;
+  size_t                             aNbTailBytes = 0;
+  bool                               isStart      = true;
+  bool                               isEof        = false;
+  while (!isEof)
+  {
+    if (!aPS.More())
     {
-      pushObject(aLine + 2);
+      return false;
     }
-    else if (::strncmp(aLine, "mtllib", 6) == 0)
+
+    // read the next block keeping incomplete line from the previous one;
+    // one extra byte is reserved for null-termination of the last line
+    const size_t aBlockCapacity = std::max(aBlockSize, aNbTailBytes * 2);
+    aBlock.Resize(aBlockCapacity + 1);
+    theStream.read(aBlock.Data() + aNbTailBytes, std::streamsize(aBlockCapacity - aNbTailBytes));
+    const size_t aNbReadBytes = (size_t)theStream.gcount();
+    isEof                     = !theStream.good();
+    aPosition += aNbReadBytes;
+
+    char* aBlockBegin = aBlock.Data();
+    char* aBlockEnd   = aBlockBegin + aNbTailBytes + aNbReadBytes;
+    char* aLinesEnd   = isEof ? aBlockEnd : findLastLineEnd(aBlockBegin, aBlockEnd);
+    aNbTailBytes      = size_t(aBlockEnd - aLinesEnd);
+    if (aLinesEnd == aBlockBegin && !isEof)
     {
-      readMaterialLib(IsSpace(aLine[6]) ? aLine + 7 : "");
+      // the line does not fit into the block
+      continue;
     }
-    else if (::strncmp(aLine, "usemtl", 6) == 0)
+
+    // split block into chunks at line boundaries and parse them in parallel
+    aChunks.Clear();
+    for (char* aChunkBegin = aBlockBegin; aChunkBegin < aLinesEnd;)
     {
-      pushMaterial(IsSpace(aLine[6]) ? aLine + 7 : "");
+      char* aChunkEnd = aLinesEnd;
+      if (size_t(aLinesEnd - aChunkBegin) > THE_CHUNK_SIZE)
+      {
+        aChunkEnd = findLineEnd(aBlockBegin, aChunkBegin + THE_CHUNK_SIZE, aLinesEnd);
+      }
+      ObjChunk& aChunk = aChunks.Appended();
+      aChunk.Begin     = aChunkBegin;
+      aChunk.End       = aChunkEnd;
+      aChunkBegin      = aChunkEnd;
     }
+    OSD_Parallel::For(0, (int)aChunks.Size(), ObjChunkParser(aChunks, myCSTrsf));
 
-    if (!checkMemory())
+    // create nodes and elements sequentially in the order of the file
+    for (size_t aChunkIter = 0; aChunkIter < aChunks.Size(); ++aChunkIter)
     {
-      addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
-      return false;
+      const ObjChunk& aChunk    = aChunks[aChunkIter];
+      const int       aLineFrom = myNbLines;
+      int             aNbVerts = 0, aNbNorms = 0, aNbTexels = 0, aNbNodes = 0;
+      for (size_t aRecIter = 0; aRecIter <= aChunk.Records.Size(); ++aRecIter)
+      {
+        const bool            isLast      = aRecIter == aChunk.Records.Size();
+        const ObjChunkRecord* aRecord     = isLast ? nullptr : &aChunk.Records[aRecIter];
+        const int             aNbVertsTo  = isLast ? (int)aChunk.Verts.Size() : aRecord->NbVerts;
+        const int             aNbNormsTo  = isLast ? (int)aChunk.Norms.Size() : aRecord->NbNorms;
+        const int             aNbTexelsTo = isLast ? (int)aChunk.Texels.Size() : aRecord->NbTexels;
+        if (aNbVertsTo != aNbVerts || aNbNormsTo != aNbNorms || aNbTexelsTo != aNbTexels)
+        {
+          isStart = false;
+        }
+        for (; aNbNorms < aNbNormsTo; ++aNbNorms)
+        {
+          myMemEstim += sizeof(NCollection_Vec3<float>);
+          myObjNorms.Append(aChunk.Norms[aNbNorms]);
+        }
+        for (; aNbTexels < aNbTexelsTo; ++aNbTexels)
+        {
+          myMemEstim += sizeof(NCollection_Vec2<float>);
+          myObjVertsUV.Append(aChunk.Texels[aNbTexels]);
+        }
+        for (; aNbVerts < aNbVertsTo; ++aNbVerts)
+        {
+          ++myNbProbeNodes;
+          myMemEstim +=
+            myObjVerts.IsSinglePrecision() ? sizeof(NCollection_Vec3<float>) : sizeof(gp_Pnt);
+          myObjVerts.Append(gp_Pnt(aChunk.Verts[aNbVerts]));
+          if (!checkMemory())
+          {
+            addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+            return false;
+          }
+        }
+        if (isLast)
+        {
+          break;
+        }
+
+        myNbLines = aLineFrom + aRecord->LineNb;
+        if (aRecord->Line == nullptr)
+        {
+          isStart = false;
+          ++myNbProbeElems;
+          pushElement(aChunk.FaceNodes.Data() + aNbNodes, aRecord->NbNodes);
+          aNbNodes += aRecord->NbNodes;
+        }
+        else if (*aRecord->Line == '#')
+        {
+          if (isStart)
+          {
+            pushComment(aRecord->Line + 1);
+          }
+          continue;
+        }
+        else
+        {
+          isStart = false;
+          pushRecord(aRecord->Line);
+        }
+
+        if (!checkMemory())
+        {
+          addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+          return false;
+        }
+      }
+      myNbLines = aLineFrom + aChunk.NbLines;
     }
+
+    // move the incomplete line to the beginning of the block (it is not modified by parser)
+    if (aNbTailBytes != 0)
+    {
+      std::memmove(aBlock.Data(), aLinesEnd, aNbTailBytes);
+    }
+
+    const int aNbMiBRead = int(aPosition / (1024 * 1024));
+    aPS.Next(aNbMiBRead - aNbMiBPassed);
+    aNbMiBPassed = aNbMiBRead;
   }
 
+  finishRead(false);
+  return true;
+}
+
+//=================================================================================================
+
+void RWObj_Reader::finishRead(const bool theToProbe)
+{
   // collect external references
   for (NCollection_DataMap<TCollection_AsciiString, RWObj_Material>::Iterator aMatIter(myMaterials);
        aMatIter.More();
@@ -276,47 +648,25 @@ bool RWObj_Reader::read(std::istream&                  theStream,
                          + " polygon(s) have been split into triangles");
   }
 
-  return true;
 }
 
 //=================================================================================================
 
 void RWObj_Reader::pushIndices(const char* thePos)
 {
-  char* aNext = nullptr;
+  myCurrNodes.Clear();
+  readFaceNodes(thePos, myCurrNodes);
+  pushElement(myCurrNodes.Data(), (int)myCurrNodes.Size());
+}
 
+//=================================================================================================
+
+void RWObj_Reader::pushElement(const NCollection_Vec3<int>* theNodes, const int theNbNodes)
+{
   int aNbElemNodes = 0;
-  for (int aNode = 0;; ++aNode)
+  for (int aNode = 0; aNode < theNbNodes; ++aNode)
   {
-    NCollection_Vec3<int> a3Indices(-1, -1, -1);
-    a3Indices[0] = int(strtol(thePos, &aNext, 10) - 1);
-    if (aNext == thePos)
-    {
-      break;
-    }
-
-    // parse UV index
-    thePos = aNext;
-    if (*thePos == '/')
-    {
-      ++thePos;
-      if (*thePos != '/')
-      {
-        a3Indices[1] = int(strtol(thePos, &aNext, 10) - 1);
-        thePos       = aNext;
-      }
-
-      // parse Normal index
-      if (*thePos == '/')
-      {
-        ++thePos;
-        if (!IsSpace(*thePos))
-        {
-          a3Indices[2] = int(strtol(thePos, &aNext, 10) - 1);
-          thePos       = aNext;
-        }
-      }
-    }
+    NCollection_Vec3<int> a3Indices = theNodes[aNode];
 
     // handle negative indices
     if (a3Indices[0] < -1)
@@ -403,16 +753,6 @@ void RWObj_Reader::pushIndices(const char* thePos)
     }
     myCurrElem[aNode] = anIndex;
     aNbElemNodes      = aNode + 1;
-
-    if (*thePos == '\n' || *thePos == '\0')
-    {
-      break;
-    }
-
-    if (*thePos != ' ')
-    {
-      ++thePos;
-    }
   }
 
   if (myCurrElem[0] < 0 || myCurrElem[1] < 0 || myCurrElem[2] < 0 || aNbElemNodes < 3)
@@ -612,6 +952,49 @@ int RWObj_Reader::triangulatePolygon(const NCollection_Array1<int>& theIndices)
 
 //=================================================================================================
 
+void RWObj_Reader::pushComment(const char* theComment)
+{
+  TCollection_AsciiString aComment(theComment);
+  aComment.LeftAdjust();
+  aComment.RightAdjust();
+  if (!aComment.IsEmpty())
+  {
+    if (!myFileComments.IsEmpty())
+    {
+      myFileComments += "\n";
+    }
+    myFileComments += aComment;
+  }
+}
+
+//=================================================================================================
+
+void RWObj_Reader::pushRecord(const char* theLine)
+{
+  if (theLine[0] == 'g' && IsSpace(theLine[1]))
+  {
+    pushGroup(theLine + 2);
+  }
+  else if (theLine[0] == 's' && IsSpace(theLine[1]))
+  {
+    pushSmoothGroup(theLine + 2);
+  }
+  else if (theLine[0] == 'o' && IsSpace(theLine[1]))
+  {
+    pushObject(theLine + 2);
+  }
+  else if (::strncmp(theLine, "mtllib", 6) == 0)
+  {
+    readMaterialLib(IsSpace(theLine[6]) ? theLine + 7 : "");
+  }
+  else if (::strncmp(theLine, "usemtl", 6) == 0)
+  {
+    pushMaterial(IsSpace(theLine[6]) ? theLine + 7 : "");
+  }
+}
+
+//=================================================================================================
+
 void RWObj_Reader::pushObject(const char* theObjectName)
 {
   TCollection_AsciiString aNewObject;
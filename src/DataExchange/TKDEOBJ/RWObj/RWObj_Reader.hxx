@@ -134,6 +134,17 @@ public:
     myObjVerts.SetSinglePrecision(theIsSinglePrecision);
   }
 
+  //! Return flag to parse file content in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup flag to parse file content in parallel threads.
+  //! The file is read by big blocks split into chunks at line boundaries;
+  //! vertex attributes and element indices of chunks are parsed in parallel,
+  //! while nodes and sub-meshes are created sequentially in the file order,
+  //! so that the result is the same as in single-threaded mode.
+  //! Probing the file is always done within the calling thread.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
   //! Reads data from OBJ file.
   //! Unicode paths can be given in UTF-8 encoding.
@@ -143,6 +154,15 @@ protected:
                             const Message_ProgressRange&   theProgress,
                             const bool                     theToProbe);
 
+  //! Reads mesh data from OBJ file by chunks parsed in parallel threads.
+  //! @param theStream   input stream positioned at the beginning
+  //! @param theFileLen  length of the file in bytes
+  //! @param theProgress progress indicator
+  //! @return FALSE on user break
+  Standard_EXPORT bool readParallel(std::istream&                theStream,
+                                    const int64_t                theFileLen,
+                                    const Message_ProgressRange& theProgress);
+
   //! @name interface methods which should be implemented by sub-class
 protected:
   //! Add new sub-mesh.
@@ -223,6 +243,17 @@ private:
   //! Handle "f indices".
   void pushIndices(const char* thePos);
 
+  //! Add element defined by the list of parsed "f" record nodes.
+  //! @param theNodes   nodes as (vertex, UV, normal) indices starting from 0 or negative (relative)
+  //! @param theNbNodes number of nodes
+  void pushElement(const NCollection_Vec3<int>* theNodes, const int theNbNodes);
+
+  //! Handle comment line (without leading '#') at the beginning of file.
+  void pushComment(const char* theComment);
+
+  //! Handle line which is not a vertex attribute nor element record.
+  void pushRecord(const char* theLine);
+
   //! Compute the center of planar polygon.
   //! @param theIndices polygon indices
   //! @return center of polygon
@@ -259,6 +290,9 @@ private:
   //! Handle "mtllib FileName".
   void readMaterialLib(const char* theFileName);
 
+  //! Collect external references and flush the last sub-mesh.
+  void finishRead(const bool theToProbe);
+
   //! Check memory limits.
   //! @return FALSE on out of memory
   bool checkMemory();
@@ -367,6 +401,7 @@ protected:
   int                   myNbProbeElems;  //!< number of probed elements
   int                   myNbElemsBig;    //!< number of big elements (polygons with 5+ nodes)
   bool                   myToAbort;       //!< flag indicating abort state (e.g. syntax error)
+  bool                   myToParallel;    //!< flag to parse file content in parallel threads
                                                     // clang-format on
 
   // Each node in the Element specifies independent indices of Vertex position, Texture coordinates
@@ -384,6 +419,8 @@ protected:
 
   RWObj_SubMesh                 myActiveSubMesh; //!< active sub-mesh definition
   NCollection_LinearVector<int> myCurrElem;      //!< indices for the current element
+  NCollection_LinearVector<NCollection_Vec3<int>>
+    myCurrNodes; //!< parsed nodes of the current "f" record
 };
 
 #endif // _RWObj_Reader_HeaderFile
@@ -184,7 +184,7 @@ occ::handle<DE_Provider> DEPLY_ConfigurationNode::BuildProvider()
 
 bool DEPLY_ConfigurationNode::IsImportSupported() const
 {
-  return false;
+  return true;
 }
 
 //=================================================================================================
@@ -28,7 +28,7 @@ class DE_ConfigurationContext;
 //! The Vendor name is "OCC"
 //! The Format type is "PLY"
 //! The supported CAD extension is ".ply"
-//! The import process isn't supported.
+//! The import process is supported.
 //! The export process is supported.
 class DEPLY_ConfigurationNode : public DE_ConfigurationNode
 {
@@ -19,8 +19,10 @@
 #include <DE_Wrapper.hxx>
 #include <Message.hxx>
 #include <RWMesh_FaceIterator.hxx>
+#include <RWPly_CafReader.hxx>
 #include <RWPly_CafWriter.hxx>
 #include <RWPly_PlyWriterContext.hxx>
+#include <RWPly_TriangulationReader.hxx>
 #include <TDocStd_Document.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -41,6 +43,17 @@ DEPLY_Provider::DEPLY_Provider(const occ::handle<DE_ConfigurationNode>& theNode)
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&       thePath,
+                          const occ::handle<TDocStd_Document>& theDocument,
+                          occ::handle<XSControl_WorkSession>&  theWS,
+                          const Message_ProgressRange&         theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theDocument, theProgress);
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
                            const occ::handle<TDocStd_Document>& theDocument,
                            occ::handle<XSControl_WorkSession>&  theWS,
@@ -52,6 +65,41 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&       thePath,
+                          const occ::handle<TDocStd_Document>& theDocument,
+                          const Message_ProgressRange&         theProgress)
+{
+  TCollection_AsciiString aContext = TCollection_AsciiString("reading the file ") + thePath;
+  if (!DE_ValidationUtils::ValidateDocument(theDocument, aContext))
+  {
+    return false;
+  }
+  if (!DE_ValidationUtils::ValidateConfigurationNode(GetNode(),
+                                                     STANDARD_TYPE(DEPLY_ConfigurationNode),
+                                                     aContext))
+  {
+    return false;
+  }
+  occ::handle<DEPLY_ConfigurationNode> aNode = occ::down_cast<DEPLY_ConfigurationNode>(GetNode());
+  RWPly_CafReader                      aReader;
+  aReader.SetSystemLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
+  aReader.SetSystemCoordinateSystem(aNode->InternalParameters.SystemCS);
+  aReader.SetFileLengthUnit(aNode->InternalParameters.FileLengthUnit);
+  aReader.SetFileCoordinateSystem(aNode->InternalParameters.FileCS);
+  aReader.SetDocument(theDocument);
+  if (!aReader.Perform(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  XCAFDoc_DocumentTool::SetLengthUnit(theDocument,
+                                      aNode->GlobalParameters.LengthUnit,
+                                      UnitsMethods_LengthUnit_Millimeter);
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
                            const occ::handle<TDocStd_Document>& theDocument,
                            const Message_ProgressRange&         theProgress)
@@ -117,6 +165,17 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&      thePath,
+                          TopoDS_Shape&                       theShape,
+                          occ::handle<XSControl_WorkSession>& theWS,
+                          const Message_ProgressRange&        theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theShape, theProgress);
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&      thePath,
                            const TopoDS_Shape&                 theShape,
                            occ::handle<XSControl_WorkSession>& theWS,
@@ -128,6 +187,40 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&      thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString& thePath,
+                          TopoDS_Shape&                  theShape,
+                          const Message_ProgressRange&   theProgress)
+{
+  TCollection_AsciiString aContext = TCollection_AsciiString("reading the file ") + thePath;
+  if (!DE_ValidationUtils::ValidateConfigurationNode(GetNode(),
+                                                     STANDARD_TYPE(DEPLY_ConfigurationNode),
+                                                     aContext))
+  {
+    return false;
+  }
+  occ::handle<DEPLY_ConfigurationNode> aNode = occ::down_cast<DEPLY_ConfigurationNode>(GetNode());
+  RWMesh_CoordinateSystemConverter     aConverter;
+  aConverter.SetOutputLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
+  aConverter.SetOutputCoordinateSystem(aNode->InternalParameters.SystemCS);
+  aConverter.SetInputLengthUnit(aNode->InternalParameters.FileLengthUnit);
+  aConverter.SetInputCoordinateSystem(aNode->InternalParameters.FileCS);
+
+  RWPly_TriangulationReader aReader;
+  aReader.SetTransformation(aConverter);
+  if (!aReader.Read(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  TopoDS_Face  aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace(aFace, aReader.Triangulation());
+  theShape = aFace;
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString& thePath,
                            const TopoDS_Shape&            theShape,
                            const Message_ProgressRange&   theProgress)
@@ -17,13 +17,13 @@
 #include <DE_Provider.hxx>
 
 //! The class to transfer PLY files.
-//! Writes any PLY files from OCCT.
+//! Reads and Writes any PLY files into/from OCCT.
 //! Each operation needs configuration node.
 //!
 //! Providers grouped by Vendor name and Format type.
 //! The Vendor name is "OCC"
 //! The Format type is "PLY"
-//! The import process isn't supported.
+//! The import process is supported.
 //! The export process is supported.
 class DEPLY_Provider : public DE_Provider
 {
@@ -40,6 +40,18 @@ public:
   Standard_EXPORT DEPLY_Provider(const occ::handle<DE_ConfigurationNode>& theNode);
 
 public:
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theDocument document to save result
+  //! @param[in] theWS current work session
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT bool Read(
+    const TCollection_AsciiString&       thePath,
+    const occ::handle<TDocStd_Document>& theDocument,
+    occ::handle<XSControl_WorkSession>&  theWS,
+    const Message_ProgressRange&         theProgress = Message_ProgressRange()) override;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theDocument document to export
@@ -52,6 +64,16 @@ public:
     occ::handle<XSControl_WorkSession>&  theWS,
     const Message_ProgressRange&         theProgress = Message_ProgressRange()) override;
 
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theDocument document to save result
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT bool Read(
+    const TCollection_AsciiString&       thePath,
+    const occ::handle<TDocStd_Document>& theDocument,
+    const Message_ProgressRange&         theProgress = Message_ProgressRange()) override;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theDocument document to export
@@ -62,6 +84,18 @@ public:
     const occ::handle<TDocStd_Document>& theDocument,
     const Message_ProgressRange&         theProgress = Message_ProgressRange()) override;
 
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theShape shape to save result
+  //! @param[in] theWS current work session
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT bool Read(
+    const TCollection_AsciiString&      thePath,
+    TopoDS_Shape&                       theShape,
+    occ::handle<XSControl_WorkSession>& theWS,
+    const Message_ProgressRange&        theProgress = Message_ProgressRange()) override;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theShape shape to export
@@ -74,6 +108,16 @@ public:
     occ::handle<XSControl_WorkSession>& theWS,
     const Message_ProgressRange&        theProgress = Message_ProgressRange()) override;
 
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theShape shape to save result
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT bool Read(
+    const TCollection_AsciiString& thePath,
+    TopoDS_Shape&                  theShape,
+    const Message_ProgressRange&   theProgress = Message_ProgressRange()) override;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theShape shape to export
@@ -2,4 +2,6 @@
 set(OCCT_TKDEPLY_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDEPLY_GTests_FILES
+  RWPly_CafReader_Test.cxx
+  RWPly_TriangulationReader_Test.cxx
 )
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_CafReader.hxx>
+
+#include <Quantity_Color.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Triangle with the same color of all vertices.
+static const char THE_COLORED_PLY[] = "ply\n"
+                                      "format ascii 1.0\n"
+                                      "element vertex 3\n"
+                                      "property float x\n"
+                                      "property float y\n"
+                                      "property float z\n"
+                                      "property uchar red\n"
+                                      "property uchar green\n"
+                                      "property uchar blue\n"
+                                      "element face 1\n"
+                                      "property list uchar int vertex_indices\n"
+                                      "end_header\n"
+                                      "0 0 0 255 0 0\n"
+                                      "1 0 0 255 0 0\n"
+                                      "1 1 0 255 0 0\n"
+                                      "3 0 1 2\n";
+} // namespace
+
+TEST(RWPly_CafReaderTest, NodeColors)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("BinXCAF", aDoc);
+
+  RWPly_CafReader aReader;
+  aReader.SetDocument(aDoc);
+  std::istringstream aStream(THE_COLORED_PLY);
+  ASSERT_TRUE(aReader.Perform(aStream, Message_ProgressRange(), "colored.ply"));
+  ASSERT_EQ(aReader.NodeColors().Length(), 3);
+  EXPECT_EQ(aReader.NodeColors().Value(1).r(), 255);
+
+  // per-node colors are not stored in the document, the face gets color shared by all nodes
+  NCollection_Sequence<TDF_Label> aFreeShapes;
+  XCAFDoc_DocumentTool::ShapeTool(aDoc->Main())->GetFreeShapes(aFreeShapes);
+  ASSERT_EQ(aFreeShapes.Length(), 1);
+  Quantity_Color aColor;
+  ASSERT_TRUE(XCAFDoc_DocumentTool::ColorTool(aDoc->Main())
+                ->GetColor(aFreeShapes.First(), XCAFDoc_ColorSurf, aColor));
+  EXPECT_TRUE(aColor.IsEqual(Quantity_Color(Quantity_NOC_RED)));
+}
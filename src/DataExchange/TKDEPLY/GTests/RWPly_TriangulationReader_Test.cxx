@@ -0,0 +1,240 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_TriangulationReader.hxx>
+
+#include <cstring>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Square split into quad and triangle with colored vertices.
+static const char THE_ASCII_PLY[] = "ply\n"
+                                    "format ascii 1.0\n"
+                                    "comment test file\n"
+                                    "element vertex 5\n"
+                                    "property float x\n"
+                                    "property float y\n"
+                                    "property float z\n"
+                                    "property uchar red\n"
+                                    "property uchar green\n"
+                                    "property uchar blue\n"
+                                    "element face 2\n"
+                                    "property list uchar int vertex_indices\n"
+                                    "property uint SurfaceID\n"
+                                    "end_header\n"
+                                    "0 0 0 255 0 0\n"
+                                    "1 0 0 0 255 0\n"
+                                    "1 1 0 0 0 255\n"
+                                    "0 1 0 10 20 30\n"
+                                    "0.5 2 0 0 0 0\n"
+                                    "4 0 1 2 3 7\n"
+                                    "3 3 2 4 8\n";
+
+//! Appends binary value to the buffer with the given byte order.
+template <typename T>
+void appendValue(std::string& theBuffer, const T theValue, const bool theIsBigEndian)
+{
+  char aBytes[sizeof(T)];
+  std::memcpy(aBytes, &theValue, sizeof(T));
+  const uint16_t aTest           = 1;
+  const bool     isBigEndianHost = *(const uint8_t*)&aTest == 0;
+  if (theIsBigEndian != isBigEndianHost)
+  {
+    for (size_t aByteIter = 0; aByteIter < sizeof(T) / 2; ++aByteIter)
+    {
+      std::swap(aBytes[aByteIter], aBytes[sizeof(T) - 1 - aByteIter]);
+    }
+  }
+  theBuffer.append(aBytes, sizeof(T));
+}
+
+//! Returns binary PLY file with the same content as THE_ASCII_PLY.
+std::string binaryPly(const bool theIsBigEndian)
+{
+  std::string aBuffer = "ply\n";
+  aBuffer += theIsBigEndian ? "format binary_big_endian 1.0\n"
+                            : "format binary_little_endian 1.0\n";
+  aBuffer += "element vertex 5\n"
+             "property float x\n"
+             "property float y\n"
+             "property float z\n"
+             "property uchar red\n"
+             "property uchar green\n"
+             "property uchar blue\n"
+             "element face 2\n"
+             "property list uchar int vertex_indices\n"
+             "property uint SurfaceID\n"
+             "end_header\n";
+  const float   aNodes[5][3]  = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0.5f, 2, 0}};
+  const uint8_t aColors[5][3] = {{255, 0, 0}, {0, 255, 0}, {0, 0, 255}, {10, 20, 30}, {0, 0, 0}};
+  for (int aNodeIter = 0; aNodeIter < 5; ++aNodeIter)
+  {
+    for (int aCompIter = 0; aCompIter < 3; ++aCompIter)
+    {
+      appendValue(aBuffer, aNodes[aNodeIter][aCompIter], theIsBigEndian);
+    }
+    for (int aCompIter = 0; aCompIter < 3; ++aCompIter)
+    {
+      appendValue(aBuffer, aColors[aNodeIter][aCompIter], theIsBigEndian);
+    }
+  }
+  appendValue(aBuffer, uint8_t(4), theIsBigEndian);
+  for (int32_t anIndex : {0, 1, 2, 3})
+  {
+    appendValue(aBuffer, anIndex, theIsBigEndian);
+  }
+  appendValue(aBuffer, uint32_t(7), theIsBigEndian);
+  appendValue(aBuffer, uint8_t(3), theIsBigEndian);
+  for (int32_t anIndex : {3, 2, 4})
+  {
+    appendValue(aBuffer, anIndex, theIsBigEndian);
+  }
+  appendValue(aBuffer, uint32_t(8), theIsBigEndian);
+  return aBuffer;
+}
+
+//! Checks the triangulation read from THE_ASCII_PLY or its binary equivalent.
+void checkSquare(const RWPly_TriangulationReader& theReader)
+{
+  const occ::handle<Poly_Triangulation>& aTris = theReader.Triangulation();
+  ASSERT_FALSE(aTris.IsNull());
+  EXPECT_EQ(aTris->NbNodes(), 5);
+  EXPECT_EQ(aTris->NbTriangles(), 3);
+  EXPECT_NEAR(aTris->Node(5).X(), 0.5, 1.0e-7);
+  EXPECT_NEAR(aTris->Node(5).Y(), 2.0, 1.0e-7);
+
+  int aN1 = 0, aN2 = 0, aN3 = 0;
+  aTris->Triangle(1).Get(aN1, aN2, aN3);
+  EXPECT_EQ(aN1, 1);
+  EXPECT_EQ(aN2, 2);
+  EXPECT_EQ(aN3, 3);
+  aTris->Triangle(2).Get(aN1, aN2, aN3);
+  EXPECT_EQ(aN1, 1);
+  EXPECT_EQ(aN2, 3);
+  EXPECT_EQ(aN3, 4);
+  aTris->Triangle(3).Get(aN1, aN2, aN3);
+  EXPECT_EQ(aN1, 4);
+  EXPECT_EQ(aN2, 3);
+  EXPECT_EQ(aN3, 5);
+
+  ASSERT_TRUE(theReader.HasNodeColors());
+  EXPECT_EQ(theReader.NodeColors().Value(1), NCollection_Vec4<uint8_t>(255, 0, 0, 255));
+  EXPECT_EQ(theReader.NodeColors().Value(4), NCollection_Vec4<uint8_t>(10, 20, 30, 255));
+}
+} // namespace
+
+TEST(RWPly_TriangulationReaderTest, ReadAscii)
+{
+  std::istringstream        aStream(THE_ASCII_PLY);
+  RWPly_TriangulationReader aReader;
+  ASSERT_TRUE(aReader.Read(aStream, "ascii.ply"));
+  checkSquare(aReader);
+  EXPECT_EQ(aReader.NbFileFaces(), 2);
+  EXPECT_TRUE(aReader.FileComments() == "test file");
+}
+
+TEST(RWPly_TriangulationReaderTest, ReadBinary)
+{
+  for (const bool isBigEndian : {false, true})
+  {
+    std::istringstream        aStream(binaryPly(isBigEndian));
+    RWPly_TriangulationReader aReader;
+    ASSERT_TRUE(aReader.Read(aStream, "binary.ply")) << "Big endian: " << isBigEndian;
+    checkSquare(aReader);
+  }
+}
+
+TEST(RWPly_TriangulationReaderTest, Probe)
+{
+  std::istringstream        aStream(THE_ASCII_PLY);
+  RWPly_TriangulationReader aReader;
+  ASSERT_TRUE(aReader.Probe(aStream, "ascii.ply"));
+  EXPECT_TRUE(aReader.Triangulation().IsNull());
+  EXPECT_EQ(aReader.NbFileVertices(), 5);
+  EXPECT_EQ(aReader.NbFileFaces(), 2);
+}
+
+TEST(RWPly_TriangulationReaderTest, InvalidData)
+{
+  // truncated binary data
+  const std::string         aBinary = binaryPly(false);
+  std::istringstream        aTruncated(aBinary.substr(0, aBinary.size() - 6));
+  RWPly_TriangulationReader aReader;
+  EXPECT_FALSE(aReader.Read(aTruncated, "truncated.ply"));
+
+  // out of range vertex index
+  std::string anAscii(THE_ASCII_PLY);
+  anAscii.replace(anAscii.find("3 3 2 4 8"), 9, "3 3 2 9 8");
+  std::istringstream anInvalid(anAscii);
+  EXPECT_FALSE(aReader.Read(anInvalid, "invalid.ply"));
+  EXPECT_TRUE(aReader.Triangulation().IsNull());
+
+  std::istringstream aNotPly("solid\nendsolid\n");
+  EXPECT_FALSE(aReader.Read(aNotPly, "not.ply"));
+
+  // records without properties would take no data
+  std::istringstream anEmptyRecords("ply\nformat binary_little_endian 1.0\n"
+                                    "element empty 9000000000000000000\n"
+                                    "element vertex 0\nproperty float x\nend_header\n");
+  EXPECT_FALSE(aReader.Read(anEmptyRecords, "empty.ply"));
+
+  // number of records exceeding data size
+  std::string aHuge(THE_ASCII_PLY);
+  aHuge.replace(aHuge.find("end_header"),
+                10,
+                "element other 9000000000000000000\nproperty list uchar int values\nend_header");
+  std::istringstream aHugeStream(aHuge);
+  EXPECT_FALSE(aReader.Read(aHugeStream, "huge.ply"));
+}
+
+TEST(RWPly_TriangulationReaderTest, ParallelPointCloud)
+{
+  // point cloud large enough to be split into several chunks
+  const int   aNbPoints = 200000;
+  std::string aBuffer   = "ply\nformat binary_little_endian 1.0\n";
+  aBuffer += "element vertex " + std::to_string(aNbPoints) + "\n";
+  aBuffer += "property double x\nproperty double y\nproperty double z\n"
+             "property float nx\nproperty float ny\nproperty float nz\nend_header\n";
+  for (int aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+  {
+    appendValue(aBuffer, double(aPntIter), false);
+    appendValue(aBuffer, double(aPntIter % 7), false);
+    appendValue(aBuffer, -double(aPntIter), false);
+    appendValue(aBuffer, 0.0f, false);
+    appendValue(aBuffer, 0.0f, false);
+    appendValue(aBuffer, 1.0f, false);
+  }
+
+  RWPly_TriangulationReader aSeqReader, aParReader;
+  aSeqReader.SetParallel(false);
+  aParReader.SetParallel(true);
+  std::istringstream aSeqStream(aBuffer), aParStream(aBuffer);
+  ASSERT_TRUE(aSeqReader.Read(aSeqStream, "seq.ply"));
+  ASSERT_TRUE(aParReader.Read(aParStream, "par.ply"));
+
+  const occ::handle<Poly_Triangulation>& aSeq = aSeqReader.Triangulation();
+  const occ::handle<Poly_Triangulation>& aPar = aParReader.Triangulation();
+  ASSERT_EQ(aSeq->NbNodes(), aNbPoints);
+  ASSERT_EQ(aPar->NbNodes(), aNbPoints);
+  EXPECT_EQ(aPar->NbTriangles(), 0);
+  EXPECT_TRUE(aPar->HasNormals());
+  EXPECT_FALSE(aParReader.HasNodeColors());
+  for (int aPntIter = 1; aPntIter <= aNbPoints; aPntIter += 997)
+  {
+    EXPECT_TRUE(aSeq->Node(aPntIter).IsEqual(aPar->Node(aPntIter), 0.0));
+    EXPECT_EQ(aPar->Node(aPntIter).X(), double(aPntIter - 1));
+  }
+}
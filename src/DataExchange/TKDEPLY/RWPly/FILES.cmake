@@ -2,10 +2,15 @@
 set(OCCT_RWPly_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_RWPly_FILES
+  RWPly_CafReader.cxx
+  RWPly_CafReader.hxx
   RWPly_CafWriter.cxx
   RWPly_CafWriter.hxx
 
   RWPly_PlyWriterContext.cxx
   RWPly_PlyWriterContext.hxx
 
+  RWPly_TriangulationReader.cxx
+  RWPly_TriangulationReader.hxx
+
 )
@@ -0,0 +1,84 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_CafReader.hxx>
+
+#include <BRep_Builder.hxx>
+#include <Quantity_ColorRGBA.hxx>
+#include <RWPly_TriangulationReader.hxx>
+#include <TopoDS_Face.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+
+//! Returns the color shared by all nodes, or the average color of nodes.
+static Quantity_ColorRGBA averageNodeColor(
+  const NCollection_Array1<NCollection_Vec4<uint8_t>>& theColors)
+{
+  NCollection_Vec4<double> aSum;
+  for (const NCollection_Vec4<uint8_t>& aColor : theColors)
+  {
+    aSum += NCollection_Vec4<double>(aColor.r(), aColor.g(), aColor.b(), aColor.a());
+  }
+  aSum /= 255.0 * double(theColors.Length());
+  return Quantity_ColorRGBA(Quantity_Color(aSum.r(), aSum.g(), aSum.b(), Quantity_TOC_sRGB),
+                            float(aSum.a()));
+}
+
+//=================================================================================================
+
+RWPly_CafReader::RWPly_CafReader()
+    : myIsSinglePrecision(false),
+      myToParallel(true)
+{
+  // PLY format does not define coordinate system, however most files are stored Y-up
+  myCoordSysConverter.SetInputCoordinateSystem(RWMesh_CoordinateSystem_glTF);
+}
+
+//=================================================================================================
+
+bool RWPly_CafReader::performMesh(std::istream&                  theStream,
+                                  const TCollection_AsciiString& theFile,
+                                  const Message_ProgressRange&   theProgress,
+                                  const bool                     theToProbe)
+{
+  myNodeColors = NCollection_Array1<NCollection_Vec4<uint8_t>>();
+
+  RWPly_TriangulationReader aReader;
+  aReader.SetTransformation(myCoordSysConverter);
+  aReader.SetSinglePrecision(myIsSinglePrecision);
+  aReader.SetParallel(myToParallel);
+  const bool isDone = theToProbe ? aReader.Probe(theStream, theFile)
+                                 : aReader.Read(theStream, theFile, theProgress);
+  if (!aReader.FileComments().IsEmpty())
+  {
+    myMetadata.Add("Comments", aReader.FileComments());
+  }
+  if (!isDone || theToProbe)
+  {
+    return isDone;
+  }
+
+  TopoDS_Face  aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace(aFace, aReader.Triangulation());
+  if (aReader.HasNodeColors())
+  {
+    myNodeColors = aReader.NodeColors();
+
+    RWMesh_NodeAttributes aShapeAttribs;
+    aShapeAttribs.Style.SetColorSurf(averageNodeColor(myNodeColors));
+    myAttribMap.Bind(aFace, aShapeAttribs);
+  }
+  myRootShapes.Append(aFace);
+  return true;
+}
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_CafReader_HeaderFile
+#define _RWPly_CafReader_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vec4.hxx>
+#include <RWMesh_CafReader.hxx>
+
+//! The PLY mesh reader into XDE document.
+//! The mesh is put into the document as a single face holding Poly_Triangulation
+//! (without triangles for a point cloud); see RWPly_TriangulationReader for supported data.
+//! Neither Poly_Triangulation nor XDE document define per-node colors,
+//! so that node colors defined by the file are assigned to the face as its surface color
+//! (the color shared by all nodes or their average), and original values are kept by NodeColors().
+class RWPly_CafReader : public RWMesh_CafReader
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+public:
+  //! Empty constructor.
+  Standard_EXPORT RWPly_CafReader();
+
+  //! Return single precision flag for reading vertex data (coordinates); FALSE by default.
+  bool IsSinglePrecision() const { return myIsSinglePrecision; }
+
+  //! Setup single/double precision flag for reading vertex data (coordinates).
+  void SetSinglePrecision(bool theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
+
+  //! Return TRUE if multithreaded decoding is allowed; TRUE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded decoding.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
+  //! Return RGBA node colors of the last read mesh within [1, NbNodes()] range;
+  //! empty if file has no colors.
+  const NCollection_Array1<NCollection_Vec4<uint8_t>>& NodeColors() const { return myNodeColors; }
+
+protected:
+  //! Read the mesh from specified file.
+  Standard_EXPORT bool performMesh(std::istream&                  theStream,
+                                   const TCollection_AsciiString& theFile,
+                                   const Message_ProgressRange&   theProgress,
+                                   const bool                     theToProbe) override;
+
+protected:
+  NCollection_Array1<NCollection_Vec4<uint8_t>> myNodeColors; //!< node colors of the last read mesh
+  // clang-format off
+  bool myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  bool myToParallel;        //!< flag to decode data in parallel threads
+  // clang-format on
+};
+
+#endif // _RWPly_CafReader_HeaderFile
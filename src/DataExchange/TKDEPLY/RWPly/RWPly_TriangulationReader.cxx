@@ -0,0 +1,1077 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_TriangulationReader.hxx>
+
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_LinearVector.hxx>
+#include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_CString.hxx>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace
+{
+//! Number of records decoded by a single task.
+static const int THE_CHUNK_NB_RECORDS = 65536;
+
+//! Scalar type of PLY property.
+enum PlyType
+{
+  PlyType_UNDEFINED = 0,
+  PlyType_Int8,
+  PlyType_UInt8,
+  PlyType_Int16,
+  PlyType_UInt16,
+  PlyType_Int32,
+  PlyType_UInt32,
+  PlyType_Float32,
+  PlyType_Float64
+};
+
+//! Vertex or face attribute defined by PLY property.
+enum PlyAttrib
+{
+  PlyAttrib_NONE = -1,
+  PlyAttrib_X,
+  PlyAttrib_Y,
+  PlyAttrib_Z,
+  PlyAttrib_NX,
+  PlyAttrib_NY,
+  PlyAttrib_NZ,
+  PlyAttrib_U,
+  PlyAttrib_V,
+  PlyAttrib_Red,
+  PlyAttrib_Green,
+  PlyAttrib_Blue,
+  PlyAttrib_Alpha,
+  PlyAttrib_Indices,
+  PlyAttrib_NB
+};
+
+//! Returns the size of binary value.
+static int plyTypeSize(const PlyType theType)
+{
+  switch (theType)
+  {
+    case PlyType_Int8:
+    case PlyType_UInt8:
+      return 1;
+    case PlyType_Int16:
+    case PlyType_UInt16:
+      return 2;
+    case PlyType_Int32:
+    case PlyType_UInt32:
+    case PlyType_Float32:
+      return 4;
+    case PlyType_Float64:
+      return 8;
+    case PlyType_UNDEFINED:
+      break;
+  }
+  return 0;
+}
+
+//! Parses the type name.
+static PlyType plyTypeFromString(const TCollection_AsciiString& theName)
+{
+  if (theName == "char" || theName == "int8")
+  {
+    return PlyType_Int8;
+  }
+  else if (theName == "uchar" || theName == "uint8")
+  {
+    return PlyType_UInt8;
+  }
+  else if (theName == "short" || theName == "int16")
+  {
+    return PlyType_Int16;
+  }
+  else if (theName == "ushort" || theName == "uint16")
+  {
+    return PlyType_UInt16;
+  }
+  else if (theName == "int" || theName == "int32")
+  {
+    return PlyType_Int32;
+  }
+  else if (theName == "uint" || theName == "uint32")
+  {
+    return PlyType_UInt32;
+  }
+  else if (theName == "float" || theName == "float32")
+  {
+    return PlyType_Float32;
+  }
+  else if (theName == "double" || theName == "float64")
+  {
+    return PlyType_Float64;
+  }
+  return PlyType_UNDEFINED;
+}
+
+//! Returns the vertex attribute defined by property name.
+static PlyAttrib plyVertexAttrib(const TCollection_AsciiString& theName)
+{
+  if (theName == "x")
+  {
+    return PlyAttrib_X;
+  }
+  else if (theName == "y")
+  {
+    return PlyAttrib_Y;
+  }
+  else if (theName == "z")
+  {
+    return PlyAttrib_Z;
+  }
+  else if (theName == "nx")
+  {
+    return PlyAttrib_NX;
+  }
+  else if (theName == "ny")
+  {
+    return PlyAttrib_NY;
+  }
+  else if (theName == "nz")
+  {
+    return PlyAttrib_NZ;
+  }
+  else if (theName == "s" || theName == "u" || theName == "texture_u")
+  {
+    return PlyAttrib_U;
+  }
+  else if (theName == "t" || theName == "v" || theName == "texture_v")
+  {
+    return PlyAttrib_V;
+  }
+  else if (theName == "red" || theName == "diffuse_red")
+  {
+    return PlyAttrib_Red;
+  }
+  else if (theName == "green" || theName == "diffuse_green")
+  {
+    return PlyAttrib_Green;
+  }
+  else if (theName == "blue" || theName == "diffuse_blue")
+  {
+    return PlyAttrib_Blue;
+  }
+  else if (theName == "alpha")
+  {
+    return PlyAttrib_Alpha;
+  }
+  return PlyAttrib_NONE;
+}
+
+//! Property of PLY element.
+struct PlyProperty
+{
+  PlyType   Type      = PlyType_UNDEFINED; //!< value type (item type for list)
+  PlyType   CountType = PlyType_UNDEFINED; //!< type of list size, undefined for scalar property
+  PlyAttrib Attrib    = PlyAttrib_NONE;    //!< attribute defined by the property
+
+  bool IsList() const { return CountType != PlyType_UNDEFINED; }
+};
+
+//! Element declared by PLY header.
+struct PlyElement
+{
+  TCollection_AsciiString               Name;
+  int64_t                               Count  = 0;
+  int                                   Stride = 0; //!< binary record size, -1 if it has lists
+  NCollection_LinearVector<PlyProperty> Properties;
+};
+
+//! Range of element records decoded by a single task.
+struct PlyChunk
+{
+  const char* Data          = nullptr; //!< first record of the chunk
+  int         FirstRecord   = 0;       //!< index of the first record
+  int         NbRecords     = 0;       //!< number of records
+  int         FirstTriangle = 0;       //!< index of the first triangle generated by the chunk
+  bool        HasErrors     = false;   //!< invalid data within the chunk
+};
+
+//! Returns TRUE if the character separates ASCII values.
+inline bool isAsciiSpace(const char theChar)
+{
+  return theChar == ' ' || theChar == '\t' || theChar == '\r' || theChar == '\n';
+}
+
+//! Moves the pointer after the next ASCII value; returns NULL if there is no more values.
+inline const char* skipAsciiValue(const char* thePtr)
+{
+  while (isAsciiSpace(*thePtr))
+  {
+    ++thePtr;
+  }
+  if (*thePtr == '\0')
+  {
+    return nullptr;
+  }
+  while (*thePtr != '\0' && !isAsciiSpace(*thePtr))
+  {
+    ++thePtr;
+  }
+  return thePtr;
+}
+
+//! Reads binary value with optional byte order swapping.
+template <typename T>
+inline T readBinary(const char* thePtr, const bool theToSwap)
+{
+  T aValue;
+  if (theToSwap)
+  {
+    char aBytes[sizeof(T)];
+    for (size_t aByteIter = 0; aByteIter < sizeof(T); ++aByteIter)
+    {
+      aBytes[aByteIter] = thePtr[sizeof(T) - 1 - aByteIter];
+    }
+    std::memcpy(&aValue, aBytes, sizeof(T));
+  }
+  else
+  {
+    std::memcpy(&aValue, thePtr, sizeof(T));
+  }
+  return aValue;
+}
+
+//! Reader of property values from the data section.
+class PlyValueReader
+{
+public:
+  PlyValueReader(const bool theIsAscii, const bool theToSwap)
+      : myIsAscii(theIsAscii),
+        myToSwap(theToSwap)
+  {
+  }
+
+  //! Returns TRUE for ASCII data.
+  bool IsAscii() const { return myIsAscii; }
+
+  //! Reads the value and moves the pointer to the next one.
+  //! The data should be checked by Skip() beforehand.
+  double ReadReal(const char*& thePtr, const PlyType theType) const
+  {
+    if (myIsAscii)
+    {
+      const char* aValue = thePtr;
+      thePtr             = skipAsciiValue(thePtr);
+      return Strtod(aValue, nullptr);
+    }
+
+    const char* aValue = thePtr;
+    thePtr += plyTypeSize(theType);
+    switch (theType)
+    {
+      case PlyType_Int8:
+        return double(readBinary<int8_t>(aValue, false));
+      case PlyType_UInt8:
+        return double(readBinary<uint8_t>(aValue, false));
+      case PlyType_Int16:
+        return double(readBinary<int16_t>(aValue, myToSwap));
+      case PlyType_UInt16:
+        return double(readBinary<uint16_t>(aValue, myToSwap));
+      case PlyType_Int32:
+        return double(readBinary<int32_t>(aValue, myToSwap));
+      case PlyType_UInt32:
+        return double(readBinary<uint32_t>(aValue, myToSwap));
+      case PlyType_Float32:
+        return double(readBinary<float>(aValue, myToSwap));
+      case PlyType_Float64:
+        return readBinary<double>(aValue, myToSwap);
+      case PlyType_UNDEFINED:
+        break;
+    }
+    return 0.0;
+  }
+
+  //! Reads the integer value and moves the pointer to the next one.
+  //! The data should be checked by Skip() beforehand.
+  int64_t ReadInteger(const char*& thePtr, const PlyType theType) const
+  {
+    if (myIsAscii)
+    {
+      const char* aValue = thePtr;
+      thePtr             = skipAsciiValue(thePtr);
+      return int64_t(strtoll(aValue, nullptr, 10));
+    }
+
+    const char* aValue = thePtr;
+    thePtr += plyTypeSize(theType);
+    switch (theType)
+    {
+      case PlyType_Int8:
+        return readBinary<int8_t>(aValue, false);
+      case PlyType_UInt8:
+        return readBinary<uint8_t>(aValue, false);
+      case PlyType_Int16:
+        return readBinary<int16_t>(aValue, myToSwap);
+      case PlyType_UInt16:
+        return readBinary<uint16_t>(aValue, myToSwap);
+      case PlyType_Int32:
+        return readBinary<int32_t>(aValue, myToSwap);
+      case PlyType_UInt32:
+        return readBinary<uint32_t>(aValue, myToSwap);
+      case PlyType_Float32:
+        return int64_t(readBinary<float>(aValue, myToSwap));
+      case PlyType_Float64:
+        return int64_t(readBinary<double>(aValue, myToSwap));
+      case PlyType_UNDEFINED:
+        break;
+    }
+    return 0;
+  }
+
+  //! Checks that the data contains the next value and moves the pointer after it.
+  bool Skip(const char*& thePtr, const char* theEnd, const PlyType theType) const
+  {
+    if (myIsAscii)
+    {
+      thePtr = skipAsciiValue(thePtr);
+      return thePtr != nullptr;
+    }
+    if (theEnd - thePtr < plyTypeSize(theType))
+    {
+      return false;
+    }
+    thePtr += plyTypeSize(theType);
+    return true;
+  }
+
+private:
+  bool myIsAscii;
+  bool myToSwap;
+};
+
+//! Walks through element records to find their end, split them into chunks
+//! and count triangles defined by polygon lists.
+//! @param[in] theElement  element to scan
+//! @param[in] theReader   values reader
+//! @param[in,out] thePtr  start of element records, moved to the end of element
+//! @param[in] theEnd      end of data
+//! @param[out] theChunks  chunks of element records
+//! @param[out] theNbTriangles  number of triangles defined by the element
+//! @return FALSE if data is truncated
+static bool scanElement(const PlyElement&                   theElement,
+                        const PlyValueReader&               theReader,
+                        const char*&                        thePtr,
+                        const char*                         theEnd,
+                        NCollection_LinearVector<PlyChunk>& theChunks,
+                        int64_t&                            theNbTriangles)
+{
+  theNbTriangles = 0;
+  if (theElement.Count == 0)
+  {
+    return true;
+  }
+  // each record takes at least one byte, so that the number of records is limited by data size;
+  // element without properties would define any number of empty records
+  if (theElement.Properties.IsEmpty() || theElement.Count > theEnd - thePtr)
+  {
+    return false;
+  }
+
+  if (!theReader.IsAscii() && theElement.Stride > 0)
+  {
+    // records of fixed size can be split into chunks without reading them
+    if (theElement.Count > (theEnd - thePtr) / theElement.Stride)
+    {
+      return false;
+    }
+    for (int64_t aRecIter = 0; aRecIter < theElement.Count; aRecIter += THE_CHUNK_NB_RECORDS)
+    {
+      PlyChunk& aChunk   = theChunks.Appended();
+      aChunk.Data        = thePtr + aRecIter * theElement.Stride;
+      aChunk.FirstRecord = int(aRecIter);
+      aChunk.NbRecords =
+        int(std::min<int64_t>(THE_CHUNK_NB_RECORDS, theElement.Count - aRecIter));
+    }
+    thePtr += theElement.Count * theElement.Stride;
+    return true;
+  }
+
+  for (int64_t aRecIter = 0; aRecIter < theElement.Count; ++aRecIter)
+  {
+    if (aRecIter % THE_CHUNK_NB_RECORDS == 0)
+    {
+      PlyChunk& aChunk     = theChunks.Appended();
+      aChunk.Data          = thePtr;
+      aChunk.FirstRecord   = int(aRecIter);
+      aChunk.NbRecords =
+        int(std::min<int64_t>(THE_CHUNK_NB_RECORDS, theElement.Count - aRecIter));
+      aChunk.FirstTriangle = int(std::min<int64_t>(theNbTriangles, INT_MAX));
+    }
+    for (const PlyProperty& aProp : theElement.Properties)
+    {
+      if (!aProp.IsList())
+      {
+        if (!theReader.Skip(thePtr, theEnd, aProp.Type))
+        {
+          return false;
+        }
+        continue;
+      }
+
+      const char* aCountPtr = thePtr;
+      if (!theReader.Skip(thePtr, theEnd, aProp.CountType))
+      {
+        return false;
+      }
+      const int64_t aNbItems = theReader.ReadInteger(aCountPtr, aProp.CountType);
+      if (aNbItems < 0)
+      {
+        return false;
+      }
+      if (aProp.Attrib == PlyAttrib_Indices && aNbItems >= 3)
+      {
+        theNbTriangles += aNbItems - 2;
+      }
+      if (!theReader.IsAscii())
+      {
+        if (aNbItems > (theEnd - thePtr) / plyTypeSize(aProp.Type))
+        {
+          return false;
+        }
+        thePtr += aNbItems * plyTypeSize(aProp.Type);
+        continue;
+      }
+      for (int64_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+      {
+        if (!theReader.Skip(thePtr, theEnd, aProp.Type))
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+//! Functor decoding chunks of vertex records.
+class VertexDecoder
+{
+public:
+  VertexDecoder(const PlyElement&                                      theElement,
+                const PlyValueReader&                                  theReader,
+                const RWMesh_CoordinateSystemConverter&                theCSTrsf,
+                const NCollection_LinearVector<PlyChunk>&              theChunks,
+                const NCollection_LinearVector<Message_ProgressRange>& theRanges,
+                const occ::handle<Poly_Triangulation>&                 theTriangulation,
+                NCollection_Array1<NCollection_Vec4<uint8_t>>&         theColors)
+      : myElement(theElement),
+        myReader(theReader),
+        myCSTrsf(theCSTrsf),
+        myChunks(theChunks),
+        myRanges(theRanges),
+        myTriangulation(theTriangulation),
+        myColors(theColors)
+  {
+  }
+
+  void operator()(const int theChunkIndex) const
+  {
+    Message_ProgressScope aPS(myRanges[theChunkIndex], nullptr, 1);
+    if (!aPS.More())
+    {
+      return;
+    }
+
+    const PlyChunk& aChunk     = myChunks[theChunkIndex];
+    const bool      hasNormals = myTriangulation->HasNormals();
+    const bool      hasUV      = myTriangulation->HasUVNodes();
+    const bool      hasColors  = !myColors.IsEmpty();
+    const char*     aPtr       = aChunk.Data;
+    for (int aRecIter = 0; aRecIter < aChunk.NbRecords; ++aRecIter)
+    {
+      double aValues[PlyAttrib_NB] = {};
+      aValues[PlyAttrib_Alpha]     = 255.0;
+      for (const PlyProperty& aProp : myElement.Properties)
+      {
+        if (aProp.IsList())
+        {
+          const int64_t aNbItems = myReader.ReadInteger(aPtr, aProp.CountType);
+          for (int64_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+          {
+            myReader.ReadReal(aPtr, aProp.Type);
+          }
+          continue;
+        }
+
+        const double aValue = myReader.ReadReal(aPtr, aProp.Type);
+        if (aProp.Attrib == PlyAttrib_NONE)
+        {
+          continue;
+        }
+        aValues[aProp.Attrib] = aValue;
+        if (aProp.Attrib >= PlyAttrib_Red && aProp.Attrib <= PlyAttrib_Alpha
+            && (aProp.Type == PlyType_Float32 || aProp.Type == PlyType_Float64))
+        {
+          // floating point colors are defined within [0, 1] range
+          aValues[aProp.Attrib] = aValue * 255.0;
+        }
+      }
+
+      const int aNodeIndex = aChunk.FirstRecord + aRecIter + 1;
+      gp_XYZ    aPos(aValues[PlyAttrib_X], aValues[PlyAttrib_Y], aValues[PlyAttrib_Z]);
+      myCSTrsf.TransformPosition(aPos);
+      myTriangulation->SetNode(aNodeIndex, aPos);
+      if (hasNormals)
+      {
+        NCollection_Vec3<float> aNorm((float)aValues[PlyAttrib_NX],
+                                      (float)aValues[PlyAttrib_NY],
+                                      (float)aValues[PlyAttrib_NZ]);
+        myCSTrsf.TransformNormal(aNorm);
+        myTriangulation->SetNormal(aNodeIndex, aNorm);
+      }
+      if (hasUV)
+      {
+        myTriangulation->SetUVNode(aNodeIndex,
+                                   gp_Pnt2d(aValues[PlyAttrib_U], aValues[PlyAttrib_V]));
+      }
+      if (hasColors)
+      {
+        myColors.ChangeValue(aNodeIndex) =
+          NCollection_Vec4<uint8_t>(toColorComponent(aValues[PlyAttrib_Red]),
+                                    toColorComponent(aValues[PlyAttrib_Green]),
+                                    toColorComponent(aValues[PlyAttrib_Blue]),
+                                    toColorComponent(aValues[PlyAttrib_Alpha]));
+      }
+    }
+  }
+
+private:
+  //! Converts the color component into 8-bit value.
+  static uint8_t toColorComponent(const double theValue)
+  {
+    return uint8_t(std::max(0.0, std::min(255.0, theValue + 0.5)));
+  }
+
+private:
+  const PlyElement&                                      myElement;
+  const PlyValueReader&                                  myReader;
+  const RWMesh_CoordinateSystemConverter&                myCSTrsf;
+  const NCollection_LinearVector<PlyChunk>&              myChunks;
+  const NCollection_LinearVector<Message_ProgressRange>& myRanges;
+  const occ::handle<Poly_Triangulation>&                 myTriangulation;
+  NCollection_Array1<NCollection_Vec4<uint8_t>>&         myColors;
+};
+
+//! Functor decoding chunks of face records into triangles.
+class FaceDecoder
+{
+public:
+  FaceDecoder(const PlyElement&                                      theElement,
+              const PlyValueReader&                                  theReader,
+              NCollection_LinearVector<PlyChunk>&                    theChunks,
+              const NCollection_LinearVector<Message_ProgressRange>& theRanges,
+              const occ::handle<Poly_Triangulation>&                 theTriangulation)
+      : myElement(theElement),
+        myReader(theReader),
+        myChunks(theChunks),
+        myRanges(theRanges),
+        myTriangulation(theTriangulation)
+  {
+  }
+
+  void operator()(const int theChunkIndex) const
+  {
+    Message_ProgressScope aPS(myRanges[theChunkIndex], nullptr, 1);
+    if (!aPS.More())
+    {
+      return;
+    }
+
+    PlyChunk&     aChunk    = myChunks[theChunkIndex];
+    const int64_t aNbNodes  = myTriangulation->NbNodes();
+    int           aTriIndex = aChunk.FirstTriangle + 1;
+    const char*   aPtr      = aChunk.Data;
+    for (int aRecIter = 0; aRecIter < aChunk.NbRecords; ++aRecIter)
+    {
+      for (const PlyProperty& aProp : myElement.Properties)
+      {
+        if (!aProp.IsList())
+        {
+          myReader.ReadReal(aPtr, aProp.Type);
+          continue;
+        }
+
+        const int64_t aNbItems = myReader.ReadInteger(aPtr, aProp.CountType);
+        if (aProp.Attrib != PlyAttrib_Indices)
+        {
+          for (int64_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+          {
+            myReader.ReadReal(aPtr, aProp.Type);
+          }
+          continue;
+        }
+
+        // split polygon into triangle fan
+        int aFirst = 0, aPrev = 0;
+        for (int64_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+        {
+          const int64_t aNode = myReader.ReadInteger(aPtr, aProp.Type);
+          if (aNode < 0 || aNode >= aNbNodes)
+          {
+            aChunk.HasErrors = true;
+            continue;
+          }
+
+          const int aNodeIndex = int(aNode) + 1;
+          if (anItemIter == 0)
+          {
+            aFirst = aNodeIndex;
+          }
+          else if (anItemIter >= 2)
+          {
+            myTriangulation->SetTriangle(aTriIndex++, Poly_Triangle(aFirst, aPrev, aNodeIndex));
+          }
+          aPrev = aNodeIndex;
+        }
+      }
+    }
+  }
+
+private:
+  const PlyElement&                                      myElement;
+  const PlyValueReader&                                  myReader;
+  NCollection_LinearVector<PlyChunk>&                    myChunks;
+  const NCollection_LinearVector<Message_ProgressRange>& myRanges;
+  const occ::handle<Poly_Triangulation>&                 myTriangulation;
+};
+
+//! Reads the header line, removing trailing CR.
+static bool readHeaderLine(std::istream& theStream, TCollection_AsciiString& theLine)
+{
+  std::string aLine;
+  if (!std::getline(theStream, aLine))
+  {
+    return false;
+  }
+  if (!aLine.empty() && aLine.back() == '\r')
+  {
+    aLine.pop_back();
+  }
+  theLine = aLine.c_str();
+  return true;
+}
+
+//! Reads PLY header.
+//! @param[in] theStream     input stream
+//! @param[in] theFile       file name for messages
+//! @param[out] theIsAscii   ASCII format flag
+//! @param[out] theIsBigEndian  byte order of binary format
+//! @param[out] theElements  declared elements
+//! @param[out] theComments  file comments
+static bool readHeader(std::istream&                         theStream,
+                       const TCollection_AsciiString&        theFile,
+                       bool&                                 theIsAscii,
+                       bool&                                 theIsBigEndian,
+                       NCollection_LinearVector<PlyElement>& theElements,
+                       TCollection_AsciiString&              theComments)
+{
+  TCollection_AsciiString aLine;
+  if (!readHeaderLine(theStream, aLine) || aLine != "ply")
+  {
+    Message::SendFail() << "Error: file '" << theFile << "' is not PLY file";
+    return false;
+  }
+
+  bool hasFormat = false;
+  for (;;)
+  {
+    if (!readHeaderLine(theStream, aLine))
+    {
+      Message::SendFail() << "Error: PLY file '" << theFile << "' has incomplete header";
+      return false;
+    }
+
+    const TCollection_AsciiString aKeyword = aLine.Token(" \t", 1);
+    if (aKeyword == "end_header")
+    {
+      break;
+    }
+    else if (aKeyword == "comment" || aKeyword == "obj_info")
+    {
+      if (!theComments.IsEmpty())
+      {
+        theComments += "\n";
+      }
+      if (aLine.Length() > aKeyword.Length() + 1)
+      {
+        theComments += aLine.SubString(aKeyword.Length() + 2, aLine.Length());
+      }
+    }
+    else if (aKeyword == "format")
+    {
+      const TCollection_AsciiString aFormat = aLine.Token(" \t", 2);
+      hasFormat                             = true;
+      theIsAscii                            = aFormat == "ascii";
+      theIsBigEndian                        = aFormat == "binary_big_endian";
+      if (!theIsAscii && !theIsBigEndian && aFormat != "binary_little_endian")
+      {
+        Message::SendFail() << "Error: PLY file '" << theFile << "' has unsupported format '"
+                            << aFormat << "'";
+        return false;
+      }
+    }
+    else if (aKeyword == "element")
+    {
+      PlyElement& anElement = theElements.Appended();
+      anElement.Name        = aLine.Token(" \t", 2);
+      anElement.Count       = strtoll(aLine.Token(" \t", 3).ToCString(), nullptr, 10);
+      if (anElement.Count < 0)
+      {
+        Message::SendFail() << "Error: PLY file '" << theFile << "' has invalid element '"
+                            << anElement.Name << "'";
+        return false;
+      }
+    }
+    else if (aKeyword == "property")
+    {
+      if (theElements.IsEmpty())
+      {
+        Message::SendFail() << "Error: PLY file '" << theFile
+                            << "' defines property out of element";
+        return false;
+      }
+
+      PlyElement&             anElement = theElements.ChangeLast();
+      PlyProperty&            aProp     = anElement.Properties.Appended();
+      TCollection_AsciiString aName;
+      if (aLine.Token(" \t", 2) == "list")
+      {
+        aProp.CountType = plyTypeFromString(aLine.Token(" \t", 3));
+        aProp.Type      = plyTypeFromString(aLine.Token(" \t", 4));
+        aName           = aLine.Token(" \t", 5);
+        if (aProp.CountType == PlyType_Float32 || aProp.CountType == PlyType_Float64)
+        {
+          aProp.CountType = PlyType_UNDEFINED;
+        }
+      }
+      else
+      {
+        aProp.Type = plyTypeFromString(aLine.Token(" \t", 2));
+        aName      = aLine.Token(" \t", 3);
+      }
+      if (aProp.Type == PlyType_UNDEFINED
+          || (aLine.Token(" \t", 2) == "list" && aProp.CountType == PlyType_UNDEFINED))
+      {
+        Message::SendFail() << "Error: PLY file '" << theFile << "' has unsupported property '"
+                            << aLine << "'";
+        return false;
+      }
+
+      if (anElement.Name == "vertex")
+      {
+        aProp.Attrib = aProp.IsList() ? PlyAttrib_NONE : plyVertexAttrib(aName);
+      }
+      else if (anElement.Name == "face" && aProp.IsList()
+               && (aName == "vertex_indices" || aName == "vertex_index"))
+      {
+        aProp.Attrib = PlyAttrib_Indices;
+      }
+
+      if (aProp.IsList() || anElement.Stride < 0)
+      {
+        anElement.Stride = -1;
+      }
+      else
+      {
+        anElement.Stride += plyTypeSize(aProp.Type);
+      }
+    }
+  }
+
+  if (!hasFormat)
+  {
+    Message::SendFail() << "Error: PLY file '" << theFile << "' does not define format";
+    return false;
+  }
+  return true;
+}
+
+//! Returns TRUE if the host has big-endian byte order.
+static bool isBigEndianHost()
+{
+  const uint16_t aValue = 1;
+  uint8_t        aBytes[2];
+  std::memcpy(aBytes, &aValue, sizeof(aValue));
+  return aBytes[0] == 0;
+}
+
+//! Loads the rest of the stream into memory, adding terminating zero.
+static bool loadData(std::istream& theStream, NCollection_LinearVector<char>& theData)
+{
+  // read the data at once if the stream size is known
+  size_t               aBlockSize = 1024 * 1024;
+  const std::streampos aDataPos   = theStream.tellg();
+  if (aDataPos != std::streampos(-1))
+  {
+    if (theStream.seekg(0, std::ios::end))
+    {
+      const std::streampos anEndPos = theStream.tellg();
+      if (anEndPos != std::streampos(-1) && anEndPos > aDataPos)
+      {
+        aBlockSize = std::max(aBlockSize, size_t(anEndPos - aDataPos) + 1);
+      }
+    }
+    theStream.clear();
+    theStream.seekg(aDataPos);
+  }
+
+  size_t aNbRead = 0;
+  for (;;)
+  {
+    theData.Resize(aNbRead + aBlockSize);
+    theStream.read(theData.Data() + aNbRead, std::streamsize(aBlockSize));
+    aNbRead += size_t(theStream.gcount());
+    if (theStream.eof())
+    {
+      break;
+    }
+    else if (!theStream.good())
+    {
+      return false;
+    }
+  }
+  theData.Resize(aNbRead + 1);
+  theData[aNbRead] = '\0';
+  return true;
+}
+} // namespace
+
+//=================================================================================================
+
+RWPly_TriangulationReader::RWPly_TriangulationReader()
+    : myNbFileVertices(0),
+      myNbFileFaces(0),
+      myIsSinglePrecision(false),
+      myToParallel(true)
+{
+}
+
+//=================================================================================================
+
+bool RWPly_TriangulationReader::Read(const TCollection_AsciiString& theFile,
+                                     const Message_ProgressRange&   theProgress)
+{
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream>      aStream =
+    aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
+  if (aStream.get() == nullptr)
+  {
+    Message::SendFail() << "Error: file '" << theFile << "' is not found";
+    return false;
+  }
+  return Read(*aStream, theFile, theProgress);
+}
+
+//=================================================================================================
+
+bool RWPly_TriangulationReader::Probe(std::istream&                  theStream,
+                                      const TCollection_AsciiString& theFile)
+{
+  myTriangulation.Nullify();
+  myNodeColors = NCollection_Array1<NCollection_Vec4<uint8_t>>();
+  myFileComments.Clear();
+  myNbFileVertices = myNbFileFaces = 0;
+
+  bool                                 isAscii = false, isBigEndian = false;
+  NCollection_LinearVector<PlyElement> anElements;
+  if (!readHeader(theStream, theFile, isAscii, isBigEndian, anElements, myFileComments))
+  {
+    return false;
+  }
+  for (const PlyElement& anElement : anElements)
+  {
+    if (anElement.Name == "vertex")
+    {
+      myNbFileVertices = int(std::min(anElement.Count, int64_t(INT_MAX)));
+    }
+    else if (anElement.Name == "face")
+    {
+      myNbFileFaces = int(std::min(anElement.Count, int64_t(INT_MAX)));
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool RWPly_TriangulationReader::Read(std::istream&                  theStream,
+                                     const TCollection_AsciiString& theFile,
+                                     const Message_ProgressRange&   theProgress)
+{
+  myTriangulation.Nullify();
+  myNodeColors = NCollection_Array1<NCollection_Vec4<uint8_t>>();
+  myFileComments.Clear();
+  myNbFileVertices = myNbFileFaces = 0;
+
+  bool                                 isAscii = false, isBigEndian = false;
+  NCollection_LinearVector<PlyElement> anElements;
+  if (!readHeader(theStream, theFile, isAscii, isBigEndian, anElements, myFileComments))
+  {
+    return false;
+  }
+
+  Message_ProgressScope          aPS(theProgress, "Reading PLY file", 3);
+  NCollection_LinearVector<char> aData;
+  if (!loadData(theStream, aData))
+  {
+    Message::SendFail() << "Error: PLY file '" << theFile << "' cannot be read";
+    return false;
+  }
+  aPS.Next();
+
+  // find records of each element
+  const PlyValueReader               aReader(isAscii, isBigEndian != isBigEndianHost());
+  const char*                        aPtr      = aData.Data();
+  const char*                        anEnd     = aData.Data() + aData.Size() - 1;
+  const PlyElement*                  aVertElem = nullptr;
+  const PlyElement*                  aFaceElem = nullptr;
+  NCollection_LinearVector<PlyChunk> aVertChunks, aFaceChunks, anOtherChunks;
+  int64_t                            aNbTriangles = 0;
+  for (const PlyElement& anElement : anElements)
+  {
+    const bool isVertex = aVertElem == nullptr && anElement.Name == "vertex";
+    const bool isFace   = aFaceElem == nullptr && anElement.Name == "face";
+    if ((isVertex || isFace) && anElement.Count > INT_MAX)
+    {
+      Message::SendFail() << "Error: PLY file '" << theFile << "' defines too many "
+                          << anElement.Name << " elements";
+      return false;
+    }
+
+    NCollection_LinearVector<PlyChunk>& aChunks = isVertex ? aVertChunks
+                                                  : isFace ? aFaceChunks
+                                                           : anOtherChunks;
+    int64_t aNbElemTriangles = 0;
+    if (!scanElement(anElement, aReader, aPtr, anEnd, aChunks, aNbElemTriangles))
+    {
+      Message::SendFail() << "Error: PLY file '" << theFile << "' has truncated "
+                          << anElement.Name << " data";
+      return false;
+    }
+    anOtherChunks.Clear();
+    if (isVertex)
+    {
+      aVertElem = &anElement;
+    }
+    else if (isFace)
+    {
+      aFaceElem    = &anElement;
+      aNbTriangles = aNbElemTriangles;
+    }
+  }
+  if (aVertElem == nullptr)
+  {
+    Message::SendFail() << "Error: PLY file '" << theFile << "' does not define vertices";
+    return false;
+  }
+  else if (aNbTriangles > INT_MAX)
+  {
+    Message::SendFail() << "Error: PLY file '" << theFile << "' defines too many triangles";
+    return false;
+  }
+
+  myNbFileVertices = int(aVertElem->Count);
+  myNbFileFaces    = aFaceElem != nullptr ? int(aFaceElem->Count) : 0;
+
+  bool hasNormals = false, hasUV = false, hasColors = false;
+  for (const PlyProperty& aProp : aVertElem->Properties)
+  {
+    hasNormals = hasNormals || aProp.Attrib == PlyAttrib_NX;
+    hasUV      = hasUV || aProp.Attrib == PlyAttrib_U;
+    hasColors  = hasColors || aProp.Attrib == PlyAttrib_Red;
+  }
+
+  occ::handle<Poly_Triangulation> aTriangulation = new Poly_Triangulation();
+  aTriangulation->SetDoublePrecision(!myIsSinglePrecision);
+  if (myNbFileVertices > 0)
+  {
+    aTriangulation->ResizeNodes(myNbFileVertices, false);
+    if (hasNormals)
+    {
+      aTriangulation->AddNormals();
+    }
+    if (hasUV)
+    {
+      aTriangulation->AddUVNodes();
+    }
+    if (hasColors)
+    {
+      myNodeColors.Resize(1, myNbFileVertices, false);
+    }
+  }
+  if (aNbTriangles > 0)
+  {
+    aTriangulation->ResizeTriangles(int(aNbTriangles), false);
+  }
+
+  {
+    Message_ProgressScope aVertPS(aPS.Next(),
+                                  "Reading vertices",
+                                  std::max(1, int(aVertChunks.Size())));
+    NCollection_LinearVector<Message_ProgressRange> aRanges;
+    for (size_t aChunkIter = 0; aChunkIter < aVertChunks.Size(); ++aChunkIter)
+    {
+      aRanges.Append(aVertPS.Next());
+    }
+    const VertexDecoder aDecoder(*aVertElem,
+                                 aReader,
+                                 myCSTrsf,
+                                 aVertChunks,
+                                 aRanges,
+                                 aTriangulation,
+                                 myNodeColors);
+    OSD_Parallel::For(0, int(aVertChunks.Size()), aDecoder, !myToParallel);
+  }
+  if (aFaceElem != nullptr)
+  {
+    Message_ProgressScope aFacePS(aPS.Next(),
+                                  "Reading faces",
+                                  std::max(1, int(aFaceChunks.Size())));
+    NCollection_LinearVector<Message_ProgressRange> aRanges;
+    for (size_t aChunkIter = 0; aChunkIter < aFaceChunks.Size(); ++aChunkIter)
+    {
+      aRanges.Append(aFacePS.Next());
+    }
+    const FaceDecoder aDecoder(*aFaceElem, aReader, aFaceChunks, aRanges, aTriangulation);
+    OSD_Parallel::For(0, int(aFaceChunks.Size()), aDecoder, !myToParallel);
+    for (const PlyChunk& aChunk : aFaceChunks)
+    {
+      if (aChunk.HasErrors)
+      {
+        myNodeColors = NCollection_Array1<NCollection_Vec4<uint8_t>>();
+        Message::SendFail() << "Error: PLY file '" << theFile
+                            << "' defines faces with invalid vertex indices";
+        return false;
+      }
+    }
+  }
+  if (!aPS.More())
+  {
+    myNodeColors = NCollection_Array1<NCollection_Vec4<uint8_t>>();
+    return false;
+  }
+
+  myTriangulation = aTriangulation;
+  return true;
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_TriangulationReader_HeaderFile
+#define _RWPly_TriangulationReader_HeaderFile
+
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vec4.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWMesh_CoordinateSystemConverter.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Reader of PLY (Polygon File Format) file into Poly_Triangulation.
+//!
+//! ASCII and binary (little and big endian) files are supported.
+//! The reader takes the following properties of "vertex" element:
+//! - "x", "y", "z" for node positions;
+//! - "nx", "ny", "nz" for node normals (optional);
+//! - "s", "t" (or "u", "v", "texture_u", "texture_v") for UV coordinates (optional);
+//! - "red", "green", "blue", "alpha" for node colors (optional, see NodeColors()).
+//!
+//! Polygons are defined by "vertex_indices" (or "vertex_index") list property of "face" element
+//! and are split into triangle fans. File without faces is read as a point cloud,
+//! e.g. triangulation defining only nodes. Other elements and properties are skipped.
+//!
+//! The data section is loaded into memory by single read,
+//! and then vertex and face records are decoded in parallel chunks.
+class RWPly_TriangulationReader
+{
+public:
+  //! Empty constructor.
+  Standard_EXPORT RWPly_TriangulationReader();
+
+  //! Return transformation from the file coordinate system.
+  const RWMesh_CoordinateSystemConverter& Transformation() const { return myCSTrsf; }
+
+  //! Set transformation from the file coordinate system.
+  void SetTransformation(const RWMesh_CoordinateSystemConverter& theCSConverter)
+  {
+    myCSTrsf = theCSConverter;
+  }
+
+  //! Return single precision flag for storing node positions; FALSE by default.
+  bool IsSinglePrecision() const { return myIsSinglePrecision; }
+
+  //! Setup single/double precision flag for storing node positions.
+  void SetSinglePrecision(bool theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
+
+  //! Return TRUE if multithreaded decoding is allowed; TRUE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded decoding.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
+public:
+  //! Read the file.
+  //! @param[in] theFile      path to the file
+  //! @param[in] theProgress  progress indicator
+  //! @return TRUE if the file has been read
+  Standard_EXPORT bool Read(const TCollection_AsciiString& theFile,
+                            const Message_ProgressRange&   theProgress = Message_ProgressRange());
+
+  //! Read the data from the stream.
+  //! @param[in] theStream    input stream opened in binary mode
+  //! @param[in] theFile      path to the file (for messages)
+  //! @param[in] theProgress  progress indicator
+  //! @return TRUE if the file has been read
+  Standard_EXPORT bool Read(std::istream&                  theStream,
+                            const TCollection_AsciiString& theFile,
+                            const Message_ProgressRange&   theProgress = Message_ProgressRange());
+
+  //! Read the header of the file without reading the data section.
+  //! Fills file comments and number of vertices and faces.
+  //! @param[in] theStream  input stream opened in binary mode
+  //! @param[in] theFile    path to the file (for messages)
+  //! @return TRUE if the header has been read
+  Standard_EXPORT bool Probe(std::istream& theStream, const TCollection_AsciiString& theFile);
+
+public:
+  //! Return the triangulation read from the file.
+  const occ::handle<Poly_Triangulation>& Triangulation() const { return myTriangulation; }
+
+  //! Return TRUE if the file defines node colors.
+  bool HasNodeColors() const { return !myNodeColors.IsEmpty(); }
+
+  //! Return RGBA node colors within [1, NbNodes()] range; empty if file has no colors.
+  const NCollection_Array1<NCollection_Vec4<uint8_t>>& NodeColors() const { return myNodeColors; }
+
+  //! Return number of vertices declared by the file header.
+  int NbFileVertices() const { return myNbFileVertices; }
+
+  //! Return number of faces declared by the file header.
+  int NbFileFaces() const { return myNbFileFaces; }
+
+  //! Return file comments.
+  const TCollection_AsciiString& FileComments() const { return myFileComments; }
+
+private:
+  RWMesh_CoordinateSystemConverter              myCSTrsf;
+  occ::handle<Poly_Triangulation>               myTriangulation;
+  NCollection_Array1<NCollection_Vec4<uint8_t>> myNodeColors;
+  TCollection_AsciiString                       myFileComments;
+  int                                           myNbFileVertices;
+  int                                           myNbFileFaces;
+  bool                                          myIsSinglePrecision;
+  bool                                          myToParallel;
+};
+
+#endif // _RWPly_TriangulationReader_HeaderFile
@@ -5,15 +5,25 @@ set(OCCT_TKDESTEP_GTests_FILES
     DESTEP_Provider_Test.cxx
     STEPConstruct_RenderingProperties_Test.cxx
     StepData_StepWriter_Test.cxx
+    StepFile_Read_Test.cxx
+    STEPControl_Reader_Test.cxx
+    STEPControl_StreamWriter_Test.cxx
     StepTidy_BaseTestFixture.pxx
     StepTidy_Axis2Placement3dReducer_Test.cxx
+    StepTidy_BSplineCurveWithKnotsReducer_Test.cxx
+    StepTidy_BSplineSurfaceWithKnotsReducer_Test.cxx
     StepTidy_CartesianPointReducer_Test.cxx
     StepTidy_CircleReducer_Test.cxx
+    StepTidy_ColourRgbReducer_Test.cxx
     StepTidy_DirectionReducer_Test.cxx
+    StepTidy_EdgeCurveReducer_Test.cxx
     StepTidy_LineReducer_Test.cxx
+    StepTidy_OrientedEdgeReducer_Test.cxx
     StepTidy_PlaneReducer_Test.cxx
     StepTidy_Merger_Test.cxx
+    StepTidy_StyledItemReducer_Test.cxx
     StepTidy_VectorReducer_Test.cxx
+    StepTidy_VertexPointReducer_Test.cxx
     StepToTopoDS_TranslateFace_Test.cxx
     StepTransientReplacements_Test.cxx
     STEPCAFControl_Controller_Test.cxx
@@ -0,0 +1,163 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <STEPControl_Reader.hxx>
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <GProp_GProps.hxx>
+#include <STEPCAFControl_Reader.hxx>
+#include <STEPCAFControl_Writer.hxx>
+#include <StepBasic_ProductDefinition.hxx>
+#include <TDataStd_Name.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns number of solids in the shape.
+int nbSolids(const TopoDS_Shape& theShape)
+{
+  int aNb = 0;
+  for (TopExp_Explorer anExp(theShape, TopAbs_SOLID); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+
+//! Writes assembly of a sub-assembly with a box and a sphere part into STEP text.
+std::string writeAssembly()
+{
+  occ::handle<TDocStd_Document>    aDoc;
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  anApp->NewDocument("BinXCAF", aDoc);
+  occ::handle<XCAFDoc_ShapeTool> aShapeTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+
+  const TDF_Label aBox = aShapeTool->AddShape(BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape(), false);
+  TDataStd_Name::Set(aBox, "Box");
+  const TDF_Label aSphere = aShapeTool->AddShape(BRepPrimAPI_MakeSphere(5.0).Shape(), false);
+  TDataStd_Name::Set(aSphere, "Sphere");
+
+  const TDF_Label aSubAssembly = aShapeTool->NewShape();
+  TDataStd_Name::Set(aSubAssembly, "SubAssembly");
+  aShapeTool->AddComponent(aSubAssembly, aBox, TopLoc_Location());
+
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(20.0, 0.0, 0.0));
+  const TDF_Label anAssembly = aShapeTool->NewShape();
+  TDataStd_Name::Set(anAssembly, "Assembly");
+  aShapeTool->AddComponent(anAssembly, aSubAssembly, TopLoc_Location());
+  aShapeTool->AddComponent(anAssembly, aSphere, TopLoc_Location(aTrsf));
+  aShapeTool->UpdateAssemblies();
+
+  STEPCAFControl_Writer aWriter;
+  std::ostringstream    aStream;
+  if (!aWriter.Transfer(aDoc) || aWriter.WriteStream(aStream) != IFSelect_RetDone)
+  {
+    return std::string();
+  }
+  return aStream.str();
+}
+} // namespace
+
+// Check scanning of the product structure.
+TEST(STEPControl_ReaderTest, ProductStructure)
+{
+  const std::string aText = writeAssembly();
+  ASSERT_FALSE(aText.empty());
+
+  std::istringstream aStream(aText);
+  STEPControl_Reader aReader;
+  ASSERT_EQ(aReader.ReadStream("assembly.stp", aStream), IFSelect_RetDone);
+
+  EXPECT_EQ(aReader.ProductDefinitions().Length(), 4);
+  EXPECT_TRUE(aReader.ProductDefinitions("Unknown").IsEmpty());
+
+  const NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> anAssemblies =
+    aReader.ProductDefinitions("Assembly");
+  ASSERT_EQ(anAssemblies.Length(), 1);
+  EXPECT_EQ(aReader.SubProductDefinitions(anAssemblies.First()).Length(), 2);
+
+  const NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> aSubAssemblies =
+    aReader.ProductDefinitions("SubAssembly");
+  ASSERT_EQ(aSubAssemblies.Length(), 1);
+  const NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> aParts =
+    aReader.SubProductDefinitions(aSubAssemblies.First());
+  ASSERT_EQ(aParts.Length(), 1);
+  EXPECT_EQ(aParts.First(), aReader.ProductDefinitions("Box").First());
+}
+
+// Check that only the selected sub-assembly is translated.
+TEST(STEPControl_ReaderTest, RootProducts)
+{
+  const std::string aText = writeAssembly();
+  ASSERT_FALSE(aText.empty());
+
+  std::istringstream aStream(aText);
+  STEPControl_Reader aReader;
+  ASSERT_EQ(aReader.ReadStream("assembly.stp", aStream), IFSelect_RetDone);
+
+  aReader.SetRootProducts(aReader.ProductDefinitions("SubAssembly"));
+  ASSERT_EQ(aReader.NbRootsForTransfer(), 1);
+  aReader.TransferRoots();
+  const TopoDS_Shape aSubShape = aReader.OneShape();
+  ASSERT_EQ(nbSolids(aSubShape), 1);
+  GProp_GProps aProps;
+  BRepGProp::VolumeProperties(aSubShape, aProps);
+  EXPECT_NEAR(aProps.Mass(), 1000.0, 1.0e-6);
+
+  // restore default roots
+  aReader.SetRootProducts(NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>>());
+  EXPECT_TRUE(aReader.RootProducts().IsEmpty());
+  ASSERT_EQ(aReader.NbRootsForTransfer(), 1);
+  aReader.TransferRoots();
+  EXPECT_EQ(nbSolids(aReader.OneShape()), 2);
+}
+
+// Check that selection of root products is cleared when a new model is loaded.
+TEST(STEPControl_ReaderTest, RootProductsClearedOnRead)
+{
+  const std::string aText = writeAssembly();
+  ASSERT_FALSE(aText.empty());
+
+  STEPCAFControl_Reader aReader;
+  std::istringstream    aStream(aText);
+  ASSERT_EQ(aReader.ReadStream("assembly.stp", aStream), IFSelect_RetDone);
+  aReader.ChangeReader().SetRootProducts(aReader.Reader().ProductDefinitions("SubAssembly"));
+  ASSERT_EQ(aReader.Reader().RootProducts().Length(), 1);
+  ASSERT_EQ(aReader.NbRootsForTransfer(), 1);
+
+  // product definitions of the previous model should not be used as roots
+  std::istringstream aStream2(aText);
+  ASSERT_EQ(aReader.ReadStream("assembly.stp", aStream2), IFSelect_RetDone);
+  EXPECT_TRUE(aReader.Reader().RootProducts().IsEmpty());
+
+  occ::handle<TDocStd_Document>    aDoc;
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  anApp->NewDocument("BinXCAF", aDoc);
+  ASSERT_TRUE(aReader.Transfer(aDoc));
+
+  NCollection_Sequence<TDF_Label> aFreeShapes;
+  XCAFDoc_DocumentTool::ShapeTool(aDoc->Main())->GetFreeShapes(aFreeShapes);
+  ASSERT_EQ(aFreeShapes.Length(), 1);
+  EXPECT_EQ(nbSolids(XCAFDoc_ShapeTool::GetShape(aFreeShapes.First())), 2);
+}
@@ -0,0 +1,183 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <STEPControl_StreamWriter.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <GProp_GProps.hxx>
+#include <STEPControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_VertexPoint.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns number of sub-shapes of the given type.
+int nbSubShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  int aNb = 0;
+  for (TopExp_Explorer anExp(theShape, theType); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+
+//! Returns volume of the shape.
+double volume(const TopoDS_Shape& theShape)
+{
+  GProp_GProps aProps;
+  BRepGProp::VolumeProperties(theShape, aProps);
+  return aProps.Mass();
+}
+
+//! Reads the shape back from STEP text.
+TopoDS_Shape readStep(const std::string& theText)
+{
+  std::istringstream aStream(theText);
+  STEPControl_Reader aReader;
+  if (aReader.ReadStream("stream.stp", aStream) != IFSelect_RetDone)
+  {
+    return TopoDS_Shape();
+  }
+  aReader.TransferRoots();
+  return aReader.OneShape();
+}
+
+//! Returns number of entities of the given type in the STEP text.
+int nbStepEntities(const std::string& theText, const occ::handle<Standard_Type>& theType)
+{
+  std::istringstream aStream(theText);
+  STEPControl_Reader aReader;
+  if (aReader.ReadStream("stream.stp", aStream) != IFSelect_RetDone)
+  {
+    return 0;
+  }
+  int aNb = 0;
+  for (int anEntIter = 1; anEntIter <= aReader.Model()->NbEntities(); ++anEntIter)
+  {
+    if (aReader.Model()->Value(anEntIter)->IsKind(theType))
+    {
+      ++aNb;
+    }
+  }
+  return aNb;
+}
+} // namespace
+
+TEST(STEPControl_StreamWriterTest, WriteAndReadBack)
+{
+  TopoDS_Compound aComp;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aComp);
+  aBuilder.Add(aComp, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aComp, BRepPrimAPI_MakeSphere(gp_Pnt(50.0, 0.0, 0.0), 5.0).Shape());
+
+  STEPControl_StreamWriter aWriter;
+  std::ostringstream       aStream;
+  ASSERT_EQ(aWriter.WriteStream(aComp, aStream), IFSelect_RetDone);
+  EXPECT_GT(aWriter.NbEntities(), 0);
+
+  const std::string aText = aStream.str();
+  EXPECT_EQ(aText.rfind("ISO-10303-21;", 0), 0u);
+  EXPECT_NE(aText.find("END-ISO-10303-21;"), std::string::npos);
+
+  const TopoDS_Shape aResult = readStep(aText);
+  ASSERT_FALSE(aResult.IsNull());
+  EXPECT_EQ(nbSubShapes(aResult, TopAbs_SOLID), 2);
+  EXPECT_NEAR(volume(aResult), volume(aComp), volume(aComp) * 1.e-3);
+}
+
+TEST(STEPControl_StreamWriterTest, KnownEntitiesAreBoundedByPiece)
+{
+  TopoDS_Compound aComp;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aComp);
+  const int aNbBoxes = 20;
+  for (int aBoxIter = 0; aBoxIter < aNbBoxes; ++aBoxIter)
+  {
+    aBuilder.Add(aComp, BRepPrimAPI_MakeBox(gp_Pnt(aBoxIter * 20.0, 0.0, 0.0), 10.0, 10.0, 10.0));
+  }
+
+  STEPControl_StreamWriter aWriter;
+  std::ostringstream       aStream;
+  ASSERT_EQ(aWriter.WriteStream(aComp, aStream), IFSelect_RetDone);
+
+  // entities of previous boxes are forgotten, only top-level items remain known
+  EXPECT_LT(aWriter.MaxNbKnownEntities() * 4, aWriter.NbEntities());
+
+  const TopoDS_Shape aResult = readStep(aStream.str());
+  ASSERT_FALSE(aResult.IsNull());
+  EXPECT_EQ(nbSubShapes(aResult, TopAbs_SOLID), aNbBoxes);
+}
+
+TEST(STEPControl_StreamWriterTest, NullShape)
+{
+  STEPControl_StreamWriter aWriter;
+  std::ostringstream       aStream;
+  EXPECT_EQ(aWriter.WriteStream(TopoDS_Shape(), aStream), IFSelect_RetVoid);
+  EXPECT_TRUE(aStream.str().empty());
+}
+
+TEST(STEPControl_StreamWriterTest, SharedSubShapes)
+{
+  // two adjacent faces of the box sharing an edge and two vertices
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+  TopoDS_Compound    aComp;
+  BRep_Builder       aBuilder;
+  aBuilder.MakeCompound(aComp);
+  TopExp_Explorer aFaceExp(aBox, TopAbs_FACE);
+  aBuilder.Add(aComp, aFaceExp.Current());
+  aFaceExp.Next();
+  aFaceExp.Next();
+  aBuilder.Add(aComp, aFaceExp.Current());
+
+  STEPControl_StreamWriter aStreamWriter;
+  std::ostringstream       aStream;
+  ASSERT_EQ(aStreamWriter.WriteStream(aComp, aStream), IFSelect_RetDone);
+  const std::string aStreamText = aStream.str();
+
+  // reference writer shares sub-shapes between items in non-manifold mode
+  DESTEP_Parameters aParams;
+  aParams.InitFromStatic();
+  aParams.WriteNonmanifold = true;
+  STEPControl_Writer aWriter;
+  ASSERT_EQ(aWriter.Transfer(aComp, STEPControl_AsIs, aParams), IFSelect_RetDone);
+  std::ostringstream aRefStream;
+  ASSERT_EQ(aWriter.WriteStream(aRefStream), IFSelect_RetDone);
+  const std::string aRefText = aRefStream.str();
+
+  EXPECT_EQ(nbStepEntities(aStreamText, STANDARD_TYPE(StepShape_EdgeCurve)), 7);
+  EXPECT_EQ(nbStepEntities(aStreamText, STANDARD_TYPE(StepShape_VertexPoint)), 6);
+  EXPECT_EQ(nbStepEntities(aStreamText, STANDARD_TYPE(StepShape_EdgeCurve)),
+            nbStepEntities(aRefText, STANDARD_TYPE(StepShape_EdgeCurve)));
+  EXPECT_LE(aStreamWriter.NbEntities(), aWriter.Model()->NbEntities());
+
+  const TopoDS_Shape aResult    = readStep(aStreamText);
+  const TopoDS_Shape aRefResult = readStep(aRefText);
+  ASSERT_FALSE(aResult.IsNull());
+  ASSERT_FALSE(aRefResult.IsNull());
+  EXPECT_EQ(nbSubShapes(aResult, TopAbs_FACE), 2);
+  EXPECT_EQ(nbSubShapes(aResult, TopAbs_EDGE), nbSubShapes(aRefResult, TopAbs_EDGE));
+  EXPECT_EQ(nbSubShapes(aResult, TopAbs_VERTEX), nbSubShapes(aRefResult, TopAbs_VERTEX));
+}
@@ -12,7 +12,16 @@
 // commercial license or contractual agreement.
 
 #include <StepData_StepWriter.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
 #include <TCollection_AsciiString.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -157,4 +166,71 @@ TEST(StepData_StepWriterTest, CleanTextForSend_HexSequenceDetection)
   TCollection_AsciiString anInput3("start \\X2\\03C0\\X0\\ end");
   TCollection_AsciiString aResult3 = StepData_StepWriter::CleanTextForSend(anInput3);
   EXPECT_STREQ(aResult3.ToCString(), "start \\X2\\03C0\\X0\\ end");
-}
\ No newline at end of file
+}
+
+// Test that stream mode produces the same text as the default mode, without keeping lines
+TEST(StepData_StepWriterTest, StreamMode_MatchesPrint)
+{
+  STEPControl_Writer aStepWriter;
+  ASSERT_EQ(aStepWriter.Transfer(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape(), STEPControl_AsIs),
+            IFSelect_RetDone);
+  occ::handle<StepData_StepModel> aModel    = aStepWriter.Model();
+  occ::handle<StepData_Protocol>  aProtocol = occ::down_cast<StepData_Protocol>(aModel->Protocol());
+  ASSERT_FALSE(aProtocol.IsNull());
+
+  StepData_StepWriter aWriter1(aModel);
+  aWriter1.SendModel(aProtocol);
+  std::ostringstream aStream1;
+  EXPECT_TRUE(aWriter1.Print(aStream1));
+
+  std::ostringstream  aStream2;
+  StepData_StepWriter aWriter2(aModel);
+  aWriter2.SetStream(&aStream2);
+  aWriter2.SendModel(aProtocol);
+  EXPECT_EQ(aWriter2.NbLines(), 0);
+  EXPECT_TRUE(aWriter2.Print(aStream2));
+
+  EXPECT_FALSE(aStream1.str().empty());
+  EXPECT_EQ(aStream1.str(), aStream2.str());
+}
+
+// Test that entities formatted in parallel chunks give the same text as sequential writing
+TEST(StepData_StepWriterTest, RunParallel_MatchesSequential)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  for (int aBoxIter = 0; aBoxIter < 30; ++aBoxIter)
+  {
+    aBuilder.Add(aCompound,
+                 BRepPrimAPI_MakeBox(gp_Pnt(aBoxIter * 20.0, 0.0, 0.0), 10.0, 10.0 + aBoxIter, 5.0)
+                   .Shape());
+  }
+  STEPControl_Writer aStepWriter;
+  ASSERT_EQ(aStepWriter.Transfer(aCompound, STEPControl_AsIs), IFSelect_RetDone);
+  occ::handle<StepData_StepModel> aModel    = aStepWriter.Model();
+  occ::handle<StepData_Protocol>  aProtocol = occ::down_cast<StepData_Protocol>(aModel->Protocol());
+  ASSERT_FALSE(aProtocol.IsNull());
+  // several chunks are needed to run in parallel
+  ASSERT_GT(aModel->NbEntities(), 3000);
+
+  StepData_StepWriter aWriter1(aModel);
+  aWriter1.SetRunParallel(false);
+  aWriter1.SendModel(aProtocol);
+  std::ostringstream aStream1;
+  EXPECT_TRUE(aWriter1.Print(aStream1));
+
+  StepData_StepWriter aWriter2(aModel);
+  EXPECT_TRUE(aWriter2.IsRunParallel());
+  aWriter2.SendModel(aProtocol);
+  std::ostringstream aStream2;
+  EXPECT_TRUE(aWriter2.Print(aStream2));
+  EXPECT_EQ(aWriter1.NbLines(), aWriter2.NbLines());
+  EXPECT_EQ(aStream1.str(), aStream2.str());
+
+  std::ostringstream  aStream3;
+  StepData_StepWriter aWriter3(aModel);
+  aWriter3.SetStream(&aStream3);
+  aWriter3.SendModel(aProtocol);
+  EXPECT_EQ(aStream1.str(), aStream3.str());
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <STEPControl_Reader.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepFile_ReadData.hxx>
+#include <StepGeom_CartesianPoint.hxx>
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_OrientedEdge.hxx>
+#include <StepShape_VertexPoint.hxx>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! STEP text with repeated entity types, enumerations and unset values.
+const char* const THE_STEP_TEXT = "ISO-10303-21;\n"
+                                  "HEADER;\n"
+                                  "FILE_DESCRIPTION((''),'2;1');\n"
+                                  "FILE_NAME('test','2025-01-01T00:00:00',(''),(''),'','','');\n"
+                                  "FILE_SCHEMA(('AUTOMOTIVE_DESIGN { 1 0 10303 214 1 1 1 1 }'));\n"
+                                  "ENDSEC;\n"
+                                  "DATA;\n"
+                                  "#1=CARTESIAN_POINT('',(0.,0.,0.));\n"
+                                  "#2=CARTESIAN_POINT('P2',(1.,2.,3.));\n"
+                                  "#3=VERTEX_POINT('',#1);\n"
+                                  "#4=VERTEX_POINT('',#2);\n"
+                                  "#5=DIRECTION('',(1.,0.,0.));\n"
+                                  "#6=VECTOR('',#5,1.);\n"
+                                  "#7=LINE('',#1,#6);\n"
+                                  "#8=EDGE_CURVE('',#3,#4,#7,.T.);\n"
+                                  "#9=EDGE_CURVE('E9',#4,#3,#7,.F.);\n"
+                                  "#10=ORIENTED_EDGE('',*,*,#8,.F.);\n"
+                                  "#11=ORIENTED_EDGE('',*,*,#9,.T.);\n"
+                                  "ENDSEC;\n"
+                                  "END-ISO-10303-21;\n";
+} // namespace
+
+// Check that shared texts of types and enumerations are read into independent values.
+TEST(StepFile_ReadTest, SharedTexts)
+{
+  std::istringstream aStream(THE_STEP_TEXT);
+  STEPControl_Reader aReader;
+  ASSERT_EQ(aReader.ReadStream("stream.stp", aStream), IFSelect_RetDone);
+
+  occ::handle<StepData_StepModel> aModel = aReader.StepModel();
+  ASSERT_FALSE(aModel.IsNull());
+  ASSERT_EQ(aModel->NbEntities(), 11);
+
+  occ::handle<StepGeom_CartesianPoint> aPoint =
+    occ::down_cast<StepGeom_CartesianPoint>(aModel->Value(2));
+  ASSERT_FALSE(aPoint.IsNull());
+  EXPECT_STREQ(aPoint->Name()->ToCString(), "P2");
+  EXPECT_EQ(aPoint->CoordinatesValue(3), 3.);
+
+  occ::handle<StepShape_EdgeCurve> anEdge1 = occ::down_cast<StepShape_EdgeCurve>(aModel->Value(8));
+  occ::handle<StepShape_EdgeCurve> anEdge2 = occ::down_cast<StepShape_EdgeCurve>(aModel->Value(9));
+  ASSERT_FALSE(anEdge1.IsNull());
+  ASSERT_FALSE(anEdge2.IsNull());
+  EXPECT_TRUE(anEdge1->SameSense());
+  EXPECT_FALSE(anEdge2->SameSense());
+  EXPECT_EQ(anEdge1->EdgeStart(), aModel->Value(3));
+  EXPECT_EQ(anEdge2->EdgeStart(), aModel->Value(4));
+  EXPECT_STREQ(anEdge2->Name()->ToCString(), "E9");
+
+  occ::handle<StepShape_OrientedEdge> anOriented1 =
+    occ::down_cast<StepShape_OrientedEdge>(aModel->Value(10));
+  occ::handle<StepShape_OrientedEdge> anOriented2 =
+    occ::down_cast<StepShape_OrientedEdge>(aModel->Value(11));
+  ASSERT_FALSE(anOriented1.IsNull());
+  ASSERT_FALSE(anOriented2.IsNull());
+  EXPECT_FALSE(anOriented1->Orientation());
+  EXPECT_TRUE(anOriented2->Orientation());
+  EXPECT_EQ(anOriented1->EdgeElement(), anEdge1);
+  EXPECT_EQ(anOriented2->EdgeElement(), anEdge2);
+}
+
+// Check that identical texts of types and enumerations are stored only once.
+TEST(StepFile_ReadTest, SharedTextStorage)
+{
+  StepFile_ReadData aData;
+  char*             aFirst  = nullptr;
+  char*             aSecond = nullptr;
+  aData.CreateNewText(".T.", 3);
+  aData.GetResultText(&aFirst);
+  aData.CreateNewText(".T.", 3);
+  aData.GetResultText(&aSecond);
+  EXPECT_EQ(aFirst, aSecond);
+  EXPECT_STREQ(aSecond, ".T.");
+
+  aData.CreateNewText("CARTESIAN_POINT", 15);
+  aData.GetResultText(&aFirst);
+  aData.CreateNewText("CARTESIAN_POINT", 15);
+  aData.GetResultText(&aSecond);
+  EXPECT_EQ(aFirst, aSecond);
+
+  // string values are not shared
+  aData.CreateNewText("'name'", 6);
+  aData.GetResultText(&aFirst);
+  aData.CreateNewText("'name'", 6);
+  aData.GetResultText(&aSecond);
+  EXPECT_NE(aFirst, aSecond);
+  EXPECT_STREQ(aFirst, aSecond);
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_BSplineCurveWithKnotsReducer.pxx>
+
+#include <StepShape_EdgeCurve.hxx>
+#include <StepGeom_TrimmedCurve.hxx>
+
+class StepTidy_BSplineCurveWithKnotsReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateCurves()
+  {
+    StepTidy_BSplineCurveWithKnotsReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+};
+
+// Check that curves with different control points are not merged.
+TEST_F(StepTidy_BSplineCurveWithKnotsReducerTest, DifferentControlPoints)
+{
+  // Creating curves.
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve1 = addBSplineCurve(nullptr, 0.);
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve2 = addBSplineCurve(nullptr, 1.);
+
+  // Creating EdgeCurves containing the curves.
+  occ::handle<StepShape_EdgeCurve> aFirstEdgeCurve = new StepShape_EdgeCurve;
+  aFirstEdgeCurve->Init(new TCollection_HAsciiString,
+                        new StepShape_Vertex,
+                        new StepShape_Vertex,
+                        aCurve1,
+                        true);
+  addToModel(aFirstEdgeCurve);
+  occ::handle<StepShape_EdgeCurve> aSecondEdgeCurve = new StepShape_EdgeCurve;
+  aSecondEdgeCurve->Init(new TCollection_HAsciiString,
+                         new StepShape_Vertex,
+                         new StepShape_Vertex,
+                         aCurve2,
+                         true);
+  addToModel(aSecondEdgeCurve);
+
+  // Performing removal of duplicate curves.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateCurves();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal curves are merged for StepShape_EdgeCurve and StepGeom_TrimmedCurve.
+TEST_F(StepTidy_BSplineCurveWithKnotsReducerTest, EqualCurves)
+{
+  // Creating curves.
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve1 = addBSplineCurve();
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve2 = addBSplineCurve();
+
+  // Creating EdgeCurve containing the first curve.
+  occ::handle<StepShape_EdgeCurve> anEdgeCurve = new StepShape_EdgeCurve;
+  anEdgeCurve->Init(new TCollection_HAsciiString,
+                    new StepShape_Vertex,
+                    new StepShape_Vertex,
+                    aCurve1,
+                    true);
+  addToModel(anEdgeCurve);
+
+  // Creating TrimmedCurve containing the second curve.
+  occ::handle<StepGeom_TrimmedCurve> aTrimmedCurve = new StepGeom_TrimmedCurve;
+  aTrimmedCurve->Init(new TCollection_HAsciiString,
+                      aCurve2,
+                      new NCollection_HArray1<StepGeom_TrimmingSelect>,
+                      new NCollection_HArray1<StepGeom_TrimmingSelect>,
+                      true,
+                      StepGeom_tpUnspecified);
+  addToModel(aTrimmedCurve);
+
+  // Performing removal of duplicate curves.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateCurves();
+
+  // Check that one curve was removed and both sharings refer to the same curve.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(anEdgeCurve->EdgeGeometry(), aTrimmedCurve->BasisCurve());
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_BSplineSurfaceWithKnotsReducer.pxx>
+
+#include <StepShape_AdvancedFace.hxx>
+#include <StepShape_FaceBound.hxx>
+
+class StepTidy_BSplineSurfaceWithKnotsReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateSurfaces()
+  {
+    StepTidy_BSplineSurfaceWithKnotsReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an advanced face with the surface to the model.
+  occ::handle<StepShape_AdvancedFace> addFace(const occ::handle<StepGeom_Surface>& theSurface) const
+  {
+    occ::handle<StepShape_AdvancedFace> aFace = new StepShape_AdvancedFace;
+    aFace->Init(new TCollection_HAsciiString,
+                new NCollection_HArray1<occ::handle<StepShape_FaceBound>>,
+                theSurface,
+                true);
+    addToModel(aFace);
+    return aFace;
+  }
+};
+
+// Check that surfaces with different names are not merged.
+TEST_F(StepTidy_BSplineSurfaceWithKnotsReducerTest, DifferentNames)
+{
+  addFace(addBSplineSurface("Surface1"));
+  addFace(addBSplineSurface("Surface2"));
+
+  // Performing removal of duplicate surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateSurfaces();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that surfaces with different control points are not merged.
+TEST_F(StepTidy_BSplineSurfaceWithKnotsReducerTest, DifferentControlPoints)
+{
+  addFace(addBSplineSurface(nullptr, 0.));
+  addFace(addBSplineSurface(nullptr, 1.));
+
+  // Performing removal of duplicate surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateSurfaces();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal surfaces are merged for StepShape_AdvancedFace.
+TEST_F(StepTidy_BSplineSurfaceWithKnotsReducerTest, StepShape_AdvancedFace)
+{
+  occ::handle<StepShape_AdvancedFace> aFace1 = addFace(addBSplineSurface());
+  occ::handle<StepShape_AdvancedFace> aFace2 = addFace(addBSplineSurface());
+
+  // Performing removal of duplicate surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateSurfaces();
+
+  // Check that one surface was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(aFace1->FaceGeometry(), aFace2->FaceGeometry());
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_ColourRgbReducer.pxx>
+
+#include <StepVisual_FillAreaStyleColour.hxx>
+#include <StepVisual_SurfaceStyleRendering.hxx>
+
+class StepTidy_ColourRgbReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateColours()
+  {
+    StepTidy_ColourRgbReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+};
+
+// Check that colours with different components are not merged.
+TEST_F(StepTidy_ColourRgbReducerTest, DifferentComponents)
+{
+  occ::handle<StepVisual_FillAreaStyleColour> aFillColour1 = new StepVisual_FillAreaStyleColour;
+  aFillColour1->Init(new TCollection_HAsciiString, addColourRgb(nullptr, gp_XYZ(1., 0., 0.)));
+  addToModel(aFillColour1);
+  occ::handle<StepVisual_FillAreaStyleColour> aFillColour2 = new StepVisual_FillAreaStyleColour;
+  aFillColour2->Init(new TCollection_HAsciiString, addColourRgb(nullptr, gp_XYZ(0., 1., 0.)));
+  addToModel(aFillColour2);
+
+  // Performing removal of duplicate colours.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateColours();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal colours are merged for StepVisual_FillAreaStyleColour
+// and StepVisual_SurfaceStyleRendering.
+TEST_F(StepTidy_ColourRgbReducerTest, EqualColours)
+{
+  occ::handle<StepVisual_FillAreaStyleColour> aFillColour = new StepVisual_FillAreaStyleColour;
+  aFillColour->Init(new TCollection_HAsciiString, addColourRgb());
+  addToModel(aFillColour);
+  occ::handle<StepVisual_SurfaceStyleRendering> aRendering = new StepVisual_SurfaceStyleRendering;
+  aRendering->Init(StepVisual_ssmNormalShading, addColourRgb());
+  addToModel(aRendering);
+
+  // Performing removal of duplicate colours.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateColours();
+
+  // Check that one colour was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(aFillColour->FillColour(), aRendering->SurfaceColour());
+}
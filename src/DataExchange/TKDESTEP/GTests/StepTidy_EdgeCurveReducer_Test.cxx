@@ -0,0 +1,90 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_EdgeCurveReducer.pxx>
+
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_OrientedEdge.hxx>
+
+class StepTidy_EdgeCurveReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateEdges()
+  {
+    StepTidy_EdgeCurveReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an oriented edge with the edge to the model.
+  occ::handle<StepShape_OrientedEdge> addOrientedEdge(
+    const occ::handle<StepShape_Edge>& theEdge) const
+  {
+    occ::handle<StepShape_OrientedEdge> anOrientedEdge = new StepShape_OrientedEdge;
+    anOrientedEdge->Init(new TCollection_HAsciiString, theEdge, true);
+    addToModel(anOrientedEdge);
+    return anOrientedEdge;
+  }
+};
+
+// Check that edges with different curves are not merged.
+TEST_F(StepTidy_EdgeCurveReducerTest, DifferentCurves)
+{
+  occ::handle<StepShape_VertexPoint> aStart = addVertexPoint(nullptr, gp_XYZ(0., 0., 0.));
+  occ::handle<StepShape_VertexPoint> anEnd  = addVertexPoint(nullptr, gp_XYZ(0., 0., 1.));
+
+  // Creating edges with equal but different instances of lines.
+  occ::handle<StepShape_EdgeCurve> anEdge1 = new StepShape_EdgeCurve;
+  anEdge1->Init(new TCollection_HAsciiString, aStart, anEnd, addLine(), true);
+  addOrientedEdge(anEdge1);
+  occ::handle<StepShape_EdgeCurve> anEdge2 = new StepShape_EdgeCurve;
+  anEdge2->Init(new TCollection_HAsciiString, aStart, anEnd, addLine(), true);
+  addOrientedEdge(anEdge2);
+
+  // Performing removal of duplicate edges.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateEdges();
+
+  // Check that nothing was removed: edges are compared by instances of their curves.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that edges with the same vertices and curve are merged for StepShape_OrientedEdge.
+TEST_F(StepTidy_EdgeCurveReducerTest, StepShape_OrientedEdge)
+{
+  occ::handle<StepShape_VertexPoint> aStart = addVertexPoint(nullptr, gp_XYZ(0., 0., 0.));
+  occ::handle<StepShape_VertexPoint> anEnd  = addVertexPoint(nullptr, gp_XYZ(0., 0., 1.));
+  occ::handle<StepGeom_Line>         aLine  = addLine();
+
+  occ::handle<StepShape_EdgeCurve> anEdge1 = new StepShape_EdgeCurve;
+  anEdge1->Init(new TCollection_HAsciiString, aStart, anEnd, aLine, true);
+  occ::handle<StepShape_OrientedEdge> anOrientedEdge1 = addOrientedEdge(anEdge1);
+  occ::handle<StepShape_EdgeCurve>    anEdge2         = new StepShape_EdgeCurve;
+  anEdge2->Init(new TCollection_HAsciiString, aStart, anEnd, aLine, true);
+  occ::handle<StepShape_OrientedEdge> anOrientedEdge2 = addOrientedEdge(anEdge2);
+
+  // Performing removal of duplicate edges.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateEdges();
+
+  // Check that one edge was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(anOrientedEdge1->EdgeElement(), anOrientedEdge2->EdgeElement());
+}
@@ -16,6 +16,9 @@
 #include <StepTidy_DuplicateCleaner.hxx>
 
 #include <StepGeom_Axis1Placement.hxx>
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_EdgeLoop.hxx>
+#include <StepShape_OrientedEdge.hxx>
 
 class StepTidy_DuplicateCleanerTest : public StepTidy_BaseTestFixture
 {
@@ -37,11 +40,34 @@ protected:
   }
 
   //! Perform removal of duplicate entities points.
-  void performRemoval()
+  void performRemoval(const bool theToRunParallel = true)
   {
     StepTidy_DuplicateCleaner aMerger(myWS);
+    aMerger.SetRunParallel(theToRunParallel);
     aMerger.Perform();
   }
+
+  //! Add an edge loop of two equal edges, each one built from its own entities.
+  void addDuplicateEdges()
+  {
+    occ::handle<NCollection_HArray1<occ::handle<StepShape_OrientedEdge>>> anOrientedEdges =
+      new NCollection_HArray1<occ::handle<StepShape_OrientedEdge>>(1, 2);
+    for (int anIndex = 1; anIndex <= 2; ++anIndex)
+    {
+      occ::handle<StepShape_EdgeCurve> anEdge = new StepShape_EdgeCurve;
+      anEdge->Init(new TCollection_HAsciiString,
+                   addVertexPoint(nullptr, gp_XYZ(0., 0., 0.)),
+                   addVertexPoint(nullptr, gp_XYZ(0., 0., 1.)),
+                   addLine(),
+                   true);
+      occ::handle<StepShape_OrientedEdge> anOrientedEdge = new StepShape_OrientedEdge;
+      anOrientedEdge->Init(new TCollection_HAsciiString, anEdge, true);
+      anOrientedEdges->SetValue(anIndex, anOrientedEdge);
+    }
+    occ::handle<StepShape_EdgeLoop> aLoop = new StepShape_EdgeLoop;
+    aLoop->Init(new TCollection_HAsciiString, anOrientedEdges);
+    addToModel(aLoop);
+  }
 };
 
 // Check that entities with the same coordinates and different names are not merged.
@@ -111,3 +137,36 @@ TEST_F(StepTidy_DuplicateCleanerTest, EqualEntities)
   EXPECT_EQ(aDirectionCountBefore, 2);
   EXPECT_EQ(aDirectionCountAfter, 1);
 }
+
+// Check that topological entities are merged after the geometry they refer to.
+TEST_F(StepTidy_DuplicateCleanerTest, TopologicalEntities)
+{
+  addDuplicateEdges();
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_VertexPoint)), 4);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_EdgeCurve)), 2);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_OrientedEdge)), 2);
+
+  // Performing removal of duplicate entities.
+  performRemoval();
+
+  // Check that vertices, edges and oriented edges were merged.
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_VertexPoint)), 2);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_EdgeCurve)), 1);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_OrientedEdge)), 1);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepGeom_Line)), 1);
+}
+
+// Check that sequential processing gives the same result as parallel one.
+TEST_F(StepTidy_DuplicateCleanerTest, TopologicalEntities_Sequential)
+{
+  addDuplicateEdges();
+
+  // Performing removal of duplicate entities in a single thread.
+  performRemoval(false);
+
+  // Check that vertices, edges and oriented edges were merged.
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_VertexPoint)), 2);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_EdgeCurve)), 1);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepShape_OrientedEdge)), 1);
+  EXPECT_EQ(getEntitiesCount(STANDARD_TYPE(StepGeom_Line)), 1);
+}
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_OrientedEdgeReducer.pxx>
+
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_EdgeLoop.hxx>
+#include <StepShape_OrientedEdge.hxx>
+
+class StepTidy_OrientedEdgeReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateEdges()
+  {
+    StepTidy_OrientedEdgeReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an edge loop with the oriented edges to the model.
+  occ::handle<StepShape_EdgeLoop> addLoop(const occ::handle<StepShape_OrientedEdge>& theEdge1,
+                                          const occ::handle<StepShape_OrientedEdge>& theEdge2) const
+  {
+    occ::handle<NCollection_HArray1<occ::handle<StepShape_OrientedEdge>>> anEdges =
+      new NCollection_HArray1<occ::handle<StepShape_OrientedEdge>>(1, 2);
+    anEdges->SetValue(1, theEdge1);
+    anEdges->SetValue(2, theEdge2);
+    occ::handle<StepShape_EdgeLoop> aLoop = new StepShape_EdgeLoop;
+    aLoop->Init(new TCollection_HAsciiString, anEdges);
+    addToModel(aLoop);
+    return aLoop;
+  }
+
+  //! Creates an edge curve.
+  occ::handle<StepShape_EdgeCurve> makeEdge() const
+  {
+    occ::handle<StepShape_EdgeCurve> anEdge = new StepShape_EdgeCurve;
+    anEdge->Init(new TCollection_HAsciiString,
+                 addVertexPoint(nullptr, gp_XYZ(0., 0., 0.)),
+                 addVertexPoint(nullptr, gp_XYZ(0., 0., 1.)),
+                 addLine(),
+                 true);
+    return anEdge;
+  }
+
+  //! Creates an oriented edge.
+  static occ::handle<StepShape_OrientedEdge> makeOrientedEdge(
+    const occ::handle<StepShape_Edge>& theEdge,
+    const bool                         theOrientation)
+  {
+    occ::handle<StepShape_OrientedEdge> anOrientedEdge = new StepShape_OrientedEdge;
+    anOrientedEdge->Init(new TCollection_HAsciiString, theEdge, theOrientation);
+    return anOrientedEdge;
+  }
+};
+
+// Check that oriented edges with different orientations are not merged.
+TEST_F(StepTidy_OrientedEdgeReducerTest, DifferentOrientations)
+{
+  occ::handle<StepShape_EdgeCurve> anEdge = makeEdge();
+  addLoop(makeOrientedEdge(anEdge, true), makeOrientedEdge(anEdge, false));
+
+  // Performing removal of duplicate oriented edges.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateEdges();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal oriented edges are merged for StepShape_EdgeLoop.
+TEST_F(StepTidy_OrientedEdgeReducerTest, StepShape_EdgeLoop)
+{
+  // Loops share the edge and contain other edges as well.
+  occ::handle<StepShape_EdgeCurve> anEdge = makeEdge();
+  occ::handle<StepShape_EdgeLoop>  aLoop1 =
+    addLoop(makeOrientedEdge(anEdge, true), makeOrientedEdge(makeEdge(), true));
+  occ::handle<StepShape_EdgeLoop> aLoop2 =
+    addLoop(makeOrientedEdge(anEdge, true), makeOrientedEdge(makeEdge(), true));
+
+  // Performing removal of duplicate oriented edges.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateEdges();
+
+  // Check that one oriented edge was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(aLoop1->EdgeListValue(1), aLoop2->EdgeListValue(1));
+}
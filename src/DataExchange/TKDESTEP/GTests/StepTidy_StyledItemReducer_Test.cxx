@@ -0,0 +1,117 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_StyledItemReducer.pxx>
+
+#include <StepRepr_RepresentationContext.hxx>
+#include <StepVisual_MechanicalDesignGeometricPresentationRepresentation.hxx>
+#include <StepVisual_OverRidingStyledItem.hxx>
+#include <StepVisual_PresentationStyleAssignment.hxx>
+
+class StepTidy_StyledItemReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateStyledItems()
+  {
+    StepTidy_StyledItemReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add a presentation representation with the styled items to the model.
+  occ::handle<StepVisual_MechanicalDesignGeometricPresentationRepresentation> addPresentation(
+    const occ::handle<StepVisual_StyledItem>& theItem1,
+    const occ::handle<StepVisual_StyledItem>& theItem2) const
+  {
+    occ::handle<NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>> anItems =
+      new NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>(1, 2);
+    anItems->SetValue(1, theItem1);
+    anItems->SetValue(2, theItem2);
+    occ::handle<StepVisual_MechanicalDesignGeometricPresentationRepresentation> aPresentation =
+      new StepVisual_MechanicalDesignGeometricPresentationRepresentation;
+    aPresentation->Init(new TCollection_HAsciiString, anItems, new StepRepr_RepresentationContext);
+    addToModel(aPresentation);
+    return aPresentation;
+  }
+
+  //! Styles shared by styled items.
+  occ::handle<NCollection_HArray1<occ::handle<StepVisual_PresentationStyleAssignment>>> myStyles =
+    new NCollection_HArray1<occ::handle<StepVisual_PresentationStyleAssignment>>(
+      1,
+      1,
+      new StepVisual_PresentationStyleAssignment);
+};
+
+// Check that styled items of different items are not merged.
+TEST_F(StepTidy_StyledItemReducerTest, DifferentItems)
+{
+  occ::handle<StepVisual_StyledItem> aStyledItem1 = new StepVisual_StyledItem;
+  aStyledItem1->Init(new TCollection_HAsciiString, myStyles, addLine());
+  occ::handle<StepVisual_StyledItem> aStyledItem2 = new StepVisual_StyledItem;
+  aStyledItem2->Init(new TCollection_HAsciiString, myStyles, addLine());
+  addPresentation(aStyledItem1, aStyledItem2);
+
+  // Performing removal of duplicate styled items.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateStyledItems();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that styled items of different types are not merged.
+TEST_F(StepTidy_StyledItemReducerTest, DifferentTypes)
+{
+  occ::handle<StepGeom_Line>         aLine        = addLine();
+  occ::handle<StepVisual_StyledItem> aStyledItem1 = new StepVisual_StyledItem;
+  aStyledItem1->Init(new TCollection_HAsciiString, myStyles, aLine);
+  occ::handle<StepVisual_StyledItem> anOverriddenItem = new StepVisual_StyledItem;
+  anOverriddenItem->Init(new TCollection_HAsciiString, myStyles, addLine());
+  occ::handle<StepVisual_OverRidingStyledItem> aStyledItem2 = new StepVisual_OverRidingStyledItem;
+  aStyledItem2->Init(new TCollection_HAsciiString, myStyles, aLine, anOverriddenItem);
+  addPresentation(aStyledItem1, aStyledItem2);
+
+  // Performing removal of duplicate styled items.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateStyledItems();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal styled items are merged for presentation representations.
+TEST_F(StepTidy_StyledItemReducerTest, EqualStyledItems)
+{
+  occ::handle<StepGeom_Line>         aLine        = addLine();
+  occ::handle<StepVisual_StyledItem> aStyledItem1 = new StepVisual_StyledItem;
+  aStyledItem1->Init(new TCollection_HAsciiString, myStyles, aLine);
+  occ::handle<StepVisual_StyledItem> aStyledItem2 = new StepVisual_StyledItem;
+  aStyledItem2->Init(new TCollection_HAsciiString, myStyles, aLine);
+  occ::handle<StepVisual_MechanicalDesignGeometricPresentationRepresentation> aPresentation =
+    addPresentation(aStyledItem1, aStyledItem2);
+
+  // Performing removal of duplicate styled items.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateStyledItems();
+
+  // Check that one styled item was removed and the presentation refers to the other one once.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  ASSERT_EQ(aPresentation->NbItems(), 1);
+  EXPECT_FALSE(aRemovedEntities.Contains(aPresentation->ItemsValue(1)));
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_VertexPointReducer.pxx>
+
+#include <StepShape_EdgeCurve.hxx>
+
+class StepTidy_VertexPointReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateVertices()
+  {
+    StepTidy_VertexPointReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an edge between the vertices to the model.
+  occ::handle<StepShape_EdgeCurve> addEdge(const occ::handle<StepShape_Vertex>& theStart,
+                                           const occ::handle<StepShape_Vertex>& theEnd) const
+  {
+    occ::handle<StepShape_EdgeCurve> anEdge = new StepShape_EdgeCurve;
+    anEdge->Init(new TCollection_HAsciiString, theStart, theEnd, addLine(), true);
+    addToModel(anEdge);
+    return anEdge;
+  }
+};
+
+// Check that vertices with different points are not merged.
+TEST_F(StepTidy_VertexPointReducerTest, DifferentPoints)
+{
+  occ::handle<StepShape_VertexPoint> aVertex1 = addVertexPoint(nullptr, gp_XYZ(0., 0., 0.));
+  occ::handle<StepShape_VertexPoint> aVertex2 = addVertexPoint(nullptr, gp_XYZ(1., 0., 0.));
+  addEdge(aVertex1, aVertex2);
+
+  // Performing removal of duplicate vertices.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateVertices();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that vertices with equal points are merged for StepShape_EdgeCurve.
+TEST_F(StepTidy_VertexPointReducerTest, StepShape_EdgeCurve)
+{
+  // Two edges with coincident end and start vertices.
+  occ::handle<StepShape_VertexPoint> aVertex1 = addVertexPoint(nullptr, gp_XYZ(0., 0., 0.));
+  occ::handle<StepShape_VertexPoint> aVertex2 = addVertexPoint(nullptr, gp_XYZ(1., 0., 0.));
+  occ::handle<StepShape_VertexPoint> aVertex3 = addVertexPoint(nullptr, gp_XYZ(1., 0., 0.));
+  occ::handle<StepShape_VertexPoint> aVertex4 = addVertexPoint(nullptr, gp_XYZ(2., 0., 0.));
+  occ::handle<StepShape_EdgeCurve>   anEdge1  = addEdge(aVertex1, aVertex2);
+  occ::handle<StepShape_EdgeCurve>   anEdge2  = addEdge(aVertex3, aVertex4);
+
+  // Performing removal of duplicate vertices.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities = replaceDuplicateVertices();
+
+  // Check that one vertex was removed and edges share the same vertex.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(anEdge1->EdgeEnd(), anEdge2->EdgeStart());
+}
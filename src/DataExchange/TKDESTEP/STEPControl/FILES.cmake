@@ -11,6 +11,8 @@ set(OCCT_STEPControl_FILES
   STEPControl_Reader.cxx
   STEPControl_Reader.hxx
   STEPControl_StepModelType.hxx
+  STEPControl_StreamWriter.cxx
+  STEPControl_StreamWriter.hxx
   STEPControl_Writer.cxx
   STEPControl_Writer.hxx
 )
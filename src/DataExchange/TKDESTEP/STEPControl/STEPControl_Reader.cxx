@@ -25,6 +25,7 @@
 #include <StepBasic_MeasureWithUnit.hxx>
 #include <StepBasic_NamedUnit.hxx>
 #include <StepBasic_PlaneAngleMeasureWithUnit.hxx>
+#include <StepBasic_Product.hxx>
 #include <StepBasic_ProductDefinitionContext.hxx>
 #include <StepBasic_ProductDefinitionFormation.hxx>
 #include <StepBasic_ProductDefinitionWithAssociatedDocuments.hxx>
@@ -143,6 +144,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadFile(const char* const filename)
   WS()->SetModel(aStepModel);
   WS()->SetLoadedFile(filename);
   WS()->InitTransferReader(4);
+  clearRootProducts();
   return status;
 }
 
@@ -199,6 +201,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadFile(const char* const        file
   WS()->SetModel(aStepModel);
   WS()->SetLoadedFile(filename);
   WS()->InitTransferReader(4);
+  clearRootProducts();
   return status;
 }
 
@@ -255,6 +258,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadStream(const char* const theName,
   WS()->SetModel(aStepModel);
   WS()->SetLoadedFile(theName);
   WS()->InitTransferReader(4);
+  clearRootProducts();
   return status;
 }
 
@@ -312,6 +316,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadStream(const char* const        th
   WS()->SetModel(aStepModel);
   WS()->SetLoadedFile(theName);
   WS()->InitTransferReader(4);
+  clearRootProducts();
   return status;
 }
 
@@ -332,6 +337,21 @@ int STEPControl_Reader::NbRootsForTransfer()
   }
   therootsta = true;
 
+  if (!myRootProducts.IsEmpty())
+  {
+    // selected products are translated with all their components
+    const Interface_Graph& aGraph = WS()->Graph();
+    for (const occ::handle<StepBasic_ProductDefinition>& aProduct : myRootProducts)
+    {
+      if (aGraph.EntityNumber(aProduct) != 0)
+      {
+        theroots.Append(aProduct);
+        WS()->TransferReader()->TransientProcess()->RootsForTransfer()->Append(aProduct);
+      }
+    }
+    return theroots.Length();
+  }
+
   occ::handle<StepData_StepModel> aStepModel = occ::down_cast<StepData_StepModel>(WS()->Model());
   // theroots.Clear();
   int nb = Model()->NbEntities();
@@ -609,6 +629,107 @@ int STEPControl_Reader::NbRootsForTransfer()
 
 //=================================================================================================
 
+NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> STEPControl_Reader::
+  ProductDefinitions(const TCollection_AsciiString& theProductName) const
+{
+  NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> aResult;
+  const occ::handle<Interface_InterfaceModel>                    aModel = Model();
+  if (aModel.IsNull())
+  {
+    return aResult;
+  }
+
+  for (int anEntIter = 1; anEntIter <= aModel->NbEntities(); ++anEntIter)
+  {
+    occ::handle<StepBasic_ProductDefinition> aPD =
+      occ::down_cast<StepBasic_ProductDefinition>(aModel->Value(anEntIter));
+    if (aPD.IsNull())
+    {
+      continue;
+    }
+    if (!theProductName.IsEmpty())
+    {
+      occ::handle<StepBasic_Product> aProduct;
+      if (!aPD->Formation().IsNull())
+      {
+        aProduct = aPD->Formation()->OfProduct();
+      }
+      if (aProduct.IsNull())
+      {
+        continue;
+      }
+      const bool isNamed = !aProduct->Name().IsNull()
+                           && aProduct->Name()->String().IsEqual(theProductName);
+      const bool isIdent =
+        !aProduct->Id().IsNull() && aProduct->Id()->String().IsEqual(theProductName);
+      if (!isNamed && !isIdent)
+      {
+        continue;
+      }
+    }
+    aResult.Append(aPD);
+  }
+  return aResult;
+}
+
+//=================================================================================================
+
+NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> STEPControl_Reader::
+  SubProductDefinitions(const occ::handle<StepBasic_ProductDefinition>& theProduct) const
+{
+  NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> aResult;
+  if (theProduct.IsNull() || Model().IsNull())
+  {
+    return aResult;
+  }
+
+  const Interface_Graph& aGraph = WS()->Graph();
+  if (aGraph.EntityNumber(theProduct) == 0)
+  {
+    return aResult;
+  }
+  Interface_EntityIterator aSharings = aGraph.Sharings(theProduct);
+  for (aSharings.Start(); aSharings.More(); aSharings.Next())
+  {
+    occ::handle<StepRepr_NextAssemblyUsageOccurrence> aNAUO =
+      occ::down_cast<StepRepr_NextAssemblyUsageOccurrence>(aSharings.Value());
+    if (!aNAUO.IsNull() && aNAUO->RelatingProductDefinition() == theProduct
+        && !aNAUO->RelatedProductDefinition().IsNull())
+    {
+      aResult.Append(aNAUO->RelatedProductDefinition());
+    }
+  }
+  return aResult;
+}
+
+//=================================================================================================
+
+void STEPControl_Reader::SetRootProducts(
+  const NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>>& theProducts)
+{
+  myRootProducts = theProducts;
+
+  // roots should be recomputed with the new selection
+  therootsta = false;
+  theroots.Clear();
+  if (!WS()->TransferReader().IsNull() && !WS()->TransferReader()->TransientProcess().IsNull())
+  {
+    WS()->TransferReader()->TransientProcess()->RootsForTransfer()->Clear();
+  }
+}
+
+//=================================================================================================
+
+void STEPControl_Reader::clearRootProducts()
+{
+  if (!myRootProducts.IsEmpty())
+  {
+    SetRootProducts(NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>>());
+  }
+}
+
+//=================================================================================================
+
 void STEPControl_Reader::FileUnits(
   NCollection_Sequence<TCollection_AsciiString>& theUnitLengthNames,
   NCollection_Sequence<TCollection_AsciiString>& theUnitAngleNames,
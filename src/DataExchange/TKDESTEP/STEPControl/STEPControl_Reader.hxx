@@ -28,6 +28,7 @@
 #include <NCollection_Sequence.hxx>
 #include <NCollection_Array1.hxx>
 class XSControl_WorkSession;
+class StepBasic_ProductDefinition;
 class StepData_StepModel;
 class StepRepr_RepresentationContext;
 
@@ -111,8 +112,34 @@ public:
 
   //! Determines the list of root entities from Model which are candidate for
   //! a transfer to a Shape (type of entities is PRODUCT)
+  //! If root products are set (see SetRootProducts()), only they are returned.
   Standard_EXPORT int NbRootsForTransfer() override;
 
+  //! Returns product definitions (PRODUCT_DEFINITION) of the model.
+  //! @param[in] theProductName  if not empty, only definitions of products
+  //!                            with this name or identifier are returned
+  Standard_EXPORT NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> ProductDefinitions(
+    const TCollection_AsciiString& theProductName = TCollection_AsciiString()) const;
+
+  //! Returns product definitions used as direct components of the given one,
+  //! i.e. related by NEXT_ASSEMBLY_USAGE_OCCURRENCE entities.
+  Standard_EXPORT NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>>
+    SubProductDefinitions(const occ::handle<StepBasic_ProductDefinition>& theProduct) const;
+
+  //! Restricts the roots for transfer to the given product definitions,
+  //! so that only the selected subassemblies or parts are translated
+  //! (with entities reachable from them).
+  //! Empty sequence restores the default roots of the model.
+  //! The selection is cleared when a new model is loaded by ReadFile() or ReadStream().
+  Standard_EXPORT void SetRootProducts(
+    const NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>>& theProducts);
+
+  //! Returns product definitions selected as roots for transfer.
+  const NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>>& RootProducts() const
+  {
+    return myRootProducts;
+  }
+
   //! Returns sequence of all unit names for shape representations
   //! found in file
   Standard_EXPORT void FileUnits(
@@ -143,6 +170,12 @@ private:
   Standard_EXPORT bool findUnits(const occ::handle<StepRepr_RepresentationContext>& theReprContext,
                                  NCollection_Array1<TCollection_AsciiString>&       theNameUnits,
                                  NCollection_Array1<double>&                        theFactorUnits);
+
+  //! Clears root products selected for the previously loaded model.
+  void clearRootProducts();
+
+private:
+  NCollection_Sequence<occ::handle<StepBasic_ProductDefinition>> myRootProducts;
 };
 
 #endif // _STEPControl_Reader_HeaderFile
@@ -0,0 +1,517 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <STEPControl_StreamWriter.hxx>
+
+#include <APIHeaderSection_MakeHeader.hxx>
+#include <Interface_MSG.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_HArray1.hxx>
+#include <NCollection_HSequence.hxx>
+#include <NCollection_Sequence.hxx>
+#include <OSD_FileSystem.hxx>
+#include <ShapeAnalysis_ShapeTolerance.hxx>
+#include <STEPConstruct_ContextTool.hxx>
+#include <STEPConstruct_Part.hxx>
+#include <STEPConstruct_UnitContext.hxx>
+#include <STEPControl_Controller.hxx>
+#include <STEPEdit.hxx>
+#include <StepBasic_ApplicationProtocolDefinition.hxx>
+#include <StepData_EntitySink.hxx>
+#include <StepData_Factors.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepGeom_Axis2Placement3d.hxx>
+#include <StepGeom_Surface.hxx>
+#include <StepGeom_GeomRepContextAndGlobUnitAssCtxAndGlobUncertaintyAssCtx.hxx>
+#include <StepShape_AdvancedBrepShapeRepresentation.hxx>
+#include <StepShape_AdvancedFace.hxx>
+#include <StepShape_FaceBound.hxx>
+#include <StepShape_BrepWithVoids.hxx>
+#include <StepShape_GeometricCurveSet.hxx>
+#include <StepShape_GeometricallyBoundedWireframeShapeRepresentation.hxx>
+#include <StepShape_ManifoldSolidBrep.hxx>
+#include <StepShape_ManifoldSurfaceShapeRepresentation.hxx>
+#include <StepShape_ShapeDefinitionRepresentation.hxx>
+#include <StepShape_ShellBasedSurfaceModel.hxx>
+#include <StepVisual_TessellatedItem.hxx>
+#include <StepVisual_TessellatedShapeRepresentation.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopoDS_Shell.hxx>
+#include <TopoDS_Solid.hxx>
+#include <TopoDSToStep.hxx>
+#include <TopoDSToStep_MakeBrepWithVoids.hxx>
+#include <TopoDSToStep_MakeGeometricCurveSet.hxx>
+#include <TopoDSToStep_MakeManifoldSolidBrep.hxx>
+#include <TopoDSToStep_MakeShellBasedSurfaceModel.hxx>
+#include <Transfer_FinderProcess.hxx>
+#include <TransferBRep.hxx>
+#include <TransferBRep_ShapeMapper.hxx>
+#include <UnitsMethods.hxx>
+#include <XSAlgo_ShapeProcessor.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! Representation items produced from a single piece of the shape.
+struct PieceItems
+{
+  occ::handle<StepRepr_RepresentationItem> Item;
+  occ::handle<StepRepr_RepresentationItem> TessItem;
+};
+
+//! Splits the shape into pieces translated separately.
+void collectPieces(const TopoDS_Shape& theShape, NCollection_Sequence<TopoDS_Shape>& thePieces)
+{
+  const TopAbs_ShapeEnum aType = theShape.ShapeType();
+  if (aType == TopAbs_COMPOUND || aType == TopAbs_COMPSOLID)
+  {
+    for (TopoDS_Iterator aSubIter(theShape); aSubIter.More(); aSubIter.Next())
+    {
+      collectPieces(aSubIter.Value(), thePieces);
+    }
+  }
+  else if (aType != TopAbs_VERTEX)
+  {
+    thePieces.Append(theShape);
+  }
+}
+
+//! Collects faces, edges and vertices of the piece, which might be shared with other pieces.
+void mapSubShapes(const TopoDS_Shape&                                            thePiece,
+                  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theSubShapes)
+{
+  TopExp::MapShapes(thePiece, TopAbs_FACE, theSubShapes);
+  TopExp::MapShapes(thePiece, TopAbs_EDGE, theSubShapes);
+  TopExp::MapShapes(thePiece, TopAbs_VERTEX, theSubShapes);
+}
+
+//! Collects faces, edges and vertices belonging to more than one piece.
+void collectSharedSubShapes(const NCollection_Sequence<TopoDS_Shape>&               thePieces,
+                            NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>& theShared)
+{
+  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aVisited;
+  for (NCollection_Sequence<TopoDS_Shape>::Iterator aPieceIter(thePieces); aPieceIter.More();
+       aPieceIter.Next())
+  {
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSubShapes;
+    mapSubShapes(aPieceIter.Value(), aSubShapes);
+    for (NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>::Iterator aSubIter(
+           aSubShapes);
+         aSubIter.More();
+         aSubIter.Next())
+    {
+      if (!aVisited.Add(aSubIter.Value()))
+      {
+        theShared.Add(aSubIter.Value());
+      }
+    }
+  }
+}
+
+//! Marks the entity written for the shared sub-shape to remain known to the sink;
+//! bounds and geometry of the face are kept as well, as they are referenced
+//! by the face linking to it from another piece.
+void keepSharedEntity(const occ::handle<Standard_Transient>& theEntity,
+                      StepData_EntitySink&                   theSink)
+{
+  theSink.Keep(theEntity);
+  if (occ::handle<StepShape_AdvancedFace> aFace = occ::down_cast<StepShape_AdvancedFace>(theEntity))
+  {
+    theSink.Keep(aFace->FaceGeometry());
+    if (!aFace->Bounds().IsNull())
+    {
+      for (const occ::handle<StepShape_FaceBound>& aBound : aFace->Bounds()->Array1())
+      {
+        theSink.Keep(aBound);
+      }
+    }
+  }
+}
+
+//! Translates the piece as STEPControl_ActorWrite does in STEPControl_AsIs mode.
+PieceItems translatePiece(const TopoDS_Shape&                        thePiece,
+                          const occ::handle<Transfer_FinderProcess>& theFP,
+                          const StepData_Factors&                    theFactors,
+                          const Message_ProgressRange&               theProgress)
+{
+  PieceItems aResult;
+  switch (thePiece.ShapeType())
+  {
+    case TopAbs_SOLID: {
+      const TopoDS_Solid& aSolid   = TopoDS::Solid(thePiece);
+      int                 nbShells = 0;
+      for (TopoDS_Iterator aSubIter(aSolid); aSubIter.More(); aSubIter.Next())
+      {
+        if (aSubIter.Value().ShapeType() == TopAbs_SHELL)
+        {
+          ++nbShells;
+        }
+      }
+      if (nbShells > 1)
+      {
+        TopoDSToStep_MakeBrepWithVoids aMaker(aSolid, theFP, theFactors, theProgress);
+        if (aMaker.IsDone())
+        {
+          aResult.Item     = aMaker.Value();
+          aResult.TessItem = aMaker.TessellatedValue();
+          return aResult;
+        }
+      }
+      TopoDSToStep_MakeManifoldSolidBrep aMaker(aSolid, theFP, theFactors, theProgress);
+      if (aMaker.IsDone())
+      {
+        aResult.Item     = aMaker.Value();
+        aResult.TessItem = aMaker.TessellatedValue();
+      }
+      break;
+    }
+    case TopAbs_SHELL: {
+      TopoDSToStep_MakeShellBasedSurfaceModel aMaker(TopoDS::Shell(thePiece),
+                                                     theFP,
+                                                     theFactors,
+                                                     theProgress);
+      if (aMaker.IsDone())
+      {
+        aResult.Item     = aMaker.Value();
+        aResult.TessItem = aMaker.TessellatedValue();
+      }
+      break;
+    }
+    case TopAbs_FACE: {
+      TopoDSToStep_MakeShellBasedSurfaceModel aMaker(TopoDS::Face(thePiece),
+                                                     theFP,
+                                                     theFactors,
+                                                     theProgress);
+      if (aMaker.IsDone())
+      {
+        aResult.Item     = aMaker.Value();
+        aResult.TessItem = aMaker.TessellatedValue();
+      }
+      break;
+    }
+    default: {
+      TopoDSToStep_MakeGeometricCurveSet aMaker(thePiece, theFP, theFactors);
+      if (aMaker.IsDone())
+      {
+        aResult.Item = aMaker.Value();
+      }
+      break;
+    }
+  }
+  return aResult;
+}
+
+//! Detaches already written item from its content, so that the content can be released
+//! while the item itself remains referenced (by identifier) from the shape representation.
+void releaseItemContent(const occ::handle<StepRepr_RepresentationItem>& theItem)
+{
+  if (occ::handle<StepShape_ManifoldSolidBrep> aBrep =
+        occ::down_cast<StepShape_ManifoldSolidBrep>(theItem))
+  {
+    aBrep->SetOuter(occ::handle<StepShape_ConnectedFaceSet>());
+    if (occ::handle<StepShape_BrepWithVoids> aBrepWithVoids =
+          occ::down_cast<StepShape_BrepWithVoids>(theItem))
+    {
+      aBrepWithVoids->SetVoids(
+        occ::handle<NCollection_HArray1<occ::handle<StepShape_OrientedClosedShell>>>());
+    }
+  }
+  else if (occ::handle<StepShape_ShellBasedSurfaceModel> aModel =
+             occ::down_cast<StepShape_ShellBasedSurfaceModel>(theItem))
+  {
+    aModel->SetSbsmBoundary(occ::handle<NCollection_HArray1<StepShape_Shell>>());
+  }
+  else if (occ::handle<StepShape_GeometricSet> aSet =
+             occ::down_cast<StepShape_GeometricSet>(theItem))
+  {
+    aSet->SetElements(occ::handle<NCollection_HArray1<StepShape_GeometricSetSelect>>());
+  }
+}
+
+//! Creates the array of representation items.
+occ::handle<NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>> makeItems(
+  const occ::handle<StepRepr_RepresentationItem>&                       theAxis,
+  const NCollection_Sequence<occ::handle<StepRepr_RepresentationItem>>& theItems)
+{
+  const int aNbItems = theItems.Length() + (theAxis.IsNull() ? 0 : 1);
+  occ::handle<NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>> anItems =
+    new NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>(1, aNbItems);
+  int anIndex = 1;
+  if (!theAxis.IsNull())
+  {
+    anItems->SetValue(anIndex++, theAxis);
+  }
+  for (NCollection_Sequence<occ::handle<StepRepr_RepresentationItem>>::Iterator anIter(theItems);
+       anIter.More();
+       anIter.Next())
+  {
+    anItems->SetValue(anIndex++, anIter.Value());
+  }
+  return anItems;
+}
+
+//! Sets non-manifold mode of the model for the lifetime of the object
+//! and restores the previous value on destruction, including stack unwinding.
+class NonmanifoldModeSentry
+{
+public:
+  NonmanifoldModeSentry(const occ::handle<StepData_StepModel>& theModel, const bool theToSet)
+      : myModel(theModel),
+        myPrevValue(theModel->InternalParameters.WriteNonmanifold)
+  {
+    if (theToSet)
+    {
+      myModel->InternalParameters.WriteNonmanifold = true;
+    }
+  }
+
+  ~NonmanifoldModeSentry() { myModel->InternalParameters.WriteNonmanifold = myPrevValue; }
+
+private:
+  NonmanifoldModeSentry(const NonmanifoldModeSentry&)            = delete;
+  NonmanifoldModeSentry& operator=(const NonmanifoldModeSentry&) = delete;
+
+private:
+  occ::handle<StepData_StepModel> myModel;
+  bool                            myPrevValue;
+};
+} // namespace
+
+//=================================================================================================
+
+STEPControl_StreamWriter::STEPControl_StreamWriter()
+    : myTolerance(-1.0),
+      myNbEntities(0),
+      myMaxNbKnown(0)
+{
+  STEPControl_Controller::Init();
+  myModel = STEPEdit::NewModel();
+  myModel->InternalParameters.InitFromStatic();
+}
+
+//=================================================================================================
+
+void STEPControl_StreamWriter::SetParameters(const DESTEP_Parameters& theParams)
+{
+  myModel->InternalParameters = theParams;
+}
+
+//=================================================================================================
+
+IFSelect_ReturnStatus STEPControl_StreamWriter::Write(const TopoDS_Shape&          theShape,
+                                                      const char* const            theFileName,
+                                                      const Message_ProgressRange& theProgress)
+{
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::ostream>      aStream =
+    aFileSystem->OpenOStream(theFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (aStream.get() == nullptr)
+  {
+    return IFSelect_RetFail;
+  }
+  const IFSelect_ReturnStatus aStatus = WriteStream(theShape, *aStream, theProgress);
+  aStream->flush();
+  return aStatus == IFSelect_RetDone && !aStream->good() ? IFSelect_RetFail : aStatus;
+}
+
+//=================================================================================================
+
+IFSelect_ReturnStatus STEPControl_StreamWriter::WriteStream(
+  const TopoDS_Shape&          theShape,
+  Standard_OStream&            theStream,
+  const Message_ProgressRange& theProgress)
+{
+  myNbEntities = 0;
+  myMaxNbKnown = 0;
+  if (theShape.IsNull())
+  {
+    return IFSelect_RetVoid;
+  }
+
+  NCollection_Sequence<TopoDS_Shape> aPieces;
+  collectPieces(theShape, aPieces);
+  if (aPieces.IsEmpty())
+  {
+    return IFSelect_RetVoid;
+  }
+
+  // header, units and product definition as prepared by STEPControl_Writer / STEPControl_ActorWrite
+  if (!myModel->IsInitializedUnit())
+  {
+    XSAlgo_ShapeProcessor::PrepareForTransfer();
+    myModel->SetLocalLengthUnit(UnitsMethods::GetCasCadeLengthUnit());
+  }
+  APIHeaderSection_MakeHeader aHeaderMaker;
+  aHeaderMaker.Apply(myModel);
+
+  const int        anAngleMode = myModel->InternalParameters.AngleUnit;
+  StepData_Factors aFactors;
+  aFactors.InitializeFactors(myModel->WriteLengthUnit() / myModel->LocalLengthUnit(),
+                             (anAngleMode <= 1 ? 1. : M_PI / 180.),
+                             1.);
+
+  STEPConstruct_ContextTool aContext(myModel);
+  aContext.AddAPD(false);
+  aContext.SetLevel(1);
+  STEPConstruct_Part aPart;
+  aPart.MakeSDR(nullptr, aContext.GetProductName(), aContext.GetAPD()->Application(), myModel);
+
+  double aTol = myTolerance;
+  if (aTol <= 0.0 && myModel->InternalParameters.WritePrecisionMode == 2)
+  {
+    aTol = myModel->InternalParameters.WritePrecisionVal;
+  }
+  if (aTol <= 0.0)
+  {
+    ShapeAnalysis_ShapeTolerance aTolAnalyzer;
+    aTol = Interface_MSG::Intervalled(
+      aTolAnalyzer.Tolerance(theShape, myModel->InternalParameters.WritePrecisionMode) * 1.5);
+  }
+  if (aTol == 0.0)
+  {
+    aTol = 1.e-07;
+  }
+  STEPConstruct_UnitContext aUnitContext;
+  aUnitContext.Init(aTol, myModel, aFactors);
+
+  StepData_EntitySink aSink(myModel, theStream);
+  aSink.Begin();
+
+  // sub-shapes shared between pieces are written once: entities translated within one piece
+  // are passed to translation of the next ones through the finder process,
+  // which is looked up by TopoDSToStep in non-manifold mode
+  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aSharedShapes;
+  collectSharedSubShapes(aPieces, aSharedShapes);
+  NCollection_DataMap<TopoDS_Shape, occ::handle<Standard_Transient>, TopTools_ShapeMapHasher>
+             aSharedEntities;
+  NonmanifoldModeSentry aNonmanifoldSentry(myModel, !aSharedShapes.IsEmpty());
+
+  // pieces are written one by one; only top-level items and entities of shared sub-shapes
+  // remain known to the sink
+  NCollection_Sequence<occ::handle<StepRepr_RepresentationItem>> anItems, aTessItems;
+  Message_ProgressScope aPS(theProgress, "Writing STEP pieces", aPieces.Length());
+  for (NCollection_Sequence<TopoDS_Shape>::Iterator aPieceIter(aPieces);
+       aPieceIter.More() && aPS.More();
+       aPieceIter.Next())
+  {
+    occ::handle<Transfer_FinderProcess> aFP = new Transfer_FinderProcess();
+    aFP->SetModel(myModel);
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSubShapes;
+    if (!aSharedShapes.IsEmpty())
+    {
+      mapSubShapes(aPieceIter.Value(), aSubShapes);
+      for (NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>::Iterator aSubIter(
+             aSubShapes);
+           aSubIter.More();
+           aSubIter.Next())
+      {
+        if (const occ::handle<Standard_Transient>* anEntity =
+              aSharedEntities.Seek(aSubIter.Value()))
+        {
+          TopoDSToStep::AddResult(aFP, aSubIter.Value(), *anEntity);
+        }
+      }
+    }
+
+    const PieceItems aPieceItems = translatePiece(aPieceIter.Value(), aFP, aFactors, aPS.Next());
+    if (!aPieceItems.Item.IsNull())
+    {
+      aSink.Add(aPieceItems.Item);
+      aSink.Keep(aPieceItems.Item);
+      anItems.Append(aPieceItems.Item);
+    }
+    if (!aPieceItems.TessItem.IsNull())
+    {
+      aSink.Add(aPieceItems.TessItem);
+      aSink.Keep(aPieceItems.TessItem);
+      aTessItems.Append(aPieceItems.TessItem);
+    }
+    for (NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>::Iterator aSubIter(
+           aSubShapes);
+         aSubIter.More();
+         aSubIter.Next())
+    {
+      const TopoDS_Shape& aSubShape = aSubIter.Value();
+      if (!aSharedShapes.Contains(aSubShape) || aSharedEntities.IsBound(aSubShape))
+      {
+        continue;
+      }
+      const occ::handle<Standard_Transient>& anEntity =
+        aFP->FindTransient(TransferBRep::ShapeMapper(aFP, aSubShape));
+      if (!anEntity.IsNull() && aSink.Ident(anEntity) != 0)
+      {
+        aSharedEntities.Bind(aSubShape, anEntity);
+        keepSharedEntity(anEntity, aSink);
+      }
+    }
+    myMaxNbKnown = std::max(myMaxNbKnown, aSink.NbKnown());
+    aSink.Release();
+    releaseItemContent(aPieceItems.Item);
+  }
+  if (!aPS.More())
+  {
+    aSink.End();
+    return IFSelect_RetStop;
+  }
+  if (anItems.IsEmpty() && aTessItems.IsEmpty())
+  {
+    aSink.End();
+    return IFSelect_RetFail;
+  }
+
+  occ::handle<StepShape_ShapeRepresentation> aShapeRep;
+  if (anItems.Length() != 1)
+  {
+    aShapeRep = new StepShape_ShapeRepresentation();
+  }
+  else if (anItems.First()->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep)))
+  {
+    aShapeRep = new StepShape_AdvancedBrepShapeRepresentation();
+  }
+  else if (anItems.First()->IsKind(STANDARD_TYPE(StepShape_ShellBasedSurfaceModel)))
+  {
+    aShapeRep = new StepShape_ManifoldSurfaceShapeRepresentation();
+  }
+  else
+  {
+    aShapeRep = new StepShape_GeometricallyBoundedWireframeShapeRepresentation();
+  }
+  aShapeRep->SetItems(makeItems(aContext.GetDefaultAxis(), anItems));
+  aShapeRep->SetContextOfItems(aUnitContext.Value());
+  aShapeRep->SetName(new TCollection_HAsciiString(""));
+  aPart.SDRValue()->SetUsedRepresentation(aShapeRep);
+  if (!aTessItems.IsEmpty())
+  {
+    occ::handle<StepShape_ShapeRepresentation> aTessRep =
+      new StepVisual_TessellatedShapeRepresentation();
+    aTessRep->SetItems(makeItems(occ::handle<StepRepr_RepresentationItem>(), aTessItems));
+    aTessRep->SetContextOfItems(aUnitContext.Value());
+    aTessRep->SetName(new TCollection_HAsciiString(""));
+    aSink.Add(aTessRep);
+  }
+
+  aSink.Add(aContext.GetAPD());
+  const occ::handle<NCollection_HSequence<occ::handle<Standard_Transient>>> aRoots =
+    aContext.GetRootsForPart(aPart);
+  for (int aRootIter = 1; aRootIter <= aRoots->Length(); ++aRootIter)
+  {
+    aSink.Add(aRoots->Value(aRootIter));
+  }
+  aSink.Add(aShapeRep);
+  myMaxNbKnown = std::max(myMaxNbKnown, aSink.NbKnown());
+  myNbEntities = aSink.NbWritten();
+  return aSink.End() ? IFSelect_RetDone : IFSelect_RetFail;
+}
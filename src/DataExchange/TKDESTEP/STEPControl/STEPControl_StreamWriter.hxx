@@ -0,0 +1,89 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _STEPControl_StreamWriter_HeaderFile
+#define _STEPControl_StreamWriter_HeaderFile
+
+#include <DESTEP_Parameters.hxx>
+#include <IFSelect_ReturnStatus.hxx>
+#include <Message_ProgressRange.hxx>
+#include <Standard_OStream.hxx>
+
+class StepData_StepModel;
+class TopoDS_Shape;
+
+//! Streaming export of a shape into STEP format with bounded memory consumption.
+//!
+//! Contrary to STEPControl_Writer, the shape is not translated into StepData_StepModel
+//! at once: the shape is split into pieces (solids, shells, faces and wires of nested compounds),
+//! each piece is translated by TopoDSToStep separately and its entities are written
+//! into the output through StepData_EntitySink immediately, then released.
+//! Only the entities shared between pieces (representation context, placement,
+//! the top-level representation items and entities of faces, edges and vertices
+//! shared by several pieces) are kept till the end of the file,
+//! so that peak memory is defined by the largest piece instead of the whole shape.
+//! Shared sub-shapes are written once and referenced from the following pieces,
+//! as done by STEPControl_Writer in non-manifold mode.
+//!
+//! A piece is never split further: a whole solid, shell or face is translated at once,
+//! so that a shape consisting of a single large solid (or shell) consumes as much memory
+//! as with STEPControl_Writer; the benefit comes from shapes made of many pieces.
+//!
+//! The result is a single part whose shape representation lists all pieces,
+//! as written by STEPControl_Writer in STEPControl_AsIs mode without assembly structure.
+//! Shapes are written as is, without shape processing; free vertices are skipped.
+class STEPControl_StreamWriter
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates the writer with default parameters initialized from static ones.
+  Standard_EXPORT STEPControl_StreamWriter();
+
+  //! Returns the model defining the Header Section, units and translation parameters;
+  //! it can be edited before writing but never receives data entities.
+  const occ::handle<StepData_StepModel>& Model() const { return myModel; }
+
+  //! Sets the translation parameters.
+  Standard_EXPORT void SetParameters(const DESTEP_Parameters& theParams);
+
+  //! Sets the uncertainty written into representation context;
+  //! non-positive value (default) means the tolerance defined by parameters or computed.
+  void SetTolerance(const double theTolerance) { myTolerance = theTolerance; }
+
+  //! Translates the shape and writes it into the stream.
+  Standard_EXPORT IFSelect_ReturnStatus
+    WriteStream(const TopoDS_Shape&          theShape,
+                Standard_OStream&            theStream,
+                const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Translates the shape and writes it into the file.
+  Standard_EXPORT IFSelect_ReturnStatus
+    Write(const TopoDS_Shape&          theShape,
+          const char* const            theFileName,
+          const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Returns the number of entities written by the last call.
+  int NbEntities() const { return myNbEntities; }
+
+  //! Returns the peak number of entities remembered by the sink during the last call.
+  int MaxNbKnownEntities() const { return myMaxNbKnown; }
+
+private:
+  occ::handle<StepData_StepModel> myModel;
+  double                          myTolerance;
+  int                             myNbEntities;
+  int                             myMaxNbKnown;
+};
+
+#endif // _STEPControl_StreamWriter_HeaderFile
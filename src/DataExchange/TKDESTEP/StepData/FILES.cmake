@@ -13,6 +13,8 @@ set(OCCT_StepData_FILES
   StepData_ECDescr.hxx
   StepData_EDescr.cxx
   StepData_EDescr.hxx
+  StepData_EntitySink.cxx
+  StepData_EntitySink.hxx
   StepData_EnumTool.cxx
   StepData_EnumTool.hxx
   StepData_ESDescr.cxx
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepData_EntitySink.hxx>
+
+#include <Interface_EntityIterator.hxx>
+#include <Interface_GeneralModule.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
+
+//=================================================================================================
+
+StepData_EntitySink::StepData_EntitySink(const occ::handle<StepData_StepModel>& theModel,
+                                         Standard_OStream&                      theStream)
+    : myModel(theModel),
+      myStream(&theStream),
+      myGeneralLib(theModel->Protocol()),
+      myWriterLib(occ::down_cast<StepData_Protocol>(theModel->Protocol())),
+      myWriter(theModel),
+      myLastIdent(0)
+{
+  myWriter.SetStream(myStream);
+  myWriter.SetEntityIdents(&myIdents);
+}
+
+//=================================================================================================
+
+void StepData_EntitySink::Begin()
+{
+  *myStream << "ISO-10303-21;\n";
+  myWriter.SendModel(occ::down_cast<StepData_Protocol>(myModel->Protocol()), true);
+  myWriter.SendData();
+}
+
+//=================================================================================================
+
+int StepData_EntitySink::Add(const occ::handle<Standard_Transient>& theEntity)
+{
+  if (theEntity.IsNull())
+  {
+    return 0;
+  }
+  if (const int* anIdent = myIdents.Seek(theEntity))
+  {
+    return *anIdent;
+  }
+
+  // identifiers are assigned in the order of discovery (the root first, as AddWithRefs does),
+  // so that references between new entities are resolved whatever the writing order;
+  // the graph is traversed without recursion as face sets may be deeply nested
+  NCollection_DynamicArray<occ::handle<Standard_Transient>> aNewEntities;
+  myIdents.Bind(theEntity, ++myLastIdent);
+  aNewEntities.Append(theEntity);
+  for (size_t anEntIter = 0; anEntIter < aNewEntities.Size(); ++anEntIter)
+  {
+    const occ::handle<Standard_Transient> anEntity = aNewEntities.Value(anEntIter);
+    occ::handle<Interface_GeneralModule>  aModule;
+    int                                   aCaseNum = 0;
+    if (!myGeneralLib.Select(anEntity, aModule, aCaseNum))
+    {
+      continue;
+    }
+    Interface_EntityIterator aShared;
+    aModule->FillSharedCase(aCaseNum, anEntity, aShared);
+    aModule->ListImpliedCase(aCaseNum, anEntity, aShared);
+    for (aShared.Start(); aShared.More(); aShared.Next())
+    {
+      const occ::handle<Standard_Transient>& aRef = aShared.Value();
+      if (!aRef.IsNull() && myIdents.TryBind(aRef, myLastIdent + 1))
+      {
+        ++myLastIdent;
+        aNewEntities.Append(aRef);
+      }
+    }
+  }
+
+  for (size_t anEntIter = 0; anEntIter < aNewEntities.Size(); ++anEntIter)
+  {
+    const occ::handle<Standard_Transient>& anEntity = aNewEntities.Value(anEntIter);
+    myWriter.SendEntity(anEntity, myIdents.Find(anEntity), myWriterLib);
+  }
+  return myIdents.Find(theEntity);
+}
+
+//=================================================================================================
+
+int StepData_EntitySink::Ident(const occ::handle<Standard_Transient>& theEntity) const
+{
+  const int* anIdent = myIdents.Seek(theEntity);
+  return anIdent != nullptr ? *anIdent : 0;
+}
+
+//=================================================================================================
+
+void StepData_EntitySink::Release()
+{
+  NCollection_DataMap<occ::handle<Standard_Transient>, int> aKeptIdents;
+  for (NCollection_Map<occ::handle<Standard_Transient>>::Iterator aKeptIter(myKept);
+       aKeptIter.More();
+       aKeptIter.Next())
+  {
+    if (const int* anIdent = myIdents.Seek(aKeptIter.Key()))
+    {
+      aKeptIdents.Bind(aKeptIter.Key(), *anIdent);
+    }
+  }
+  myIdents.Exchange(aKeptIdents);
+}
+
+//=================================================================================================
+
+bool StepData_EntitySink::End()
+{
+  myWriter.EndSec();
+  myWriter.EndFile();
+  return myWriter.Print(*myStream);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepData_EntitySink_HeaderFile
+#define _StepData_EntitySink_HeaderFile
+
+#include <Interface_CheckIterator.hxx>
+#include <Interface_GeneralLib.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
+#include <StepData_StepWriter.hxx>
+#include <StepData_WriterLib.hxx>
+
+class StepData_StepModel;
+
+//! Sink writing entities of the Data Section into the output stream as soon as they are added,
+//! without recording them in StepData_StepModel and without keeping the file image in memory.
+//!
+//! Identifiers are assigned to entities when they are added; an entity is written together
+//! with all entities referenced by it which have not been written yet.
+//! The sink remembers identifiers of written entities to share them between later entities;
+//! Release() forgets all identifiers except the ones marked by Keep(),
+//! so that memory is bounded by the entities which remain shared.
+//! An entity added again after being forgotten is written once more under a new identifier.
+//!
+//! Usage: Begin(), then Add() for each root entity, Release() between independent pieces, End().
+class StepData_EntitySink
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates the sink.
+  //! @param[in] theModel   model defining the Header Section and the protocol;
+  //!                       its data entities are ignored
+  //! @param[in] theStream  output stream, which should stay alive until End()
+  Standard_EXPORT StepData_EntitySink(const occ::handle<StepData_StepModel>& theModel,
+                                      Standard_OStream&                      theStream);
+
+  //! Returns the writer formatting entities (e.g. to tune its FloatWriter before Begin()).
+  StepData_StepWriter& Writer() { return myWriter; }
+
+  //! Writes the beginning of the file: the Header Section and the start of the Data Section.
+  Standard_EXPORT void Begin();
+
+  //! Writes the entity and all entities referenced by it which are not known to the sink.
+  //! @return identifier of the entity, or 0 for a null entity
+  Standard_EXPORT int Add(const occ::handle<Standard_Transient>& theEntity);
+
+  //! Returns the identifier of a known entity, or 0.
+  Standard_EXPORT int Ident(const occ::handle<Standard_Transient>& theEntity) const;
+
+  //! Marks the entity to remain known after Release().
+  void Keep(const occ::handle<Standard_Transient>& theEntity) { myKept.Add(theEntity); }
+
+  //! Forgets identifiers of written entities except the kept ones.
+  Standard_EXPORT void Release();
+
+  //! Writes the end of the Data Section and the end of the file.
+  //! @return FALSE if the stream is in bad state
+  Standard_EXPORT bool End();
+
+  //! Returns the number of written entities.
+  int NbWritten() const { return myLastIdent; }
+
+  //! Returns the number of entities currently known to the sink.
+  int NbKnown() const { return myIdents.Extent(); }
+
+  //! Returns the check-list filled while writing entities.
+  Interface_CheckIterator CheckList() const { return myWriter.CheckList(); }
+
+private:
+  occ::handle<StepData_StepModel>                           myModel;
+  Standard_OStream*                                         myStream;
+  Interface_GeneralLib                                      myGeneralLib;
+  StepData_WriterLib                                        myWriterLib;
+  StepData_StepWriter                                       myWriter;
+  NCollection_DataMap<occ::handle<Standard_Transient>, int> myIdents;
+  NCollection_Map<occ::handle<Standard_Transient>>          myKept;
+  int                                                       myLastIdent;
+};
+
+#endif // _StepData_EntitySink_HeaderFile
@@ -35,10 +35,16 @@
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_HAsciiString.hxx>
 
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
 #include <cstdio>
 #define StepLong 72
 // StepLong: maximum length of a Step file line
 
+// Number of entities formatted by a single task when sending entities in parallel
+static const int THE_PARALLEL_CHUNK = 1024;
+
 // Literal constants (useful for performance AND MEMORY)
 
 static TCollection_AsciiString textscope(" &SCOPE");
@@ -70,6 +76,9 @@ StepData_StepWriter::StepData_StepWriter(const occ::handle<StepData_StepModel>&
   thecomm                 = false;
   thelevel = theindval = 0;
   theindent            = false;
+  thestream            = nullptr;
+  theidents            = nullptr;
+  therunpar            = true;
   // Floating point format: delegated to FloatWriter
 }
 
@@ -96,6 +105,32 @@ int& StepData_StepWriter::TypeMode()
   return thetypmode;
 }
 
+//  ....                Stream Output                ....
+
+//=================================================================================================
+
+void StepData_StepWriter::SetStream(Standard_OStream* theStream)
+{
+  if (theStream != nullptr)
+  {
+    // lines recorded so far precede the ones to be sent
+    for (int aLineIter = 1; aLineIter <= thefile->Length(); ++aLineIter)
+    {
+      *theStream << thefile->Value(aLineIter)->ToCString() << "\n";
+    }
+    thefile->Clear();
+  }
+  thestream = theStream;
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SetEntityIdents(
+  const NCollection_DataMap<occ::handle<Standard_Transient>, int>* theIdents)
+{
+  theidents = theIdents;
+}
+
 //  ....                Scope Description (BEFORE Sending)               ....
 
 //=================================================================================================
@@ -162,7 +197,7 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
 
   if (!headeronly)
   {
-    thefile->Append(new TCollection_HAsciiString("ISO-10303-21;"));
+    AddLine("ISO-10303-21;");
   }
   SendHeader();
 
@@ -250,24 +285,86 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
   //  ....                Output Entities one by one                ....
 
   int nb = themodel->NbEntities();
-  for (int i = 1; i <= nb; i++)
+  if (therunpar && thescopebeg.IsNull() && nb >= 2 * THE_PARALLEL_CHUNK)
   {
-    //    Main list: we don't send Entities that are in a Scope
-    //    They will be sent through the Scope that contains them
-    if (!thescopebeg.IsNull())
+    SendEntitiesParallel(lib);
+  }
+  else
+  {
+    for (int i = 1; i <= nb; i++)
     {
-      if (thescopenext->Value(i) != 0)
+      //    Main list: we don't send Entities that are in a Scope
+      //    They will be sent through the Scope that contains them
+      if (!thescopebeg.IsNull())
       {
-        continue;
+        if (thescopenext->Value(i) != 0)
+        {
+          continue;
+        }
       }
+      SendEntity(i, lib);
     }
-    SendEntity(i, lib);
   }
 
   EndSec();
   EndFile();
 }
 
+//=================================================================================================
+
+void StepData_StepWriter::SendEntitiesParallel(const StepData_WriterLib& lib)
+{
+  // Entities are formatted by chunks, each one by its own writer into its own lines;
+  // chunks are processed by batches, so that lines of a single batch only are kept at once
+  // in stream mode. Formatting depends on nothing but the entity (current line is empty
+  // between entities), hence the result is the same as when sending entities one by one.
+  const int nb        = themodel->NbEntities();
+  const int aNbChunks = (nb + THE_PARALLEL_CHUNK - 1) / THE_PARALLEL_CHUNK;
+  const int aBatch    = std::max(OSD_Parallel::NbLogicalProcessors(), 1) * 4;
+  NewLine(false);
+  for (int aBatchLower = 0; aBatchLower < aNbChunks; aBatchLower += aBatch)
+  {
+    const int aBatchUpper = std::min(aBatchLower + aBatch, aNbChunks) - 1;
+    NCollection_Array1<occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>>>
+                                                 aLines(aBatchLower, aBatchUpper);
+    NCollection_Array1<Interface_CheckIterator> aChecks(aBatchLower, aBatchUpper);
+    OSD_Parallel::For(aBatchLower, aBatchUpper + 1, [&](const int theChunk) {
+      StepData_StepWriter aWriter(themodel);
+      aWriter.thelabmode = thelabmode;
+      aWriter.thetypmode = thetypmode;
+      aWriter.thefloatw  = thefloatw;
+      aWriter.theindent  = theindent;
+      aWriter.thesect    = true;
+      const int aLower   = theChunk * THE_PARALLEL_CHUNK + 1;
+      const int anUpper  = std::min(aLower + THE_PARALLEL_CHUNK - 1, nb);
+      for (int i = aLower; i <= anUpper; i++)
+      {
+        aWriter.SendEntity(i, lib);
+      }
+      aWriter.NewLine(false);
+      aLines.ChangeValue(theChunk)  = aWriter.thefile;
+      aChecks.ChangeValue(theChunk) = aWriter.thechecks;
+    });
+    for (int aChunk = aBatchLower; aChunk <= aBatchUpper; aChunk++)
+    {
+      const occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>>& aChunkLines =
+        aLines.Value(aChunk);
+      if (thestream == nullptr)
+      {
+        thefile->Append(aChunkLines->ChangeSequence());
+      }
+      else
+      {
+        for (int aLineIter = 1; aLineIter <= aChunkLines->Length(); ++aLineIter)
+        {
+          *thestream << aChunkLines->Value(aLineIter)->ToCString() << "\n";
+        }
+      }
+      thechecks.Merge(aChecks.ChangeValue(aChunk));
+    }
+  }
+}
+
 //  ....                FILE DIVISION INTO SECTIONS                ....
 
 //=================================================================================================
@@ -275,7 +372,7 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
 void StepData_StepWriter::SendHeader()
 {
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("HEADER;"));
+  AddLine("HEADER;");
   thesect = true;
 }
 
@@ -288,7 +385,7 @@ void StepData_StepWriter::SendData()
     throw Interface_InterfaceMismatch("StepWriter : Data section");
   }
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("DATA;"));
+  AddLine("DATA;");
   thesect = true;
 }
 
@@ -296,7 +393,7 @@ void StepData_StepWriter::SendData()
 
 void StepData_StepWriter::EndSec()
 {
-  thefile->Append(new TCollection_HAsciiString("ENDSEC;"));
+  AddLine("ENDSEC;");
   thesect = false;
 }
 
@@ -309,7 +406,7 @@ void StepData_StepWriter::EndFile()
     throw Interface_InterfaceMismatch("StepWriter : EndFile");
   }
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("END-ISO-10303-21;"));
+  AddLine("END-ISO-10303-21;");
   thesect = false;
 }
 
@@ -370,8 +467,6 @@ void StepData_StepWriter::SendEntity(const int num, const StepData_WriterLib& li
 
   //   Write Entity via Lib
   thenum = num;
-  occ::handle<StepData_ReadWriteModule> module;
-  int                                   CN;
   if (themodel->IsRedefinedContent(num))
   {
     //    Error Entity: Write the Content + Errors as Comments
@@ -411,10 +506,37 @@ void StepData_StepWriter::SendEntity(const int num, const StepData_WriterLib& li
     }
     Comment(false);
     NewLine(false);
-
+  }
+  else
+  {
     //    Normal case
+    SendContent(anent, lib);
   }
-  else if (lib.Select(anent, module, CN))
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SendEntity(const occ::handle<Standard_Transient>& theEntity,
+                                     const int                              theIdent,
+                                     const StepData_WriterLib&              theLib)
+{
+  char anIdent[20];
+  Sprintf(anIdent, "#%d = ", theIdent);
+  thecurr.Clear();
+  thecurr.Add(anIdent);
+  themult = false;
+  thenum  = theIdent;
+  SendContent(theEntity, theLib);
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SendContent(const occ::handle<Standard_Transient>& anent,
+                                      const StepData_WriterLib&              lib)
+{
+  occ::handle<StepData_ReadWriteModule> module;
+  int                                   CN;
+  if (lib.Select(anent, module, CN))
   {
     if (module->IsComplex(CN))
     {
@@ -472,7 +594,7 @@ void StepData_StepWriter::NewLine(const bool evenempty)
 {
   if (evenempty || thecurr.Length() > 0)
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
   }
   int indst = thelevel * 2;
   if (theindent)
@@ -524,7 +646,7 @@ void StepData_StepWriter::SendScope()
 void StepData_StepWriter::SendEndscope()
 {
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString(textendscope));
+  AddLine(textendscope);
 }
 
 //=================================================================================================
@@ -932,7 +1054,7 @@ void StepData_StepWriter::Send(const TCollection_AsciiString& val)
   }
   else
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     int anIndst = thelevel * 2;
     if (theindent)
     {
@@ -986,7 +1108,7 @@ void StepData_StepWriter::Send(const TCollection_AsciiString& val)
           }
         }
         TCollection_AsciiString aBval = aVal.Split(aStop);
-        thefile->Append(new TCollection_HAsciiString(aVal));
+        AddLine(aVal);
         aVal = aBval;
         aNn -= aStop;
       }
@@ -1010,7 +1132,15 @@ void StepData_StepWriter::Send(const occ::handle<Standard_Transient>& val)
     Comment(false);
     return;
   }
-  int num = themodel->Number(val);
+  int num = 0;
+  if (theidents == nullptr)
+  {
+    num = themodel->Number(val);
+  }
+  else if (const int* anIdent = theidents->Seek(val))
+  {
+    num = *anIdent;
+  }
   //  String? (if not listed in the Model)
   if (num == 0)
   {
@@ -1223,7 +1353,7 @@ void StepData_StepWriter::AddString(const TCollection_AsciiString& astr, const i
 {
   while (!thecurr.CanGet(astr.Length() + more))
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     int indst = thelevel * 2;
     if (theindent)
     {
@@ -1240,7 +1370,7 @@ void StepData_StepWriter::AddString(const char* const astr, const int lnstr, con
 {
   while (!thecurr.CanGet(lnstr + more))
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     int indst = thelevel * 2;
     if (theindent)
     {
@@ -1251,6 +1381,33 @@ void StepData_StepWriter::AddString(const char* const astr, const int lnstr, con
   thecurr.Add(astr, lnstr);
 }
 
+//=================================================================================================
+
+void StepData_StepWriter::FlushLine()
+{
+  if (thestream == nullptr)
+  {
+    thefile->Append(thecurr.Moved());
+    return;
+  }
+  // stream mode: the line is written at once and is not kept
+  TCollection_AsciiString aLine;
+  thecurr.Move(aLine);
+  *thestream << aLine.ToCString() << "\n";
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::AddLine(const TCollection_AsciiString& theLine)
+{
+  if (thestream == nullptr)
+  {
+    thefile->Append(new TCollection_HAsciiString(theLine));
+    return;
+  }
+  *thestream << theLine.ToCString() << "\n";
+}
+
 //   FINAL SENDING
 
 //=================================================================================================
@@ -1278,6 +1435,11 @@ occ::handle<TCollection_HAsciiString> StepData_StepWriter::Line(const int num) c
 
 bool StepData_StepWriter::Print(Standard_OStream& S)
 {
+  if (thestream != nullptr && thestream != &S)
+  {
+    // lines have been already sent to another stream
+    return false;
+  }
   bool isGood = (S.good());
   int  nb     = thefile->Length();
   for (int i = 1; i <= nb && isGood; i++)
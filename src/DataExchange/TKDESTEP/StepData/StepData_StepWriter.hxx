@@ -24,6 +24,7 @@
 #include <TCollection_HAsciiString.hxx>
 #include <NCollection_Sequence.hxx>
 #include <NCollection_HSequence.hxx>
+#include <NCollection_DataMap.hxx>
 #include <Interface_LineBuffer.hxx>
 #include <Standard_Integer.hxx>
 #include <Interface_FloatWriter.hxx>
@@ -78,6 +79,30 @@ public:
   //! because it is returned as the address of its field
   Standard_EXPORT Interface_FloatWriter& FloatWriter();
 
+  //! Sets the stream receiving each line as soon as it is completed,
+  //! instead of keeping lines in memory until Print(); lines recorded
+  //! before the call are written at once. NULL restores the default mode.
+  //! The stream should stay alive while entities are sent.
+  Standard_EXPORT void SetStream(Standard_OStream* theStream);
+
+  //! Returns the stream set by SetStream(), or NULL.
+  Standard_OStream* Stream() const { return thestream; }
+
+  //! Sets the flag to format entities of the Data Section in parallel threads
+  //! within SendModel() (the text is the same); TRUE by default.
+  //! Entities are sent one by one anyway if Scopes are defined or the Model is small.
+  void SetRunParallel(const bool theToRunParallel) { therunpar = theToRunParallel; }
+
+  //! Returns TRUE if entities of the Data Section are formatted in parallel threads.
+  bool IsRunParallel() const { return therunpar; }
+
+  //! Sets the map of entity identifiers to be used for references
+  //! instead of the numbering of the Model (for entities which are
+  //! not recorded in the Model, see SendEntity() with identifier).
+  //! NULL restores the numbering of the Model. The map is not copied.
+  Standard_EXPORT void SetEntityIdents(
+    const NCollection_DataMap<occ::handle<Standard_Transient>, int>* theIdents);
+
   //! Declares the Entity Number <numscope> to correspond to a Scope
   //! which contains the Entity Number <numin>. Several calls to the
   //! same <numscope> add Entities in this Scope, in this order.
@@ -107,6 +132,13 @@ public:
   //! Scope, also Sends the Scope information and contained Items
   Standard_EXPORT void SendEntity(const int nument, const StepData_WriterLib& lib);
 
+  //! Sends an Entity of the Data Section which is not recorded in the
+  //! Model, under the given identifier. Referenced entities are sent
+  //! with identifiers from the map given to SetEntityIdents().
+  Standard_EXPORT void SendEntity(const occ::handle<Standard_Transient>& theEntity,
+                                  const int                              theIdent,
+                                  const StepData_WriterLib&              theLib);
+
   //! sets end of section; to be done before passing to next one
   Standard_EXPORT void EndSec();
 
@@ -260,14 +292,15 @@ public:
   //! references
   Standard_EXPORT Interface_CheckIterator CheckList() const;
 
-  //! Returns count of Lines
+  //! Returns count of Lines (kept in memory, see SetStream())
   Standard_EXPORT int NbLines() const;
 
   //! Returns a Line given its rank in the File
   Standard_EXPORT occ::handle<TCollection_HAsciiString> Line(const int num) const;
 
   //! writes result on an output defined as an OStream
-  //! then clears it
+  //! then clears it; in stream mode (see SetStream()) only flushes
+  //! the stream, returns False if <S> is not that stream
   Standard_EXPORT bool Print(Standard_OStream& S);
 
   //! Static helper function to prepare text for STEP file output while preserving
@@ -310,6 +343,19 @@ private:
   //! Same as above, but the string is given by CString + Length
   Standard_EXPORT void AddString(const char* const str, const int lnstr, const int more = 0);
 
+  //! Sends the content of an entity (type and parameters, then end of entity)
+  Standard_EXPORT void SendContent(const occ::handle<Standard_Transient>& anent,
+                                   const StepData_WriterLib&              lib);
+
+  //! Sends all entities of the Model (without Scopes) formatted by chunks in parallel threads
+  Standard_EXPORT void SendEntitiesParallel(const StepData_WriterLib& lib);
+
+  //! Ends current line: writes it to the stream if set, else records it
+  Standard_EXPORT void FlushLine();
+
+  //! Adds a complete line: writes it to the stream if set, else records it
+  Standard_EXPORT void AddLine(const TCollection_AsciiString& theLine);
+
   occ::handle<StepData_StepModel>                                           themodel;
   occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>> thefile;
   Interface_LineBuffer                                                      thecurr;
@@ -328,6 +374,9 @@ private:
   occ::handle<NCollection_HArray1<int>>                                     thescopebeg;
   occ::handle<NCollection_HArray1<int>>                                     thescopeend;
   occ::handle<NCollection_HArray1<int>>                                     thescopenext;
+  Standard_OStream*                                                         thestream;
+  const NCollection_DataMap<occ::handle<Standard_Transient>, int>*          theidents;
+  bool                                                                      therunpar;
 };
 
 #endif // _StepData_StepWriter_HeaderFile
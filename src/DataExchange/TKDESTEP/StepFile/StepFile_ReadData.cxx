@@ -18,6 +18,8 @@
 #include <Interface_Check.hxx>
 #include <TCollection_AsciiString.hxx>
 
+#include <cctype>
+
 // Constant litterales
 namespace TextValue
 {
@@ -147,13 +149,22 @@ StepFile_ReadData::StepFile_ReadData()
 
 void StepFile_ReadData::CreateNewText(const char* theNewText, int theLenText)
 {
-  // Optimization for most frequent entity, CARTESIAN_POINT
-  static char aTextOfCarPnt[] = "CARTESIAN_POINT";
-  if (strcmp(theNewText, aTextOfCarPnt) == 0)
+  // Entity types, enumerations and short values (unset values, small integers)
+  // are repeated throughout the file, so that they are stored only once
+  const bool isShared =
+    !myErrorArg
+    && (theLenText <= 3 || isalpha((unsigned char)theNewText[0]) != 0 || theNewText[0] == '!'
+        || (theNewText[0] == '.' && theNewText[theLenText - 1] == '.'));
+  if (isShared)
   {
-    myResText = aTextOfCarPnt;
-    return;
+    const auto aShared = mySharedTexts.Contained(theNewText);
+    if (aShared.has_value())
+    {
+      myResText = const_cast<char*>(aShared->get());
+      return;
+    }
   }
+
   //  If error argument exists - prepare size to new text value and old result text
   const int aLength = (myErrorArg) ? theLenText + (int)strlen(myResText) : theLenText;
 
@@ -170,6 +181,10 @@ void StepFile_ReadData::CreateNewText(const char* theNewText, int theLenText)
     return;
   }
   strcpy(myResText, theNewText);
+  if (isShared)
+  {
+    mySharedTexts.Add(myResText);
+  }
 }
 
 //=================================================================================================
@@ -385,6 +400,7 @@ void StepFile_ReadData::ClearRecorder(const int theMode)
   if (theMode & 2)
   {
     myResText = nullptr;
+    mySharedTexts.Clear();
     myTextAlloc.Reset(true);
   }
 }
@@ -20,6 +20,8 @@
 #include <Standard_Handle.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <NCollection_Map.hxx>
+#include <Standard_CStringHasher.hxx>
 
 #include <Interface_ParamType.hxx>
 
@@ -120,7 +122,7 @@ private:
 
 public:
   //! Constructs an uninitialized tool
-  StepFile_ReadData();
+  Standard_EXPORT StepFile_ReadData();
 
   //! Destructor cleans allocated memory of all fields
   ~StepFile_ReadData() { ClearRecorder(3); }
@@ -128,7 +130,12 @@ public:
   //! Prepares the text value for analysis.
   //! It is the main tool for transferring data from flex to bison
   //! If characters page is full, allocates a new page.
-  void CreateNewText(const char* theNewText, int theLenText);
+  //! Repeated texts of entity types, enumerations and other short values
+  //! are stored once and shared between all arguments referring to them.
+  Standard_EXPORT void CreateNewText(const char* theNewText, int theLenText);
+
+  //! Get current text value
+  Standard_EXPORT void GetResultText(char** theText);
 
   //! Adds the current record to the list
   void RecordNewEntity();
@@ -163,7 +170,7 @@ public:
   //! * 1 - clear pages of records and arguments
   //! * 2 - clear pages of characters
   //! * 3 - clear all data
-  void ClearRecorder(const int theMode);
+  Standard_EXPORT void ClearRecorder(const int theMode);
 
   //! Returns a value of fields of current argument
   bool GetArgDescription(Interface_ParamType* theType, char** theValue);
@@ -218,9 +225,6 @@ private:
   //! Prepare text to analyze
   char* RecordNewText(char* theText);
 
-  //! Get current text value
-  void GetResultText(char** theText);
-
   //! Add a record to the current records page
   void AddNewRecord(Record* theNewRecord);
 
@@ -254,6 +258,9 @@ private:
   Scope*              myCurScope;        //!< Current node of the scopes list
   ErrorsPage*         myFirstError;      //!< First node of the errors pages list
   ErrorsPage*         myCurError;        //!< Current node of the errors pages list
+
+  //! Texts shared between arguments: entity types, enumerations and other short values
+  NCollection_Map<const char*, Standard_CStringHasher> mySharedTexts;
 };
 
 #endif // _StepFile_ReadData_HeaderFile
@@ -6,25 +6,46 @@ set(OCCT_StepTidy_FILES
   StepTidy_Axis2Placement3dHasher.pxx
   StepTidy_Axis2Placement3dReducer.cxx
   StepTidy_Axis2Placement3dReducer.pxx
+  StepTidy_BSplineCurveWithKnotsHasher.pxx
+  StepTidy_BSplineCurveWithKnotsReducer.cxx
+  StepTidy_BSplineCurveWithKnotsReducer.pxx
+  StepTidy_BSplineSurfaceWithKnotsHasher.pxx
+  StepTidy_BSplineSurfaceWithKnotsReducer.cxx
+  StepTidy_BSplineSurfaceWithKnotsReducer.pxx
   StepTidy_CartesianPointHasher.pxx
   StepTidy_CartesianPointReducer.cxx
   StepTidy_CartesianPointReducer.pxx
   StepTidy_CircleHasher.pxx
   StepTidy_CircleReducer.cxx
   StepTidy_CircleReducer.pxx
+  StepTidy_ColourRgbHasher.pxx
+  StepTidy_ColourRgbReducer.cxx
+  StepTidy_ColourRgbReducer.pxx
   StepTidy_DirectionHasher.pxx
   StepTidy_DirectionReducer.cxx
   StepTidy_DirectionReducer.pxx
+  StepTidy_EdgeCurveHasher.pxx
+  StepTidy_EdgeCurveReducer.cxx
+  StepTidy_EdgeCurveReducer.pxx
   StepTidy_EntityReducer.pxx
   StepTidy_LineHasher.pxx
   StepTidy_LineReducer.cxx
   StepTidy_LineReducer.pxx
   StepTidy_DuplicateCleaner.cxx
   StepTidy_DuplicateCleaner.hxx
+  StepTidy_OrientedEdgeHasher.pxx
+  StepTidy_OrientedEdgeReducer.cxx
+  StepTidy_OrientedEdgeReducer.pxx
   StepTidy_PlaneHasher.pxx
   StepTidy_PlaneReducer.cxx
   StepTidy_PlaneReducer.pxx
+  StepTidy_StyledItemHasher.pxx
+  StepTidy_StyledItemReducer.cxx
+  StepTidy_StyledItemReducer.pxx
   StepTidy_VectorHasher.pxx
   StepTidy_VectorReducer.cxx
   StepTidy_VectorReducer.pxx
+  StepTidy_VertexPointHasher.pxx
+  StepTidy_VertexPointReducer.cxx
+  StepTidy_VertexPointReducer.pxx
 )
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepTidy_ColourRgbReducer.pxx>
+
+#include <StepVisual_CurveStyle.hxx>
+#include <StepVisual_FillAreaStyleColour.hxx>
+#include <StepVisual_SurfaceStyleRendering.hxx>
+#include <StepVisual_SurfaceStyleRenderingWithProperties.hxx>
+
+//=================================================================================================
+
+StepTidy_ColourRgbReducer::StepTidy_ColourRgbReducer(
+  const occ::handle<XSControl_WorkSession>& theWS)
+    : StepTidy_EntityReducer<StepVisual_ColourRgb, StepTidy_ColourRgbHasher>(theWS)
+{
+  registerReplacer(STANDARD_TYPE(StepVisual_FillAreaStyleColour), replaceFillAreaStyleColour);
+  registerReplacer(STANDARD_TYPE(StepVisual_CurveStyle), replaceCurveStyle);
+  registerReplacer(STANDARD_TYPE(StepVisual_SurfaceStyleRendering), replaceSurfaceStyleRendering);
+  registerReplacer(STANDARD_TYPE(StepVisual_SurfaceStyleRenderingWithProperties),
+                   replaceSurfaceStyleRendering);
+}
+
+//=================================================================================================
+
+bool StepTidy_ColourRgbReducer::replaceFillAreaStyleColour(
+  const occ::handle<StepVisual_ColourRgb>& theOldEntity,
+  const occ::handle<StepVisual_ColourRgb>& theNewEntity,
+  const occ::handle<Standard_Transient>&   theSharing)
+{
+  occ::handle<StepVisual_FillAreaStyleColour> aSharing =
+    occ::down_cast<StepVisual_FillAreaStyleColour>(theSharing);
+  if (aSharing->FillColour() == theOldEntity)
+  {
+    aSharing->SetFillColour(theNewEntity);
+    return true;
+  }
+  return false;
+}
+
+//=================================================================================================
+
+bool StepTidy_ColourRgbReducer::replaceCurveStyle(
+  const occ::handle<StepVisual_ColourRgb>& theOldEntity,
+  const occ::handle<StepVisual_ColourRgb>& theNewEntity,
+  const occ::handle<Standard_Transient>&   theSharing)
+{
+  occ::handle<StepVisual_CurveStyle> aSharing = occ::down_cast<StepVisual_CurveStyle>(theSharing);
+  if (aSharing->CurveColour() == theOldEntity)
+  {
+    aSharing->SetCurveColour(theNewEntity);
+    return true;
+  }
+  return false;
+}
+
+//=================================================================================================
+
+bool StepTidy_ColourRgbReducer::replaceSurfaceStyleRendering(
+  const occ::handle<StepVisual_ColourRgb>& theOldEntity,
+  const occ::handle<StepVisual_ColourRgb>& theNewEntity,
+  const occ::handle<Standard_Transient>&   theSharing)
+{
+  occ::handle<StepVisual_SurfaceStyleRendering> aSharing =
+    occ::down_cast<StepVisual_SurfaceStyleRendering>(theSharing);
+  if (aSharing->SurfaceColour() == theOldEntity)
+  {
+    aSharing->SetSurfaceColour(theNewEntity);
+    return true;
+  }
+  return false;
+}
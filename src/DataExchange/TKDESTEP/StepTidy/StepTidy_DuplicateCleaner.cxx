@@ -15,20 +15,67 @@
 
 #include <Interface_EntityIterator.hxx>
 #include <Interface_Graph.hxx>
+#include <OSD_Parallel.hxx>
 #include <StepTidy_Axis2Placement3dReducer.pxx>
+#include <StepTidy_BSplineCurveWithKnotsReducer.pxx>
+#include <StepTidy_BSplineSurfaceWithKnotsReducer.pxx>
 #include <StepTidy_CartesianPointReducer.pxx>
+#include <StepTidy_ColourRgbReducer.pxx>
 #include <StepTidy_DirectionReducer.pxx>
+#include <StepTidy_EdgeCurveReducer.pxx>
 #include <StepTidy_LineReducer.pxx>
+#include <StepTidy_OrientedEdgeReducer.pxx>
 #include <StepTidy_VectorReducer.pxx>
 #include <StepTidy_PlaneReducer.pxx>
 #include <StepTidy_CircleReducer.pxx>
+#include <StepTidy_StyledItemReducer.pxx>
+#include <StepTidy_VertexPointReducer.pxx>
 #include <StepData_StepModel.hxx>
+
+#include <functional>
 #include <utility>
 
+namespace
+{
+//! Processes all entities of the model by each reducer and replaces found duplicates.
+//! Each reducer handles its own entity type and fills its own map, so that reducers
+//! process entities in parallel threads. Duplicates are then replaced by reducers
+//! one after another, as several reducers may modify the same sharing entity.
+//! @param theModel the model to process.
+//! @param theToRunParallel flag to run reducers in parallel threads.
+//! @param theReplacedEntities map where replaced entities are stored.
+//! @param theReducers the reducers to run.
+template <typename... Reducers>
+void reduceEntities(const occ::handle<StepData_StepModel>&            theModel,
+                    const bool                                        theToRunParallel,
+                    NCollection_Map<occ::handle<Standard_Transient>>& theReplacedEntities,
+                    Reducers&... theReducers)
+{
+  const std::function<void(const occ::handle<Standard_Transient>&)> aProcessors[] = {
+    [&theReducers](const occ::handle<Standard_Transient>& theEntity) {
+      theReducers.ProcessEntity(theEntity);
+    }...};
+  const int aNbEntities = theModel->NbEntities();
+  OSD_Parallel::For(
+    0,
+    static_cast<int>(sizeof...(Reducers)),
+    [&](const int theReducerIndex) {
+      for (int anIndex = 1; anIndex <= aNbEntities; ++anIndex)
+      {
+        aProcessors[theReducerIndex](theModel->Value(anIndex));
+      }
+    },
+    !theToRunParallel);
+
+  (theReducers.Perform(theReplacedEntities), ...);
+}
+} // namespace
+
 //=================================================================================================
 
 StepTidy_DuplicateCleaner::StepTidy_DuplicateCleaner(occ::handle<XSControl_WorkSession> theWS)
-    : myWS(std::move(theWS))
+    : myWS(std::move(theWS)),
+      myIsRunParallel(true)
 {
 }
 
@@ -42,37 +89,59 @@ void StepTidy_DuplicateCleaner::Perform()
     return;
   }
 
-  //! Initialize Reducers.
-  StepTidy_CartesianPointReducer   aCartesianPointReducer(myWS);
-  StepTidy_DirectionReducer        aDirectionReducer(myWS);
-  StepTidy_Axis2Placement3dReducer aAxis2Placement3dReducer(myWS);
-  StepTidy_VectorReducer           aVectorReducer(myWS);
-  StepTidy_LineReducer             aLineReducer(myWS);
-  StepTidy_PlaneReducer            aPlaneReducer(myWS);
-  StepTidy_CircleReducer           aCircleReducer(myWS);
-
-  // Process all entities.
-  for (int anIndex = 1; anIndex <= aModel->NbEntities(); ++anIndex)
+  // Graph is computed once: reducers only read it, and sharings of the entities of each type
+  // are changed only by the reducer of that type.
+  if (!myWS->ComputeGraph())
   {
-    const occ::handle<Standard_Transient> anEntity = aModel->Value(anIndex);
-    aCartesianPointReducer.ProcessEntity(anEntity);
-    aDirectionReducer.ProcessEntity(anEntity);
-    aAxis2Placement3dReducer.ProcessEntity(anEntity);
-    aVectorReducer.ProcessEntity(anEntity);
-    aLineReducer.ProcessEntity(anEntity);
-    aPlaneReducer.ProcessEntity(anEntity);
-    aCircleReducer.ProcessEntity(anEntity);
+    return;
   }
-
-  // Perform replacement of duplicate entities.
   NCollection_Map<occ::handle<Standard_Transient>> aReplacedEntities;
-  aCartesianPointReducer.Perform(aReplacedEntities);
-  aDirectionReducer.Perform(aReplacedEntities);
-  aAxis2Placement3dReducer.Perform(aReplacedEntities);
-  aVectorReducer.Perform(aReplacedEntities);
-  aLineReducer.Perform(aReplacedEntities);
-  aPlaneReducer.Perform(aReplacedEntities);
-  aCircleReducer.Perform(aReplacedEntities);
+
+  // Geometry, vertices and colours are compared by their values.
+  {
+    StepTidy_CartesianPointReducer          aCartesianPointReducer(myWS);
+    StepTidy_DirectionReducer               aDirectionReducer(myWS);
+    StepTidy_Axis2Placement3dReducer        aAxis2Placement3dReducer(myWS);
+    StepTidy_VectorReducer                  aVectorReducer(myWS);
+    StepTidy_LineReducer                    aLineReducer(myWS);
+    StepTidy_PlaneReducer                   aPlaneReducer(myWS);
+    StepTidy_CircleReducer                  aCircleReducer(myWS);
+    StepTidy_BSplineCurveWithKnotsReducer   aBSplineCurveReducer(myWS);
+    StepTidy_BSplineSurfaceWithKnotsReducer aBSplineSurfaceReducer(myWS);
+    StepTidy_VertexPointReducer             aVertexPointReducer(myWS);
+    StepTidy_ColourRgbReducer               aColourRgbReducer(myWS);
+    reduceEntities(aModel,
+                   myIsRunParallel,
+                   aReplacedEntities,
+                   aCartesianPointReducer,
+                   aDirectionReducer,
+                   aAxis2Placement3dReducer,
+                   aVectorReducer,
+                   aLineReducer,
+                   aPlaneReducer,
+                   aCircleReducer,
+                   aBSplineCurveReducer,
+                   aBSplineSurfaceReducer,
+                   aVertexPointReducer,
+                   aColourRgbReducer);
+  }
+
+  // Edges and styled items are compared by instances of entities merged above.
+  {
+    StepTidy_EdgeCurveReducer  anEdgeCurveReducer(myWS);
+    StepTidy_StyledItemReducer aStyledItemReducer(myWS);
+    reduceEntities(aModel,
+                   myIsRunParallel,
+                   aReplacedEntities,
+                   anEdgeCurveReducer,
+                   aStyledItemReducer);
+  }
+
+  // Oriented edges are compared by instances of edges merged above.
+  {
+    StepTidy_OrientedEdgeReducer anOrientedEdgeReducer(myWS);
+    reduceEntities(aModel, myIsRunParallel, aReplacedEntities, anOrientedEdgeReducer);
+  }
 
   // Remove duplicate entities.
   removeEntities(aReplacedEntities);
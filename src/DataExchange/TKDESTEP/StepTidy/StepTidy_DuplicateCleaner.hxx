@@ -23,6 +23,9 @@ class XSControl_WorkSession;
 //! This class is used to merge equal STEP entities in the work session and remove duplicates.
 //! It uses the child classes of StepTidy_EntityReducer class to perform the merging.
 //! The child classes of StepTidy_EntityReducer are specialized for different types of entities.
+//! Geometric entities, vertices and colours are merged first, then edges and styled items
+//! (compared by instances of already merged entities), then oriented edges.
+//! Reducers of each step process entities in parallel threads.
 //! StepTidy_EntityReducer implements the basic logic for searching and merging entities
 //! while child classes implement the logic for replacing specific type of entities in the specific
 //! type of sharing entities.
@@ -46,6 +49,12 @@ public:
   //! @param theWS the work session to merge entities in.
   Standard_EXPORT StepTidy_DuplicateCleaner(occ::handle<XSControl_WorkSession> theWS);
 
+  //! Sets the flag to process entities of different types in parallel threads; TRUE by default.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if entities of different types are processed in parallel threads.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
   //! Perform the merging of entities.
   //! All entities in a model stored in the provided work session that are considered equal to
   //! each other will be merged, and duplicates will be removed.
@@ -58,6 +67,8 @@ private:
 
 private:
   occ::handle<XSControl_WorkSession> myWS; //!< The work session containing the model with entities.
+  //! Flag to process entities of different types in parallel threads.
+  bool myIsRunParallel;
 };
 
 #endif // _StepTidy_DuplicateCleaner_HeaderFile
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepTidy_EdgeCurveReducer.pxx>
+
+#include <StepShape_OrientedEdge.hxx>
+#include <StepShape_SeamEdge.hxx>
+
+//=================================================================================================
+
+StepTidy_EdgeCurveReducer::StepTidy_EdgeCurveReducer(
+  const occ::handle<XSControl_WorkSession>& theWS)
+    : StepTidy_EntityReducer<StepShape_EdgeCurve, StepTidy_EdgeCurveHasher>(theWS)
+{
+  registerReplacer(STANDARD_TYPE(StepShape_OrientedEdge), replaceOrientedEdge);
+  registerReplacer(STANDARD_TYPE(StepShape_SeamEdge), replaceOrientedEdge);
+}
+
+//=================================================================================================
+
+bool StepTidy_EdgeCurveReducer::replaceOrientedEdge(
+  const occ::handle<StepShape_EdgeCurve>& theOldEntity,
+  const occ::handle<StepShape_EdgeCurve>& theNewEntity,
+  const occ::handle<Standard_Transient>&  theSharing)
+{
+  occ::handle<StepShape_OrientedEdge> aSharing = occ::down_cast<StepShape_OrientedEdge>(theSharing);
+  if (aSharing->EdgeElement() == theOldEntity)
+  {
+    aSharing->SetEdgeElement(theNewEntity);
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepTidy_OrientedEdgeReducer.pxx>
+
+#include <StepShape_EdgeLoop.hxx>
+
+//=================================================================================================
+
+StepTidy_OrientedEdgeReducer::StepTidy_OrientedEdgeReducer(
+  const occ::handle<XSControl_WorkSession>& theWS)
+    : StepTidy_EntityReducer<StepShape_OrientedEdge, StepTidy_OrientedEdgeHasher>(theWS)
+{
+  registerReplacer(STANDARD_TYPE(StepShape_EdgeLoop), replaceEdgeLoop);
+}
+
+//=================================================================================================
+
+bool StepTidy_OrientedEdgeReducer::replaceEdgeLoop(
+  const occ::handle<StepShape_OrientedEdge>& theOldEntity,
+  const occ::handle<StepShape_OrientedEdge>& theNewEntity,
+  const occ::handle<Standard_Transient>&     theSharing)
+{
+  occ::handle<StepShape_EdgeLoop> aSharing = occ::down_cast<StepShape_EdgeLoop>(theSharing);
+
+  bool                                                                  isReplaced = false;
+  occ::handle<NCollection_HArray1<occ::handle<StepShape_OrientedEdge>>> anArray =
+    aSharing->EdgeList();
+  if (anArray.IsNull())
+  {
+    return false;
+  }
+  for (int anIndex = anArray->Lower(); anIndex <= anArray->Upper(); ++anIndex)
+  {
+    if (anArray->Value(anIndex) == theOldEntity)
+    {
+      anArray->SetValue(anIndex, theNewEntity);
+      isReplaced = true;
+    }
+  }
+  return isReplaced;
+}
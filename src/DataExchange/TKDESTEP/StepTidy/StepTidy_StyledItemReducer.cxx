@@ -0,0 +1,87 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepTidy_StyledItemReducer.pxx>
+
+#include <StepVisual_DraughtingModel.hxx>
+#include <StepVisual_MechanicalDesignGeometricPresentationRepresentation.hxx>
+
+//=================================================================================================
+
+StepTidy_StyledItemReducer::StepTidy_StyledItemReducer(
+  const occ::handle<XSControl_WorkSession>& theWS)
+    : StepTidy_EntityReducer<StepVisual_StyledItem, StepTidy_StyledItemHasher>(theWS)
+{
+  registerReplacer(STANDARD_TYPE(StepVisual_MechanicalDesignGeometricPresentationRepresentation),
+                   replaceRepresentation);
+  registerReplacer(STANDARD_TYPE(StepVisual_DraughtingModel), replaceRepresentation);
+}
+
+//=================================================================================================
+
+bool StepTidy_StyledItemReducer::replaceRepresentation(
+  const occ::handle<StepVisual_StyledItem>& theOldEntity,
+  const occ::handle<StepVisual_StyledItem>& theNewEntity,
+  const occ::handle<Standard_Transient>&    theSharing)
+{
+  occ::handle<StepRepr_Representation> aSharing =
+    occ::down_cast<StepRepr_Representation>(theSharing);
+
+  occ::handle<NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>> anArray =
+    aSharing->Items();
+  if (anArray.IsNull())
+  {
+    return false;
+  }
+
+  // items of representation form a SET, so the old entity is removed
+  // if the new one is already there instead of adding a second reference to it
+  int  aNbOld = 0;
+  bool hasNew = false;
+  for (int anIndex = anArray->Lower(); anIndex <= anArray->Upper(); ++anIndex)
+  {
+    const occ::handle<StepRepr_RepresentationItem>& anItem = anArray->Value(anIndex);
+    if (anItem == theOldEntity)
+    {
+      ++aNbOld;
+    }
+    else if (anItem == theNewEntity)
+    {
+      hasNew = true;
+    }
+  }
+  if (aNbOld == 0)
+  {
+    return false;
+  }
+
+  const int aNbItems = anArray->Length() - aNbOld + (hasNew ? 0 : 1);
+  occ::handle<NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>> aNewArray =
+    new NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>(1, aNbItems);
+  int aNewIndex = 1;
+  for (int anIndex = anArray->Lower(); anIndex <= anArray->Upper(); ++anIndex)
+  {
+    const occ::handle<StepRepr_RepresentationItem>& anItem = anArray->Value(anIndex);
+    if (anItem != theOldEntity)
+    {
+      aNewArray->SetValue(aNewIndex++, anItem);
+    }
+    else if (!hasNew)
+    {
+      aNewArray->SetValue(aNewIndex++, theNewEntity);
+      hasNew = true;
+    }
+  }
+  aSharing->SetItems(aNewArray);
+  return true;
+}
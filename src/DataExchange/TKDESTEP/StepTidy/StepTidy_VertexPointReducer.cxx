@@ -0,0 +1,66 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepTidy_VertexPointReducer.pxx>
+
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_VertexLoop.hxx>
+
+//=================================================================================================
+
+StepTidy_VertexPointReducer::StepTidy_VertexPointReducer(
+  const occ::handle<XSControl_WorkSession>& theWS)
+    : StepTidy_EntityReducer<StepShape_VertexPoint, StepTidy_VertexPointHasher>(theWS)
+{
+  registerReplacer(STANDARD_TYPE(StepShape_EdgeCurve), replaceEdgeCurve);
+  registerReplacer(STANDARD_TYPE(StepShape_VertexLoop), replaceVertexLoop);
+}
+
+//=================================================================================================
+
+bool StepTidy_VertexPointReducer::replaceEdgeCurve(
+  const occ::handle<StepShape_VertexPoint>& theOldEntity,
+  const occ::handle<StepShape_VertexPoint>& theNewEntity,
+  const occ::handle<Standard_Transient>&    theSharing)
+{
+  occ::handle<StepShape_EdgeCurve> aSharing = occ::down_cast<StepShape_EdgeCurve>(theSharing);
+
+  bool isReplaced = false;
+  if (aSharing->EdgeStart() == theOldEntity)
+  {
+    aSharing->SetEdgeStart(theNewEntity);
+    isReplaced = true;
+  }
+  if (aSharing->EdgeEnd() == theOldEntity)
+  {
+    aSharing->SetEdgeEnd(theNewEntity);
+    isReplaced = true;
+  }
+  return isReplaced;
+}
+
+//=================================================================================================
+
+bool StepTidy_VertexPointReducer::replaceVertexLoop(
+  const occ::handle<StepShape_VertexPoint>& theOldEntity,
+  const occ::handle<StepShape_VertexPoint>& theNewEntity,
+  const occ::handle<Standard_Transient>&    theSharing)
+{
+  occ::handle<StepShape_VertexLoop> aSharing = occ::down_cast<StepShape_VertexLoop>(theSharing);
+  if (aSharing->LoopVertex() == theOldEntity)
+  {
+    aSharing->SetLoopVertex(theNewEntity);
+    return true;
+  }
+  return false;
+}
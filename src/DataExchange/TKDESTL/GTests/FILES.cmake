@@ -3,4 +3,5 @@ set(OCCT_TKDESTL_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDESTL_GTests_FILES
   DESTL_Provider_Test.cxx
+  RWStl_Reader_Test.cxx
 )
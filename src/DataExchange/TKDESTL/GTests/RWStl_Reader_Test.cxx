@@ -0,0 +1,167 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWStl_Reader.hxx>
+
+#include <Message_ProgressRange.hxx>
+#include <NCollection_DynamicArray.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace
+{
+//! Reader collecting nodes and triangles in the order of callbacks.
+class CollectingReader : public RWStl_Reader
+{
+public:
+  int AddNode(const gp_XYZ& thePnt) override
+  {
+    myNodes.Append(thePnt);
+    return myNodes.Length();
+  }
+
+  void AddTriangle(int theN1, int theN2, int theN3) override
+  {
+    myTriangles.Append(theN1);
+    myTriangles.Append(theN2);
+    myTriangles.Append(theN3);
+  }
+
+  NCollection_DynamicArray<gp_XYZ> myNodes;
+  NCollection_DynamicArray<int>    myTriangles;
+};
+
+//! Appends a 32-bit float to the binary STL data.
+void appendFloat(std::string& theData, const float theValue)
+{
+  char aBytes[sizeof(float)];
+  std::memcpy(aBytes, &theValue, sizeof(float));
+  theData.append(aBytes, sizeof(float));
+}
+
+//! Appends a facet with zero normal to the binary STL data.
+void appendFacet(std::string&  theData,
+                 const gp_XYZ& theP1,
+                 const gp_XYZ& theP2,
+                 const gp_XYZ& theP3)
+{
+  for (int aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+  {
+    appendFloat(theData, 0.0f);
+  }
+  const gp_XYZ* aNodes[3] = {&theP1, &theP2, &theP3};
+  for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+  {
+    appendFloat(theData, (float)aNodes[aNodeIter]->X());
+    appendFloat(theData, (float)aNodes[aNodeIter]->Y());
+    appendFloat(theData, (float)aNodes[aNodeIter]->Z());
+  }
+  theData.append(2, '\0');
+}
+
+//! Generates binary STL with a folded grid of triangles sharing nodes,
+//! so that neighbor triangles meet at various angles.
+//! A degenerate facet is inserted every 1000 facets.
+//! @param[in] theNbRows  number of grid rows
+//! @param[in] theNbCols  number of grid columns
+//! @param[in] theNbFacetsShift  difference between facets number in the header and actual one
+std::string generateBinaryStl(const int theNbRows, const int theNbCols, const int theNbFacetsShift)
+{
+  std::string aData(80, ' ');
+  aData.append(4, '\0');
+
+  int aNbFacets = 0;
+  for (int aRow = 0; aRow < theNbRows; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCols; ++aCol)
+    {
+      gp_XYZ aCorners[4];
+      for (int aCornerIter = 0; aCornerIter < 4; ++aCornerIter)
+      {
+        const int aNodeRow = aRow + aCornerIter / 2;
+        const int aNodeCol = aCol + (aCornerIter % 2 == 0 ? 0 : 1);
+        aCorners[aCornerIter] = gp_XYZ(aNodeCol, aNodeRow, (aNodeCol % 3) * (aNodeRow % 2) * 0.75);
+      }
+      appendFacet(aData, aCorners[0], aCorners[1], aCorners[3]);
+      appendFacet(aData, aCorners[0], aCorners[3], aCorners[2]);
+      aNbFacets += 2;
+      if (aNbFacets % 1000 == 0)
+      {
+        appendFacet(aData, aCorners[0], aCorners[0], aCorners[1]);
+        ++aNbFacets;
+      }
+    }
+  }
+
+  const int32_t aNbFacetsHeader = aNbFacets + theNbFacetsShift;
+  std::memcpy(&aData[80], &aNbFacetsHeader, sizeof(int32_t));
+  return aData;
+}
+
+//! Reads binary STL data sequentially and in parallel and compares the results.
+void checkParallelRead(const std::string& theData, const double theMergeAngle)
+{
+  CollectingReader aReaders[2];
+  bool             aResults[2] = {false, false};
+  for (int aReaderIter = 0; aReaderIter < 2; ++aReaderIter)
+  {
+    std::istringstream aStream(theData, std::ios::in | std::ios::binary);
+    aReaders[aReaderIter].SetMergeAngle(theMergeAngle);
+    aReaders[aReaderIter].SetParallel(aReaderIter == 1);
+    aResults[aReaderIter] = aReaders[aReaderIter].ReadBinary(aStream, Message_ProgressRange());
+  }
+
+  EXPECT_EQ(aResults[0], aResults[1]);
+  EXPECT_GT(aReaders[0].myTriangles.Length(), 0);
+  ASSERT_EQ(aReaders[0].myNodes.Length(), aReaders[1].myNodes.Length());
+  ASSERT_EQ(aReaders[0].myTriangles.Length(), aReaders[1].myTriangles.Length());
+  for (int aNodeIter = 0; aNodeIter < aReaders[0].myNodes.Length(); ++aNodeIter)
+  {
+    const gp_XYZ& aNode1 = aReaders[0].myNodes[aNodeIter];
+    const gp_XYZ& aNode2 = aReaders[1].myNodes[aNodeIter];
+    ASSERT_TRUE(aNode1.X() == aNode2.X() && aNode1.Y() == aNode2.Y() && aNode1.Z() == aNode2.Z())
+      << "Node " << aNodeIter;
+  }
+  for (int anIndexIter = 0; anIndexIter < aReaders[0].myTriangles.Length(); ++anIndexIter)
+  {
+    ASSERT_EQ(aReaders[0].myTriangles[anIndexIter], aReaders[1].myTriangles[anIndexIter])
+      << "Triangle " << anIndexIter / 3;
+  }
+}
+} // namespace
+
+TEST(RWStl_ReaderTest, ParallelBinary_DefaultAngle)
+{
+  const std::string aData = generateBinaryStl(60, 100, 0);
+  checkParallelRead(aData, M_PI / 2.0);
+}
+
+TEST(RWStl_ReaderTest, ParallelBinary_MergeAngle)
+{
+  const std::string aData = generateBinaryStl(60, 100, 0);
+  checkParallelRead(aData, M_PI / 4.0);
+  checkParallelRead(aData, 0.0);
+}
+
+TEST(RWStl_ReaderTest, ParallelBinary_TruncatedData)
+{
+  // the header declares more facets than the data contains
+  std::string aData = generateBinaryStl(60, 100, 1000);
+  aData.resize(aData.size() - 25);
+  checkParallelRead(aData, M_PI / 2.0);
+}
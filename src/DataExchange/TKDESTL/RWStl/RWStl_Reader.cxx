@@ -18,10 +18,13 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <NCollection_LinearVector.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
@@ -41,6 +44,18 @@ static const size_t THE_STL_MIN_FILE_SIZE = THE_STL_HEADER_SIZE + THE_STL_SIZEOF
 // The length of buffer to read (in bytes)
 static const size_t THE_BUFFER_SIZE = 1024;
 
+// Number of facets read from the stream at once by sequential binary reader
+static const int THE_CHUNK_NBFACETS = 80;
+
+// Number of facets read from the stream at once by parallel binary reader
+static const int THE_BLOCK_NBFACETS = 256 * 1024;
+
+// Number of facets decoded by a single task of parallel binary reader
+static const int THE_TASK_NBFACETS = 4096;
+
+// Number of partitions of nodes merged independently by parallel binary reader
+static const int THE_NB_PARTITIONS = 256;
+
 //! Auxiliary tool for merging nodes during STL reading.
 class MergeNodeTool : public Poly_MergeNodesTool
 {
@@ -115,13 +130,38 @@ inline static gp_XYZ readStlFloatVec3(const char* theData)
                 readStlFloat(theData + sizeof(float) * 2));
 }
 
+//! Hasher for exactly matching node positions.
+struct StlNodeHasher
+{
+  size_t operator()(const NCollection_Vec3<float>& theKey) const noexcept
+  {
+    return opencascade::hashBytes(theKey.GetData(), 3 * sizeof(float));
+  }
+
+  bool operator()(const NCollection_Vec3<float>& theKey1,
+                  const NCollection_Vec3<float>& theKey2) const noexcept
+  {
+    // compare bits to distinguish signed zeros as hash code does
+    return theKey1.IsEqual(theKey2)
+           && std::memcmp(theKey1.GetData(), theKey2.GetData(), 3 * sizeof(float)) == 0;
+  }
+};
+
+//! Node created at the position, for merging by angle.
+struct StlNodeEntry
+{
+  int Corner; //!< facet node (facet index * 3 + node index) created the node
+  int Prev;   //!< previously created node at the same position or -1
+};
+
 } // namespace
 
 //=================================================================================================
 
 RWStl_Reader::RWStl_Reader()
     : myMergeAngle(M_PI / 2.0),
-      myMergeTolearance(0.0)
+      myMergeTolearance(0.0),
+      myToParallel(false)
 {
 }
 
@@ -425,6 +465,26 @@ bool RWStl_Reader::ReadBinary(Standard_IStream& theStream, const Message_Progres
 
   // number of facets is stored as 32-bit integer at position 80
   const int aNbFacets = *(int32_t*)(aHeader + 80);
+  if (myToParallel && aNbFacets > 0 && aNbFacets <= std::numeric_limits<int>::max() / 3
+      && (float)myMergeTolearance <= 0.0f)
+  {
+    // the number of facets in the header is not trusted for memory allocation
+    const std::streampos aDataPos = theStream.tellg();
+    if (aDataPos != std::streampos(-1))
+    {
+      theStream.seekg(0, std::ios::end);
+      const std::streamoff aDataLen = theStream.tellg() - aDataPos;
+      theStream.seekg(aDataPos);
+      if (theStream.good())
+      {
+        const int aNbDataFacets =
+          (int)std::min(std::streamoff(aNbFacets), aDataLen / std::streamoff(THE_STL_SIZEOF_FACET));
+        return readBinaryParallel(theStream, aNbFacets, aNbDataFacets, theProgress);
+      }
+      theStream.clear();
+      theStream.seekg(aDataPos);
+    }
+  }
 
   MergeNodeTool aMergeTool(this, aNbFacets);
   aMergeTool.SetMergeAngle(myMergeAngle);
@@ -436,8 +496,7 @@ bool RWStl_Reader::ReadBinary(Standard_IStream& theStream, const Message_Progres
   int                   aNbRead = 0;
 
   // allocate buffer for 80 triangles
-  const int THE_CHUNK_NBFACETS = 80;
-  char      aBuffer[THE_STL_SIZEOF_FACET * THE_CHUNK_NBFACETS];
+  char aBuffer[THE_STL_SIZEOF_FACET * THE_CHUNK_NBFACETS];
 
   // normal + 3 nodes + 2 extra bytes
   const size_t aVec3Size        = sizeof(float) * 3;
@@ -470,3 +529,258 @@ bool RWStl_Reader::ReadBinary(Standard_IStream& theStream, const Message_Progres
 
   return aPS.More();
 }
+
+//=================================================================================================
+
+bool RWStl_Reader::readBinaryParallel(Standard_IStream&            theStream,
+                                      const int                    theNbFacets,
+                                      const int                    theNbDataFacets,
+                                      const Message_ProgressRange& theProgress)
+{
+  Message_ProgressScope aPS(theProgress, "Reading binary STL file", 4);
+
+  // read facets by blocks and decode their nodes in parallel
+  const size_t                                aVec3Size = sizeof(float) * 3;
+  NCollection_Array1<NCollection_Vec3<float>> aNodes(0, std::max(theNbDataFacets, 1) * 3 - 1);
+  NCollection_Array1<char> aBuffer(0, int(THE_BLOCK_NBFACETS * THE_STL_SIZEOF_FACET) - 1);
+  int                      aNbFacets = theNbFacets;
+  bool                     isFailed  = false;
+  {
+    Message_ProgressScope aReadPS(aPS.Next(2), nullptr, theNbFacets);
+    for (int aFirstFacet = 0; aFirstFacet < aNbFacets; aFirstFacet += THE_BLOCK_NBFACETS)
+    {
+      if (!aReadPS.More())
+      {
+        return false;
+      }
+
+      const int             aNbBlockFacets = std::min(THE_BLOCK_NBFACETS, aNbFacets - aFirstFacet);
+      const std::streamsize aDataToRead    = aNbBlockFacets * THE_STL_SIZEOF_FACET;
+      const std::streamsize aNbReadBytes =
+        theStream.read(&aBuffer.ChangeFirst(), aDataToRead).gcount();
+      int aNbDecoded = aNbBlockFacets;
+      if (aNbReadBytes != aDataToRead)
+      {
+        // keep facets which would be passed by chunks of sequential reader
+        const int aNbComplete = aFirstFacet + int(aNbReadBytes / THE_STL_SIZEOF_FACET);
+        aNbFacets             = aNbComplete - aNbComplete % THE_CHUNK_NBFACETS;
+        aNbDecoded            = std::max(aNbFacets - aFirstFacet, 0);
+        isFailed              = true;
+      }
+
+      const char*              aBlockData  = &aBuffer.First();
+      NCollection_Vec3<float>* aBlockNodes = &aNodes.ChangeFirst() + aFirstFacet * 3;
+      const int aNbTasks = (aNbDecoded + THE_TASK_NBFACETS - 1) / THE_TASK_NBFACETS;
+      OSD_Parallel::For(0, aNbTasks, [&](const int theTaskIndex) {
+        const int aFrom = theTaskIndex * THE_TASK_NBFACETS;
+        const int aTo   = std::min(aFrom + THE_TASK_NBFACETS, aNbDecoded);
+        for (int aFacetIter = aFrom; aFacetIter < aTo; ++aFacetIter)
+        {
+          // skip normal
+          const char* aFacetData = aBlockData + aFacetIter * THE_STL_SIZEOF_FACET + aVec3Size;
+          for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+          {
+            const char* aNodeData = aFacetData + aNodeIter * aVec3Size;
+            aBlockNodes[aFacetIter * 3 + aNodeIter] =
+              NCollection_Vec3<float>(readStlFloat(aNodeData),
+                                      readStlFloat(aNodeData + sizeof(float)),
+                                      readStlFloat(aNodeData + sizeof(float) * 2));
+          }
+        }
+      });
+      aReadPS.Next(aNbBlockFacets);
+      if (isFailed)
+      {
+        Message::SendFail("Error: binary STL read failed");
+        break;
+      }
+    }
+  }
+  if (aNbFacets <= 0)
+  {
+    return !isFailed && aPS.More();
+  }
+
+  // the same merge parameters as in Poly_MergeNodesTool
+  const float aMergeAngleCos = (float)std::cos(myMergeAngle);
+  const bool  toMerge        = (float)myMergeAngle > 0.0f;
+  const bool  toCheckAngle   = toMerge && aMergeAngleCos > 0.01f;
+  const int   aNbCorners     = aNbFacets * 3;
+
+  // representative facet node for each facet node (replaced by node index later)
+  NCollection_Array1<int> aNodeIds(0, aNbCorners - 1);
+  if (toMerge)
+  {
+    NCollection_Array1<NCollection_Vec3<float>> aNormals(0, toCheckAngle ? aNbFacets - 1 : 0);
+    if (toCheckAngle)
+    {
+      const int aNbTasks = (aNbFacets + THE_TASK_NBFACETS - 1) / THE_TASK_NBFACETS;
+      OSD_Parallel::For(0, aNbTasks, [&](const int theTaskIndex) {
+        const int aFrom = theTaskIndex * THE_TASK_NBFACETS;
+        const int aTo   = std::min(aFrom + THE_TASK_NBFACETS, aNbFacets);
+        for (int aFacetIter = aFrom; aFacetIter < aTo; ++aFacetIter)
+        {
+          // the same computations as Poly_MergeNodesTool::computeTriNormal()
+          const NCollection_Vec3<float>* aTri = &aNodes.Value(aFacetIter * 3);
+          const gp_XYZ                   aPnt0(aTri[0].x(), aTri[0].y(), aTri[0].z());
+          const gp_XYZ                   aPnt1(aTri[1].x(), aTri[1].y(), aTri[1].z());
+          const gp_XYZ                   aPnt2(aTri[2].x(), aTri[2].y(), aTri[2].z());
+          const gp_XYZ                   aCross = (aPnt1 - aPnt0) ^ (aPnt2 - aPnt0);
+          const NCollection_Vec3<float>  aNorm((float)aCross.X(),
+                                              (float)aCross.Y(),
+                                              (float)aCross.Z());
+          aNormals.SetValue(aFacetIter, aNorm.Normalized());
+        }
+      });
+    }
+
+    // distribute facet nodes over partitions by hash of position keeping the file order
+    const int aNbBlocks =
+      std::max(1,
+               std::min(OSD_Parallel::NbLogicalProcessors() * 4,
+                        aNbCorners / (THE_TASK_NBFACETS * 3)));
+    const int               aBlockSize = (aNbCorners + aNbBlocks - 1) / aNbBlocks;
+    NCollection_Array1<int> aPartOffsets(0, aNbBlocks * THE_NB_PARTITIONS - 1);
+    NCollection_Array1<int> aPartStarts(0, THE_NB_PARTITIONS);
+    NCollection_Array1<int> aSorted(0, aNbCorners - 1);
+    {
+      NCollection_Array1<uint8_t> aParts(0, aNbCorners - 1);
+      aPartOffsets.Init(0);
+      OSD_Parallel::For(0, aNbBlocks, [&](const int theBlockIndex) {
+        int*      aCounts = &aPartOffsets.ChangeValue(theBlockIndex * THE_NB_PARTITIONS);
+        const int aTo     = std::min((theBlockIndex + 1) * aBlockSize, aNbCorners);
+        for (int aCorner = theBlockIndex * aBlockSize; aCorner < aTo; ++aCorner)
+        {
+          const uint8_t aPart =
+            uint8_t(StlNodeHasher()(aNodes.Value(aCorner)) % THE_NB_PARTITIONS);
+          aParts.SetValue(aCorner, aPart);
+          ++aCounts[aPart];
+        }
+      });
+
+      int aNbSorted = 0;
+      for (int aPartIter = 0; aPartIter < THE_NB_PARTITIONS; ++aPartIter)
+      {
+        aPartStarts.SetValue(aPartIter, aNbSorted);
+        for (int aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+        {
+          int&      anOffset = aPartOffsets.ChangeValue(aBlockIter * THE_NB_PARTITIONS + aPartIter);
+          const int aCount   = anOffset;
+          anOffset           = aNbSorted;
+          aNbSorted += aCount;
+        }
+      }
+      aPartStarts.SetValue(THE_NB_PARTITIONS, aNbSorted);
+
+      OSD_Parallel::For(0, aNbBlocks, [&](const int theBlockIndex) {
+        int*      anOffsets = &aPartOffsets.ChangeValue(theBlockIndex * THE_NB_PARTITIONS);
+        const int aTo       = std::min((theBlockIndex + 1) * aBlockSize, aNbCorners);
+        for (int aCorner = theBlockIndex * aBlockSize; aCorner < aTo; ++aCorner)
+        {
+          aSorted.SetValue(anOffsets[aParts.Value(aCorner)]++, aCorner);
+        }
+      });
+    }
+    if (!aPS.More())
+    {
+      return false;
+    }
+
+    // merge nodes within each partition in the file order;
+    // nodes at the same position are looked up from the most recently created one,
+    // as Poly_MergeNodesTool does
+    OSD_Parallel::For(0, THE_NB_PARTITIONS, [&](const int thePartIndex) {
+      const int aFrom = aPartStarts.Value(thePartIndex);
+      const int aTo   = aPartStarts.Value(thePartIndex + 1);
+      NCollection_DataMap<NCollection_Vec3<float>, int, StlNodeHasher> aLastNodes(
+        std::max(aTo - aFrom, 1),
+        new NCollection_IncAllocator());
+      NCollection_LinearVector<StlNodeEntry> anEntries;
+      for (int aSortedIter = aFrom; aSortedIter < aTo; ++aSortedIter)
+      {
+        const int                      aCorner = aSorted.Value(aSortedIter);
+        const NCollection_Vec3<float>& aPos    = aNodes.Value(aCorner);
+        int*                           aLast   = aLastNodes.ChangeSeek(aPos);
+        int                            aRep    = aCorner;
+        if (!toCheckAngle)
+        {
+          if (aLast != nullptr)
+          {
+            aRep = *aLast;
+          }
+          else
+          {
+            aLastNodes.Bind(aPos, aCorner);
+          }
+          aNodeIds.SetValue(aCorner, aRep);
+          continue;
+        }
+
+        const NCollection_Vec3<float>& aNorm = aNormals.Value(aCorner / 3);
+        for (int anEntry = aLast != nullptr ? *aLast : -1; anEntry != -1;
+             anEntry     = anEntries[anEntry].Prev)
+        {
+          const int aNodeCorner = anEntries[anEntry].Corner;
+          if (aNormals.Value(aNodeCorner / 3).Dot(aNorm) >= aMergeAngleCos)
+          {
+            aRep = aNodeCorner;
+            break;
+          }
+        }
+        if (aRep == aCorner)
+        {
+          StlNodeEntry& aNewEntry = anEntries.Appended();
+          aNewEntry.Corner        = aCorner;
+          aNewEntry.Prev          = aLast != nullptr ? *aLast : -1;
+          if (aLast != nullptr)
+          {
+            *aLast = int(anEntries.Size()) - 1;
+          }
+          else
+          {
+            aLastNodes.Bind(aPos, int(anEntries.Size()) - 1);
+          }
+        }
+        aNodeIds.SetValue(aCorner, aRep);
+      }
+    });
+  }
+  aPS.Next();
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  // pass nodes and triangles in the file order
+  Message_ProgressScope anAddPS(aPS.Next(), nullptr, aNbFacets);
+  for (int aFacetIter = 0; aFacetIter < aNbFacets; ++aFacetIter)
+  {
+    int aNodesRes[3] = {-1, -1, -1};
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      const int aCorner = aFacetIter * 3 + aNodeIter;
+      const int aRep    = toMerge ? aNodeIds.Value(aCorner) : aCorner;
+      if (aRep == aCorner)
+      {
+        const NCollection_Vec3<float>& aPos = aNodes.Value(aCorner);
+        aNodesRes[aNodeIter]                = AddNode(gp_XYZ(aPos.x(), aPos.y(), aPos.z()));
+      }
+      else
+      {
+        aNodesRes[aNodeIter] = aNodeIds.Value(aRep);
+      }
+      aNodeIds.SetValue(aCorner, aNodesRes[aNodeIter]);
+    }
+    if (aNodesRes[0] != aNodesRes[1] && aNodesRes[1] != aNodesRes[2]
+        && aNodesRes[2] != aNodesRes[0])
+    {
+      AddTriangle(aNodesRes[0], aNodesRes[1], aNodesRes[2]);
+    }
+    if ((aFacetIter % THE_BLOCK_NBFACETS) == 0 && !anAddPS.More())
+    {
+      return false;
+    }
+  }
+  anAddPS.Next(aNbFacets);
+  return !isFailed && aPS.More();
+}
@@ -106,9 +106,34 @@ public:
   //! Set linear merge tolerance.
   void SetMergeTolerance(double theTolerance) { myMergeTolearance = theTolerance; }
 
+  //! Return flag to read binary STL data in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup flag to read binary STL data in parallel threads.
+  //! Facets are decoded by blocks, while equal nodes are merged in parallel
+  //! within partitions defined by the hash of node position.
+  //! Nodes and triangles are passed to AddNode() and AddTriangle() in the same order
+  //! and with the same merge angle semantics as in single-threaded mode,
+  //! at the cost of keeping all facet nodes in memory.
+  //! Has no effect on Ascii files and with non-zero merge tolerance.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
+protected:
+  //! Reads facets of binary STL data and merges nodes in parallel threads.
+  //! @param[in] theStream       stream positioned after the header
+  //! @param[in] theNbFacets     number of facets to read defined by the header
+  //! @param[in] theNbDataFacets number of facets available within the stream
+  //! @param[in] theProgress     progress indicator
+  //! @return FALSE on error or user break
+  Standard_EXPORT bool readBinaryParallel(Standard_IStream&            theStream,
+                                          const int                    theNbFacets,
+                                          const int                    theNbDataFacets,
+                                          const Message_ProgressRange& theProgress);
+
 protected:
   double myMergeAngle;
   double myMergeTolearance;
+  bool   myToParallel;
 };
 
 #endif
@@ -0,0 +1,170 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <AIS_ConnectedInteractive.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFPrs_DocumentPresenter.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns TRUE if all faces of the shape have triangulation (with normals, if requested).
+bool isTriangulated(const TopoDS_Shape& theShape, const bool theToCheckNormals = false)
+{
+  TopLoc_Location aLoc;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const occ::handle<Poly_Triangulation>& aTris =
+      BRep_Tool::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc);
+    if (aTris.IsNull() || (theToCheckNormals && !aTris->HasNormals()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! Creates assembly of three box instances (one of them colored) and one cylinder.
+occ::handle<TDocStd_Document> createDocument(TopoDS_Shape& theBox, TopoDS_Shape& theCyl)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("XmlXCAF", aDoc);
+
+  occ::handle<XCAFDoc_ShapeTool> aShTool  = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+  occ::handle<XCAFDoc_ColorTool> aColTool = XCAFDoc_DocumentTool::ColorTool(aDoc->Main());
+  theBox = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+  theCyl = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+  const TDF_Label aBoxLab = aShTool->AddShape(theBox, false);
+  const TDF_Label aCylLab = aShTool->AddShape(theCyl, false);
+
+  const TDF_Label aRootLab = aShTool->NewShape();
+  for (int aBoxIter = 0; aBoxIter < 3; ++aBoxIter)
+  {
+    gp_Trsf aTrsf;
+    aTrsf.SetTranslation(gp_Vec(20.0 * aBoxIter, 0.0, 0.0));
+    const TDF_Label aCompLab = aShTool->AddComponent(aRootLab, aBoxLab, TopLoc_Location(aTrsf));
+    if (aBoxIter == 2)
+    {
+      aColTool->SetColor(aCompLab, Quantity_Color(Quantity_NOC_RED), XCAFDoc_ColorSurf);
+    }
+  }
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(0.0, 20.0, 0.0));
+  aShTool->AddComponent(aRootLab, aCylLab, TopLoc_Location(aTrsf));
+  aShTool->UpdateAssemblies();
+  return aDoc;
+}
+} // namespace
+
+TEST(XCAFPrs_DocumentPresenterTest, SharedPrototypes)
+{
+  TopoDS_Shape                  aBox, aCyl;
+  occ::handle<TDocStd_Document> aDoc = createDocument(aBox, aCyl);
+
+  XCAFPrs_DocumentPresenter aPresenter;
+  aPresenter.Init(aDoc);
+  ASSERT_EQ(aPresenter.NbInstances(), 4);
+  // default box, box with instance color and cylinder
+  ASSERT_EQ(aPresenter.NbPrototypes(), 3);
+
+  int aNbConnected = 0;
+  for (int anInstIter = 1; anInstIter <= aPresenter.NbInstances(); ++anInstIter)
+  {
+    ASSERT_FALSE(aPresenter.Instance(anInstIter).IsNull());
+    EXPECT_FALSE(aPresenter.InstanceId(anInstIter).IsEmpty());
+    if (!occ::down_cast<AIS_ConnectedInteractive>(aPresenter.Instance(anInstIter)).IsNull())
+    {
+      ++aNbConnected;
+    }
+  }
+  EXPECT_EQ(aNbConnected, 2);
+}
+
+TEST(XCAFPrs_DocumentPresenterTest, ParallelPrepare)
+{
+  TopoDS_Shape                  aBox, aCyl;
+  occ::handle<TDocStd_Document> aDoc = createDocument(aBox, aCyl);
+
+  XCAFPrs_DocumentPresenter aPresenter;
+  aPresenter.SetRunParallel(true);
+  aPresenter.Init(aDoc);
+  EXPECT_FALSE(isTriangulated(aBox));
+  aPresenter.Prepare(occ::handle<AIS_InteractiveContext>());
+
+  // normals are computed before filling triangles in parallel
+  EXPECT_TRUE(isTriangulated(aBox, true));
+  EXPECT_TRUE(isTriangulated(aCyl, true));
+  for (int aProtoIter = 1; aProtoIter <= aPresenter.NbPrototypes(); ++aProtoIter)
+  {
+    EXPECT_FALSE(aPresenter.Prototype(aProtoIter)->Shape().IsNull());
+  }
+}
+
+TEST(XCAFPrs_DocumentPresenterTest, ParallelPrepareSharedFaces)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("XmlXCAF", aDoc);
+
+  // second part shares the face with the box
+  occ::handle<XCAFDoc_ShapeTool> aShTool  = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+  const TopoDS_Shape             aBox     = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+  const TopoDS_Shape             aFace    = TopExp_Explorer(aBox, TopAbs_FACE).Current();
+  const TDF_Label                aRootLab = aShTool->NewShape();
+  aShTool->AddComponent(aRootLab, aShTool->AddShape(aBox, false), TopLoc_Location());
+  aShTool->AddComponent(aRootLab, aShTool->AddShape(aFace, false), TopLoc_Location());
+  aShTool->UpdateAssemblies();
+
+  XCAFPrs_DocumentPresenter aPresenter;
+  aPresenter.SetRunParallel(true);
+  aPresenter.Init(aDoc);
+  ASSERT_EQ(aPresenter.NbPrototypes(), 2);
+  aPresenter.Prepare(occ::handle<AIS_InteractiveContext>());
+  EXPECT_TRUE(isTriangulated(aBox, true));
+}
+
+TEST(XCAFPrs_DocumentPresenterTest, Instancing)
+{
+  TopoDS_Shape                  aBox, aCyl;
+  occ::handle<TDocStd_Document> aDoc = createDocument(aBox, aCyl);
+
+  XCAFPrs_DocumentPresenter aPresenter;
+  aPresenter.SetUseInstancing(true);
+  aPresenter.Init(aDoc);
+  ASSERT_EQ(aPresenter.NbInstances(), 4);
+  ASSERT_EQ(aPresenter.NbPrototypes(), 3);
+
+  // two default boxes are drawn by the same prototype, while colored box keeps its own
+  EXPECT_EQ(aPresenter.Instance(1), aPresenter.Instance(2));
+  EXPECT_NE(aPresenter.Instance(1), aPresenter.Instance(3));
+  EXPECT_TRUE(aPresenter.Instance(1)->LocalTransformation().Form() == gp_Identity);
+  for (int anInstIter = 1; anInstIter <= aPresenter.NbInstances(); ++anInstIter)
+  {
+    EXPECT_TRUE(occ::down_cast<AIS_ConnectedInteractive>(aPresenter.Instance(anInstIter)).IsNull());
+  }
+
+  aPresenter.Prepare(occ::handle<AIS_InteractiveContext>());
+  EXPECT_TRUE(isTriangulated(aBox, true));
+}
@@ -11,6 +11,8 @@ set(OCCT_XCAFPrs_FILES
   XCAFPrs_DocumentExplorer.hxx
   XCAFPrs_DocumentIdIterator.hxx
   XCAFPrs_DocumentNode.hxx
+  XCAFPrs_DocumentPresenter.cxx
+  XCAFPrs_DocumentPresenter.hxx
   XCAFPrs_Driver.cxx
   XCAFPrs_Driver.hxx
   XCAFPrs_Style.cxx
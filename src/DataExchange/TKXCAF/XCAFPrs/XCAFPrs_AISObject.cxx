@@ -40,7 +40,8 @@ IMPLEMENT_STANDARD_RTTIEXT(XCAFPrs_AISObject, AIS_ColoredShape)
 
 XCAFPrs_AISObject::XCAFPrs_AISObject(const TDF_Label& theLabel)
     : AIS_ColoredShape(TopoDS_Shape()),
-      myToSyncStyles(true)
+      myToSyncStyles(true),
+      myHasPreparedStyles(false)
 {
   // define plastic material by default for proper color reproduction
   setMaterial(myDrawer, Graphic3d_NameOfMaterial_Plastified, false, false);
@@ -212,25 +213,7 @@ void XCAFPrs_AISObject::Compute(
   const occ::handle<Prs3d_Presentation>&         thePrs,
   const int                                      theMode)
 {
-  // update shape and sub-shapes styles only on first compute, or on first recompute
-  if (myToSyncStyles)
-  {
-    bool toMapStyles = myToSyncStyles;
-    for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(myPresentations);
-         aPrsIter.More();
-         aPrsIter.Next())
-    {
-      if (aPrsIter.Value() != thePrs && !aPrsIter.Value()->MustBeUpdated())
-      {
-        toMapStyles = false;
-        break;
-      }
-    }
-    if (toMapStyles)
-    {
-      DispatchStyles(true);
-    }
-  }
+  updateStyles(thePrs);
   if (myshape.IsNull())
   {
     return;
@@ -258,6 +241,32 @@ void XCAFPrs_AISObject::Compute(
 
 //=================================================================================================
 
+void XCAFPrs_AISObject::updateStyles(const occ::handle<Prs3d_Presentation>& thePrs)
+{
+  // update shape and sub-shapes styles only on first compute, or on first recompute
+  if (myToSyncStyles && !myHasPreparedStyles)
+  {
+    bool toMapStyles = myToSyncStyles;
+    for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(myPresentations);
+         aPrsIter.More();
+         aPrsIter.Next())
+    {
+      if (aPrsIter.Value() != thePrs && !aPrsIter.Value()->MustBeUpdated())
+      {
+        toMapStyles = false;
+        break;
+      }
+    }
+    if (toMapStyles)
+    {
+      DispatchStyles(true);
+    }
+  }
+  myHasPreparedStyles = false;
+}
+
+//=================================================================================================
+
 void XCAFPrs_AISObject::setStyleToDrawer(const occ::handle<Prs3d_Drawer>& theDrawer,
                                          const XCAFPrs_Style&             theStyle,
                                          const XCAFPrs_Style&             theDefStyle,
@@ -299,6 +308,40 @@ void XCAFPrs_AISObject::setStyleToDrawer(const occ::handle<Prs3d_Drawer>& theDra
   theDrawer->VIsoAspect()->SetColor(aSurfColor.GetRGB());
 }
 
+//=================================================================================================
+
+void XCAFPrs_AISObject::PrepareCompute(const int theMode, const Message_ProgressRange& theRange)
+{
+  PrepareStyles();
+  AIS_ColoredShape::PrepareCompute(theMode, theRange);
+}
+
+//=================================================================================================
+
+void XCAFPrs_AISObject::PrepareStyles()
+{
+  // styles are fetched by Compute() only when there are no other valid presentations
+  if (myToSyncStyles && !myHasPreparedStyles)
+  {
+    bool toMapStyles = true;
+    for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(myPresentations);
+         aPrsIter.More();
+         aPrsIter.Next())
+    {
+      if (!aPrsIter.Value()->MustBeUpdated())
+      {
+        toMapStyles = false;
+        break;
+      }
+    }
+    if (toMapStyles)
+    {
+      DispatchStyles(true);
+      myHasPreparedStyles = true;
+    }
+  }
+}
+
 //=======================================================================
 // function : DefaultStyle
 // purpose  : DefaultStyle() can be redefined by subclasses in order to set custom default style
@@ -46,6 +46,17 @@ public:
   //! Re-computation of existing presentation is not required after calling this method.
   Standard_EXPORT void SetMaterial(const Graphic3d_MaterialAspect& theMaterial) override;
 
+  //! Fetches styles from the document (when they should be synchronized within Compute())
+  //! and prepares presentation data as AIS_ColoredShape does.
+  //! The document should not be modified while this method is in progress.
+  Standard_EXPORT void PrepareCompute(const int                    theMode,
+                                      const Message_ProgressRange& theRange) override;
+
+  //! Fetches styles and the shape from the document, when they should be synchronized
+  //! within Compute(); called by PrepareCompute().
+  //! The document should not be modified while this method is in progress.
+  Standard_EXPORT void PrepareStyles();
+
 protected:
   //! Redefined method to compute presentation.
   Standard_EXPORT void Compute(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
@@ -57,6 +68,10 @@ protected:
   //! By default, the style uses white color for curves and surfaces.
   Standard_EXPORT virtual void DefaultStyle(XCAFPrs_Style& theStyle) const;
 
+  //! Fetches styles from the document on first compute or on first recompute,
+  //! unless they have been already fetched by PrepareStyles(); called by Compute().
+  Standard_EXPORT void updateStyles(const occ::handle<Prs3d_Presentation>& thePrs);
+
 protected:
   //! Assign style to drawer.
   static void setStyleToDrawer(const occ::handle<Prs3d_Drawer>& theDrawer,
@@ -69,6 +84,7 @@ protected:
   // clang-format off
   bool myToSyncStyles; //!< flag indicating that shape and sub-shapes should be updates within Compute()
   // clang-format on
+  bool myHasPreparedStyles; //!< flag indicating that styles have been fetched by PrepareStyles()
 
 public:
   DEFINE_STANDARD_RTTIEXT(XCAFPrs_AISObject, AIS_ColoredShape)
@@ -0,0 +1,551 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <XCAFPrs_DocumentPresenter.hxx>
+
+#include <AIS_ConnectedInteractive.hxx>
+#include <Graphic3d_ArrayOfPoints.hxx>
+#include <Graphic3d_ArrayOfSegments.hxx>
+#include <Graphic3d_ArrayOfTriangles.hxx>
+#include <Graphic3d_InstanceBuffer.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Map.hxx>
+#include <OSD_Parallel.hxx>
+#include <Prs3d_LineAspect.hxx>
+#include <Prs3d_PointAspect.hxx>
+#include <Prs3d_ShadingAspect.hxx>
+#include <Select3D_SensitiveInstances.hxx>
+#include <SelectMgr_Selection.hxx>
+#include <SelectMgr_SensitiveEntity.hxx>
+#include <StdPrs_ShadedShape.hxx>
+#include <StdPrs_ToolTriangulatedShape.hxx>
+#include <StdPrs_WFShape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_LayerTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFDoc_VisMaterialTool.hxx>
+#include <XCAFPrs_DocumentExplorer.hxx>
+
+namespace
+{
+//! Returns the shape without location and orientation, identifying shared TShape.
+TopoDS_Shape unlocatedShape(const TopoDS_Shape& theShape)
+{
+  return theShape.Located(TopLoc_Location()).Oriented(TopAbs_FORWARD);
+}
+
+//! Prototype presentation using the style inherited from assembly as default one.
+class XCAFPrs_PrototypeObject : public XCAFPrs_AISObject
+{
+  DEFINE_STANDARD_RTTI_INLINE(XCAFPrs_PrototypeObject, XCAFPrs_AISObject)
+public:
+  XCAFPrs_PrototypeObject(const TDF_Label& theLabel, const XCAFPrs_Style& theStyle)
+      : XCAFPrs_AISObject(theLabel),
+        myDefStyle(theStyle)
+  {
+  }
+
+protected:
+  void DefaultStyle(XCAFPrs_Style& theStyle) const override { theStyle = myDefStyle; }
+
+private:
+  XCAFPrs_Style myDefStyle;
+};
+
+//! Prototype presentation drawing all instances of the part using hardware instancing.
+//! Triangles and edges are filled once and displayed at each instance location,
+//! so that all instances are highlighted and selected together as a single object.
+//! Only whole-object selection (mode 0) is supported.
+class XCAFPrs_InstancedPrototypeObject : public XCAFPrs_PrototypeObject
+{
+  DEFINE_STANDARD_RTTI_INLINE(XCAFPrs_InstancedPrototypeObject, XCAFPrs_PrototypeObject)
+public:
+  XCAFPrs_InstancedPrototypeObject(const TDF_Label& theLabel, const XCAFPrs_Style& theStyle)
+      : XCAFPrs_PrototypeObject(theLabel, theStyle),
+        myInstances(new Graphic3d_InstanceBuffer())
+  {
+  }
+
+  //! Adds the instance at specified location.
+  void AddInstance(const TopLoc_Location& theLocation)
+  {
+    myInstances->AddInstance(theLocation.Transformation());
+  }
+
+  //! Bounding box presentation (mode 2) is not supported.
+  bool AcceptDisplayMode(const int theMode) const override
+  {
+    return theMode == AIS_WireFrame || theMode == AIS_Shaded;
+  }
+
+protected:
+  void Compute(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
+               const occ::handle<Prs3d_Presentation>&         thePrs,
+               const int                                      theMode) override;
+
+  void ComputeSelection(const occ::handle<SelectMgr_Selection>& theSelection,
+                        const int                               theMode) override;
+
+private:
+  //! Adds a new group displaying primitive array at all instance locations.
+  void addInstancedArray(const occ::handle<Prs3d_Presentation>&          thePrs,
+                         const occ::handle<Graphic3d_Aspects>&           theAspect,
+                         const occ::handle<Graphic3d_ArrayOfPrimitives>& theArray,
+                         const bool                                      theIsClosed = false)
+  {
+    if (theArray.IsNull())
+    {
+      return;
+    }
+
+    occ::handle<Graphic3d_Group> aGroup = thePrs->NewGroup();
+    aGroup->SetClosed(theIsClosed);
+    aGroup->SetPrimitivesAspect(theAspect);
+    aGroup->AddInstancedPrimitiveArray(theArray, myInstances);
+  }
+
+private:
+  occ::handle<Graphic3d_InstanceBuffer> myInstances; //!< locations of instances
+};
+
+//=================================================================================================
+
+void XCAFPrs_InstancedPrototypeObject::Compute(const occ::handle<PrsMgr_PresentationManager>&,
+                                               const occ::handle<Prs3d_Presentation>& thePrs,
+                                               const int                              theMode)
+{
+  updateStyles(thePrs);
+  if (myshape.IsNull() || (myshape.ShapeType() == TopAbs_COMPOUND && myshape.NbChildren() == 0)
+      || !AcceptDisplayMode(theMode))
+  {
+    return;
+  }
+
+  // same preparation of triangulation as within AIS_ColoredShape::Compute()
+  StdPrs_ToolTriangulatedShape::ClearOnOwnDeflectionChange(myshape, myDrawer, true);
+  if (theMode == AIS_Shaded && myDrawer->IsAutoTriangulation())
+  {
+    if (StdPrs_ToolTriangulatedShape::Tessellate(myshape, myDrawer))
+    {
+      clearPreparedTriangles();
+    }
+  }
+  else
+  {
+    StdPrs_ToolTriangulatedShape::GetDeflection(myshape, myDrawer);
+  }
+  if (!myPreparedShape.IsEqual(myshape))
+  {
+    clearPreparedTriangles();
+  }
+
+  NCollection_DataMap<TopoDS_Shape, occ::handle<AIS_ColoredDrawer>, TopTools_ShapeMapHasher>
+    aSubshapeDrawerMap;
+  fillSubshapeDrawerMap(aSubshapeDrawerMap);
+
+  occ::handle<AIS_ColoredDrawer> aBaseDrawer;
+  myShapeColors.Find(myshape, aBaseDrawer);
+
+  DataMapOfDrawerCompd aDispatchedOpened[(size_t)TopAbs_SHAPE];
+  DataMapOfDrawerCompd aDispatchedClosed;
+  dispatchColors(aBaseDrawer,
+                 myshape,
+                 aSubshapeDrawerMap,
+                 TopAbs_COMPOUND,
+                 false,
+                 aDispatchedOpened,
+                 theMode == AIS_Shaded ? aDispatchedClosed : aDispatchedOpened[TopAbs_FACE]);
+  for (size_t aShType = 0; aShType <= (size_t)TopAbs_SHAPE; ++aShType)
+  {
+    const bool                  isClosed = aShType == TopAbs_SHAPE;
+    const DataMapOfDrawerCompd& aDrawerShapeMap =
+      isClosed ? aDispatchedClosed : aDispatchedOpened[aShType];
+    for (DataMapOfDrawerCompd::Iterator aMapIter(aDrawerShapeMap); aMapIter.More(); aMapIter.Next())
+    {
+      const occ::handle<AIS_ColoredDrawer>& aCustomDrawer = aMapIter.Key();
+      const TopoDS_Compound&                aShapeDraw    = aMapIter.Value();
+      occ::handle<Prs3d_Drawer>             aDrawer       = myDrawer;
+      if (!aCustomDrawer.IsNull())
+      {
+        if (aCustomDrawer->IsHidden())
+        {
+          continue;
+        }
+        aDrawer = aCustomDrawer;
+      }
+
+      // absolute deflection contains previously computed relative deflection
+      const Aspect_TypeOfDeflection aPrevType = aDrawer->TypeOfDeflection();
+      aDrawer->SetTypeOfDeflection(Aspect_TOD_ABSOLUTE);
+      if (aShType == TopAbs_VERTEX)
+      {
+        addInstancedArray(thePrs,
+                          aDrawer->PointAspect()->Aspect(),
+                          StdPrs_WFShape::AddVertexes(aShapeDraw, aDrawer->VertexDrawMode()));
+      }
+      else if (theMode == AIS_Shaded && (isClosed || aShType == TopAbs_FACE))
+      {
+        // take triangles filled by PrepareCompute(), if any
+        occ::handle<Graphic3d_ArrayOfTriangles> aTriangles;
+        if (!myPreparedTriangles[aShType].Find(aCustomDrawer, aTriangles))
+        {
+          aTriangles = fillTriangles(aShapeDraw, aDrawer);
+        }
+        addInstancedArray(thePrs, aDrawer->ShadingAspect()->Aspect(), aTriangles, isClosed);
+        if (aDrawer->FaceBoundaryDraw())
+        {
+          addInstancedArray(
+            thePrs,
+            aDrawer->FaceBoundaryAspect()->Aspect(),
+            StdPrs_ShadedShape::FillFaceBoundaries(aShapeDraw,
+                                                   aDrawer->FaceBoundaryUpperContinuity()));
+        }
+      }
+      else
+      {
+        addInstancedArray(thePrs,
+                          aDrawer->WireAspect()->Aspect(),
+                          StdPrs_WFShape::AddAllEdges(aShapeDraw, aDrawer));
+      }
+      aDrawer->SetTypeOfDeflection(aPrevType);
+    }
+  }
+  clearPreparedTriangles();
+}
+
+//=================================================================================================
+
+void XCAFPrs_InstancedPrototypeObject::ComputeSelection(
+  const occ::handle<SelectMgr_Selection>& theSelection,
+  const int                               theMode)
+{
+  if (theMode != 0)
+  {
+    return;
+  }
+
+  // sensitive entities of the part are shared by all instances
+  occ::handle<SelectMgr_Selection> aPartSelection = new SelectMgr_Selection(theMode);
+  XCAFPrs_PrototypeObject::ComputeSelection(aPartSelection, theMode);
+  for (NCollection_DynamicArray<occ::handle<SelectMgr_SensitiveEntity>>::Iterator aSelEntIter(
+         aPartSelection->Entities());
+       aSelEntIter.More();
+       aSelEntIter.Next())
+  {
+    const occ::handle<Select3D_SensitiveEntity>& aSensitive = aSelEntIter.Value()->BaseSensitive();
+    theSelection->Add(
+      new Select3D_SensitiveInstances(aSensitive->OwnerId(), aSensitive, myInstances));
+  }
+}
+} // namespace
+
+//=================================================================================================
+
+XCAFPrs_DocumentPresenter::XCAFPrs_DocumentPresenter()
+    : myDisplayMode(AIS_Shaded),
+      myIsRunParallel(true),
+      myToUseInstancing(false),
+      myIsPrepared(false)
+{
+}
+
+//=================================================================================================
+
+void XCAFPrs_DocumentPresenter::Init(const occ::handle<TDocStd_Document>& theDocument)
+{
+  NCollection_Sequence<TDF_Label> aRoots;
+  if (!theDocument.IsNull())
+  {
+    XCAFDoc_DocumentTool::ShapeTool(theDocument->Main())->GetFreeShapes(aRoots);
+  }
+  Init(theDocument, aRoots);
+}
+
+//=================================================================================================
+
+void XCAFPrs_DocumentPresenter::Init(const occ::handle<TDocStd_Document>&   theDocument,
+                                     const NCollection_Sequence<TDF_Label>& theRoots)
+{
+  myDocument = theDocument;
+  myPrototypes.Clear();
+  myInstances.Clear();
+  myIsPrepared = false;
+  if (theDocument.IsNull())
+  {
+    return;
+  }
+
+  // the same default style as XCAFPrs_AISObject::DefaultStyle()
+  XCAFPrs_Style aDefStyle;
+  aDefStyle.SetColorSurf(Quantity_NOC_WHITE);
+  aDefStyle.SetColorCurv(Quantity_NOC_WHITE);
+
+  // nodes referring to the same part share prototype unless assembly overrides its style
+  NCollection_DataMap<TDF_Label, NCollection_List<int>> aPartPrototypes;
+  for (XCAFPrs_DocumentExplorer aDocExp(theDocument,
+                                        theRoots,
+                                        XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes,
+                                        aDefStyle);
+       aDocExp.More();
+       aDocExp.Next())
+  {
+    const XCAFPrs_DocumentNode& aNode     = aDocExp.Current();
+    NCollection_List<int>*      aPartList = aPartPrototypes.ChangeSeek(aNode.RefLabel);
+    if (aPartList == nullptr)
+    {
+      aPartList = aPartPrototypes.Bound(aNode.RefLabel, NCollection_List<int>());
+    }
+
+    int aProtoIndex = -1;
+    for (NCollection_List<int>::Iterator aProtoIter(*aPartList); aProtoIter.More();
+         aProtoIter.Next())
+    {
+      if (myPrototypes.Value(aProtoIter.Value()).Style.IsEqual(aNode.Style))
+      {
+        aProtoIndex = aProtoIter.Value();
+        break;
+      }
+    }
+    if (aProtoIndex == -1)
+    {
+      PrototypeNode aProto;
+      aProto.Object      = new XCAFPrs_PrototypeObject(aNode.RefLabel, aNode.Style);
+      aProto.Style       = aNode.Style;
+      aProto.NbInstances = 0;
+      aProtoIndex        = myPrototypes.Length();
+      myPrototypes.Append(aProto);
+      aPartList->Append(aProtoIndex);
+    }
+    ++myPrototypes.ChangeValue(aProtoIndex).NbInstances;
+
+    InstanceNode anInstance;
+    anInstance.Id        = aNode.Id;
+    anInstance.Location  = aNode.Location;
+    anInstance.Prototype = aProtoIndex;
+    myInstances.Append(anInstance);
+  }
+
+  if (myToUseInstancing)
+  {
+    for (NCollection_DynamicArray<PrototypeNode>::Iterator aProtoIter(myPrototypes);
+         aProtoIter.More();
+         aProtoIter.Next())
+    {
+      PrototypeNode& aProto = aProtoIter.ChangeValue();
+      if (aProto.NbInstances > 1)
+      {
+        aProto.Object =
+          new XCAFPrs_InstancedPrototypeObject(aProto.Object->GetLabel(), aProto.Style);
+      }
+    }
+  }
+
+  // single instance displays the prototype itself, while shared one is displayed via connection
+  // or by the prototype drawing all its instances
+  for (NCollection_DynamicArray<InstanceNode>::Iterator anInstIter(myInstances); anInstIter.More();
+       anInstIter.Next())
+  {
+    InstanceNode&        anInstance = anInstIter.ChangeValue();
+    const PrototypeNode& aProto     = myPrototypes.Value(anInstance.Prototype);
+    if (aProto.NbInstances == 1)
+    {
+      if (!anInstance.Location.IsIdentity())
+      {
+        aProto.Object->SetLocalTransformation(anInstance.Location);
+      }
+      anInstance.Object = aProto.Object;
+    }
+    else if (occ::handle<XCAFPrs_InstancedPrototypeObject> anInstanced =
+               occ::down_cast<XCAFPrs_InstancedPrototypeObject>(aProto.Object))
+    {
+      anInstanced->AddInstance(anInstance.Location);
+      anInstance.Object = aProto.Object;
+    }
+    else
+    {
+      occ::handle<AIS_ConnectedInteractive> aConnected = new AIS_ConnectedInteractive();
+      aConnected->Connect(aProto.Object, anInstance.Location.Transformation());
+      anInstance.Object = aConnected;
+    }
+  }
+}
+
+//=================================================================================================
+
+void XCAFPrs_DocumentPresenter::Prepare(const occ::handle<AIS_InteractiveContext>& theContext,
+                                        const Message_ProgressRange&               theRange)
+{
+  myIsPrepared = true;
+  if (myPrototypes.IsEmpty())
+  {
+    return;
+  }
+
+  // document tools are created on first access and cache shape tool,
+  // so that they should be initialized before fetching styles from multiple threads
+  const TDF_Label aMainLab = myDocument->Main();
+  XCAFDoc_DocumentTool::ShapeTool(aMainLab);
+  XCAFDoc_DocumentTool::ColorTool(aMainLab)->ShapeTool();
+  XCAFDoc_DocumentTool::LayerTool(aMainLab)->ShapeTool();
+  XCAFDoc_DocumentTool::VisMaterialTool(aMainLab)->ShapeTool();
+
+  for (int aProtoIter = 0; aProtoIter < myPrototypes.Length(); ++aProtoIter)
+  {
+    // link to default drawer of the context defining deflection and other parameters
+    myPrototypes.Value(aProtoIter).Object->SetContext(theContext);
+  }
+
+  // fetch styles and shapes of prototypes
+  OSD_Parallel::For(
+    0,
+    myPrototypes.Length(),
+    [&](const int theIndex) { myPrototypes.Value(theIndex).Object->PrepareStyles(); },
+    !myIsRunParallel);
+
+  // triangulation is stored within faces and polygons on triangulation within edges,
+  // which are shared by prototypes of the same part and might be shared by different parts,
+  // so that each part is triangulated only once
+  // and parts sharing faces or edges with other parts are triangulated sequentially
+  NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> aPartGroups, aSubShapeGroups;
+  NCollection_DynamicArray<int>                                   aGroupPrototypes;
+  NCollection_DynamicArray<bool>                                  aGroupIsShared;
+
+  const TopAbs_ShapeEnum aSharedTypes[2] = {TopAbs_FACE, TopAbs_EDGE};
+  for (int aProtoIter = 0; aProtoIter < myPrototypes.Length(); ++aProtoIter)
+  {
+    const TopoDS_Shape aPart = unlocatedShape(myPrototypes.Value(aProtoIter).Object->Shape());
+    if (aPart.IsNull() || aPartGroups.IsBound(aPart))
+    {
+      continue;
+    }
+
+    const int aGroup = aGroupPrototypes.Length();
+    aPartGroups.Bind(aPart, aGroup);
+    aGroupPrototypes.Append(aProtoIter);
+    aGroupIsShared.Append(false);
+    for (const TopAbs_ShapeEnum aType : aSharedTypes)
+    {
+      for (TopExp_Explorer aSubIter(aPart, aType); aSubIter.More(); aSubIter.Next())
+      {
+        const TopoDS_Shape aSubShape = unlocatedShape(aSubIter.Current());
+        if (const int* anOwner = aSubShapeGroups.Seek(aSubShape))
+        {
+          if (*anOwner != aGroup)
+          {
+            aGroupIsShared.ChangeValue(*anOwner) = true;
+            aGroupIsShared.ChangeValue(aGroup)   = true;
+          }
+        }
+        else
+        {
+          aSubShapeGroups.Bind(aSubShape, aGroup);
+        }
+      }
+    }
+  }
+
+  Message_ProgressScope aPS(theRange, "Preparing presentations", 2);
+  {
+    Message_ProgressScope aMeshPS(aPS.Next(), "Triangulating parts", aGroupPrototypes.Length());
+    NCollection_DynamicArray<int>                   aParallelGroups;
+    NCollection_DynamicArray<Message_ProgressRange> aMeshRanges;
+    for (int aGroupIter = 0; aGroupIter < aGroupPrototypes.Length(); ++aGroupIter)
+    {
+      aMeshRanges.Append(aMeshPS.Next());
+      if (aGroupIsShared.Value(aGroupIter))
+      {
+        const int aProtoIndex = aGroupPrototypes.Value(aGroupIter);
+        myPrototypes.Value(aProtoIndex)
+          .Object->PrepareTriangulation(myDisplayMode, aMeshRanges.Value(aGroupIter));
+      }
+      else
+      {
+        aParallelGroups.Append(aGroupIter);
+      }
+    }
+
+    OSD_Parallel::For(
+      0,
+      aParallelGroups.Length(),
+      [&](const int theIndex) {
+        const int                    aGroup = aParallelGroups.Value(theIndex);
+        const Message_ProgressRange& aRange = aMeshRanges.Value(aGroup);
+        if (aRange.UserBreak())
+        {
+          return;
+        }
+        myPrototypes.Value(aGroupPrototypes.Value(aGroup))
+          .Object->PrepareTriangulation(myDisplayMode, aRange);
+      },
+      !myIsRunParallel);
+  }
+  if (!aPS.More())
+  {
+    return;
+  }
+
+  // triangles are filled from the triangulation prepared above without modifying it
+  Message_ProgressScope aFillPS(aPS.Next(), "Filling triangles", myPrototypes.Length());
+  NCollection_Array1<Message_ProgressRange> aRanges(0, myPrototypes.Length() - 1);
+  for (int aProtoIter = 0; aProtoIter < myPrototypes.Length(); ++aProtoIter)
+  {
+    aRanges.ChangeValue(aProtoIter) = aFillPS.Next();
+  }
+
+  OSD_Parallel::For(
+    0,
+    myPrototypes.Length(),
+    [&](const int theIndex) {
+      if (aRanges.Value(theIndex).UserBreak())
+      {
+        return;
+      }
+      myPrototypes.Value(theIndex).Object->PrepareTriangles(myDisplayMode,
+                                                            aRanges.Value(theIndex));
+    },
+    !myIsRunParallel);
+}
+
+//=================================================================================================
+
+void XCAFPrs_DocumentPresenter::Display(const occ::handle<AIS_InteractiveContext>& theContext,
+                                        const bool                   theToUpdateViewer,
+                                        const Message_ProgressRange& theRange)
+{
+  if (!myIsPrepared)
+  {
+    Prepare(theContext, theRange);
+  }
+
+  // instanced prototype is shared by all its instances and displayed only once
+  NCollection_Map<occ::handle<AIS_InteractiveObject>> aDisplayed;
+  for (NCollection_DynamicArray<InstanceNode>::Iterator anInstIter(myInstances); anInstIter.More();
+       anInstIter.Next())
+  {
+    const occ::handle<AIS_InteractiveObject>& anObject = anInstIter.Value().Object;
+    if (aDisplayed.Add(anObject))
+    {
+      theContext->Display(anObject, myDisplayMode, 0, false);
+    }
+  }
+  if (theToUpdateViewer)
+  {
+    theContext->UpdateCurrentViewer();
+  }
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _XCAFPrs_DocumentPresenter_HeaderFile
+#define _XCAFPrs_DocumentPresenter_HeaderFile
+
+#include <AIS_InteractiveContext.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <TDocStd_Document.hxx>
+#include <XCAFPrs_AISObject.hxx>
+#include <XCAFPrs_Style.hxx>
+
+//! Builds and displays presentations of the whole XDE document in bulk.
+//!
+//! Leaf nodes of the document are gathered with XCAFPrs_DocumentExplorer;
+//! nodes referring to the same part with the same inherited style share a single prototype
+//! presentation (XCAFPrs_AISObject), which is displayed through AIS_ConnectedInteractive
+//! when the part is instanced several times
+//! (or draws all instances itself when hardware instancing is enabled by SetUseInstancing()).
+//! Styles of prototypes are fetched, shapes are triangulated and primitive arrays are filled
+//! in parallel threads (see AIS_InteractiveObject::PrepareCompute()),
+//! and then all instances are displayed within a single pass.
+//!
+//! Triangulation is stored within shared faces and edges, so that each part is triangulated
+//! by a single thread before filling primitive arrays of its prototypes,
+//! while parts sharing faces or edges with other parts are triangulated sequentially.
+class XCAFPrs_DocumentPresenter
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty presenter.
+  Standard_EXPORT XCAFPrs_DocumentPresenter();
+
+  //! Returns the display mode; AIS_Shaded by default.
+  int DisplayMode() const { return myDisplayMode; }
+
+  //! Sets the display mode to prepare and display presentations.
+  void SetDisplayMode(const int theMode) { myDisplayMode = theMode; }
+
+  //! Sets the flag to prepare prototypes in parallel threads; TRUE by default.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if prototypes are prepared in parallel threads.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
+  //! Returns TRUE if parts instanced several times are drawn using hardware instancing;
+  //! FALSE by default.
+  bool ToUseInstancing() const { return myToUseInstancing; }
+
+  //! Sets the flag to draw all instances of the prototype by a single presentation
+  //! using hardware instancing (see Graphic3d_Group::AddInstancedPrimitiveArray())
+  //! instead of AIS_ConnectedInteractive per instance.
+  //! Such instances are highlighted and selected together (only with selection mode 0).
+  //! Should be set before Init().
+  void SetUseInstancing(const bool theToUse) { myToUseInstancing = theToUse; }
+
+  //! Gathers free shapes of the document.
+  Standard_EXPORT void Init(const occ::handle<TDocStd_Document>& theDocument);
+
+  //! Gathers specified root shapes of the document.
+  //! @param[in] theDocument  document to display
+  //! @param[in] theRoots     root labels to display
+  Standard_EXPORT void Init(const occ::handle<TDocStd_Document>&   theDocument,
+                            const NCollection_Sequence<TDF_Label>& theRoots);
+
+  //! Returns the number of prototype presentations.
+  int NbPrototypes() const { return myPrototypes.Length(); }
+
+  //! Returns the prototype within [1, NbPrototypes()] range.
+  const occ::handle<XCAFPrs_AISObject>& Prototype(const int theIndex) const
+  {
+    return myPrototypes.Value(theIndex - 1).Object;
+  }
+
+  //! Returns the number of displayed instances (leaf nodes of the document).
+  int NbInstances() const { return myInstances.Length(); }
+
+  //! Returns the instance presentation within [1, NbInstances()] range,
+  //! which is either prototype itself or AIS_ConnectedInteractive referring to it;
+  //! instancing prototype is returned for all its instances when ToUseInstancing() is set.
+  const occ::handle<AIS_InteractiveObject>& Instance(const int theIndex) const
+  {
+    return myInstances.Value(theIndex - 1).Object;
+  }
+
+  //! Returns the path identifier of the instance within [1, NbInstances()] range,
+  //! as defined by XCAFPrs_DocumentExplorer.
+  const TCollection_AsciiString& InstanceId(const int theIndex) const
+  {
+    return myInstances.Value(theIndex - 1).Id;
+  }
+
+  //! Prepares presentation data of all prototypes in parallel.
+  //! The document should not be modified while this method is in progress.
+  //! @param[in] theContext  context, where presentations will be displayed
+  //! @param[in] theRange    progress range
+  Standard_EXPORT void Prepare(const occ::handle<AIS_InteractiveContext>& theContext,
+                               const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Prepares presentations (when not yet done) and displays all instances.
+  //! @param[in] theContext         context to display presentations
+  //! @param[in] theToUpdateViewer  flag to update the viewer once all instances are displayed
+  //! @param[in] theRange           progress range
+  Standard_EXPORT void Display(const occ::handle<AIS_InteractiveContext>& theContext,
+                               const bool                                 theToUpdateViewer,
+                               const Message_ProgressRange& theRange = Message_ProgressRange());
+
+private:
+  //! Prototype presentation.
+  struct PrototypeNode
+  {
+    occ::handle<XCAFPrs_AISObject> Object;      //!< presentation of the part
+    XCAFPrs_Style                  Style;       //!< style inherited from assembly
+    int                            NbInstances; //!< number of instances of the prototype
+  };
+
+  //! Instance of the prototype.
+  struct InstanceNode
+  {
+    occ::handle<AIS_InteractiveObject> Object;    //!< displayed presentation
+    TCollection_AsciiString            Id;        //!< path identifier
+    TopLoc_Location                    Location;  //!< global location
+    int                                Prototype; //!< index of the prototype (0-based)
+  };
+
+private:
+  occ::handle<TDocStd_Document>           myDocument;
+  NCollection_DynamicArray<PrototypeNode> myPrototypes;
+  NCollection_DynamicArray<InstanceNode>  myInstances;
+  int                                     myDisplayMode;
+  bool                                    myIsRunParallel;
+  bool                                    myToUseInstancing;
+  bool                                    myIsPrepared;
+};
+
+#endif // _XCAFPrs_DocumentPresenter_HeaderFile
@@ -18,6 +18,7 @@
 
 Interface_FileParameter::Interface_FileParameter()
 {
+  theval  = nullptr;
   thetype = Interface_ParamMisc;
   thenum  = 0;
 }
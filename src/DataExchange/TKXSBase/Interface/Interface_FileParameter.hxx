@@ -69,8 +69,8 @@ public:
   ~Interface_FileParameter() { Destroy(); }
 
 private:
-  Interface_ParamType thetype;
   Standard_PCharacter theval;
+  Interface_ParamType thetype;
   int                 thenum;
 };
 
@@ -540,6 +540,43 @@ static int VVbo(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
 
 //=================================================================================================
 
+static int VVboStats(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<AIS_InteractiveContext> aContextAIS = ViewerTest::GetAISContext();
+  if (aContextAIS.IsNull())
+  {
+    Message::SendFail("Error: no active viewer");
+    return 1;
+  }
+  occ::handle<OpenGl_GraphicDriver> aDriver =
+    occ::down_cast<OpenGl_GraphicDriver>(aContextAIS->CurrentViewer()->Driver());
+  if (aDriver.IsNull())
+  {
+    Message::SendFail("Error: OpenGl_GraphicDriver is not available");
+    return 1;
+  }
+
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-reset")
+    {
+      aDriver->ResetEvictionCounters();
+      return 0;
+    }
+    Message::SendFail() << "Syntax error at '" << theArgVec[anArgIter] << "'";
+    return 1;
+  }
+
+  theDI << "Budget: " << (aDriver->Options().vboMemoryBudget / 1024) << "\n";
+  theDI << "Evicted: " << int(aDriver->NbEvictedStructures()) << "\n";
+  theDI << "Reuploaded: " << int(aDriver->NbReuploadedStructures()) << "\n";
+  return 0;
+}
+
+//=================================================================================================
+
 static int VCaps(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
 {
   OpenGl_Caps*                        aCaps = getDefaultCaps().get();
@@ -570,6 +607,7 @@ static int VCaps(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
     theDI << "MaxVersion:" << aCaps->contextMajorVersionUpper << "."
           << aCaps->contextMinorVersionUpper << "\n";
     theDI << "CompressTextures: " << (aCaps->compressedTexturesDisable ? "0" : "1") << "\n";
+    theDI << "VboBudget: " << (aCaps->vboMemoryBudget / 1024) << "\n";
     return 0;
   }
 
@@ -608,6 +646,17 @@ static int VCaps(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
     {
       aCaps->vboDisable = !Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
     }
+    else if ((anArgCase == "-vbobudget" || anArgCase == "-vbomemorybudget")
+             && anArgIter + 1 < theArgNb)
+    {
+      const TCollection_AsciiString aStr(theArgVec[++anArgIter]);
+      if (!aStr.IsIntegerValue() || aStr.IntegerValue() < 0)
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      aCaps->vboMemoryBudget = size_t(aStr.IntegerValue()) * 1024;
+    }
     else if (anArgCase == "-sprite" || anArgCase == "-sprites")
     {
       aCaps->pntSpritesDisable = !Draw::ParseOnOffIterator(theArgNb, theArgVec, anArgIter);
@@ -734,6 +783,7 @@ void OpenGlTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:       [-softMode {0|1}] [-noupdate|-update]"
     "\n\t\t:       [-zeroToOneDepth {0|1}]"
     "\n\t\t:       [-noExtensions {0|1}] [-maxVersion Major Minor]"
+    "\n\t\t:       [-vboBudget KiB]"
     "\n\t\t: Modify particular graphic driver options:"
     "\n\t\t:  sRGB     - enable/disable sRGB rendering"
     "\n\t\t:  FFP      - use fixed-function pipeline instead of"
@@ -748,6 +798,8 @@ void OpenGlTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  opaqueAlpha - disable writes in alpha component of color buffer"
     "\n\t\t:  winBuffer - allow using window buffer for rendering"
     "\n\t\t:  zeroToOneDepth - use [0,1] depth range instead of [-1,1] range"
+    "\n\t\t:  vboBudget - GPU memory budget for vertex buffers in KiB;"
+    "\n\t\t:              least recently drawn structures are evicted when exceeded (0 - unlimited)"
     "\n\t\t: Window buffer creation options:"
     "\n\t\t:  quadbuffer  - QuadBuffer for stereoscopic displays"
     "\n\t\t:  deepColor   - window buffer with higher color precision (30bit instead of 24bit RGB)"
@@ -782,4 +834,13 @@ void OpenGlTest::Commands(Draw_Interpretor& theCommands)
                   __FILE__,
                   VVbo,
                   aGroup);
+  theCommands.Add("vvbostats",
+                  "vvbostats [-reset]"
+                  "\n\t\t: Prints the number of structures, which vertex buffers have been evicted"
+                  "\n\t\t: to fit the GPU memory budget (see vcaps -vboBudget)"
+                  "\n\t\t: and the number of evicted structures uploaded again."
+                  "\n\t\t:  -reset - reset counters",
+                  __FILE__,
+                  VVboStats,
+                  aGroup);
 }
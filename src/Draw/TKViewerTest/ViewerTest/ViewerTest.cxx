@@ -40,6 +40,7 @@
 #include <StdSelect_ShapeTypeFilter.hxx>
 #include <AIS_ColoredShape.hxx>
 #include <AIS_InteractiveObject.hxx>
+#include <AIS_ThumbnailRenderer.hxx>
 #include <AIS_Trihedron.hxx>
 #include <AIS_Axis.hxx>
 #include <AIS_SignatureFilter.hxx>
@@ -1314,6 +1315,90 @@ static int VDump(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
   return 0;
 }
 
+//=================================================================================================
+
+static int VThumbnails(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<AIS_InteractiveContext> aCtx  = ViewerTest::GetAISContext();
+  occ::handle<V3d_View>               aView = ViewerTest::CurrentView();
+  if (aView.IsNull())
+  {
+    Message::SendFail() << "Error: cannot find an active view!";
+    return 1;
+  }
+
+  occ::handle<AIS_ThumbnailRenderer> aRenderer = new AIS_ThumbnailRenderer(aCtx, aView);
+  TCollection_AsciiString            aFilePath;
+  NCollection_Sequence<TopoDS_Shape> aShapes;
+  int                                aNbColumns = 0;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-size" && anArgIter + 2 < theArgNb)
+    {
+      aRenderer->SetThumbnailSize(Draw::Atoi(theArgVec[anArgIter + 1]),
+                                  Draw::Atoi(theArgVec[anArgIter + 2]));
+      anArgIter += 2;
+    }
+    else if ((anArg == "-columns" || anArg == "-cols") && anArgIter + 1 < theArgNb)
+    {
+      aNbColumns = Draw::Atoi(theArgVec[++anArgIter]);
+    }
+    else if ((anArg == "-dispmode" || anArg == "-displaymode") && anArgIter + 1 < theArgNb)
+    {
+      aRenderer->SetDisplayMode(Draw::Atoi(theArgVec[++anArgIter]));
+    }
+    else if (aFilePath.IsEmpty())
+    {
+      aFilePath = theArgVec[anArgIter];
+    }
+    else
+    {
+      TopoDS_Shape aShape = DBRep::Get(theArgVec[anArgIter]);
+      if (aShape.IsNull())
+      {
+        Message::SendFail() << "Syntax error: '" << theArgVec[anArgIter] << "' is not a shape";
+        return 1;
+      }
+      aShapes.Append(aShape);
+    }
+  }
+  if (aFilePath.IsEmpty() || aShapes.IsEmpty())
+  {
+    Message::SendFail("Syntax error: wrong number of arguments");
+    return 1;
+  }
+  else if (aRenderer->ThumbnailWidth() <= 0 || aRenderer->ThumbnailHeight() <= 0)
+  {
+    Message::SendFail("Syntax error: wrong thumbnail size");
+    return 1;
+  }
+  if (aNbColumns <= 0)
+  {
+    aNbColumns = (int)std::ceil(std::sqrt((double)aShapes.Length()));
+  }
+
+  NCollection_Array1<occ::handle<AIS_InteractiveObject>> anObjects(1, aShapes.Length());
+  for (int aShapeIter = 1; aShapeIter <= aShapes.Length(); ++aShapeIter)
+  {
+    anObjects.SetValue(aShapeIter, new AIS_Shape(aShapes.Value(aShapeIter)));
+  }
+
+  Image_AlienPixMap aPixMap;
+  const bool        isDone = aRenderer->PerformTiled(anObjects, aPixMap, aNbColumns);
+  aView->Redraw();
+  if (!isDone)
+  {
+    theDI << "Fail: thumbnails rendering failed!\n";
+  }
+  if (!aPixMap.Save(aFilePath))
+  {
+    theDI << "Fail: image can not be saved!\n";
+  }
+  return 0;
+}
+
 enum TypeOfDispOperation
 {
   TypeOfDispOperation_SetDispMode,
@@ -6832,6 +6917,15 @@ vdump <filename>.png [-width Width -height Height]
 Dumps content of the active view into image file.
 )" /* [vdump] */);
 
+  addCmd("vthumbnails", VThumbnails, /* [vthumbnails] */ R"(
+vthumbnails <filename>.png shape1 [shape2 [...]]
+            [-size Width Height=256 256] [-columns NbColumns] [-dispMode Mode=1]
+Renders thumbnails of shapes one after another within the active view
+and saves them as tiles of a single image.
+Shapes should not be displayed in the view.
+ -columns number of tiles in a row; by default tiles form a square.
+)" /* [vthumbnails] */);
+
   addCmd("vsub", VSubInt, /* [vsub] */ R"(
 vsub 0/1 (off/on) [obj] : Subintensity(on/off) of selected objects
 )" /* [vsub] */);
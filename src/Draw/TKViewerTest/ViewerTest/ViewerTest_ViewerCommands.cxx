@@ -68,6 +68,7 @@
 #include <Message_ProgressScope.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_LocalArray.hxx>
+#include <OSD_OpenFile.hxx>
 #include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <Prs3d_ShadingAspect.hxx>
@@ -10722,6 +10723,14 @@ static bool parsePerfStatsFlag(const TCollection_AsciiString&           theValue
   {
     aFlag = Graphic3d_RenderingParams::PerfCounters_FrameTime;
   }
+  else if (aVal == "culling")
+  {
+    aFlag = Graphic3d_RenderingParams::PerfCounters_Culling;
+  }
+  else if (aVal == "itemtimers" || aVal == "structtimers")
+  {
+    aFlag = Graphic3d_RenderingParams::PerfCounters_ItemTimers;
+  }
   else if (aVal == "basic")
   {
     aFlag = Graphic3d_RenderingParams::PerfCounters_Basic;
@@ -10956,6 +10965,14 @@ static int VRenderParams(Draw_Interpretor& theDI, int theArgNb, const char** the
       {
         theDI << " frameTime";
       }
+      if ((aParams.CollectedStats & Graphic3d_RenderingParams::PerfCounters_Culling) != 0)
+      {
+        theDI << " culling";
+      }
+      if ((aParams.CollectedStats & Graphic3d_RenderingParams::PerfCounters_ItemTimers) != 0)
+      {
+        theDI << " itemTimers";
+      }
       if ((aParams.CollectedStats & Graphic3d_RenderingParams::PerfCounters_SkipImmediate) != 0)
       {
         theDI << " skipimmediate";
@@ -12114,6 +12131,7 @@ static int VStatProfiler(Draw_Interpretor& theDI, int theArgNb, const char** the
   }
 
   bool                                    toRedraw = true;
+  TCollection_AsciiString                 aCapturePath;
   Graphic3d_RenderingParams::PerfCounters aPrevCounters =
     aView->ChangeRenderingParams().CollectedStats;
   float aPrevUpdInterval = aView->ChangeRenderingParams().StatsUpdateInterval;
@@ -12128,6 +12146,10 @@ static int VStatProfiler(Draw_Interpretor& theDI, int theArgNb, const char** the
     {
       toRedraw = false;
     }
+    else if (aFlag == "-capture" && anArgIter + 1 < theArgNb)
+    {
+      aCapturePath = theArgVec[++anArgIter];
+    }
     else
     {
       Graphic3d_RenderingParams::PerfCounters aParam = Graphic3d_RenderingParams::PerfCounters_NONE;
@@ -12179,6 +12201,11 @@ static int VStatProfiler(Draw_Interpretor& theDI, int theArgNb, const char** the
       {
         aParam = Graphic3d_RenderingParams::PerfCounters_FrameTime;
       }
+      else if (aFlag == "cullingtests" || aFlag == "culledfrustum" || aFlag == "culleddistance"
+               || aFlag == "culledsize")
+      {
+        aParam = Graphic3d_RenderingParams::PerfCounters_Culling;
+      }
       else
       {
         Message::SendFail() << "Error: unknown argument '" << theArgVec[anArgIter] << "'";
@@ -12189,6 +12216,38 @@ static int VStatProfiler(Draw_Interpretor& theDI, int theArgNb, const char** the
     }
   }
 
+  if (!aCapturePath.IsEmpty())
+  {
+    occ::handle<Graphic3d_FrameStats> aStats = aView->FrameStats();
+    if (aStats.IsNull())
+    {
+      Message::SendFail("Error: frame statistics are not supported by the view");
+      return 1;
+    }
+
+    aView->ChangeRenderingParams().CollectedStats = Graphic3d_RenderingParams::PerfCounters(
+      aPrevCounters | Graphic3d_RenderingParams::PerfCounters_Culling
+      | Graphic3d_RenderingParams::PerfCounters_ItemTimers);
+    aView->ChangeRenderingParams().StatsUpdateInterval = -1;
+    aView->Redraw();
+    aView->ChangeRenderingParams().StatsUpdateInterval = aPrevUpdInterval;
+    aView->ChangeRenderingParams().CollectedStats      = aPrevCounters;
+
+    std::ofstream aFile;
+    OSD_OpenStream(aFile, aCapturePath.ToCString(), std::ios::out | std::ios::binary);
+    if (!aFile.is_open())
+    {
+      Message::SendFail() << "Error: unable to create file '" << aCapturePath << "'";
+      return 1;
+    }
+    aStats->DumpFrameCapture(aFile);
+    toRedraw = false;
+    if (aRenderParams == Graphic3d_RenderingParams::PerfCounters_NONE)
+    {
+      return 0;
+    }
+  }
+
   if (aRenderParams != Graphic3d_RenderingParams::PerfCounters_NONE)
   {
     aView->ChangeRenderingParams().CollectedStats = Graphic3d_RenderingParams::PerfCounters(
@@ -12320,6 +12379,22 @@ static int VStatProfiler(Draw_Interpretor& theDI, int theArgNb, const char** the
       {
         theDI << searchInfo(aDict, "CPU Dynamics (max)") << " ";
       }
+      else if (aFlag == "cullingtests")
+      {
+        theDI << searchInfo(aDict, "Culling tests") << " ";
+      }
+      else if (aFlag == "culledfrustum")
+      {
+        theDI << searchInfo(aDict, "Culled [frustum]") << " ";
+      }
+      else if (aFlag == "culleddistance")
+      {
+        theDI << searchInfo(aDict, "Culled [distance]") << " ";
+      }
+      else if (aFlag == "culledsize")
+      {
+        theDI << searchInfo(aDict, "Culled [size]") << " ";
+      }
     }
   }
   else
@@ -14779,7 +14854,8 @@ vrenderparams [-raster] [-shadingModel {unlit|facet|gouraud|phong|pbr|pbr_facet}
 
 Diagnostic output (on-screen overlay):
 vrenderparams [-perfCounters none|fps|cpu|layers|structures|groups|arrays|triangles|points
-                                 |gpuMem|frameTime|basic|extended|full|nofps|skipImmediate]
+                                 |gpuMem|frameTime|culling|itemTimers
+                                 |basic|extended|full|nofps|skipImmediate]
               [-perfUpdateInterval nbSeconds=1] [-perfChart nbFrames=1] [-perfChartMax seconds=0.1]
  -perfCounters       Show/hide performance counters (flags can be combined).
  -perfUpdateInterval Performance counters update interval.
@@ -14838,10 +14914,14 @@ vstatprofiler [fps|cpu|allLayers|layers|allstructures|structures|groups
                 |allArrays|fillArrays|lineArrays|pointArrays|textArrays
                 |triangles|points|geomMem|textureMem|frameMem
                 |elapsedFrame|cpuFrameAverage|cpuPickingAverage|cpuCullingAverage|cpuDynAverage
-                |cpuFrameMax|cpuPickingMax|cpuCullingMax|cpuDynMax]
-              [-noredraw]
+                |cpuFrameMax|cpuPickingMax|cpuCullingMax|cpuDynMax
+                |cullingTests|culledFrustum|culledDistance|culledSize]
+              [-noredraw] [-capture FilePath]
 Prints rendering statistics for specified counters or for all when unspecified.
 Set '-noredraw' flag to avoid additional redraw call and use already collected values.
+Culling counters report numbers of tested and culled BVH nodes of layers, not structures.
+Option '-capture' redraws the view and writes the frame capture in JSON format
+(counters, timers, per-layer and per-structure CPU/GPU rendering times).
 )" /* [vstatprofiler] */);
 
   addCmd("vplace", VPlace, /* [vplace] */ R"(
@@ -89,6 +89,7 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
   TCollection_AsciiString aShapeName, aFilePath;
   bool                    toCreateCompOfTris = false;
   bool                    anIsMulti          = false;
+  bool                    toParallel         = false;
   double                  aMergeAngle        = M_PI / 2.0;
   for (int anArgIter = 1; anArgIter < theArgc; ++anArgIter)
   {
@@ -118,6 +119,10 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
         ++anArgIter;
       }
     }
+    else if (anArg == "-parallel")
+    {
+      toParallel = Draw::ParseOnOffIterator(theArgc, theArgv, anArgIter);
+    }
     else if (anArg == "-mergeangle" || anArg == "-smoothangle" || anArg == "-nomergeangle"
              || anArg == "-nosmoothangle")
     {
@@ -189,7 +194,7 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
     {
       // Read STL file to the triangulation.
       occ::handle<Poly_Triangulation> aTriangulation =
-        RWStl::ReadFile(aFilePath.ToCString(), aMergeAngle, aProgress->Start());
+        RWStl::ReadFile(aFilePath.ToCString(), aMergeAngle, toParallel, aProgress->Start());
 
       TopoDS_Face  aFace;
       BRep_Builder aB;
@@ -1291,13 +1296,15 @@ void XSDRAWSTL::Factory(Draw_Interpretor& theDI)
             aGroup);
   theDI.Add(
     "readstl",
-    "readstl shape file [-brep] [-mergeAngle Angle] [-multi]"
+    "readstl shape file [-brep] [-mergeAngle Angle] [-multi] [-parallel {on|off}]=off"
     "\n\t\t: Reads STL file and creates a new shape with specified name."
     "\n\t\t: When -brep is specified, creates a Compound of per-triangle Faces."
     "\n\t\t: Single triangulation-only Face is created otherwise (default)."
     "\n\t\t: -mergeAngle specifies maximum angle in degrees between triangles to merge equal "
     "nodes; disabled by default."
-    "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set.",
+    "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set."
+    "\n\t\t: -parallel decodes binary file and merges nodes in parallel threads;"
+    "\n\t\t:           ignored when -brep or -multi is set.",
     __FILE__,
     readstl,
     aGroup);
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_ReadLineBuffer.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+//! Reads all lines from the text using the buffer of specified size.
+std::vector<std::string> readLines(const std::string& theText,
+                                   const size_t       theBufferSize,
+                                   const bool         theToPutGap)
+{
+  std::istringstream      aStream(theText);
+  Standard_ReadLineBuffer aBuffer(theBufferSize);
+  aBuffer.SetMultilineMode(true, theToPutGap);
+
+  std::vector<std::string> aLines;
+  size_t                   aLineLen = 0;
+  while (const char* aLine = aBuffer.ReadLine(aStream, aLineLen))
+  {
+    aLines.push_back(std::string(aLine, aLineLen));
+  }
+  return aLines;
+}
+} // namespace
+
+// Check that backslash continuation gives the same line wherever it falls within read buffer.
+TEST(Standard_ReadLineBufferTest, MultilineAtBufferBoundary)
+{
+  const size_t aBufferSize = 8;
+  for (int aGapIter = 0; aGapIter < 2; ++aGapIter)
+  {
+    const bool        toPutGap = aGapIter == 0;
+    const std::string anExpected[2] = {"v 1 2" + std::string(toPutGap ? " " : "") + "3", "v 4"};
+    for (int anEolIter = 0; anEolIter < 2; ++anEolIter)
+    {
+      const std::string anEol = anEolIter == 0 ? "\n" : "\r\n";
+      for (size_t aShift = 0; aShift <= 2 * aBufferSize; ++aShift)
+      {
+        // leading spaces move the backslash along the buffer
+        const std::string aText =
+          std::string(aShift, ' ') + "v 1 2\\" + anEol + "3" + anEol + "v 4" + anEol;
+        const std::vector<std::string> aLines = readLines(aText, aBufferSize, toPutGap);
+        ASSERT_EQ(aLines.size(), 2u) << "Shift " << aShift << ", gap " << toPutGap;
+        EXPECT_EQ(aLines[0], std::string(aShift, ' ') + anExpected[0])
+          << "Shift " << aShift << ", gap " << toPutGap << ", CR " << anEolIter;
+        EXPECT_EQ(aLines[1], anExpected[1]);
+      }
+    }
+  }
+}
+
+// Check that lines are read without multiline mode regardless of buffer size.
+TEST(Standard_ReadLineBufferTest, SingleLines)
+{
+  std::istringstream      aStream("first\nsecond line\\\n\nlast");
+  Standard_ReadLineBuffer aBuffer(4);
+
+  std::vector<std::string> aLines;
+  size_t                   aLineLen = 0;
+  while (const char* aLine = aBuffer.ReadLine(aStream, aLineLen))
+  {
+    aLines.push_back(std::string(aLine, aLineLen));
+  }
+  ASSERT_EQ(aLines.size(), 4u);
+  EXPECT_EQ(aLines[0], "first");
+  EXPECT_EQ(aLines[1], "second line\\");
+  EXPECT_EQ(aLines[2], "");
+  EXPECT_EQ(aLines[3], "last");
+}
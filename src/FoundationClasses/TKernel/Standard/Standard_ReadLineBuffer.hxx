@@ -78,10 +78,11 @@ public:
   template <typename Stream_T>
   const char* ReadLine(Stream_T& theStream, size_t& theLineLength, int64_t& theReadData)
   {
-    char* aResultLine = nullptr;
-    bool  isMultiline = false;
-    theLineLength     = 0;
-    theReadData       = 0;
+    char* aResultLine   = nullptr;
+    bool  isMultiline   = false;
+    bool  isMultilineCR = false;
+    theLineLength       = 0;
+    theReadData         = 0;
 
     while (aResultLine == nullptr)
     {
@@ -125,7 +126,8 @@ public:
           if (myBufferPos + 1 == myBytesLastRead
               || (myBufferPos + 2 == myBytesLastRead && myReadBuffer[myBufferPos + 1] == '\r'))
           {
-            isMultiline = true;
+            isMultiline   = true;
+            isMultilineCR = myBufferPos + 1 != myBytesLastRead;
             if (myToPutGapInMultiline)
             {
               myReadBuffer[myBufferPos] = ' ';
@@ -175,14 +177,26 @@ public:
           }
           else if (myBufferPos == 1 && myReadBuffer[0] == '\r')
           {
-            myReadBufferLastStr.EraseLast();
+            // keep the gap put in place of backslash at the end of previous chunk
+            if (!myToPutGapInMultiline)
+            {
+              myReadBufferLastStr.EraseLast();
+            }
             aStartLinePos += 2;
             isMultiline = false;
           }
           else if (myBufferPos == 0)
           {
             aStartLinePos += 1;
-            if (myReadBufferLastStr[myReadBufferLastStr.Size() - 1] == '\\')
+            if (myToPutGapInMultiline)
+            {
+              // keep a single gap as for the line break within the chunk
+              if (isMultilineCR)
+              {
+                myReadBufferLastStr.EraseLast();
+              }
+            }
+            else if (myReadBufferLastStr[myReadBufferLastStr.Size() - 1] == '\\')
             {
               myReadBufferLastStr.EraseLast();
             }
@@ -147,6 +147,13 @@ public:
   //! Sets the mode of chamfer
   Standard_EXPORT void SetMode(const ChFiDS_ChamfMode theMode);
 
+  //! Sets the flag to check mutual intersections of computed stripes in parallel threads.
+  //! FALSE by default. Stripes are computed sequentially (see ChFi3d_Builder::SetRunParallel()).
+  void SetRunParallel(const bool theToRunParallel) { myBuilder.SetRunParallel(theToRunParallel); }
+
+  //! Returns TRUE if parallel threads are allowed.
+  bool IsRunParallel() const { return myBuilder.IsRunParallel(); }
+
   //! return True if chamfer symmetric false else.
   Standard_EXPORT bool IsSymetric(const int IC) const;
 
@@ -81,6 +81,13 @@ public:
   Standard_EXPORT void SetContinuity(const GeomAbs_Shape InternalContinuity,
                                      const double        AngularTolerance);
 
+  //! Sets the flag to check mutual intersections of computed stripes in parallel threads.
+  //! FALSE by default. Stripes are computed sequentially (see ChFi3d_Builder::SetRunParallel()).
+  void SetRunParallel(const bool theToRunParallel) { myBuilder.SetRunParallel(theToRunParallel); }
+
+  //! Returns TRUE if parallel threads are allowed.
+  bool IsRunParallel() const { return myBuilder.IsRunParallel(); }
+
   //! Adds a fillet contour in the builder (builds a
   //! contour of tangent edges).
   //! The Radius must be set after.
@@ -23,6 +23,7 @@
 #include <ChFi3d_Builder_0.hxx>
 #include <ChFiDS_CommonPoint.hxx>
 #include <ChFiDS_SurfData.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_Sequence.hxx>
 #include <NCollection_HSequence.hxx>
 #include <ChFiDS_Stripe.hxx>
@@ -30,6 +31,7 @@
 #include <ChFiDS_Spine.hxx>
 #include <Geom2d_Curve.hxx>
 #include <gp_Pnt2d.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeFix.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -353,26 +355,48 @@ void ChFi3d_Builder::Compute()
   }
   if (done)
   {
-    int i1;
-    for (itel.Initialize(myListStripe), i1 = 0; itel.More(); itel.Next(), i1++)
+    // 05/02/02 akm vvv : (OCC119) First we'll check ain't there
+    //                    intersections between fillets.
+    // The check of a pair of stripes does not modify them, so all pairs
+    // are checked beforehand (in parallel threads if allowed).
+    // Parts of stripes are copied from their sequences in advance, as sequences
+    // cache the last accessed item and thus cannot be read concurrently.
+    const int                                      aNbStripes = myListStripe.Extent();
+    NCollection_Array1<occ::handle<ChFiDS_Stripe>> aStripes(1, aNbStripes);
+    NCollection_Array1<NCollection_Array1<occ::handle<ChFiDS_SurfData>>> aStripeParts(1,
+                                                                                      aNbStripes);
+    NCollection_Array1<bool> anIsIntersected(1, aNbStripes);
+    anIsIntersected.Init(false);
+    int i1 = 1;
+    for (itel.Initialize(myListStripe); itel.More(); itel.Next(), i1++)
     {
-      const occ::handle<ChFiDS_Stripe>& st = itel.Value();
-      // 05/02/02 akm vvv : (OCC119) First we'll check ain't there
-      //                    intersections between fillets
-      NCollection_List<occ::handle<ChFiDS_Stripe>>::Iterator itel1;
-      int                                                    i2;
-      for (itel1.Initialize(myListStripe), i2 = 0; itel1.More(); itel1.Next(), i2++)
+      aStripes.SetValue(i1, itel.Value());
+      const NCollection_Sequence<occ::handle<ChFiDS_SurfData>>& aSeqSurf =
+        itel.Value()->SetOfSurfData()->Sequence();
+      NCollection_Array1<occ::handle<ChFiDS_SurfData>>& aParts = aStripeParts.ChangeValue(i1);
+      aParts = NCollection_Array1<occ::handle<ChFiDS_SurfData>>(1, aSeqSurf.Length());
+      int aPartIter = 1;
+      for (NCollection_Sequence<occ::handle<ChFiDS_SurfData>>::Iterator aSurfIter(aSeqSurf);
+           aSurfIter.More();
+           aSurfIter.Next(), aPartIter++)
+      {
+        aParts.SetValue(aPartIter, aSurfIter.Value());
+      }
+    }
+    const double aTol2d          = tol2d;
+    auto         aCheckInterFunc = [&](const int theIndex) {
+      const int            anInd1 = theIndex + 1;
+      const ChFiDS_Stripe& st     = *aStripes.Value(anInd1);
+      for (int i2 = anInd1 + 1; i2 <= aNbStripes; i2++)
       {
-        if (i2 <= i1)
-        {
-          // Do not twice intersect the stripes
-          continue;
-        }
-        occ::handle<ChFiDS_Stripe> aCheckStripe = itel1.Value();
         try
         {
           OCC_CATCH_SIGNALS
-          ChFi3d_StripeEdgeInter(st, aCheckStripe, DStr, tol2d);
+          ChFi3d_StripeEdgeInter(st,
+                                 aStripeParts.Value(anInd1),
+                                 *aStripes.Value(i2),
+                                 aStripeParts.Value(i2),
+                                 aTol2d);
         }
         catch (Standard_Failure const& anException)
         {
@@ -380,13 +404,23 @@ void ChFi3d_Builder::Compute()
           std::cout << "EXCEPTION Fillets compute " << anException << std::endl;
 #endif
           (void)anException;
-          badstripes.Append(itel.Value());
-          hasresult = false;
-          done      = false;
+          anIsIntersected.SetValue(anInd1, true);
           break;
         }
       }
-      // 05/02/02 akm ^^^
+    };
+    OSD_Parallel::For(0, aNbStripes, aCheckInterFunc, !myIsRunParallel || aNbStripes < 3);
+    // 05/02/02 akm ^^^
+
+    for (i1 = 1; i1 <= aNbStripes; i1++)
+    {
+      const occ::handle<ChFiDS_Stripe>& st = aStripes.Value(i1);
+      if (anIsIntersected.Value(i1))
+      {
+        badstripes.Append(st);
+        hasresult = false;
+        done      = false;
+      }
       int solidindex = st->SolidIndex();
       ChFi3d_FilDS(solidindex, st, DStr, myRegul, tolapp3d, tol2d);
       if (!done)
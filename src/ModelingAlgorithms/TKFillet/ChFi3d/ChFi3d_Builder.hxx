@@ -80,6 +80,16 @@ public:
   Standard_EXPORT void SetContinuity(const GeomAbs_Shape InternalContinuity,
                                      const double        AngularTolerance);
 
+  //! Sets the flag to check mutual intersections of computed stripes in parallel threads.
+  //! FALSE by default.
+  //! Only this check runs in parallel; the stripes themselves (PerformSetOfSurf())
+  //! are computed sequentially, as each of them writes into the shared data structure
+  //! (surfaces, curves and shape indices referenced by ChFiDS_SurfData).
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if parallel threads are allowed.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
   //! extracts from the list the contour containing edge E.
   Standard_EXPORT void Remove(const TopoDS_Edge& E);
 
@@ -840,6 +850,7 @@ private:
 
   TopoDS_Shape                   myShape;
   double                         angular;
+  bool                           myIsRunParallel;
   NCollection_List<TopoDS_Shape> myGenerated;
   TopoDS_Shape                   myShapeResult;
   TopoDS_Shape                   badShape;
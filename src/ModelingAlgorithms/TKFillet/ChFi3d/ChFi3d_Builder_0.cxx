@@ -22,6 +22,8 @@
 
 #include <AppParCurves_MultiBSpCurve.hxx>
 #include <Approx_SameParameter.hxx>
+#include <Bnd_Box2d.hxx>
+#include <BndLib_Add2dCurve.hxx>
 #include <BRepLib.hxx>
 #include <BRepTools.hxx>
 #include <BRepTopAdaptor_HVertex.hxx>
@@ -3353,42 +3355,65 @@ void ChFi3d_StripeEdgeInter(const occ::handle<ChFiDS_Stripe>& theStripe1,
                             const occ::handle<ChFiDS_Stripe>& theStripe2,
                             TopOpeBRepDS_DataStructure& /*DStr*/,
                             const double tol2d)
+{
+  const NCollection_Sequence<occ::handle<ChFiDS_SurfData>>& aSurDat1 =
+    theStripe1->SetOfSurfData()->Sequence();
+  const NCollection_Sequence<occ::handle<ChFiDS_SurfData>>& aSurDat2 =
+    theStripe2->SetOfSurfData()->Sequence();
+  NCollection_Array1<occ::handle<ChFiDS_SurfData>> aParts1(1, aSurDat1.Length());
+  NCollection_Array1<occ::handle<ChFiDS_SurfData>> aParts2(1, aSurDat2.Length());
+  int                                              iPart = 1;
+  for (NCollection_Sequence<occ::handle<ChFiDS_SurfData>>::Iterator anIter(aSurDat1);
+       anIter.More();
+       anIter.Next(), iPart++)
+  {
+    aParts1.SetValue(iPart, anIter.Value());
+  }
+  iPart = 1;
+  for (NCollection_Sequence<occ::handle<ChFiDS_SurfData>>::Iterator anIter(aSurDat2);
+       anIter.More();
+       anIter.Next(), iPart++)
+  {
+    aParts2.SetValue(iPart, anIter.Value());
+  }
+  ChFi3d_StripeEdgeInter(*theStripe1, aParts1, *theStripe2, aParts2, tol2d);
+}
+
+//=================================================================================================
+
+void ChFi3d_StripeEdgeInter(const ChFiDS_Stripe&                                   theStripe1,
+                            const NCollection_Array1<occ::handle<ChFiDS_SurfData>>& theSurfData1,
+                            const ChFiDS_Stripe&                                   theStripe2,
+                            const NCollection_Array1<occ::handle<ChFiDS_SurfData>>& theSurfData2,
+                            const double                                           tol2d)
 {
   // Do not check the stripeshaving common corner points
   for (int iSur1 = 1; iSur1 <= 2; iSur1++)
   {
     for (int iSur2 = 1; iSur2 <= 2; iSur2++)
     {
-      if (theStripe1->IndexPoint(false, iSur1) == theStripe2->IndexPoint(false, iSur2)
-          || theStripe1->IndexPoint(false, iSur1) == theStripe2->IndexPoint(true, iSur2)
-          || theStripe1->IndexPoint(true, iSur1) == theStripe2->IndexPoint(false, iSur2)
-          || theStripe1->IndexPoint(true, iSur1) == theStripe2->IndexPoint(true, iSur2))
+      if (theStripe1.IndexPoint(false, iSur1) == theStripe2.IndexPoint(false, iSur2)
+          || theStripe1.IndexPoint(false, iSur1) == theStripe2.IndexPoint(true, iSur2)
+          || theStripe1.IndexPoint(true, iSur1) == theStripe2.IndexPoint(false, iSur2)
+          || theStripe1.IndexPoint(true, iSur1) == theStripe2.IndexPoint(true, iSur2))
       {
         return;
       }
     }
   }
 
-  occ::handle<NCollection_HSequence<occ::handle<ChFiDS_SurfData>>> aSurDat1 =
-    theStripe1->SetOfSurfData();
-  occ::handle<NCollection_HSequence<occ::handle<ChFiDS_SurfData>>> aSurDat2 =
-    theStripe2->SetOfSurfData();
-
   Geom2dInt_GInter anIntersector;
-  int              iPart1, iPart2;
   int              Ishape11, Ishape12, Ishape21, Ishape22;
   // Loop on parts of the first stripe
-  for (iPart1 = 1; iPart1 <= aSurDat1->Length(); iPart1++)
+  for (const occ::handle<ChFiDS_SurfData>& aDat1 : theSurfData1)
   {
-    occ::handle<ChFiDS_SurfData> aDat1 = aSurDat1->Value(iPart1);
-    Ishape11                           = aDat1->IndexOfS1();
-    Ishape12                           = aDat1->IndexOfS2();
+    Ishape11 = aDat1->IndexOfS1();
+    Ishape12 = aDat1->IndexOfS2();
     // Loop on parts of the second stripe
-    for (iPart2 = 1; iPart2 <= aSurDat2->Length(); iPart2++)
+    for (const occ::handle<ChFiDS_SurfData>& aDat2 : theSurfData2)
     {
-      occ::handle<ChFiDS_SurfData> aDat2 = aSurDat2->Value(iPart2);
-      Ishape21                           = aDat2->IndexOfS1();
-      Ishape22                           = aDat2->IndexOfS2();
+      Ishape21 = aDat2->IndexOfS1();
+      Ishape22 = aDat2->IndexOfS2();
 
       // Find those FaceInterferences able to intersect
       ChFiDS_FaceInterference aFI1, aFI2;
@@ -3432,6 +3457,14 @@ void ChFi3d_StripeEdgeInter(const occ::handle<ChFiDS_Stripe>& theStripe1,
       Geom2dAdaptor_Curve aPCurve2(aFI2.PCurveOnFace(),
                                    aFI2.FirstParameter(),
                                    aFI2.LastParameter());
+      // Cheap rejection of distant pcurves before the exact intersection
+      Bnd_Box2d aBox1, aBox2;
+      BndLib_Add2dCurve::Add(aPCurve1, tol2d, aBox1);
+      BndLib_Add2dCurve::Add(aPCurve2, tol2d, aBox2);
+      if (aBox1.IsOut(aBox2))
+      {
+        continue;
+      }
       anIntersector.Perform(aPCurve1, aPCurve2, tol2d, Precision::PConfusion());
       if (anIntersector.NbSegments() > 0 || anIntersector.NbPoints() > 0)
       {
@@ -383,6 +383,14 @@ void ChFi3d_StripeEdgeInter(const occ::handle<ChFiDS_Stripe>& theStripe1,
                             TopOpeBRepDS_DataStructure&       DStr,
                             const double                      tol2d);
 
+//! Same as above, but takes parts of the stripes copied from their sequences of SurfData,
+//! so that the same stripe could be checked from several threads concurrently.
+void ChFi3d_StripeEdgeInter(const ChFiDS_Stripe&                                   theStripe1,
+                            const NCollection_Array1<occ::handle<ChFiDS_SurfData>>& theSurfData1,
+                            const ChFiDS_Stripe&                                   theStripe2,
+                            const NCollection_Array1<occ::handle<ChFiDS_SurfData>>& theSurfData2,
+                            const double                                           tol2d);
+
 int ChFi3d_IndexOfSurfData(const TopoDS_Vertex&              V1,
                            const occ::handle<ChFiDS_Stripe>& CD,
                            int&                              sens);
@@ -340,7 +340,8 @@ static TopOpeBRepDS_BuildTool mkbuildtool()
 
 ChFi3d_Builder::ChFi3d_Builder(const TopoDS_Shape& S, const double Ta)
     : done(false),
-      myShape(S)
+      myShape(S),
+      myIsRunParallel(false)
 {
   myDS   = new TopOpeBRepDS_HDataStructure();
   myCoup = new TopOpeBRepBuild_HBuilder(mkbuildtool());
@@ -120,6 +120,36 @@ TEST(BRepFilletAPI_MakeFilletTest, FilletMoreFaces)
   EXPECT_GT(aFaceCount, 6);
 }
 
+TEST(BRepFilletAPI_MakeFilletTest, FilletAllEdges_ParallelMatchesSequential)
+{
+  BRepPrimAPI_MakeBox aBoxMaker(20.0, 20.0, 20.0);
+  const TopoDS_Shape& aBox = aBoxMaker.Shape();
+  ASSERT_TRUE(aBoxMaker.IsDone());
+
+  double aVolumes[2] = {0.0, 0.0};
+  for (int anIter = 0; anIter < 2; ++anIter)
+  {
+    BRepFilletAPI_MakeFillet aFillet(aBox);
+    EXPECT_FALSE(aFillet.IsRunParallel());
+    aFillet.SetRunParallel(anIter == 1);
+    for (TopExp_Explorer anExp(aBox, TopAbs_EDGE); anExp.More(); anExp.Next())
+    {
+      aFillet.Add(1.0, TopoDS::Edge(anExp.Current()));
+    }
+    const TopoDS_Shape& aResult = aFillet.Shape();
+    ASSERT_TRUE(aFillet.IsDone());
+
+    BRepCheck_Analyzer anAnalyzer(aResult);
+    EXPECT_TRUE(anAnalyzer.IsValid());
+
+    GProp_GProps aProps;
+    BRepGProp::VolumeProperties(aResult, aProps);
+    aVolumes[anIter] = aProps.Mass();
+  }
+  EXPECT_LT(aVolumes[0], 8000.0);
+  EXPECT_NEAR(aVolumes[0], aVolumes[1], 1.0e-6 * aVolumes[0]);
+}
+
 TEST(BRepFilletAPI_MakeFilletTest, FilletVariableRadius)
 {
   BRepPrimAPI_MakeBox aBoxMaker(20.0, 20.0, 20.0);
@@ -21,8 +21,6 @@
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 
-static double uinf, vinf, usup, vsup;
-
 int Contap_HContTool::NbSamplesV(const occ::handle<Adaptor3d_Surface>& S,
                                  const double,
                                  const double)
@@ -114,7 +112,15 @@ int Contap_HContTool::NbSamplesU(const occ::handle<Adaptor3d_Surface>& S,
   return (nbs);
 }
 
-int Contap_HContTool::NbSamplePoints(const occ::handle<Adaptor3d_Surface>& S)
+//! Computes the parametric range of the surface used for sampling,
+//! bounding infinite ranges.
+//! The range is evaluated per call (instead of being kept in static variables)
+//! to allow concurrent computation of contours.
+static void sampleBounds(const occ::handle<Adaptor3d_Surface>& S,
+                         double&                               uinf,
+                         double&                               usup,
+                         double&                               vinf,
+                         double&                               vsup)
 {
   uinf = S->FirstUParameter();
   usup = S->LastUParameter();
@@ -160,6 +166,12 @@ int Contap_HContTool::NbSamplePoints(const occ::handle<Adaptor3d_Surface>& S)
   {
     vsup = vinf + 2.e5;
   }
+}
+
+int Contap_HContTool::NbSamplePoints(const occ::handle<Adaptor3d_Surface>& S)
+{
+  double uinf, usup, vinf, vsup;
+  sampleBounds(S, uinf, usup, vinf, vsup);
   if (S->GetType() == GeomAbs_BSplineSurface)
   {
     int m = (NbSamplesU(S, uinf, usup) / 3) * (NbSamplesV(S, vinf, vsup) / 3);
@@ -183,6 +195,8 @@ void Contap_HContTool::SamplePoint(const occ::handle<Adaptor3d_Surface>& S,
                                    double&                               U,
                                    double&                               V)
 {
+  double uinf, usup, vinf, vsup;
+  sampleBounds(S, uinf, usup, vinf, vsup);
   if (S->GetType() == GeomAbs_BSplineSurface)
   {
     int nbIntU = NbSamplesU(S, uinf, usup) / 3;
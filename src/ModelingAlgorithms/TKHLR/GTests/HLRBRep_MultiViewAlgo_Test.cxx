@@ -0,0 +1,154 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <gp_Ax2.hxx>
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <HLRBRep_HLRToShape.hxx>
+#include <HLRBRep_MultiViewAlgo.hxx>
+#include <HLRBRep_PolyHLRToShape.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns number of edges in the shape (0 for null shape).
+int nbEdges(const TopoDS_Shape& theShape)
+{
+  if (theShape.IsNull())
+  {
+    return 0;
+  }
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> anEdges;
+  TopExp::MapShapes(theShape, TopAbs_EDGE, anEdges);
+  return anEdges.Extent();
+}
+
+//! Computes visible and hidden sharp edges for single projector.
+void computeView(const TopoDS_Shape&      theShape1,
+                 const TopoDS_Shape&      theShape2,
+                 const HLRAlgo_Projector& theProjector,
+                 const bool               theToRunParallel,
+                 int&                     theNbVisible,
+                 int&                     theNbHidden)
+{
+  occ::handle<HLRBRep_Algo> anAlgo = new HLRBRep_Algo();
+  anAlgo->SetRunParallel(theToRunParallel);
+  anAlgo->Add(theShape1);
+  anAlgo->Add(theShape2);
+  anAlgo->Projector(theProjector);
+  anAlgo->Update();
+  anAlgo->Hide();
+
+  HLRBRep_HLRToShape aToShape(anAlgo);
+  theNbVisible = nbEdges(aToShape.VCompound());
+  theNbHidden  = nbEdges(aToShape.HCompound());
+}
+
+//! Returns the set of standard drawing projectors.
+NCollection_Array1<HLRAlgo_Projector> drawingProjectors()
+{
+  NCollection_Array1<HLRAlgo_Projector> aProjectors(1, 3);
+  aProjectors.SetValue(1,
+                       HLRAlgo_Projector(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, -1.0, 0.0))));
+  aProjectors.SetValue(2,
+                       HLRAlgo_Projector(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, 0.0, 1.0))));
+  aProjectors.SetValue(3,
+                       HLRAlgo_Projector(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(1.0, -1.0, 1.0))));
+  return aProjectors;
+}
+} // namespace
+
+TEST(HLRBRep_MultiViewAlgoTest, ParallelUpdate_MatchesSequential)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0).Shape();
+  const TopoDS_Shape aCyl =
+    BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(5.0, 5.0, 10.0), gp_Dir(0.0, 0.0, 1.0)), 3.0, 5.0)
+      .Shape();
+
+  const NCollection_Array1<HLRAlgo_Projector> aProjectors = drawingProjectors();
+  for (int aViewIter = aProjectors.Lower(); aViewIter <= aProjectors.Upper(); ++aViewIter)
+  {
+    int aNbVisSeq = 0, aNbHidSeq = 0, aNbVisPar = 0, aNbHidPar = 0;
+    computeView(aBox, aCyl, aProjectors(aViewIter), false, aNbVisSeq, aNbHidSeq);
+    computeView(aBox, aCyl, aProjectors(aViewIter), true, aNbVisPar, aNbHidPar);
+    EXPECT_GT(aNbVisSeq, 0);
+    EXPECT_EQ(aNbVisSeq, aNbVisPar) << "View " << aViewIter;
+    EXPECT_EQ(aNbHidSeq, aNbHidPar) << "View " << aViewIter;
+  }
+}
+
+TEST(HLRBRep_MultiViewAlgoTest, ExactViews_MatchSingleViewAlgo)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0).Shape();
+  const TopoDS_Shape aCyl =
+    BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(5.0, 5.0, 10.0), gp_Dir(0.0, 0.0, 1.0)), 3.0, 5.0)
+      .Shape();
+
+  const NCollection_Array1<HLRAlgo_Projector> aProjectors = drawingProjectors();
+
+  HLRBRep_MultiViewAlgo anAlgo;
+  anAlgo.Add(aBox);
+  anAlgo.Add(aCyl);
+  for (int aViewIter = aProjectors.Lower(); aViewIter <= aProjectors.Upper(); ++aViewIter)
+  {
+    EXPECT_EQ(anAlgo.AddProjector(aProjectors(aViewIter)), aViewIter);
+  }
+  anAlgo.Perform();
+  ASSERT_TRUE(anAlgo.IsDone());
+  ASSERT_EQ(anAlgo.NbViews(), aProjectors.Length());
+
+  for (int aViewIter = 1; aViewIter <= anAlgo.NbViews(); ++aViewIter)
+  {
+    ASSERT_FALSE(anAlgo.Algo(aViewIter).IsNull());
+    HLRBRep_HLRToShape aToShape(anAlgo.Algo(aViewIter));
+
+    int aNbVisible = 0, aNbHidden = 0;
+    computeView(aBox, aCyl, aProjectors(aViewIter), false, aNbVisible, aNbHidden);
+    EXPECT_EQ(nbEdges(aToShape.VCompound()), aNbVisible) << "View " << aViewIter;
+    EXPECT_EQ(nbEdges(aToShape.HCompound()), aNbHidden) << "View " << aViewIter;
+  }
+}
+
+TEST(HLRBRep_MultiViewAlgoTest, PolyViews)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0).Shape();
+  BRepMesh_IncrementalMesh(aBox, 0.1);
+
+  const NCollection_Array1<HLRAlgo_Projector> aProjectors = drawingProjectors();
+
+  HLRBRep_MultiViewAlgo anAlgo(true);
+  EXPECT_TRUE(anAlgo.IsPolyAlgo());
+  anAlgo.Add(aBox);
+  for (int aViewIter = aProjectors.Lower(); aViewIter <= aProjectors.Upper(); ++aViewIter)
+  {
+    anAlgo.AddProjector(aProjectors(aViewIter));
+  }
+  anAlgo.Perform();
+  ASSERT_TRUE(anAlgo.IsDone());
+
+  for (int aViewIter = 1; aViewIter <= anAlgo.NbViews(); ++aViewIter)
+  {
+    ASSERT_FALSE(anAlgo.PolyAlgo(aViewIter).IsNull());
+    HLRBRep_PolyHLRToShape aToShape;
+    aToShape.Update(anAlgo.PolyAlgo(aViewIter));
+    EXPECT_GT(nbEdges(aToShape.VCompound()), 0) << "View " << aViewIter;
+  }
+}
@@ -66,6 +66,8 @@ set(OCCT_HLRBRep_FILES
   HLRBRep_Intersector.hxx
   HLRBRep_LineTool.hxx
   HLRBRep_LineTool.lxx
+  HLRBRep_MultiViewAlgo.cxx
+  HLRBRep_MultiViewAlgo.hxx
 
   HLRBRep_MyImpParToolOfTheIntersectorOfTheIntConicCurveOfCInter.hxx
   HLRBRep_MyImpParToolOfTheIntersectorOfTheIntConicCurveOfCInter_0.cxx
@@ -41,16 +41,18 @@
 #include <StdFail_UndefinedDerivative.hxx>
 #include <Standard_Integer.hxx>
 
+#include <atomic>
 #include <cstdio>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_Data, Standard_Transient)
 
-int nbOkIntersection;
-int nbPtIntersection;
-int nbSegIntersection;
-int nbClassification;
-int nbCal1Intersection; // pairs of unrejected edges
-int nbCal2Intersection; // true intersections (not vertex)
-int nbCal3Intersection; // Curve-Surface intersections
+// statistic counters are atomic as several data structures can be hidden concurrently
+std::atomic<int> nbOkIntersection;
+std::atomic<int> nbPtIntersection;
+std::atomic<int> nbSegIntersection;
+std::atomic<int> nbClassification;
+std::atomic<int> nbCal1Intersection; // pairs of unrejected edges
+std::atomic<int> nbCal2Intersection; // true intersections (not vertex)
+std::atomic<int> nbCal3Intersection; // Curve-Surface intersections
 
 static const double CutLar = 2.e-1;
 static const double CutBig = 1.e-1;
@@ -30,17 +30,19 @@
 #include <fstream>
 #include <Standard_Type.hxx>
 #include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 
+#include <atomic>
 #include <cstdio>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_InternalAlgo, Standard_Transient)
 
-extern int nbPtIntersection;   // total P.I.
-extern int nbSegIntersection;  // total S.I
-extern int nbClassification;   // total classification
-extern int nbOkIntersection;   // pairs of intersecting edges
-extern int nbCal1Intersection; // pairs of unrejected edges
-extern int nbCal2Intersection; // true intersections (not vertex)
-extern int nbCal3Intersection; // curve-surface intersections
+extern std::atomic<int> nbPtIntersection;   // total P.I.
+extern std::atomic<int> nbSegIntersection;  // total S.I
+extern std::atomic<int> nbClassification;   // total classification
+extern std::atomic<int> nbOkIntersection;   // pairs of intersecting edges
+extern std::atomic<int> nbCal1Intersection; // pairs of unrejected edges
+extern std::atomic<int> nbCal2Intersection; // true intersections (not vertex)
+extern std::atomic<int> nbCal3Intersection; // curve-surface intersections
 
 static int HLRBRep_InternalAlgo_TRACE   = true;
 static int HLRBRep_InternalAlgo_TRACE10 = true;
@@ -48,7 +50,8 @@ static int HLRBRep_InternalAlgo_TRACE10 = true;
 //=================================================================================================
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
-    : myDebug(false)
+    : myDebug(false),
+      myIsRunParallel(false)
 {
 }
 
@@ -56,10 +59,11 @@ HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo(const occ::handle<HLRBRep_InternalAlgo>& A)
 {
-  myDS     = A->DataStructure();
-  myProj   = A->Projector();
-  myShapes = A->SeqOfShapeBounds();
-  myDebug  = A->Debug();
+  myDS            = A->DataStructure();
+  myProj          = A->Projector();
+  myShapes        = A->SeqOfShapeBounds();
+  myDebug         = A->Debug();
+  myIsRunParallel = A->IsRunParallel();
 }
 
 //=================================================================================================
@@ -78,39 +82,97 @@ HLRAlgo_Projector& HLRBRep_InternalAlgo::Projector()
 
 //=================================================================================================
 
+void HLRBRep_InternalAlgo::SetRunParallel(const bool theToRunParallel)
+{
+  myIsRunParallel = theToRunParallel;
+}
+
+//=================================================================================================
+
+bool HLRBRep_InternalAlgo::IsRunParallel() const
+{
+  return myIsRunParallel;
+}
+
+//=================================================================================================
+
+//! Computes outlines of the shape and loads it into a separate data structure.
+//! Returns an empty data structure if the computation has failed.
+static occ::handle<HLRBRep_Data> loadShapeData(
+  HLRBRep_ShapeBounds&                                                             theSB,
+  const HLRAlgo_Projector&                                                         theProj,
+  NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher>& theMST,
+  const bool                                                                       theIsDebug,
+  const int                                                                        theIndex)
+{
+  try
+  {
+    OCC_CATCH_SIGNALS
+    return HLRBRep_ShapeToHLR::Load(theSB.Shape(), theProj, theMST, theSB.NbOfIso());
+  }
+  catch (Standard_Failure const& anException)
+  {
+    if (theIsDebug)
+    {
+      std::cout << "An exception was caught when preparing the Shape " << theIndex;
+      std::cout << " and computing its OutLines " << '\n';
+      std::cout << anException << '\n';
+    }
+  }
+  return new HLRBRep_Data(0, 0, 0);
+}
+
+//=================================================================================================
+
 void HLRBRep_InternalAlgo::Update()
 {
   if (!myShapes.IsEmpty())
   {
-    int                        n  = myShapes.Length();
-    occ::handle<HLRBRep_Data>* DS = new occ::handle<HLRBRep_Data>[n];
+    int                                           n = myShapes.Length();
+    NCollection_Array1<occ::handle<HLRBRep_Data>> DS(0, n - 1);
 
     int i, dv, de, df, nv = 0, ne = 0, nf = 0;
 
-    for (i = 1; i <= n; i++)
+    if (myIsRunParallel && n > 1)
     {
-      HLRBRep_ShapeBounds& SB = myShapes(i);
-      try
-      {
-        OCC_CATCH_SIGNALS
-        DS[i - 1] = HLRBRep_ShapeToHLR::Load(SB.Shape(), myProj, myMapOfShapeTool, SB.NbOfIso());
-        dv        = DS[i - 1]->NbVertices();
-        de        = DS[i - 1]->NbEdges();
-        df        = DS[i - 1]->NbFaces();
-      }
-      catch (Standard_Failure const& anException)
+      // each shape is loaded with its own map of face tools,
+      // merged into the common map afterwards
+      typedef NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher>
+                                         MapOfShapeTool;
+      NCollection_Array1<MapOfShapeTool> aMapsOfShapeTool(0, n - 1);
+      OSD_Parallel::For(0, n, [&](const int theIndex) {
+        DS[theIndex] = loadShapeData(myShapes(theIndex + 1),
+                                     myProj,
+                                     aMapsOfShapeTool[theIndex],
+                                     myDebug,
+                                     theIndex + 1);
+      });
+      for (i = 0; i < n; i++)
       {
-        if (myDebug)
+        for (MapOfShapeTool::Iterator aToolIter(aMapsOfShapeTool[i]); aToolIter.More();
+             aToolIter.Next())
         {
-          std::cout << "An exception was caught when preparing the Shape " << i;
-          std::cout << " and computing its OutLines " << '\n';
-          std::cout << anException << '\n';
+          if (!myMapOfShapeTool.IsBound(aToolIter.Key()))
+          {
+            myMapOfShapeTool.Bind(aToolIter.Key(), aToolIter.Value());
+          }
         }
-        DS[i - 1] = new HLRBRep_Data(0, 0, 0);
-        dv        = 0;
-        de        = 0;
-        df        = 0;
       }
+    }
+    else
+    {
+      for (i = 0; i < n; i++)
+      {
+        DS[i] = loadShapeData(myShapes(i + 1), myProj, myMapOfShapeTool, myDebug, i + 1);
+      }
+    }
+
+    for (i = 1; i <= n; i++)
+    {
+      HLRBRep_ShapeBounds& SB = myShapes(i);
+      dv                      = DS[i - 1]->NbVertices();
+      de                      = DS[i - 1]->NbEdges();
+      df                      = DS[i - 1]->NbFaces();
 
       SB = HLRBRep_ShapeBounds(SB.Shape(), SB.ShapeData(), SB.NbOfIso(), 1, dv, 1, de, 1, df);
       nv += dv;
@@ -141,8 +203,6 @@ void HLRBRep_InternalAlgo::Update()
       }
     }
 
-    delete[] DS;
-
     myDS->Update(myProj);
 
     HLRAlgo_EdgesBlock::MinMaxIndices     ShapMin, ShapMax, MinMaxShap;
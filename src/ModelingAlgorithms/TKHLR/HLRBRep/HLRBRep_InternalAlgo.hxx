@@ -47,6 +47,18 @@ public:
   //! set the projector.
   Standard_EXPORT HLRAlgo_Projector& Projector();
 
+  //! Sets the flag to compute outlines of the loaded shapes in parallel threads
+  //! during Update(); FALSE by default.
+  //! The hiding of edges by faces (Hide() and PartialHide()) is always sequential:
+  //! each face updates the status of all edges overlapping it, and HLRBRep_Data keeps
+  //! the current edge and face iteration state, so faces cannot be processed concurrently
+  //! without a per-thread copy of the data structure.
+  //! Edges overlapping a face are still selected by the linear min-max box rejection.
+  Standard_EXPORT void SetRunParallel(const bool theToRunParallel);
+
+  //! Returns TRUE if outlines of the loaded shapes are computed in parallel threads.
+  Standard_EXPORT bool IsRunParallel() const;
+
   //! update the DataStructure.
   Standard_EXPORT void Update();
 
@@ -134,6 +146,7 @@ private:
   NCollection_Sequence<HLRBRep_ShapeBounds>                                       myShapes;
   NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher> myMapOfShapeTool;
   bool                                                                            myDebug;
+  bool                                                                            myIsRunParallel;
 };
 
 #endif // _HLRBRep_InternalAlgo_HeaderFile
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <HLRBRep_MultiViewAlgo.hxx>
+
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+
+//=================================================================================================
+
+HLRBRep_MultiViewAlgo::HLRBRep_MultiViewAlgo(const bool theToUsePolyAlgo)
+    : myIsPolyAlgo(theToUsePolyAlgo),
+      myIsRunParallel(true),
+      myIsDone(false)
+{
+}
+
+//=================================================================================================
+
+void HLRBRep_MultiViewAlgo::Add(const TopoDS_Shape& theShape, const int theNbIso)
+{
+  myShapes.Append(theShape);
+  myNbIsos.Append(theNbIso);
+  myIsDone = false;
+}
+
+//=================================================================================================
+
+int HLRBRep_MultiViewAlgo::AddProjector(const HLRAlgo_Projector& theProjector)
+{
+  myProjectors.Append(theProjector);
+  myIsDone = false;
+  return myProjectors.Length();
+}
+
+//=================================================================================================
+
+void HLRBRep_MultiViewAlgo::Perform()
+{
+  myIsDone           = false;
+  const int aNbViews = myProjectors.Length();
+  if (aNbViews == 0)
+  {
+    myAlgos     = NCollection_Array1<occ::handle<HLRBRep_Algo>>();
+    myPolyAlgos = NCollection_Array1<occ::handle<HLRBRep_PolyAlgo>>();
+    return;
+  }
+
+  // sequences are not suitable for concurrent access, copy input into arrays
+  NCollection_Array1<TopoDS_Shape>      aShapes(1, std::max(myShapes.Length(), 1));
+  NCollection_Array1<int>               aNbIsos(1, std::max(myShapes.Length(), 1));
+  NCollection_Array1<HLRAlgo_Projector> aProjectors(1, aNbViews);
+  for (int aShapeIter = 1; aShapeIter <= myShapes.Length(); ++aShapeIter)
+  {
+    aShapes.SetValue(aShapeIter, myShapes.Value(aShapeIter));
+    aNbIsos.SetValue(aShapeIter, myNbIsos.Value(aShapeIter));
+  }
+  for (int aViewIter = 1; aViewIter <= aNbViews; ++aViewIter)
+  {
+    aProjectors.SetValue(aViewIter, myProjectors.Value(aViewIter));
+  }
+
+  myAlgos.Resize(1, aNbViews, false);
+  myPolyAlgos.Resize(1, aNbViews, false);
+  myAlgos.Init(occ::handle<HLRBRep_Algo>());
+  myPolyAlgos.Init(occ::handle<HLRBRep_PolyAlgo>());
+
+  // views are independent, shapes are loaded into a new algorithm for each view;
+  // nested parallelism is used only when there is nothing to run concurrently
+  const int  aNbShapes       = myShapes.Length();
+  const bool isInnerParallel = myIsRunParallel && aNbViews == 1;
+
+  auto aComputeViewFunc = [&](const int theIndex) {
+    const int aView = theIndex + 1;
+    if (myIsPolyAlgo)
+    {
+      occ::handle<HLRBRep_PolyAlgo> anAlgo = new HLRBRep_PolyAlgo();
+      anAlgo->Projector(aProjectors.Value(aView));
+      for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+      {
+        anAlgo->Load(aShapes.Value(aShapeIter));
+      }
+      anAlgo->Update();
+      myPolyAlgos.SetValue(aView, anAlgo);
+    }
+    else
+    {
+      occ::handle<HLRBRep_Algo> anAlgo = new HLRBRep_Algo();
+      anAlgo->SetRunParallel(isInnerParallel);
+      anAlgo->Projector(aProjectors.Value(aView));
+      for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+      {
+        anAlgo->Add(aShapes.Value(aShapeIter), aNbIsos.Value(aShapeIter));
+      }
+      anAlgo->Update();
+      anAlgo->Hide();
+      myAlgos.SetValue(aView, anAlgo);
+    }
+  };
+  OSD_Parallel::For(0, aNbViews, aComputeViewFunc, !myIsRunParallel || aNbViews == 1);
+
+  myIsDone = true;
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _HLRBRep_MultiViewAlgo_HeaderFile
+#define _HLRBRep_MultiViewAlgo_HeaderFile
+
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <HLRBRep_PolyAlgo.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Sequence.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Computes hidden lines of the same set of shapes for several projectors
+//! (e.g. front, top, side and isometric drawing views) concurrently.
+//!
+//! Each view gets its own HLRBRep_Algo (or HLRBRep_PolyAlgo) instance,
+//! as outlines computed by HLRTopoBRep_OutLiner depend on the projector;
+//! the input shapes are shared by all views and are not modified.
+//! The results of a view are extracted by HLRBRep_HLRToShape (HLRBRep_PolyHLRToShape)
+//! initialized from Algo() (PolyAlgo()).
+class HLRBRep_MultiViewAlgo
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty algorithm.
+  //! @param[in] theToUsePolyAlgo  use HLRBRep_PolyAlgo working on triangulation
+  //!                              instead of exact HLRBRep_Algo
+  Standard_EXPORT HLRBRep_MultiViewAlgo(const bool theToUsePolyAlgo = false);
+
+  //! Adds the shape to be visualized in all views.
+  //! @param[in] theShape  shape to add
+  //! @param[in] theNbIso  number of isoparameters (ignored by HLRBRep_PolyAlgo)
+  Standard_EXPORT void Add(const TopoDS_Shape& theShape, const int theNbIso = 0);
+
+  //! Adds a new view and returns its index.
+  Standard_EXPORT int AddProjector(const HLRAlgo_Projector& theProjector);
+
+  //! Returns the number of views.
+  int NbViews() const { return myProjectors.Length(); }
+
+  //! Returns the projector of the view.
+  const HLRAlgo_Projector& Projector(const int theView) const { return myProjectors(theView); }
+
+  //! Returns TRUE if HLRBRep_PolyAlgo is used.
+  bool IsPolyAlgo() const { return myIsPolyAlgo; }
+
+  //! Sets the flag to compute views in parallel threads; TRUE by default.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if views are computed in parallel threads.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
+  //! Computes outlines and hides all views.
+  Standard_EXPORT void Perform();
+
+  //! Returns TRUE if the views have been computed.
+  bool IsDone() const { return myIsDone; }
+
+  //! Returns the exact algorithm of the view after Perform().
+  const occ::handle<HLRBRep_Algo>& Algo(const int theView) const { return myAlgos(theView); }
+
+  //! Returns the polygonal algorithm of the view after Perform().
+  const occ::handle<HLRBRep_PolyAlgo>& PolyAlgo(const int theView) const
+  {
+    return myPolyAlgos(theView);
+  }
+
+private:
+  NCollection_Sequence<TopoDS_Shape>                myShapes;
+  NCollection_Sequence<int>                         myNbIsos;
+  NCollection_Sequence<HLRAlgo_Projector>           myProjectors;
+  NCollection_Array1<occ::handle<HLRBRep_Algo>>     myAlgos;
+  NCollection_Array1<occ::handle<HLRBRep_PolyAlgo>> myPolyAlgos;
+  bool                                              myIsPolyAlgo;
+  bool                                              myIsRunParallel;
+  bool                                              myIsDone;
+};
+
+#endif // _HLRBRep_MultiViewAlgo_HeaderFile
@@ -36,11 +36,14 @@
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD_Parallel.hxx>
 //
 #include <BRepBndLib.hxx>
 #include <BOPTools_BoxTree.hxx>
@@ -54,7 +57,8 @@ BRepOffset_Inter3d::BRepOffset_Inter3d(const occ::handle<BRepAlgo_AsDes>& AsDes,
                                        const double                       Tol)
     : myAsDes(AsDes),
       mySide(Side),
-      myTol(Tol)
+      myTol(Tol),
+      myIsRunParallel(false)
 {
 }
 
@@ -86,6 +90,115 @@ static void ExtentEdge(const TopoDS_Face& /*F*/, const TopoDS_Edge& E, TopoDS_Ed
   NE.Orientation(E.Orientation());
 }
 
+//! Pair of extended offset faces to be intersected by ConnexIntByInt().
+struct ConnexIntTask
+{
+  int                            ShapeIndex; //!< index of the shape connecting the faces
+  TopoDS_Face                    F1;
+  TopoDS_Face                    F2;
+  TopoDS_Face                    NF1;
+  TopoDS_Face                    NF2;
+  TopoDS_Edge                    E;
+  TopAbs_State                   Side;
+  bool                           ToCompute; //!< the pair is intersected by this task
+  NCollection_List<TopoDS_Shape> LInt1;
+  NCollection_List<TopoDS_Shape> LInt2;
+};
+
+//=======================================================================
+// function : hasUsedIndex
+// purpose  : Checks if any of the indices is contained in the map
+//=======================================================================
+static bool hasUsedIndex(const NCollection_List<int>& theIndices,
+                         const NCollection_Map<int>&  theUsed)
+{
+  for (NCollection_List<int>::Iterator anIt(theIndices); anIt.More(); anIt.Next())
+  {
+    if (theUsed.Contains(anIt.Value()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//=======================================================================
+// function : addSubShapeIndices
+// purpose  : Adds the face, its edges and vertices to the map and
+//            appends their indices to the list
+//=======================================================================
+static void addSubShapeIndices(
+  const TopoDS_Shape&                                            theFace,
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theMSubShapes,
+  NCollection_List<int>&                                         theIndices)
+{
+  theIndices.Append(theMSubShapes.Add(theFace));
+  for (TopExp_Explorer anExpE(theFace, TopAbs_EDGE); anExpE.More(); anExpE.Next())
+  {
+    theIndices.Append(theMSubShapes.Add(anExpE.Current()));
+    for (TopoDS_Iterator aItV(anExpE.Current()); aItV.More(); aItV.Next())
+    {
+      theIndices.Append(theMSubShapes.Add(aItV.Value()));
+    }
+  }
+}
+
+//=======================================================================
+// function : performIndependentTasks
+// purpose  : Performs the tasks in parallel batches, so that the tasks
+//            modifying the same sub-shapes are never run simultaneously
+//            and are run in the order of their indices.
+//            Returns FALSE on user break.
+//=======================================================================
+template <typename TaskFunctor>
+static bool performIndependentTasks(const NCollection_Array1<NCollection_List<int>>& theSubShapes,
+                                    const TaskFunctor&                               theFunctor,
+                                    Message_ProgressScope&                           thePS)
+{
+  NCollection_DynamicArray<int> aRemaining, aDeferred, aBatch;
+  for (int iTask = theSubShapes.Lower(); iTask <= theSubShapes.Upper(); ++iTask)
+  {
+    aRemaining.Append(iTask);
+  }
+  while (!aRemaining.IsEmpty())
+  {
+    if (!thePS.More())
+    {
+      return false;
+    }
+    // select the tasks with distinct sub-shapes; the sub-shapes of deferred tasks
+    // are reserved as well to keep the order of the tasks modifying them
+    NCollection_Map<int> aMUsed;
+    aBatch.Clear();
+    aDeferred.Clear();
+    for (int iR = 0; iR < aRemaining.Length(); ++iR)
+    {
+      const int                    iTask = aRemaining.Value(iR);
+      const NCollection_List<int>& aLSS  = theSubShapes(iTask);
+      if (hasUsedIndex(aLSS, aMUsed))
+      {
+        aDeferred.Append(iTask);
+      }
+      else
+      {
+        aBatch.Append(iTask);
+      }
+      for (NCollection_List<int>::Iterator aItSS(aLSS); aItSS.More(); aItSS.Next())
+      {
+        aMUsed.Add(aItSS.Value());
+      }
+    }
+
+    OSD_Parallel::For(0, aBatch.Length(), [&](const int theIndex) {
+      theFunctor(aBatch.Value(theIndex));
+    });
+    thePS.Next(aBatch.Length());
+
+    aRemaining = aDeferred;
+  }
+  return true;
+}
+
 //=================================================================================================
 
 void BRepOffset_Inter3d::CompletInt(const NCollection_List<TopoDS_Shape>& SetOfFaces,
@@ -131,19 +244,84 @@ void BRepOffset_Inter3d::CompletInt(const NCollection_List<TopoDS_Shape>& SetOfF
   const NCollection_LinearVector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aSelector.Pairs();
   const int             aNbPairs = static_cast<int>(aPairs.Size());
   Message_ProgressScope aPS(theRange, "Complete intersection", aNbPairs);
-  for (int iPair = 0; iPair < aNbPairs; ++iPair, aPS.Next())
+  if (!myIsRunParallel || aNbPairs < 2)
   {
-    if (!aPS.More())
+    for (int iPair = 0; iPair < aNbPairs; ++iPair, aPS.Next())
     {
-      return;
+      if (!aPS.More())
+      {
+        return;
+      }
+      const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
+
+      const TopoDS_Face& aF1 = TopoDS::Face(aMFaces.FindKey(std::min(aPair.ID1, aPair.ID2)));
+      const TopoDS_Face& aF2 = TopoDS::Face(aMFaces.FindKey(std::max(aPair.ID1, aPair.ID2)));
+
+      // intersect faces
+      FaceInter(aF1, aF2, InitOffsetFace);
+    }
+    return;
+  }
+
+  // The intersection of two faces updates their sub-shapes (3D curves of edges,
+  // tolerances of vertices and edges), thus only the pairs of faces having no
+  // common sub-shapes are intersected simultaneously. The results are stored
+  // in the order of pairs after all intersections are computed, so that the
+  // content of AsDes does not depend on the number of threads.
+  const int                                                     aNbFaces = aMFaces.Extent();
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMSubShapes;
+  NCollection_Array1<NCollection_List<int>>                     aFaceSubShapes(1, aNbFaces);
+  for (int iF = 1; iF <= aNbFaces; ++iF)
+  {
+    addSubShapeIndices(aMFaces.FindKey(iF), aMSubShapes, aFaceSubShapes(iF));
+  }
+  NCollection_Array1<NCollection_List<int>> aPairSubShapes(0, aNbPairs - 1);
+  for (int iPair = 0; iPair < aNbPairs; ++iPair)
+  {
+    const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
+    for (NCollection_List<int>::Iterator aItSS(aFaceSubShapes(aPair.ID1)); aItSS.More();
+         aItSS.Next())
+    {
+      aPairSubShapes(iPair).Append(aItSS.Value());
     }
+    for (NCollection_List<int>::Iterator aItSS(aFaceSubShapes(aPair.ID2)); aItSS.More();
+         aItSS.Next())
+    {
+      aPairSubShapes(iPair).Append(aItSS.Value());
+    }
+  }
+
+  NCollection_Array1<NCollection_List<TopoDS_Shape>> aLInt1(0, aNbPairs - 1);
+  NCollection_Array1<NCollection_List<TopoDS_Shape>> aLInt2(0, aNbPairs - 1);
+  NCollection_Array1<bool>                           anIsToStore(0, aNbPairs - 1);
+  anIsToStore.Init(false);
+
+  const auto anInterFunctor = [&](const int iPair) {
     const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
 
     const TopoDS_Face& aF1 = TopoDS::Face(aMFaces.FindKey(std::min(aPair.ID1, aPair.ID2)));
     const TopoDS_Face& aF2 = TopoDS::Face(aMFaces.FindKey(std::max(aPair.ID1, aPair.ID2)));
+    anIsToStore.ChangeValue(iPair) = computeFaceInter(aF1,
+                                                      aF2,
+                                                      InitOffsetFace,
+                                                      aLInt1.ChangeValue(iPair),
+                                                      aLInt2.ChangeValue(iPair));
+  };
+  if (!performIndependentTasks(aPairSubShapes, anInterFunctor, aPS))
+  {
+    return;
+  }
 
-    // intersect faces
-    FaceInter(aF1, aF2, InitOffsetFace);
+  for (int iPair = 0; iPair < aNbPairs; ++iPair)
+  {
+    if (anIsToStore(iPair))
+    {
+      const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
+
+      const TopoDS_Face& aF1 = TopoDS::Face(aMFaces.FindKey(std::min(aPair.ID1, aPair.ID2)));
+      const TopoDS_Face& aF2 = TopoDS::Face(aMFaces.FindKey(std::max(aPair.ID1, aPair.ID2)));
+      Store(aF1, aF2, aLInt1(iPair), aLInt2(iPair));
+    }
   }
 }
 
@@ -157,23 +335,37 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face&    F1,
                                    const BRepAlgo_Image& InitOffsetFace)
 {
   NCollection_List<TopoDS_Shape> LInt1, LInt2;
-  TopoDS_Edge                    NullEdge;
-  TopoDS_Face                    NullFace;
+  if (computeFaceInter(F1, F2, InitOffsetFace, LInt1, LInt2))
+  {
+    Store(F1, F2, LInt1, LInt2);
+  }
+}
+
+//=================================================================================================
+
+bool BRepOffset_Inter3d::computeFaceInter(const TopoDS_Face&              F1,
+                                          const TopoDS_Face&              F2,
+                                          const BRepAlgo_Image&           InitOffsetFace,
+                                          NCollection_List<TopoDS_Shape>& LInt1,
+                                          NCollection_List<TopoDS_Shape>& LInt2) const
+{
+  TopoDS_Edge NullEdge;
+  TopoDS_Face NullFace;
 
   if (F1.IsSame(F2))
   {
-    return;
+    return false;
   }
   if (IsDone(F1, F2))
   {
-    return;
+    return false;
   }
 
   const TopoDS_Shape& InitF1 = InitOffsetFace.ImageFrom(F1);
   const TopoDS_Shape& InitF2 = InitOffsetFace.ImageFrom(F2);
   if (InitF1.IsSame(InitF2))
   {
-    return;
+    return false;
   }
 
   bool InterPipes = (InitF2.ShapeType() == TopAbs_EDGE && InitF1.ShapeType() == TopAbs_EDGE);
@@ -250,7 +442,7 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face&    F1,
       BRepOffset_Tool::Inter3D(F1, F2, LInt1, LInt2, mySide, NullEdge, NullFace, NullFace);
     }
   }
-  Store(F1, F2, LInt1, LInt2);
+  return true;
 }
 
 //=================================================================================================
@@ -649,14 +841,12 @@ void BRepOffset_Inter3d::ConnexIntByInt(
     }
   }
   //
+  // Collect the pairs of faces to intersect in the order of treated shapes;
+  // the faces are extended beforehand, as the extension does not depend on intersections
+  NCollection_DynamicArray<ConnexIntTask> aTasks;
   aNb = VEmap.Extent();
-  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aNb);
-  for (i = 1; i <= aNb; ++i, aPSInter.Next())
+  for (i = 1; i <= aNb; ++i)
   {
-    if (!aPSInter.More())
-    {
-      return;
-    }
     const TopoDS_Shape& aS = VEmap(i);
     //
     TopoDS_Edge                    E;
@@ -751,100 +941,174 @@ void BRepOffset_Inter3d::ConnexIntByInt(
         NF2 = TopoDS::Face(MES(OF2));
       }
       //
-      if (!IsDone(NF1, NF2))
+      ConnexIntTask& aTask = aTasks.Appended();
+      aTask.ShapeIndex     = i;
+      aTask.F1             = F1;
+      aTask.F2             = F2;
+      aTask.NF1            = NF1;
+      aTask.NF2            = NF2;
+      aTask.E              = E;
+      aTask.Side           = CurSide;
+      // the pair is intersected only once, the next occurrences reuse the result
+      aTask.ToCompute = !IsDone(NF1, NF2);
+      if (aTask.ToCompute)
       {
-        NCollection_List<TopoDS_Shape> LInt1, LInt2;
-        BRepOffset_Tool::Inter3D(NF1, NF2, LInt1, LInt2, CurSide, E, F1, F2);
         SetDone(NF1, NF2);
-        if (!LInt1.IsEmpty())
+      }
+    }
+  }
+  //
+  // Intersect the pairs of faces; the intersection does not use the stored results
+  // of other pairs, so it is performed for all pairs before storing the results
+  NCollection_DynamicArray<int> aComputed;
+  for (int iT = 0; iT < aTasks.Length(); ++iT)
+  {
+    if (aTasks(iT).ToCompute)
+    {
+      aComputed.Append(iT);
+    }
+  }
+  const int             aNbComputed = aComputed.Length();
+  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aNbComputed);
+  const auto            anInterFunctor = [&](const int theIndex) {
+    ConnexIntTask& aTask = aTasks.ChangeValue(aComputed.Value(theIndex));
+    BRepOffset_Tool::Inter3D(aTask.NF1,
+                             aTask.NF2,
+                             aTask.LInt1,
+                             aTask.LInt2,
+                             aTask.Side,
+                             aTask.E,
+                             aTask.F1,
+                             aTask.F2);
+  };
+  if (!myIsRunParallel || aNbComputed < 2)
+  {
+    for (int iC = 0; iC < aNbComputed; ++iC, aPSInter.Next())
+    {
+      if (!aPSInter.More())
+      {
+        return;
+      }
+      anInterFunctor(iC);
+    }
+  }
+  else
+  {
+    // faces sharing sub-shapes are not intersected simultaneously
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMSubShapes;
+    NCollection_Array1<NCollection_List<int>>                     aTaskSubShapes(0, aNbComputed - 1);
+    for (int iC = 0; iC < aNbComputed; ++iC)
+    {
+      const ConnexIntTask& aTask = aTasks(aComputed(iC));
+      addSubShapeIndices(aTask.NF1, aMSubShapes, aTaskSubShapes(iC));
+      addSubShapeIndices(aTask.NF2, aMSubShapes, aTaskSubShapes(iC));
+    }
+    if (!performIndependentTasks(aTaskSubShapes, anInterFunctor, aPSInter))
+    {
+      return;
+    }
+  }
+  //
+  // Store the results in the order of treated shapes
+  for (int iT = 0; iT < aTasks.Length(); ++iT)
+  {
+    const ConnexIntTask& aTask = aTasks(iT);
+    const TopoDS_Shape&  aS    = VEmap(aTask.ShapeIndex);
+    NF1                        = aTask.NF1;
+    NF2                        = aTask.NF2;
+    //
+    if (aTask.ToCompute)
+    {
+      const NCollection_List<TopoDS_Shape>& LInt1 = aTask.LInt1;
+      const NCollection_List<TopoDS_Shape>& LInt2 = aTask.LInt2;
+      if (!LInt1.IsEmpty())
+      {
+        Store(NF1, NF2, LInt1, LInt2);
+        //
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS))
         {
-          Store(NF1, NF2, LInt1, LInt2);
-          //
-          TopoDS_Compound C;
-          B.MakeCompound(C);
-          //
-          if (Build.IsBound(aS))
-          {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next())
-            {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
-          }
-          //
-          it.Initialize(LInt1);
-          for (; it.More(); it.Next())
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next())
           {
-            const TopoDS_Shape& aNE = it.Value();
+            const TopoDS_Shape& aNE = aExp.Current();
             B.Add(C, aNE);
-            //
-            // keep connection from new edge to shape from which it was created
-            NCollection_List<TopoDS_Shape>* pLS =
-              &aDMIntE(aDMIntE.Add(aNE, NCollection_List<TopoDS_Shape>()));
-            pLS->Append(aS);
-            // keep connection to faces created the edge as well
-            NCollection_List<TopoDS_Shape>* pLFF =
-              aDMIntFF.Bound(aNE, NCollection_List<TopoDS_Shape>());
-            pLFF->Append(F1);
-            pLFF->Append(F2);
           }
-          //
-          Build.Bind(aS, C);
         }
-        else
+        //
+        it.Initialize(LInt1);
+        for (; it.More(); it.Next())
         {
-          Failed.Append(aS);
+          const TopoDS_Shape& aNE = it.Value();
+          B.Add(C, aNE);
+          //
+          // keep connection from new edge to shape from which it was created
+          NCollection_List<TopoDS_Shape>* pLS =
+            &aDMIntE(aDMIntE.Add(aNE, NCollection_List<TopoDS_Shape>()));
+          pLS->Append(aS);
+          // keep connection to faces created the edge as well
+          NCollection_List<TopoDS_Shape>* pLFF =
+            aDMIntFF.Bound(aNE, NCollection_List<TopoDS_Shape>());
+          pLFF->Append(aTask.F1);
+          pLFF->Append(aTask.F2);
         }
+        //
+        Build.Bind(aS, C);
       }
       else
-      { // IsDone(NF1,NF2)
-        //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
-        const NCollection_List<TopoDS_Shape>& aLInt1 = myAsDes->Descendant(NF1);
-        const NCollection_List<TopoDS_Shape>& aLInt2 = myAsDes->Descendant(NF2);
+      {
+        Failed.Append(aS);
+      }
+    }
+    else
+    { // IsDone(NF1,NF2)
+      //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
+      const NCollection_List<TopoDS_Shape>& aLInt1 = myAsDes->Descendant(NF1);
+      const NCollection_List<TopoDS_Shape>& aLInt2 = myAsDes->Descendant(NF2);
 
-        if (!aLInt1.IsEmpty())
+      if (!aLInt1.IsEmpty())
+      {
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS))
         {
-          TopoDS_Compound C;
-          B.MakeCompound(C);
-          //
-          if (Build.IsBound(aS))
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next())
           {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next())
-            {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
+            const TopoDS_Shape& aNE = aExp.Current();
+            B.Add(C, aNE);
           }
+        }
+        //
+        for (it.Initialize(aLInt1); it.More(); it.Next())
+        {
+          const TopoDS_Shape& anE1 = it.Value();
           //
-          for (it.Initialize(aLInt1); it.More(); it.Next())
+          for (it1.Initialize(aLInt2); it1.More(); it1.Next())
           {
-            const TopoDS_Shape& anE1 = it.Value();
-            //
-            for (it1.Initialize(aLInt2); it1.More(); it1.Next())
+            const TopoDS_Shape& anE2 = it1.Value();
+            if (anE1.IsSame(anE2))
             {
-              const TopoDS_Shape& anE2 = it1.Value();
-              if (anE1.IsSame(anE2))
+              B.Add(C, anE1);
+              //
+              NCollection_List<TopoDS_Shape>* pLS = aDMIntE.ChangeSeek(anE1);
+              if (pLS)
               {
-                B.Add(C, anE1);
-                //
-                NCollection_List<TopoDS_Shape>* pLS = aDMIntE.ChangeSeek(anE1);
-                if (pLS)
-                {
-                  pLS->Append(aS);
-                }
+                pLS->Append(aS);
               }
             }
           }
-          Build.Bind(aS, C);
-        }
-        else
-        {
-          Failed.Append(aS);
         }
+        Build.Bind(aS, C);
+      }
+      else
+      {
+        Failed.Append(aS);
       }
     }
     //  Modified by skv - Fri Dec 26 12:20:14 2003 OCC4455 End
@@ -114,10 +114,28 @@ public:
   //! Returns AsDes tool
   occ::handle<BRepAlgo_AsDes> AsDes() const { return myAsDes; }
 
+  //! Sets the flag to compute intersections of independent pairs of faces
+  //! in parallel threads in CompletInt() and ConnexIntByInt(). FALSE by default.
+  //! Pairs of faces sharing sub-shapes are intersected one after another,
+  //! and the results are stored in the same order as in sequential mode.
+  //! ContextIntByInt() and ConnexIntByArc() remain sequential.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if intersections may be computed in parallel threads.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
   //! Returns new edges
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& NewEdges() { return myNewEdges; }
 
 private:
+  //! Computes the intersection of the faces without storing it.
+  //! Returns FALSE if the faces should not be intersected.
+  bool computeFaceInter(const TopoDS_Face&              F1,
+                        const TopoDS_Face&              F2,
+                        const BRepAlgo_Image&           InitOffsetFace,
+                        NCollection_List<TopoDS_Shape>& LInt1,
+                        NCollection_List<TopoDS_Shape>& LInt2) const;
+
   //! Stores the intersection results into AsDes
   Standard_EXPORT void Store(const TopoDS_Face&                    F1,
                              const TopoDS_Face&                    F2,
@@ -131,5 +149,6 @@ private:
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myNewEdges;
   TopAbs_State                                                  mySide;
   double                                                        myTol;
+  bool                                                          myIsRunParallel;
 };
 #endif // _BRepOffset_Inter3d_HeaderFile
@@ -21,6 +21,7 @@
 #include <Adaptor3d_CurveOnSurface.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_PointRepresentation.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_List.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
@@ -75,6 +76,7 @@
 #include <gp_Pnt.hxx>
 #include <GProp_GProps.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_ConstructionError.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -259,6 +261,7 @@ static void GetEnlargedFaces(
 static bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
                                      BRepAlgo_Image&                       theImage,
                                      TopoDS_Shape&                         theShells,
+                                     const bool                            theRunParallel,
                                      const Message_ProgressRange&          theRange);
 
 static bool GetSubShapes(const TopoDS_Shape&    theShape,
@@ -604,6 +607,7 @@ static void FillContours(
 //=================================================================================================
 
 BRepOffset_MakeOffset::BRepOffset_MakeOffset()
+    : myIsRunParallel(false)
 {
   myAsDes = new BRepAlgo_AsDes();
 }
@@ -630,7 +634,8 @@ BRepOffset_MakeOffset::BRepOffset_MakeOffset(const TopoDS_Shape&          S,
       myJoin(Join),
       myThickening(Thickening),
       myRemoveIntEdges(RemoveIntEdges),
-      myDone(false)
+      myDone(false),
+      myIsRunParallel(false)
 {
   myAsDes                  = new BRepAlgo_AsDes();
   myIsLinearizationAllowed = true;
@@ -940,6 +945,7 @@ void BRepOffset_MakeOffset::MakeOffsetShape(const Message_ProgressRange& theRang
                                            : "Connect offset faces by intersection");
 
   BRepOffset_Inter3d Inter(myAsDes, Side, myTol);
+  Inter.SetRunParallel(myIsRunParallel);
   Intersection3D(Inter, aPSInter.Next(90));
   if (myError != BRepOffset_NoError)
   {
@@ -1197,6 +1203,35 @@ const TopoDS_Shape& BRepOffset_MakeOffset::Shape() const
   return myOffsetShape;
 }
 
+//=======================================================================
+// function : isTangentFree
+// purpose  : Checks that the face has no tangential edges and vertices,
+//           i.e. its offset does not use the offset edges of other faces
+//=======================================================================
+static bool isTangentFree(const TopoDS_Face& theFace, const BRepOffset_Analyse& theAnalyse)
+{
+  NCollection_List<TopoDS_Shape> aLT;
+  theAnalyse.Edges(theFace, ChFiDS_Tangential, aLT);
+  if (!aLT.IsEmpty())
+  {
+    return false;
+  }
+  for (TopExp_Explorer anExpV(theFace, TopAbs_VERTEX); anExpV.More(); anExpV.Next())
+  {
+    const TopoDS_Vertex& aV = TopoDS::Vertex(anExpV.Current());
+    if (!theAnalyse.HasAncestor(aV))
+    {
+      return false;
+    }
+    theAnalyse.Edges(aV, ChFiDS_Tangential, aLT);
+    if (!aLT.IsEmpty())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 //=================================================================================================
 
 void BRepOffset_MakeOffset::MakeOffsetFaces(
@@ -1213,6 +1248,39 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
   BRepLib::SortFaces(myFaceComp, aLF);
   //
   Message_ProgressScope aPS(theRange, "Making offset faces", aLF.Extent());
+  //
+  // The offset of a face having neither tangential edges nor vertices does not
+  // depend on the offsets of other faces, such faces are offset in parallel threads
+  NCollection_DataMap<TopoDS_Shape, BRepOffset_Offset, TopTools_ShapeMapHasher> aMFIndependent;
+  if (myIsRunParallel)
+  {
+    NCollection_DynamicArray<TopoDS_Face> aVFIndependent;
+    for (aItLF.Initialize(aLF); aItLF.More(); aItLF.Next())
+    {
+      const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
+      if (!isTangentFree(aF, myAnalyse))
+      {
+        continue;
+      }
+      aVFIndependent.Append(aF);
+    }
+    //
+    const NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> anEmptyMap;
+    //
+    const int                             aNbIndependent = aVFIndependent.Length();
+    NCollection_Array1<BRepOffset_Offset> anIndepOffsets(0, std::max(aNbIndependent - 1, 0));
+    OSD_Parallel::For(0, aNbIndependent, [&](const int theIndex) {
+      const TopoDS_Face& aF      = aVFIndependent.Value(theIndex);
+      const double*      pOffset = myFaceOffset.Seek(aF);
+      anIndepOffsets.ChangeValue(theIndex) =
+        BRepOffset_Offset(aF, pOffset ? *pOffset : myOffset, anEmptyMap, OffsetOutside, myJoin);
+    });
+    for (int i = 0; i < aNbIndependent; ++i)
+    {
+      aMFIndependent.Bind(aVFIndependent.Value(i), anIndepOffsets.Value(i));
+    }
+  }
+  //
   aItLF.Initialize(aLF);
   for (; aItLF.More(); aItLF.Next(), aPS.Next())
   {
@@ -1222,7 +1290,12 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
       return;
     }
     const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
-    aCurOffset            = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
+    if (const BRepOffset_Offset* pOF = aMFIndependent.Seek(aF))
+    {
+      theMapSF.Bind(aF, *pOF);
+      continue;
+    }
+    aCurOffset = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
     BRepOffset_Offset              OF(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
     NCollection_List<TopoDS_Shape> Let;
     myAnalyse.Edges(aF, ChFiDS_Tangential, Let);
@@ -1358,6 +1431,7 @@ void BRepOffset_MakeOffset::BuildOffsetByInter(const Message_ProgressRange& theR
   }
 
   BRepOffset_Inter3d Inter3(AsDes, Side, myTol);
+  Inter3.SetRunParallel(myIsRunParallel);
   // Intersection between parallel faces
   Inter3.ConnexIntByInt(myFaceComp,
                         MapSF,
@@ -3756,7 +3830,7 @@ void BRepOffset_MakeOffset::MakeShells(const Message_ProgressRange& theRange)
   {
     //
     TopoDS_Shape aShells;
-    bDone = BuildShellsCompleteInter(aLSF, myImageOffset, aShells, aPS.Next());
+    bDone = BuildShellsCompleteInter(aLSF, myImageOffset, aShells, myIsRunParallel, aPS.Next());
     if (bDone)
     {
       myOffsetShape = aShells;
@@ -5064,6 +5138,7 @@ void GetEnlargedFaces(
 bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
                               BRepAlgo_Image&                       theImage,
                               TopoDS_Shape&                         theShells,
+                              const bool                            theRunParallel,
                               const Message_ProgressRange&          theRange)
 {
   Message_ProgressScope aPS(theRange, nullptr, 5);
@@ -5073,6 +5148,7 @@ bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
   // we need to intersect the faces to process the tangential faces
   aMV1.SetIntersect(true);
   aMV1.SetAvoidInternalShapes(true);
+  aMV1.SetRunParallel(theRunParallel);
   aMV1.Perform(aPS.Next(3));
   //
   bool bDone = !aMV1.HasErrors();
@@ -5161,6 +5237,7 @@ bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
   // no need to intersect this time
   aMV2.SetIntersect(false);
   aMV2.SetAvoidInternalShapes(true);
+  aMV2.SetRunParallel(theRunParallel);
   aMV2.Perform(aPS.Next());
   bDone = !aMV2.HasErrors();
   if (!bDone)
@@ -5215,6 +5292,7 @@ bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
   aMV3.SetArguments(aLF);
   aMV3.SetIntersect(false);
   aMV3.SetAvoidInternalShapes(true);
+  aMV3.SetRunParallel(theRunParallel);
   aMV3.Perform(aPS.Next());
   bDone = !aMV3.HasErrors();
   if (!bDone)
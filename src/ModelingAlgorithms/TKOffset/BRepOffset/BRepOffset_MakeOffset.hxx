@@ -76,6 +76,17 @@ public:
   //! Changes the flag allowing the linearization
   Standard_EXPORT void AllowLinearization(const bool theIsAllowed);
 
+  //! Sets the flag to use parallel threads: offset faces not connected to
+  //! other faces by tangential edges are built simultaneously, independent
+  //! pairs of adjacent offset faces (and all pairs in complete intersection mode)
+  //! are intersected simultaneously, and the Boolean operations building the result
+  //! run in parallel mode. The intersection with caps and the 2D intersection
+  //! of edges within faces remain sequential. FALSE by default.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if parallel threads are allowed.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
   //! Add Closing Faces, <F> has to be in the initial
   //! shape S.
   Standard_EXPORT void AddFace(const TopoDS_Face& F);
@@ -276,6 +287,7 @@ private:
   BRepOffset_MakeLoops myMakeLoops;
   bool                 myIsPerformSewing; // Handle bad walls in thicksolid mode.
   bool                 myIsPlanar;
+  bool                 myIsRunParallel;
   TopoDS_Shape         myBadShape;
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> myFacePlanfaceMap;
   NCollection_List<TopoDS_Shape>                                           myGenerated;
@@ -114,6 +114,15 @@ public:
     const bool                   RemoveIntEdges = false,
     const Message_ProgressRange& theRange       = Message_ProgressRange());
 
+  //! Sets the flag to build independent offset faces and intersections in parallel threads.
+  void SetRunParallel(const bool theToRunParallel)
+  {
+    myOffsetShape.SetRunParallel(theToRunParallel);
+  }
+
+  //! Returns TRUE if parallel computations are enabled.
+  bool IsRunParallel() const { return myOffsetShape.IsRunParallel(); }
+
   //! Returns instance of the underlying intersection / arc algorithm.
   Standard_EXPORT virtual const BRepOffset_MakeOffset& MakeOffset() const;
 
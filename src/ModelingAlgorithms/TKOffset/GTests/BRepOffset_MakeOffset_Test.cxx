@@ -25,11 +25,13 @@
 #include <BRepPrimAPI_MakeSphere.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepGProp.hxx>
 #include <Geom_Circle.hxx>
 #include <Geom_Ellipse.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_TrimmedCurve.hxx>
 #include <GeomAPI_PointsToBSpline.hxx>
+#include <GProp_GProps.hxx>
 #include <gp_Ax2.hxx>
 #include <gp_Circ.hxx>
 #include <gp_Elips.hxx>
@@ -1027,3 +1029,68 @@ TEST(BRepOffset_MakeOffsetTest, ThickSolid_CircleToOctagonLoft)
   // Octagon is closer to a circle, corners are less sharp
   EXPECT_TRUE(aThickMaker.IsDone()) << "ThickSolid on circle-to-octagon loft failed.";
 }
+
+//=================================================================================================
+// Test: parallel offset gives the same result as the sequential one
+//=================================================================================================
+
+static double OffsetVolume(const TopoDS_Shape& theShape,
+                           const double        theOffset,
+                           const bool          theIsInter,
+                           const bool          theToRunParallel)
+{
+  BRepOffset_MakeOffset anOffsetMaker;
+  anOffsetMaker.Initialize(theShape,
+                           theOffset,
+                           1.0e-7,
+                           BRepOffset_Skin,
+                           theIsInter,
+                           false,
+                           GeomAbs_Intersection);
+  anOffsetMaker.SetRunParallel(theToRunParallel);
+  anOffsetMaker.MakeOffsetShape();
+  if (!anOffsetMaker.IsDone())
+  {
+    return -1.0;
+  }
+  GProp_GProps aProps;
+  BRepGProp::VolumeProperties(anOffsetMaker.Shape(), aProps);
+  return aProps.Mass();
+}
+
+TEST(BRepOffset_MakeOffsetTest, OffsetShape_FusedBoxCylinder_Parallel)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(100.0, 100.0, 50.0).Shape();
+  const TopoDS_Shape aCyl =
+    BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(50, 50, 50), gp_Dir(0, 0, 1)), 30.0, 50.0).Shape();
+  BRepAlgoAPI_Fuse aFuser(aBox, aCyl);
+  ASSERT_TRUE(aFuser.IsDone()) << "Failed to fuse shapes";
+
+  const double aVolSeq = OffsetVolume(aFuser.Shape(), 5.0, false, false);
+  const double aVolPar = OffsetVolume(aFuser.Shape(), 5.0, false, true);
+  ASSERT_GT(aVolSeq, 0.0) << "Sequential offset failed";
+  EXPECT_NEAR(aVolSeq, aVolPar, 1.0e-6 * aVolSeq);
+}
+
+TEST(BRepOffset_MakeOffsetTest, OffsetShape_Box_CompleteIntersection_Parallel)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(100.0, 100.0, 50.0).Shape();
+
+  const double aVolSeq = OffsetVolume(aBox, 5.0, true, false);
+  const double aVolPar = OffsetVolume(aBox, 5.0, true, true);
+  ASSERT_GT(aVolSeq, 0.0) << "Sequential offset failed";
+  EXPECT_NEAR(aVolSeq, 110.0 * 110.0 * 60.0, 1.0e-6 * aVolSeq);
+  EXPECT_NEAR(aVolSeq, aVolPar, 1.0e-6 * aVolSeq);
+}
+
+TEST(BRepOffset_MakeOffsetTest, OffsetShape_Box_Parallel)
+{
+  // adjacent offset faces are intersected by BRepOffset_Inter3d::ConnexIntByInt()
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(100.0, 100.0, 50.0).Shape();
+
+  const double aVolSeq = OffsetVolume(aBox, 5.0, false, false);
+  const double aVolPar = OffsetVolume(aBox, 5.0, false, true);
+  ASSERT_GT(aVolSeq, 0.0) << "Sequential offset failed";
+  EXPECT_NEAR(aVolSeq, 110.0 * 110.0 * 60.0, 1.0e-6 * aVolSeq);
+  EXPECT_NEAR(aVolSeq, aVolPar, 1.0e-6 * aVolSeq);
+}
@@ -0,0 +1,476 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepClass3d_SolidMeshClassifier.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BVH_Ray.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <NCollection_Map.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+//! Relative tolerance for detecting ray hits close to triangle boundaries.
+constexpr double THE_BARYCENTRIC_EPS = 1.0e-9;
+
+//! Number of ray directions tried before falling back to exact classification.
+constexpr int THE_NB_RAY_DIRS = 4;
+
+//! Ray directions deliberately not aligned with coordinate axes and diagonals
+//! to avoid hitting edges of axis-aligned and regular meshes.
+static const double THE_RAY_DIRS[THE_NB_RAY_DIRS][3] = {{0.5372, 0.6219, 0.5698},
+                                                        {-0.7118, 0.3341, 0.6179},
+                                                        {0.2147, -0.8763, 0.4313},
+                                                        {-0.4079, -0.2581, -0.8758}};
+
+//! Selector checking if any triangle lies within the given distance from the point.
+class NearTriangleSelector : public BVH_Traverse<double, 3, BRepExtrema_TriangleSet, double>
+{
+public:
+  NearTriangleSelector(const BVH_Vec3d& thePnt, const double theSqDistance)
+      : myPnt(thePnt),
+        mySqDistance(theSqDistance),
+        myIsFound(false)
+  {
+  }
+
+  //! Returns TRUE if some triangle has been found within the distance.
+  bool IsFound() const { return myIsFound; }
+
+  bool RejectNode(const BVH_Vec3d& theCornerMin,
+                  const BVH_Vec3d& theCornerMax,
+                  double&          theMetric) const override
+  {
+    theMetric = BVH_Tools<double, 3>::PointBoxSquareDistance(myPnt, theCornerMin, theCornerMax);
+    return theMetric > mySqDistance;
+  }
+
+  bool IsMetricBetter(const double& theLeft, const double& theRight) const override
+  {
+    return theLeft < theRight;
+  }
+
+  bool Accept(const int theIndex, const double&) override
+  {
+    BVH_Vec3d aVert1, aVert2, aVert3;
+    myBVHSet->GetVertices(theIndex, aVert1, aVert2, aVert3);
+    if (BVH_Tools<double, 3>::PointTriangleSquareDistance(myPnt, aVert1, aVert2, aVert3)
+        <= mySqDistance)
+    {
+      myIsFound = true;
+      return true;
+    }
+    return false;
+  }
+
+  bool Stop() const override { return myIsFound; }
+
+private:
+  BVH_Vec3d myPnt;
+  double    mySqDistance;
+  bool      myIsFound;
+};
+
+//! Selector counting crossings of the ray with triangles.
+//! The ray is marked ambiguous when it passes too close to a triangle edge or vertex,
+//! or is nearly parallel to a triangle it hits.
+class RayCrossingSelector : public BVH_Traverse<double, 3, BRepExtrema_TriangleSet, double>
+{
+public:
+  RayCrossingSelector(const BVH_Ray<double, 3>& theRay)
+      : myRay(theRay),
+        myNbCrossings(0),
+        myIsAmbiguous(false)
+  {
+  }
+
+  //! Returns the number of crossings.
+  int NbCrossings() const { return myNbCrossings; }
+
+  //! Returns TRUE if crossings cannot be counted reliably.
+  bool IsAmbiguous() const { return myIsAmbiguous; }
+
+  bool RejectNode(const BVH_Vec3d& theCornerMin,
+                  const BVH_Vec3d& theCornerMax,
+                  double&          theMetric) const override
+  {
+    double aTimeLeave = 0.0;
+    theMetric         = 0.0;
+    return !BVH_Tools<double, 3>::RayBoxIntersection(myRay,
+                                                     theCornerMin,
+                                                     theCornerMax,
+                                                     theMetric,
+                                                     aTimeLeave);
+  }
+
+  bool Accept(const int theIndex, const double&) override
+  {
+    BVH_Vec3d aVert1, aVert2, aVert3;
+    myBVHSet->GetVertices(theIndex, aVert1, aVert2, aVert3);
+
+    // Moller-Trumbore ray-triangle intersection
+    const BVH_Vec3d anEdge1 = aVert2 - aVert1;
+    const BVH_Vec3d anEdge2 = aVert3 - aVert1;
+    const BVH_Vec3d aPVec   = BVH_Vec3d::Cross(myRay.Direct, anEdge2);
+    const double    aDet    = anEdge1.Dot(aPVec);
+    const double    aScale  = anEdge1.Modulus() * anEdge2.Modulus();
+    if (std::abs(aDet) <= THE_BARYCENTRIC_EPS * aScale)
+    {
+      // ray is parallel to the triangle plane and might graze the triangle
+      myIsAmbiguous = true;
+      return false;
+    }
+
+    const double    anInvDet = 1.0 / aDet;
+    const BVH_Vec3d aTVec    = myRay.Origin - aVert1;
+    const double    aU       = aTVec.Dot(aPVec) * anInvDet;
+    if (aU < -THE_BARYCENTRIC_EPS || aU > 1.0 + THE_BARYCENTRIC_EPS)
+    {
+      return false;
+    }
+
+    const BVH_Vec3d aQVec = BVH_Vec3d::Cross(aTVec, anEdge1);
+    const double    aV    = myRay.Direct.Dot(aQVec) * anInvDet;
+    if (aV < -THE_BARYCENTRIC_EPS || aU + aV > 1.0 + THE_BARYCENTRIC_EPS)
+    {
+      return false;
+    }
+
+    const double aTime = anEdge2.Dot(aQVec) * anInvDet;
+    if (aTime <= 0.0)
+    {
+      return false;
+    }
+
+    if (aU < THE_BARYCENTRIC_EPS || aV < THE_BARYCENTRIC_EPS
+        || aU + aV > 1.0 - THE_BARYCENTRIC_EPS)
+    {
+      // crossing on shared edge or vertex would be counted several times
+      myIsAmbiguous = true;
+      return false;
+    }
+
+    ++myNbCrossings;
+    return true;
+  }
+
+  bool Stop() const override { return myIsAmbiguous; }
+
+private:
+  BVH_Ray<double, 3> myRay;
+  int                myNbCrossings;
+  bool               myIsAmbiguous;
+};
+
+//! Functor classifying a band of points.
+struct ClassifyFunctor
+{
+  ClassifyFunctor(BRepClass3d_SolidMeshClassifier&  theClassifier,
+                  const NCollection_Array1<gp_Pnt>& thePoints,
+                  NCollection_Array1<TopAbs_State>& theStates,
+                  NCollection_Array1<int>&          theNbExact,
+                  const double                      theTol,
+                  const int                         theBandSize)
+      : Classifier(theClassifier),
+        Points(thePoints),
+        States(theStates),
+        NbExact(theNbExact),
+        Tol(theTol),
+        BandSize(theBandSize)
+  {
+  }
+
+  void operator()(const int theBandIndex) const
+  {
+    const int aFirst = Points.Lower() + theBandIndex * BandSize;
+    const int aLast  = std::min(aFirst + BandSize - 1, Points.Upper());
+
+    // exact classifier is local to the band as it is not thread-safe
+    std::unique_ptr<BRepClass3d_SolidClassifier> anExactClassifier;
+    for (int aPntIter = aFirst; aPntIter <= aLast; ++aPntIter)
+    {
+      const gp_Pnt& aPnt   = Points.Value(aPntIter);
+      TopAbs_State  aState = Classifier.PerformOnMesh(aPnt, Tol);
+      if (aState == TopAbs_UNKNOWN)
+      {
+        if (!anExactClassifier)
+        {
+          anExactClassifier = std::make_unique<BRepClass3d_SolidClassifier>(Classifier.Shape());
+        }
+        anExactClassifier->Perform(aPnt, Tol);
+        aState = anExactClassifier->State();
+        ++NbExact.ChangeValue(theBandIndex);
+      }
+      States.ChangeValue(aPntIter) = aState;
+    }
+  }
+
+  BRepClass3d_SolidMeshClassifier&  Classifier;
+  const NCollection_Array1<gp_Pnt>& Points;
+  NCollection_Array1<TopAbs_State>& States;
+  NCollection_Array1<int>&          NbExact;
+  double                            Tol;
+  int                               BandSize;
+};
+} // namespace
+
+//=================================================================================================
+
+BRepClass3d_SolidMeshClassifier::BRepClass3d_SolidMeshClassifier()
+    : myMeshDeviation(0.0),
+      myState(TopAbs_UNKNOWN),
+      myNbExact(0),
+      myIsMeshUsable(false),
+      myIsInverted(false)
+{
+}
+
+//=================================================================================================
+
+BRepClass3d_SolidMeshClassifier::BRepClass3d_SolidMeshClassifier(const TopoDS_Shape& theShape)
+    : myMeshDeviation(0.0),
+      myState(TopAbs_UNKNOWN),
+      myNbExact(0),
+      myIsMeshUsable(false),
+      myIsInverted(false)
+{
+  Load(theShape);
+}
+
+//=================================================================================================
+
+BRepClass3d_SolidMeshClassifier::~BRepClass3d_SolidMeshClassifier() = default;
+
+//=================================================================================================
+
+void BRepClass3d_SolidMeshClassifier::Load(const TopoDS_Shape& theShape)
+{
+  myShape = theShape;
+  myTriangleSet.Nullify();
+  myExactClassifier.reset();
+  myMeshBox.Clear();
+  myMeshDeviation = 0.0;
+  myState         = TopAbs_UNKNOWN;
+  myNbExact       = 0;
+  myIsMeshUsable  = false;
+  myIsInverted    = false;
+  if (theShape.IsNull())
+  {
+    return;
+  }
+
+  // parity counting requires closed shells without free, internal or duplicated faces
+  for (TopExp_Explorer aShellExp(theShape, TopAbs_SHELL); aShellExp.More(); aShellExp.Next())
+  {
+    if (!BRep_Tool::IsClosed(aShellExp.Current()))
+    {
+      return;
+    }
+  }
+  if (TopExp_Explorer(theShape, TopAbs_FACE, TopAbs_SHELL).More())
+  {
+    return;
+  }
+
+  NCollection_DynamicArray<TopoDS_Shape>               aFaces;
+  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFaceMap;
+  double aMaxDeflection = 0.0, aMaxTolerance = 0.0, aSignedVolume = 0.0;
+  for (TopExp_Explorer aFaceExp(theShape, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aFaceExp.Current());
+    if (aFace.Orientation() == TopAbs_INTERNAL || aFace.Orientation() == TopAbs_EXTERNAL
+        || !aFaceMap.Add(aFace))
+    {
+      return;
+    }
+
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& aTriangulation = BRep_Tool::Triangulation(aFace, aLoc);
+    if (aTriangulation.IsNull() || aTriangulation->NbTriangles() == 0)
+    {
+      return;
+    }
+
+    aMaxDeflection = std::max(aMaxDeflection, aTriangulation->Deflection());
+    aMaxTolerance  = std::max(aMaxTolerance, BRep_Tool::Tolerance(aFace));
+
+    // signed volume of the mesh defines orientation of the solid
+    const gp_Trsf& aTrsf      = aLoc.Transformation();
+    const bool     isReversed = aFace.Orientation() == TopAbs_REVERSED;
+    for (int aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter)
+    {
+      int aNode1 = 0, aNode2 = 0, aNode3 = 0;
+      aTriangulation->Triangle(aTriIter).Get(aNode1, aNode2, aNode3);
+      const gp_XYZ aPnt1 = aTriangulation->Node(aNode1).Transformed(aTrsf).XYZ();
+      const gp_XYZ aPnt2 = aTriangulation->Node(aNode2).Transformed(aTrsf).XYZ();
+      const gp_XYZ aPnt3 = aTriangulation->Node(aNode3).Transformed(aTrsf).XYZ();
+      const double aVol  = aPnt1.Dot(aPnt2.Crossed(aPnt3));
+      aSignedVolume += isReversed ? -aVol : aVol;
+    }
+    aFaces.Append(aFace);
+  }
+  if (aFaces.IsEmpty())
+  {
+    return;
+  }
+
+  for (TopExp_Explorer anEdgeExp(theShape, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+  {
+    aMaxTolerance = std::max(aMaxTolerance, BRep_Tool::Tolerance(TopoDS::Edge(anEdgeExp.Current())));
+  }
+  for (TopExp_Explorer aVertExp(theShape, TopAbs_VERTEX); aVertExp.More(); aVertExp.Next())
+  {
+    aMaxTolerance =
+      std::max(aMaxTolerance, BRep_Tool::Tolerance(TopoDS::Vertex(aVertExp.Current())));
+  }
+
+  myTriangleSet = new BRepExtrema_TriangleSet();
+  if (!myTriangleSet->Init(aFaces) || myTriangleSet->Size() == 0)
+  {
+    myTriangleSet.Nullify();
+    return;
+  }
+
+  // evaluate box and BVH in advance to allow concurrent queries
+  myMeshBox       = myTriangleSet->Box();
+  myMeshDeviation = aMaxDeflection + aMaxTolerance;
+  myIsInverted    = aSignedVolume < 0.0;
+  myIsMeshUsable  = !myTriangleSet->BVH().IsNull();
+}
+
+//=================================================================================================
+
+BRepClass3d_SolidClassifier& BRepClass3d_SolidMeshClassifier::exactClassifier()
+{
+  if (!myExactClassifier)
+  {
+    myExactClassifier = std::make_unique<BRepClass3d_SolidClassifier>(myShape);
+  }
+  return *myExactClassifier;
+}
+
+//=================================================================================================
+
+TopAbs_State BRepClass3d_SolidMeshClassifier::PerformOnMesh(const gp_Pnt& thePnt,
+                                                            const double  theTol) const
+{
+  if (!myIsMeshUsable)
+  {
+    return TopAbs_UNKNOWN;
+  }
+
+  const BVH_Vec3d aPnt(thePnt.X(), thePnt.Y(), thePnt.Z());
+  const double    aBand   = theTol + myMeshDeviation;
+  const double    aSqBand = aBand * aBand;
+  if (BVH_Tools<double, 3>::PointBoxSquareDistance(aPnt, myMeshBox) > aSqBand)
+  {
+    return myIsInverted ? TopAbs_IN : TopAbs_OUT;
+  }
+
+  const occ::handle<BVH_Tree<double, 3>>& aBVH = myTriangleSet->BVH();
+
+  // points within the tolerance band of the boundary are classified exactly
+  NearTriangleSelector aNearSelector(aPnt, aSqBand);
+  aNearSelector.SetBVHSet(myTriangleSet.get());
+  aNearSelector.Select(aBVH);
+  if (aNearSelector.IsFound())
+  {
+    return TopAbs_UNKNOWN;
+  }
+
+  for (int aDirIter = 0; aDirIter < THE_NB_RAY_DIRS; ++aDirIter)
+  {
+    const BVH_Vec3d aDir(THE_RAY_DIRS[aDirIter][0],
+                         THE_RAY_DIRS[aDirIter][1],
+                         THE_RAY_DIRS[aDirIter][2]);
+
+    RayCrossingSelector aRaySelector(BVH_Ray<double, 3>(aPnt, aDir));
+    aRaySelector.SetBVHSet(myTriangleSet.get());
+    aRaySelector.Select(aBVH);
+    if (!aRaySelector.IsAmbiguous())
+    {
+      const bool isOdd = (aRaySelector.NbCrossings() % 2) != 0;
+      return isOdd != myIsInverted ? TopAbs_IN : TopAbs_OUT;
+    }
+  }
+  return TopAbs_UNKNOWN;
+}
+
+//=================================================================================================
+
+void BRepClass3d_SolidMeshClassifier::Perform(const gp_Pnt& thePnt, const double theTol)
+{
+  myNbExact = 0;
+  myState   = PerformOnMesh(thePnt, theTol);
+  if (myState == TopAbs_UNKNOWN && !myShape.IsNull())
+  {
+    BRepClass3d_SolidClassifier& anExactClassifier = exactClassifier();
+    anExactClassifier.Perform(thePnt, theTol);
+    myState   = anExactClassifier.State();
+    myNbExact = 1;
+  }
+}
+
+//=================================================================================================
+
+void BRepClass3d_SolidMeshClassifier::Perform(const NCollection_Array1<gp_Pnt>& thePoints,
+                                              const double                      theTol,
+                                              NCollection_Array1<TopAbs_State>& theStates,
+                                              const bool theToRunParallel)
+{
+  myNbExact = 0;
+  if (thePoints.IsEmpty())
+  {
+    theStates = NCollection_Array1<TopAbs_State>();
+    return;
+  }
+
+  theStates.Resize(thePoints.Lower(), thePoints.Upper(), false);
+  theStates.Init(TopAbs_UNKNOWN);
+  if (myShape.IsNull())
+  {
+    return;
+  }
+
+  const int aNbPoints    = thePoints.Length();
+  const int aMinBandSize = 64;
+  int       aNbTasks     = 1;
+  if (theToRunParallel)
+  {
+    aNbTasks = OSD_ThreadPool::DefaultPool()->NbThreads() * 4;
+  }
+  const int aBandSize =
+    std::max(aMinBandSize, (int)std::ceil((double)aNbPoints / aNbTasks));
+  aNbTasks = (aNbPoints + aBandSize - 1) / aBandSize;
+
+  NCollection_Array1<int> aNbExact(0, aNbTasks - 1);
+  aNbExact.Init(0);
+  ClassifyFunctor aFunctor(*this, thePoints, theStates, aNbExact, theTol, aBandSize);
+  OSD_Parallel::For(0, aNbTasks, aFunctor, !theToRunParallel || aNbTasks == 1);
+
+  for (int aTaskIter = 0; aTaskIter < aNbTasks; ++aTaskIter)
+  {
+    myNbExact += aNbExact.Value(aTaskIter);
+  }
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepClass3d_SolidMeshClassifier_HeaderFile
+#define _BRepClass3d_SolidMeshClassifier_HeaderFile
+
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepExtrema_TriangleSet.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <memory>
+
+//! Classifies points against a solid using the triangulation of its faces.
+//!
+//! The triangulations already stored in the faces (e.g. computed by BRepMesh)
+//! are gathered into a BVH of triangles. Points lying farther from the mesh
+//! than the boundary band are classified by ray parity counting against the
+//! triangles, which is significantly cheaper than intersecting exact surfaces.
+//! The boundary band is the sum of the classification tolerance, the maximal
+//! triangulation deflection and the maximal tolerance of sub-shapes.
+//! Points within the band, as well as rays hitting triangle edges or vertices,
+//! are delegated to the exact BRepClass3d_SolidClassifier.
+//!
+//! The mesh path is disabled (all points are classified exactly) when
+//! some face has no triangulation, a shell is not closed, or the shape
+//! contains internal/external faces.
+class BRepClass3d_SolidMeshClassifier
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor.
+  Standard_EXPORT BRepClass3d_SolidMeshClassifier();
+
+  //! Constructor from a Shape.
+  Standard_EXPORT BRepClass3d_SolidMeshClassifier(const TopoDS_Shape& theShape);
+
+  //! Releases resources.
+  Standard_EXPORT ~BRepClass3d_SolidMeshClassifier();
+
+  //! Loads the solid and builds BVH over triangulation of its faces.
+  Standard_EXPORT void Load(const TopoDS_Shape& theShape);
+
+  //! Returns the loaded shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns TRUE if triangulation of the loaded shape is suitable for classification;
+  //! otherwise all points are classified by exact algorithm.
+  bool IsMeshUsable() const { return myIsMeshUsable; }
+
+  //! Returns maximal deviation of triangulation from the exact shape
+  //! (deflection of triangulation plus tolerance of sub-shapes).
+  double MeshDeviation() const { return myMeshDeviation; }
+
+  //! Overrides maximal deviation of triangulation from the exact shape.
+  //! Can be used for triangulations with unknown deflection.
+  void SetMeshDeviation(const double theDeviation) { myMeshDeviation = theDeviation; }
+
+  //! Classifies the point P with the tolerance Tol on the solid.
+  Standard_EXPORT void Perform(const gp_Pnt& thePnt, const double theTol);
+
+  //! Returns the result of the last classification of a single point.
+  TopAbs_State State() const { return myState; }
+
+  //! Classifies the array of points with the tolerance Tol on the solid.
+  //! The exact classifier is created per task in parallel mode.
+  //! @param[in] thePoints  points to classify
+  //! @param[in] theTol  classification tolerance
+  //! @param[out] theStates  output states, resized to the bounds of points array
+  //! @param[in] theToRunParallel  flag to run classification in parallel threads
+  Standard_EXPORT void Perform(const NCollection_Array1<gp_Pnt>& thePoints,
+                               const double                      theTol,
+                               NCollection_Array1<TopAbs_State>& theStates,
+                               const bool                        theToRunParallel = true);
+
+  //! Returns the number of points classified by exact algorithm during the last Perform.
+  int NbExactClassified() const { return myNbExact; }
+
+public:
+  //! Classifies the point using triangulation only.
+  //! Returns TopAbs_UNKNOWN if the point should be classified by exact algorithm.
+  //! This method is thread-safe.
+  Standard_EXPORT TopAbs_State PerformOnMesh(const gp_Pnt& thePnt, const double theTol) const;
+
+private:
+  //! Returns the exact classifier, loading it on first call.
+  BRepClass3d_SolidClassifier& exactClassifier();
+
+private:
+  TopoDS_Shape                                 myShape;
+  occ::handle<BRepExtrema_TriangleSet>         myTriangleSet;
+  std::unique_ptr<BRepClass3d_SolidClassifier> myExactClassifier;
+  BVH_Box<double, 3>                           myMeshBox;
+  double                                       myMeshDeviation;
+  TopAbs_State                                 myState;
+  int                                          myNbExact;
+  bool                                         myIsMeshUsable;
+  bool                                         myIsInverted;
+};
+
+#endif // _BRepClass3d_SolidMeshClassifier_HeaderFile
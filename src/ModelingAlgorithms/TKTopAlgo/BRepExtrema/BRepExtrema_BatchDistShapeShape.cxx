@@ -0,0 +1,198 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepExtrema_BatchDistShapeShape.hxx>
+
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_OutOfRange.hxx>
+
+//=================================================================================================
+
+BRepExtrema_BatchDistShapeShape::BRepExtrema_BatchDistShapeShape()
+    : myEps(Precision::Confusion()),
+      myThreshold(-1.0),
+      myIsMultiThread(true)
+{
+}
+
+//=================================================================================================
+
+int BRepExtrema_BatchDistShapeShape::AddShape(const TopoDS_Shape& theShape)
+{
+  // shapes are prepared in parallel within Perform()
+  myInputShapes.Append(theShape);
+  myShapes.Append(occ::handle<BRepExtrema_PreparedShape>());
+  return myInputShapes.Length();
+}
+
+//=================================================================================================
+
+int BRepExtrema_BatchDistShapeShape::AddPair(const int theShape1, const int theShape2)
+{
+  Standard_OutOfRange_Raise_if(theShape1 < 1 || theShape1 > myInputShapes.Length()
+                                 || theShape2 < 1 || theShape2 > myInputShapes.Length(),
+                               "BRepExtrema_BatchDistShapeShape::AddPair: wrong shape index");
+  PairResult aPair;
+  aPair.Shape1 = theShape1;
+  aPair.Shape2 = theShape2;
+  myPairs.Append(aPair);
+  return myPairs.Length();
+}
+
+//=================================================================================================
+
+void BRepExtrema_BatchDistShapeShape::AddPairs(const int theFirst1,
+                                               const int theLast1,
+                                               const int theFirst2,
+                                               const int theLast2)
+{
+  for (int aShape1 = theFirst1; aShape1 <= theLast1; ++aShape1)
+  {
+    for (int aShape2 = theFirst2; aShape2 <= theLast2; ++aShape2)
+    {
+      AddPair(aShape1, aShape2);
+    }
+  }
+}
+
+//=================================================================================================
+
+void BRepExtrema_BatchDistShapeShape::AddAllPairs()
+{
+  for (int aShape1 = 1; aShape1 <= myShapes.Length(); ++aShape1)
+  {
+    for (int aShape2 = aShape1 + 1; aShape2 <= myShapes.Length(); ++aShape2)
+    {
+      AddPair(aShape1, aShape2);
+    }
+  }
+}
+
+//=================================================================================================
+
+void BRepExtrema_BatchDistShapeShape::ClearPairs()
+{
+  myPairs.Clear();
+}
+
+//=================================================================================================
+
+void BRepExtrema_BatchDistShapeShape::Clear()
+{
+  myPairs.Clear();
+  myInputShapes.Clear();
+  myShapes.Clear();
+}
+
+//=================================================================================================
+
+bool BRepExtrema_BatchDistShapeShape::Perform(const Message_ProgressRange& theRange)
+{
+  const int aNbPairs = myPairs.Length();
+  for (int aPairIter = 0; aPairIter < aNbPairs; ++aPairIter)
+  {
+    PairResult& aPair       = myPairs.ChangeValue(aPairIter);
+    aPair.Distance          = 0.0;
+    aPair.IsDone            = false;
+    aPair.IsBeyondThreshold = false;
+    aPair.IsInner           = false;
+  }
+  if (aNbPairs == 0)
+  {
+    return true;
+  }
+
+  Message_ProgressScope aRootScope(theRange, "Batch distance computation", 2);
+
+  // decomposition and boxes are computed once per shape and shared by all its pairs;
+  // prepared shapes are not modified by distance computations
+  OSD_Parallel::For(
+    0,
+    myShapes.Length(),
+    [&](const int theIndex) {
+      occ::handle<BRepExtrema_PreparedShape>& aShape = myShapes.ChangeValue(theIndex);
+      if (aShape.IsNull())
+      {
+        aShape = new BRepExtrema_PreparedShape(myInputShapes.Value(theIndex));
+      }
+    },
+    !myIsMultiThread);
+  aRootScope.Next();
+  if (!aRootScope.More())
+  {
+    return false;
+  }
+
+  Message_ProgressScope                     aScope(aRootScope.Next(), "Distance", aNbPairs);
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aNbPairs - 1);
+  for (int aPairIter = 0; aPairIter < aNbPairs; ++aPairIter)
+  {
+    aRanges.SetValue(aPairIter, aScope.Next());
+  }
+
+  // inner parallelism is useful only when there is nothing to run concurrently
+  const bool isInnerParallel = myIsMultiThread && aNbPairs == 1;
+  OSD_Parallel::For(
+    0,
+    aNbPairs,
+    [&](const int theIndex) {
+      PairResult&                                   aPair   = myPairs.ChangeValue(theIndex);
+      const occ::handle<BRepExtrema_PreparedShape>& aShape1 = myShapes.Value(aPair.Shape1 - 1);
+      const occ::handle<BRepExtrema_PreparedShape>& aShape2 = myShapes.Value(aPair.Shape2 - 1);
+      if (aShape1->Shape().IsNull() || aShape2->Shape().IsNull())
+      {
+        return;
+      }
+
+      // distance between boxes is the lower bound of the distance between shapes
+      const double aLowerBound = (aShape1->Box().IsVoid() || aShape2->Box().IsVoid())
+                                   ? 0.0
+                                   : aShape1->Box().Distance(aShape2->Box());
+      if (myThreshold >= 0.0 && aLowerBound > myThreshold)
+      {
+        aPair.Distance          = aLowerBound;
+        aPair.IsBeyondThreshold = true;
+        return;
+      }
+
+      try
+      {
+        OCC_CATCH_SIGNALS
+        BRepExtrema_DistShapeShape aDist;
+        aDist.SetDeflection(myEps);
+        aDist.SetMultiThread(isInnerParallel);
+        aDist.LoadS1(aShape1);
+        aDist.LoadS2(aShape2);
+        if (aDist.Perform(aRanges.Value(theIndex)) && aDist.NbSolution() > 0)
+        {
+          aPair.Distance = aDist.Value();
+          aPair.Pnt1     = aDist.PointOnShape1(1);
+          aPair.Pnt2     = aDist.PointOnShape2(1);
+          aPair.IsInner  = aDist.InnerSolution();
+          aPair.IsDone   = true;
+        }
+      }
+      catch (Standard_Failure const&)
+      {
+        aPair.IsDone = false;
+      }
+    },
+    !myIsMultiThread || aNbPairs == 1);
+
+  return !aScope.UserBreak();
+}
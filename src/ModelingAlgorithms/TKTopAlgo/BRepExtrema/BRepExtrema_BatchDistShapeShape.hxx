@@ -0,0 +1,174 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepExtrema_BatchDistShapeShape_HeaderFile
+#define _BRepExtrema_BatchDistShapeShape_HeaderFile
+
+#include <BRepExtrema_PreparedShape.hxx>
+#include <gp_Pnt.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <Precision.hxx>
+
+//! Computes minimum distances between many pairs of shapes,
+//! e.g. for clearance checking of assembly parts.
+//!
+//! Each shape is decomposed and its sub-shape boxes are computed only once
+//! (see BRepExtrema_PreparedShape) and then shared by all pairs it participates in.
+//! Pairs are evaluated by BRepExtrema_DistShapeShape and are distributed across threads.
+//! When a threshold is set, the pairs whose bounding boxes are farther than the threshold
+//! are not computed at all and are reported by IsBeyondThreshold().
+//!
+//! Usage:
+//! @code
+//!   BRepExtrema_BatchDistShapeShape aBatch;
+//!   const int aShape1 = aBatch.AddShape(aPart1);
+//!   const int aShape2 = aBatch.AddShape(aPart2);
+//!   aBatch.AddPair(aShape1, aShape2);
+//!   aBatch.SetThreshold(1.0);
+//!   aBatch.Perform();
+//!   for (int aPairIter = 1; aPairIter <= aBatch.NbPairs(); ++aPairIter)
+//!   {
+//!     if (aBatch.IsDone(aPairIter)) { aBatch.Value(aPairIter); }
+//!   }
+//! @endcode
+class BRepExtrema_BatchDistShapeShape
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates empty tool.
+  Standard_EXPORT BRepExtrema_BatchDistShapeShape();
+
+  //! Adds the shape and returns its index (starting from 1).
+  Standard_EXPORT int AddShape(const TopoDS_Shape& theShape);
+
+  //! Returns the number of shapes.
+  int NbShapes() const { return myInputShapes.Length(); }
+
+  //! Returns the shape with the given index.
+  const TopoDS_Shape& Shape(const int theIndex) const
+  {
+    return myInputShapes.Value(theIndex - 1);
+  }
+
+  //! Adds the pair of shapes to compute distance between and returns its index (starting from 1).
+  //! @param[in] theShape1  index of the first shape
+  //! @param[in] theShape2  index of the second shape
+  Standard_EXPORT int AddPair(const int theShape1, const int theShape2);
+
+  //! Adds pairs between each shape of the range [theFirst1, theLast1]
+  //! and each shape of the range [theFirst2, theLast2] (N x M pairs).
+  Standard_EXPORT void AddPairs(const int theFirst1,
+                                const int theLast1,
+                                const int theFirst2,
+                                const int theLast2);
+
+  //! Adds pairs between all shapes (each unordered pair once).
+  Standard_EXPORT void AddAllPairs();
+
+  //! Removes all pairs keeping the shapes.
+  Standard_EXPORT void ClearPairs();
+
+  //! Removes all shapes and pairs.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of pairs.
+  int NbPairs() const { return myPairs.Length(); }
+
+  //! Returns indices of shapes of the pair.
+  void Pair(const int theIndex, int& theShape1, int& theShape2) const
+  {
+    const PairResult& aPair = myPairs.Value(theIndex - 1);
+    theShape1               = aPair.Shape1;
+    theShape2               = aPair.Shape2;
+  }
+
+  //! Sets deflection of distance computation; Precision::Confusion() by default.
+  void SetDeflection(const double theDeflection) { myEps = theDeflection; }
+
+  //! Sets the maximum distance of interest; pairs that are certainly farther
+  //! (according to bounding boxes) are skipped. Negative value (default) disables the filter.
+  void SetThreshold(const double theThreshold) { myThreshold = theThreshold; }
+
+  //! Returns the maximum distance of interest.
+  double Threshold() const { return myThreshold; }
+
+  //! Sets the flag to evaluate pairs in parallel threads; TRUE by default.
+  void SetMultiThread(const bool theIsMultiThread) { myIsMultiThread = theIsMultiThread; }
+
+  //! Returns TRUE if pairs are evaluated in parallel threads.
+  bool IsMultiThread() const { return myIsMultiThread; }
+
+  //! Computes distances for all pairs.
+  //! Returns FALSE if computation has been interrupted by the progress indicator.
+  Standard_EXPORT bool Perform(const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Returns TRUE if the minimum distance of the pair has been computed.
+  bool IsDone(const int thePair) const { return myPairs.Value(thePair - 1).IsDone; }
+
+  //! Returns TRUE if the pair was skipped as its shapes are farther than the threshold.
+  bool IsBeyondThreshold(const int thePair) const
+  {
+    return myPairs.Value(thePair - 1).IsBeyondThreshold;
+  }
+
+  //! Returns the minimum distance of the pair; for skipped pairs,
+  //! the lower bound of the distance (distance between bounding boxes) is returned.
+  double Value(const int thePair) const { return myPairs.Value(thePair - 1).Distance; }
+
+  //! Returns TRUE if one shape of the pair is a solid containing the other one (partially).
+  bool InnerSolution(const int thePair) const { return myPairs.Value(thePair - 1).IsInner; }
+
+  //! Returns the point of the first solution on the first shape of the pair.
+  const gp_Pnt& PointOnShape1(const int thePair) const { return myPairs.Value(thePair - 1).Pnt1; }
+
+  //! Returns the point of the first solution on the second shape of the pair.
+  const gp_Pnt& PointOnShape2(const int thePair) const { return myPairs.Value(thePair - 1).Pnt2; }
+
+private:
+  //! Pair of shapes and the result of distance computation.
+  struct PairResult
+  {
+    int    Shape1;
+    int    Shape2;
+    double Distance;
+    gp_Pnt Pnt1;
+    gp_Pnt Pnt2;
+    bool   IsDone;
+    bool   IsBeyondThreshold;
+    bool   IsInner;
+
+    PairResult()
+        : Shape1(0),
+          Shape2(0),
+          Distance(0.0),
+          IsDone(false),
+          IsBeyondThreshold(false),
+          IsInner(false)
+    {
+    }
+  };
+
+private:
+  NCollection_DynamicArray<TopoDS_Shape>                           myInputShapes;
+  // clang-format off
+  NCollection_DynamicArray<occ::handle<BRepExtrema_PreparedShape>> myShapes; //!< prepared shapes, created by Perform()
+  // clang-format on
+  NCollection_DynamicArray<PairResult>                             myPairs;
+  double                                                           myEps;
+  double                                                           myThreshold;
+  bool                                                             myIsMultiThread;
+};
+
+#endif // _BRepExtrema_BatchDistShapeShape_HeaderFile
@@ -46,30 +46,6 @@
 namespace
 {
 
-static void Decomposition(const TopoDS_Shape&                                            S,
-                          NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& MapV,
-                          NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& MapE,
-                          NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& MapF)
-{
-  MapV.Clear();
-  MapE.Clear();
-  MapF.Clear();
-  TopExp::MapShapes(S, TopAbs_VERTEX, MapV);
-  TopExp::MapShapes(S, TopAbs_EDGE, MapE);
-  TopExp::MapShapes(S, TopAbs_FACE, MapF);
-}
-
-static void BoxCalculation(const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& Map,
-                           NCollection_Array1<Bnd_Box>& SBox)
-{
-  for (int i = 1; i <= Map.Extent(); i++)
-  {
-    Bnd_Box box;
-    BRepBndLib::Add(Map(i), box);
-    SBox[i] = box;
-  }
-}
-
 inline double DistanceInitiale(const TopoDS_Vertex& V1, const TopoDS_Vertex& V2)
 {
   return (BRep_Tool::Pnt(V1).Distance(BRep_Tool::Pnt(V2)));
@@ -616,8 +592,6 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape()
       myIsDone(false),
       myInnerSol(false),
       myEps(Precision::Confusion()),
-      myIsInitS1(false),
-      myIsInitS2(false),
       myFlag(Extrema_ExtFlag_MINMAX),
       myAlgo(Extrema_ExtAlgo_Grad),
       myIsMultiThread(false)
@@ -635,8 +609,6 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape(const TopoDS_Shape&
       myIsDone(false),
       myInnerSol(false),
       myEps(Precision::Confusion()),
-      myIsInitS1(false),
-      myIsInitS2(false),
       myFlag(F),
       myAlgo(A),
       myIsMultiThread(false)
@@ -658,8 +630,6 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape(const TopoDS_Shape&
       myIsDone(false),
       myInnerSol(false),
       myEps(theDeflection),
-      myIsInitS1(false),
-      myIsInitS2(false),
       myFlag(F),
       myAlgo(A),
       myIsMultiThread(false)
@@ -673,18 +643,28 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape(const TopoDS_Shape&
 
 void BRepExtrema_DistShapeShape::LoadS1(const TopoDS_Shape& Shape1)
 {
-  myShape1   = Shape1;
-  myIsInitS1 = false;
-  Decomposition(Shape1, myMapV1, myMapE1, myMapF1);
+  myShape1 = new BRepExtrema_PreparedShape(Shape1);
 }
 
 //=================================================================================================
 
 void BRepExtrema_DistShapeShape::LoadS2(const TopoDS_Shape& Shape2)
 {
-  myShape2   = Shape2;
-  myIsInitS2 = false;
-  Decomposition(Shape2, myMapV2, myMapE2, myMapF2);
+  myShape2 = new BRepExtrema_PreparedShape(Shape2);
+}
+
+//=================================================================================================
+
+void BRepExtrema_DistShapeShape::LoadS1(const occ::handle<BRepExtrema_PreparedShape>& theShape1)
+{
+  myShape1 = theShape1;
+}
+
+//=================================================================================================
+
+void BRepExtrema_DistShapeShape::LoadS2(const occ::handle<BRepExtrema_PreparedShape>& theShape2)
+{
+  myShape2 = theShape2;
 }
 
 //=================================================================================================
@@ -831,24 +811,30 @@ bool BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange& theRange)
   mySolutionsShape1.Clear();
   mySolutionsShape2.Clear();
 
-  if (myShape1.IsNull() || myShape2.IsNull())
+  if (myShape1.IsNull() || myShape2.IsNull() || myShape1->Shape().IsNull()
+      || myShape2->Shape().IsNull())
   {
     return false;
   }
 
+  const auto& aMapV1 = myShape1->Vertices();
+  const auto& aMapE1 = myShape1->Edges();
+  const auto& aMapF1 = myShape1->Faces();
+  const auto& aMapV2 = myShape2->Vertices();
+  const auto& aMapE2 = myShape2->Edges();
+  const auto& aMapF2 = myShape2->Faces();
+
   // Treatment of solids
-  bool anIsSolid1 =
-    (myShape1.ShapeType() == TopAbs_SOLID) || (myShape1.ShapeType() == TopAbs_COMPSOLID);
-  bool anIsSolid2 =
-    (myShape2.ShapeType() == TopAbs_SOLID) || (myShape2.ShapeType() == TopAbs_COMPSOLID);
-  int aRootStepsNum = 9; // By num of DistanceMapMap calls
-  aRootStepsNum     = anIsSolid1 ? aRootStepsNum + 1 : aRootStepsNum;
-  aRootStepsNum     = anIsSolid2 ? aRootStepsNum + 1 : aRootStepsNum;
+  bool anIsSolid1    = myShape1->IsSolid();
+  bool anIsSolid2    = myShape2->IsSolid();
+  int  aRootStepsNum = 9; // By num of DistanceMapMap calls
+  aRootStepsNum      = anIsSolid1 ? aRootStepsNum + 1 : aRootStepsNum;
+  aRootStepsNum      = anIsSolid2 ? aRootStepsNum + 1 : aRootStepsNum;
   Message_ProgressScope aRootScope(theRange, "calculating distance", aRootStepsNum);
 
   if (anIsSolid1)
   {
-    if (!SolidTreatment(myShape1, myMapV2, aRootScope.Next()))
+    if (!SolidTreatment(myShape1->Shape(), aMapV2, aRootScope.Next()))
     {
       return false;
     }
@@ -856,7 +842,7 @@ bool BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange& theRange)
 
   if (anIsSolid2 && (!myInnerSol))
   {
-    if (!SolidTreatment(myShape2, myMapV1, aRootScope.Next()))
+    if (!SolidTreatment(myShape2->Shape(), aMapV1, aRootScope.Next()))
     {
       return false;
     }
@@ -864,54 +850,17 @@ bool BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange& theRange)
 
   if (!myInnerSol)
   {
-    if (!myIsInitS1) // rebuild cached data for 1st shape
-    {
-      if (!myMapV1.IsEmpty())
-      {
-        myBV1.Resize(1, myMapV1.Extent(), false);
-      }
-      if (!myMapE1.IsEmpty())
-      {
-        myBE1.Resize(1, myMapE1.Extent(), false);
-      }
-      if (!myMapF1.IsEmpty())
-      {
-        myBF1.Resize(1, myMapF1.Extent(), false);
-      }
-
-      BoxCalculation(myMapV1, myBV1);
-      BoxCalculation(myMapE1, myBE1);
-      BoxCalculation(myMapF1, myBF1);
-
-      myIsInitS1 = true;
-    }
-
-    if (!myIsInitS2) // rebuild cached data for 2nd shape
-    {
-      if (!myMapV2.IsEmpty())
-      {
-        myBV2.Resize(1, myMapV2.Extent(), false);
-      }
-      if (!myMapE2.IsEmpty())
-      {
-        myBE2.Resize(1, myMapE2.Extent(), false);
-      }
-      if (!myMapF2.IsEmpty())
-      {
-        myBF2.Resize(1, myMapF2.Extent(), false);
-      }
-
-      BoxCalculation(myMapV2, myBV2);
-      BoxCalculation(myMapE2, myBE2);
-      BoxCalculation(myMapF2, myBF2);
-
-      myIsInitS2 = true;
-    }
-
-    if (myMapV1.Extent() && myMapV2.Extent())
+    const NCollection_Array1<Bnd_Box>& aBV1 = myShape1->VertexBoxes();
+    const NCollection_Array1<Bnd_Box>& aBE1 = myShape1->EdgeBoxes();
+    const NCollection_Array1<Bnd_Box>& aBF1 = myShape1->FaceBoxes();
+    const NCollection_Array1<Bnd_Box>& aBV2 = myShape2->VertexBoxes();
+    const NCollection_Array1<Bnd_Box>& aBE2 = myShape2->EdgeBoxes();
+    const NCollection_Array1<Bnd_Box>& aBF2 = myShape2->FaceBoxes();
+
+    if (aMapV1.Extent() && aMapV2.Extent())
     {
-      const TopoDS_Vertex& V1 = TopoDS::Vertex(myMapV1(1));
-      const TopoDS_Vertex& V2 = TopoDS::Vertex(myMapV2(1));
+      const TopoDS_Vertex& V1 = TopoDS::Vertex(aMapV1(1));
+      const TopoDS_Vertex& V2 = TopoDS::Vertex(aMapV2(1));
       myDistRef               = DistanceInitiale(V1, V2);
     }
     else
@@ -919,42 +868,42 @@ bool BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange& theRange)
       myDistRef = 1.e30; // szv:!!!
     }
 
-    if (!DistanceVertVert(myMapV1, myMapV2, aRootScope.Next()))
+    if (!DistanceVertVert(aMapV1, aMapV2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapV1, myMapE2, myBV1, myBE2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapV1, aMapE2, aBV1, aBE2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapE1, myMapV2, myBE1, myBV2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapE1, aMapV2, aBE1, aBV2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapV1, myMapF2, myBV1, myBF2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapV1, aMapF2, aBV1, aBF2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapF1, myMapV2, myBF1, myBV2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapF1, aMapV2, aBF1, aBV2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapE1, myMapE2, myBE1, myBE2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapE1, aMapE2, aBE1, aBE2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapE1, myMapF2, myBE1, myBF2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapE1, aMapF2, aBE1, aBF2, aRootScope.Next()))
     {
       return false;
     }
-    if (!DistanceMapMap(myMapF1, myMapE2, myBF1, myBE2, aRootScope.Next()))
+    if (!DistanceMapMap(aMapF1, aMapE2, aBF1, aBE2, aRootScope.Next()))
     {
       return false;
     }
 
     if (std::abs(myDistRef) > myEps)
     {
-      if (!DistanceMapMap(myMapF1, myMapF2, myBF1, myBF2, aRootScope.Next()))
+      if (!DistanceMapMap(aMapF1, aMapF2, aBF1, aBF2, aRootScope.Next()))
       {
         return false;
       }
@@ -17,6 +17,7 @@
 #include <Bnd_Box.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_Sequence.hxx>
+#include <BRepExtrema_PreparedShape.hxx>
 #include <BRepExtrema_SolutionElem.hxx>
 #include <BRepExtrema_SupportType.hxx>
 #include <Extrema_ExtAlgo.hxx>
@@ -76,6 +77,14 @@ public:
   //! load second shape into extrema
   Standard_EXPORT void LoadS2(const TopoDS_Shape& Shape1);
 
+  //! Loads the first shape already decomposed into sub-shapes.
+  //! The prepared shape is only read by the algorithm
+  //! and can be shared with other instances of the algorithm, including concurrent ones.
+  Standard_EXPORT void LoadS1(const occ::handle<BRepExtrema_PreparedShape>& theShape1);
+
+  //! Loads the second shape already decomposed into sub-shapes.
+  Standard_EXPORT void LoadS2(const occ::handle<BRepExtrema_PreparedShape>& theShape2);
+
   //! computation of the minimum distance (value and
   //!          couple of points). Parameter theDeflection is used
   //!          to specify a maximum deviation of extreme distances
@@ -184,31 +193,17 @@ private:
                       const Message_ProgressRange& theRange);
 
 private:
-  double                                                        myDistRef;
-  bool                                                          myIsDone;
-  NCollection_Sequence<BRepExtrema_SolutionElem>                mySolutionsShape1;
-  NCollection_Sequence<BRepExtrema_SolutionElem>                mySolutionsShape2;
-  bool                                                          myInnerSol;
-  double                                                        myEps;
-  TopoDS_Shape                                                  myShape1;
-  TopoDS_Shape                                                  myShape2;
-  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapV1;
-  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapV2;
-  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapE1;
-  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapE2;
-  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapF1;
-  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapF2;
-  bool                                                          myIsInitS1;
-  bool                                                          myIsInitS2;
-  Extrema_ExtFlag                                               myFlag;
-  Extrema_ExtAlgo                                               myAlgo;
-  NCollection_Array1<Bnd_Box>                                   myBV1;
-  NCollection_Array1<Bnd_Box>                                   myBV2;
-  NCollection_Array1<Bnd_Box>                                   myBE1;
-  NCollection_Array1<Bnd_Box>                                   myBE2;
-  NCollection_Array1<Bnd_Box>                                   myBF1;
-  NCollection_Array1<Bnd_Box>                                   myBF2;
-  bool                                                          myIsMultiThread;
+  double                                         myDistRef;
+  bool                                           myIsDone;
+  NCollection_Sequence<BRepExtrema_SolutionElem> mySolutionsShape1;
+  NCollection_Sequence<BRepExtrema_SolutionElem> mySolutionsShape2;
+  bool                                           myInnerSol;
+  double                                         myEps;
+  occ::handle<BRepExtrema_PreparedShape>         myShape1;
+  occ::handle<BRepExtrema_PreparedShape>         myShape2;
+  Extrema_ExtFlag                                myFlag;
+  Extrema_ExtAlgo                                myAlgo;
+  bool                                           myIsMultiThread;
 };
 
 #endif
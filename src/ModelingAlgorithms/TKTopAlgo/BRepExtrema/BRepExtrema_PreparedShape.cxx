@@ -0,0 +1,56 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepExtrema_PreparedShape.hxx>
+
+#include <BRepBndLib.hxx>
+#include <TopExp.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepExtrema_PreparedShape, Standard_Transient)
+
+namespace
+{
+//! Computes bounding boxes of all shapes in the map and adds them to the total box.
+void computeBoxes(const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theMap,
+                  NCollection_Array1<Bnd_Box>&                                         theBoxes,
+                  Bnd_Box&                                                             theTotal)
+{
+  if (theMap.IsEmpty())
+  {
+    theBoxes = NCollection_Array1<Bnd_Box>();
+    return;
+  }
+
+  theBoxes.Resize(1, theMap.Extent(), false);
+  for (int anIter = 1; anIter <= theMap.Extent(); ++anIter)
+  {
+    Bnd_Box aBox;
+    BRepBndLib::Add(theMap(anIter), aBox);
+    theBoxes.SetValue(anIter, aBox);
+    theTotal.Add(aBox);
+  }
+}
+} // namespace
+
+//=================================================================================================
+
+BRepExtrema_PreparedShape::BRepExtrema_PreparedShape(const TopoDS_Shape& theShape)
+    : myShape(theShape)
+{
+  TopExp::MapShapes(theShape, TopAbs_VERTEX, myMapV);
+  TopExp::MapShapes(theShape, TopAbs_EDGE, myMapE);
+  TopExp::MapShapes(theShape, TopAbs_FACE, myMapF);
+  computeBoxes(myMapV, myBoxesV, myBox);
+  computeBoxes(myMapE, myBoxesE, myBox);
+  computeBoxes(myMapF, myBoxesF, myBox);
+}
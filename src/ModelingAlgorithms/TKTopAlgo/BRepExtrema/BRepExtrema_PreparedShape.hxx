@@ -0,0 +1,91 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepExtrema_PreparedShape_HeaderFile
+#define _BRepExtrema_PreparedShape_HeaderFile
+
+#include <Bnd_Box.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+//! Shape decomposed into vertices, edges and faces with cached bounding boxes
+//! of these sub-shapes, as used by BRepExtrema_DistShapeShape.
+//!
+//! The same prepared shape can be shared by several distance computations
+//! (see BRepExtrema_BatchDistShapeShape) to avoid repeating the decomposition
+//! and the box computation for each pair of shapes.
+//! The decomposition and the boxes are computed by the constructor;
+//! the object is not modified afterwards and can be used from several threads.
+class BRepExtrema_PreparedShape : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BRepExtrema_PreparedShape, Standard_Transient)
+public:
+  //! Decomposes the shape into sub-shapes and computes their bounding boxes.
+  //! @param[in] theShape  shape to prepare
+  Standard_EXPORT BRepExtrema_PreparedShape(const TopoDS_Shape& theShape);
+
+  //! Returns the shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns TRUE if the shape is a solid or a compsolid.
+  bool IsSolid() const
+  {
+    return !myShape.IsNull()
+           && (myShape.ShapeType() == TopAbs_SOLID || myShape.ShapeType() == TopAbs_COMPSOLID);
+  }
+
+  //! Returns the map of vertices.
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& Vertices() const
+  {
+    return myMapV;
+  }
+
+  //! Returns the map of edges.
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& Edges() const
+  {
+    return myMapE;
+  }
+
+  //! Returns the map of faces.
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& Faces() const
+  {
+    return myMapF;
+  }
+
+  //! Returns bounding boxes of vertices.
+  const NCollection_Array1<Bnd_Box>& VertexBoxes() const { return myBoxesV; }
+
+  //! Returns bounding boxes of edges.
+  const NCollection_Array1<Bnd_Box>& EdgeBoxes() const { return myBoxesE; }
+
+  //! Returns bounding boxes of faces.
+  const NCollection_Array1<Bnd_Box>& FaceBoxes() const { return myBoxesF; }
+
+  //! Returns bounding box of the whole shape (union of sub-shape boxes).
+  const Bnd_Box& Box() const { return myBox; }
+
+private:
+  TopoDS_Shape                                                  myShape;
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapV;
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapE;
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myMapF;
+  NCollection_Array1<Bnd_Box>                                   myBoxesV;
+  NCollection_Array1<Bnd_Box>                                   myBoxesE;
+  NCollection_Array1<Bnd_Box>                                   myBoxesF;
+  Bnd_Box                                                       myBox;
+};
+
+#endif // _BRepExtrema_PreparedShape_HeaderFile
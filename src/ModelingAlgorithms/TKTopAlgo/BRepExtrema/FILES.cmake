@@ -2,6 +2,8 @@
 set(OCCT_BRepExtrema_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_BRepExtrema_FILES
+  BRepExtrema_BatchDistShapeShape.cxx
+  BRepExtrema_BatchDistShapeShape.hxx
   BRepExtrema_DistanceSS.cxx
   BRepExtrema_DistanceSS.hxx
   BRepExtrema_DistShapeShape.cxx
@@ -22,6 +24,8 @@ set(OCCT_BRepExtrema_FILES
   BRepExtrema_OverlapTool.hxx
   BRepExtrema_Poly.cxx
   BRepExtrema_Poly.hxx
+  BRepExtrema_PreparedShape.cxx
+  BRepExtrema_PreparedShape.hxx
   BRepExtrema_ProximityValueTool.cxx
   BRepExtrema_ProximityValueTool.hxx
   BRepExtrema_ProximityDistTool.cxx
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepClass3d_SolidMeshClassifier.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Array1.hxx>
+#include <Precision.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Fills array with points of regular grid covering the given range.
+NCollection_Array1<gp_Pnt> makeGrid(const double theMin, const double theMax, const int theNb)
+{
+  NCollection_Array1<gp_Pnt> aPoints(1, theNb * theNb * theNb);
+  const double               aStep = (theMax - theMin) / (theNb - 1);
+  int                        anIdx = 1;
+  for (int anX = 0; anX < theNb; ++anX)
+  {
+    for (int anY = 0; anY < theNb; ++anY)
+    {
+      for (int aZ = 0; aZ < theNb; ++aZ)
+      {
+        aPoints.SetValue(anIdx++,
+                         gp_Pnt(theMin + anX * aStep, theMin + anY * aStep, theMin + aZ * aStep));
+      }
+    }
+  }
+  return aPoints;
+}
+} // namespace
+
+TEST(BRepClass3d_SolidMeshClassifierTest, NoTriangulation_FallsBackToExact)
+{
+  BRepPrimAPI_MakeBox aMakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape& aBox = aMakeBox.Shape();
+
+  BRepClass3d_SolidMeshClassifier aClassifier(aBox);
+  EXPECT_FALSE(aClassifier.IsMeshUsable());
+
+  aClassifier.Perform(gp_Pnt(5.0, 5.0, 5.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_IN);
+  EXPECT_EQ(aClassifier.NbExactClassified(), 1);
+
+  aClassifier.Perform(gp_Pnt(20.0, 5.0, 5.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_OUT);
+}
+
+TEST(BRepClass3d_SolidMeshClassifierTest, Box_SinglePoints)
+{
+  BRepPrimAPI_MakeBox aMakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape& aBox = aMakeBox.Shape();
+  BRepMesh_IncrementalMesh(aBox, 0.1);
+
+  BRepClass3d_SolidMeshClassifier aClassifier(aBox);
+  ASSERT_TRUE(aClassifier.IsMeshUsable());
+
+  aClassifier.Perform(gp_Pnt(5.0, 5.0, 5.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_IN);
+  EXPECT_EQ(aClassifier.NbExactClassified(), 0);
+
+  aClassifier.Perform(gp_Pnt(20.0, 20.0, 20.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_OUT);
+  EXPECT_EQ(aClassifier.NbExactClassified(), 0);
+
+  aClassifier.Perform(gp_Pnt(12.0, 5.0, 5.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_OUT);
+  EXPECT_EQ(aClassifier.NbExactClassified(), 0);
+
+  // point on the boundary is delegated to the exact classifier
+  aClassifier.Perform(gp_Pnt(5.0, 5.0, 0.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_ON);
+  EXPECT_EQ(aClassifier.NbExactClassified(), 1);
+}
+
+TEST(BRepClass3d_SolidMeshClassifierTest, Sphere_BatchMatchesExact)
+{
+  BRepPrimAPI_MakeSphere aMakeSphere(10.0);
+  const TopoDS_Shape&    aSphere = aMakeSphere.Shape();
+  BRepMesh_IncrementalMesh(aSphere, 0.05);
+
+  BRepClass3d_SolidMeshClassifier aClassifier(aSphere);
+  ASSERT_TRUE(aClassifier.IsMeshUsable());
+
+  const NCollection_Array1<gp_Pnt> aPoints = makeGrid(-12.0, 12.0, 9);
+  NCollection_Array1<TopAbs_State> aStates;
+  aClassifier.Perform(aPoints, Precision::Confusion(), aStates, true);
+  ASSERT_EQ(aStates.Length(), aPoints.Length());
+  EXPECT_LT(aClassifier.NbExactClassified(), aPoints.Length());
+
+  BRepClass3d_SolidClassifier anExactClassifier(aSphere);
+  for (int anIdx = aPoints.Lower(); anIdx <= aPoints.Upper(); ++anIdx)
+  {
+    anExactClassifier.Perform(aPoints(anIdx), Precision::Confusion());
+    EXPECT_EQ(aStates(anIdx), anExactClassifier.State()) << "Point index " << anIdx;
+  }
+}
+
+TEST(BRepClass3d_SolidMeshClassifierTest, ReversedSolid_Inverted)
+{
+  BRepPrimAPI_MakeBox aMakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape  aBox = aMakeBox.Shape();
+  BRepMesh_IncrementalMesh(aBox, 0.1);
+
+  BRepClass3d_SolidMeshClassifier aClassifier(aBox.Reversed());
+  ASSERT_TRUE(aClassifier.IsMeshUsable());
+
+  aClassifier.Perform(gp_Pnt(5.0, 5.0, 5.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_OUT);
+
+  aClassifier.Perform(gp_Pnt(50.0, 5.0, 5.0), Precision::Confusion());
+  EXPECT_EQ(aClassifier.State(), TopAbs_IN);
+}
+
+TEST(BRepClass3d_SolidMeshClassifierTest, Box_SequentialAndParallelEqual)
+{
+  BRepPrimAPI_MakeBox aMakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape& aBox = aMakeBox.Shape();
+  BRepMesh_IncrementalMesh(aBox, 0.1);
+
+  BRepClass3d_SolidMeshClassifier  aClassifier(aBox);
+  const NCollection_Array1<gp_Pnt> aPoints = makeGrid(-2.5, 12.5, 7);
+
+  NCollection_Array1<TopAbs_State> aStatesSeq, aStatesPar;
+  aClassifier.Perform(aPoints, Precision::Confusion(), aStatesSeq, false);
+  aClassifier.Perform(aPoints, Precision::Confusion(), aStatesPar, true);
+  for (int anIdx = aPoints.Lower(); anIdx <= aPoints.Upper(); ++anIdx)
+  {
+    EXPECT_EQ(aStatesSeq(anIdx), aStatesPar(anIdx));
+    EXPECT_NE(aStatesSeq(anIdx), TopAbs_UNKNOWN);
+  }
+}
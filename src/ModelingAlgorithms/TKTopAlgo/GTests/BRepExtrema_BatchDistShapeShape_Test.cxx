@@ -0,0 +1,145 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepExtrema_BatchDistShapeShape.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepExtrema_PreparedShape.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Creates a row of unit boxes separated by the given gap along X axis.
+void addBoxRow(BRepExtrema_BatchDistShapeShape& theBatch, const int theNb, const double theGap)
+{
+  for (int aBoxIter = 0; aBoxIter < theNb; ++aBoxIter)
+  {
+    const double aX = aBoxIter * (1.0 + theGap);
+    theBatch.AddShape(BRepPrimAPI_MakeBox(gp_Pnt(aX, 0.0, 0.0), 1.0, 1.0, 1.0).Shape());
+  }
+}
+} // namespace
+
+TEST(BRepExtrema_BatchDistShapeShapeTest, AllPairs_MatchSinglePairAlgo)
+{
+  BRepExtrema_BatchDistShapeShape aBatch;
+  addBoxRow(aBatch, 4, 0.5);
+  aBatch.AddShape(BRepPrimAPI_MakeSphere(gp_Pnt(2.0, 5.0, 0.5), 1.0).Shape());
+  aBatch.AddAllPairs();
+  ASSERT_EQ(aBatch.NbPairs(), 10);
+  ASSERT_TRUE(aBatch.Perform());
+
+  for (int aPairIter = 1; aPairIter <= aBatch.NbPairs(); ++aPairIter)
+  {
+    int aShape1 = 0, aShape2 = 0;
+    aBatch.Pair(aPairIter, aShape1, aShape2);
+    BRepExtrema_DistShapeShape aDist(aBatch.Shape(aShape1), aBatch.Shape(aShape2));
+    ASSERT_TRUE(aDist.IsDone());
+    ASSERT_TRUE(aBatch.IsDone(aPairIter)) << "Pair " << aPairIter;
+    EXPECT_FALSE(aBatch.IsBeyondThreshold(aPairIter));
+    EXPECT_NEAR(aBatch.Value(aPairIter), aDist.Value(), Precision::Confusion())
+      << "Pair " << aPairIter;
+    EXPECT_NEAR(aBatch.PointOnShape1(aPairIter).Distance(aBatch.PointOnShape2(aPairIter)),
+                aBatch.Value(aPairIter),
+                Precision::Confusion());
+  }
+
+  // neighbouring boxes
+  EXPECT_NEAR(aBatch.Value(1), 0.5, Precision::Confusion());
+}
+
+TEST(BRepExtrema_BatchDistShapeShapeTest, Threshold_SkipsFarPairs)
+{
+  BRepExtrema_BatchDistShapeShape aBatch;
+  addBoxRow(aBatch, 5, 2.0);
+  aBatch.AddPairs(1, 1, 2, 5);
+  aBatch.SetThreshold(3.0);
+  ASSERT_TRUE(aBatch.Perform());
+  ASSERT_EQ(aBatch.NbPairs(), 4);
+
+  // only the nearest box is within the threshold
+  EXPECT_TRUE(aBatch.IsDone(1));
+  EXPECT_NEAR(aBatch.Value(1), 2.0, Precision::Confusion());
+  for (int aPairIter = 2; aPairIter <= aBatch.NbPairs(); ++aPairIter)
+  {
+    EXPECT_FALSE(aBatch.IsDone(aPairIter)) << "Pair " << aPairIter;
+    EXPECT_TRUE(aBatch.IsBeyondThreshold(aPairIter)) << "Pair " << aPairIter;
+    EXPECT_GT(aBatch.Value(aPairIter), 3.0);
+  }
+}
+
+TEST(BRepExtrema_BatchDistShapeShapeTest, SequentialAndParallelEqual)
+{
+  BRepExtrema_BatchDistShapeShape aBatch;
+  addBoxRow(aBatch, 6, 0.25);
+  aBatch.AddAllPairs();
+
+  aBatch.SetMultiThread(false);
+  ASSERT_TRUE(aBatch.Perform());
+  NCollection_Array1<double> aSeqValues(1, aBatch.NbPairs());
+  for (int aPairIter = 1; aPairIter <= aBatch.NbPairs(); ++aPairIter)
+  {
+    ASSERT_TRUE(aBatch.IsDone(aPairIter));
+    aSeqValues.SetValue(aPairIter, aBatch.Value(aPairIter));
+  }
+
+  aBatch.SetMultiThread(true);
+  ASSERT_TRUE(aBatch.Perform());
+  for (int aPairIter = 1; aPairIter <= aBatch.NbPairs(); ++aPairIter)
+  {
+    ASSERT_TRUE(aBatch.IsDone(aPairIter));
+    EXPECT_EQ(aSeqValues(aPairIter), aBatch.Value(aPairIter)) << "Pair " << aPairIter;
+  }
+}
+
+TEST(BRepExtrema_BatchDistShapeShapeTest, InnerSolid_ZeroDistance)
+{
+  BRepExtrema_BatchDistShapeShape aBatch;
+  const int aBig =
+    aBatch.AddShape(BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0).Solid());
+  const int aSmall =
+    aBatch.AddShape(BRepPrimAPI_MakeBox(gp_Pnt(4.0, 4.0, 4.0), 1.0, 1.0, 1.0).Solid());
+  aBatch.AddPair(aBig, aSmall);
+  ASSERT_TRUE(aBatch.Perform());
+  ASSERT_TRUE(aBatch.IsDone(1));
+  EXPECT_TRUE(aBatch.InnerSolution(1));
+  EXPECT_NEAR(aBatch.Value(1), 0.0, Precision::Confusion());
+}
+
+TEST(BRepExtrema_BatchDistShapeShapeTest, SharedPreparedShape_ConcurrentUse)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape();
+  const occ::handle<BRepExtrema_PreparedShape> aBase = new BRepExtrema_PreparedShape(aBox);
+  EXPECT_EQ(aBase->FaceBoxes().Length(), 6);
+  EXPECT_FALSE(aBase->Box().IsVoid());
+
+  const int                  aNbQueries = 16;
+  NCollection_Array1<double> aValues(0, aNbQueries - 1);
+  OSD_Parallel::For(0, aNbQueries, [&](const int theIndex) {
+    BRepExtrema_DistShapeShape aDist;
+    aDist.LoadS1(aBase);
+    aDist.LoadS2(BRepPrimAPI_MakeBox(gp_Pnt(2.0 + theIndex, 0.0, 0.0), 1.0, 1.0, 1.0).Shape());
+    aValues.SetValue(theIndex, aDist.Perform() ? aDist.Value() : -1.0);
+  });
+  for (int aQueryIter = 0; aQueryIter < aNbQueries; ++aQueryIter)
+  {
+    EXPECT_NEAR(aValues(aQueryIter), 1.0 + aQueryIter, Precision::Confusion());
+  }
+}
@@ -8,6 +8,8 @@ set(OCCT_TKTopAlgo_GTests_FILES
   BRepBuilderAPI_MakeWire_Test.cxx
   BRepBuilderAPI_Transform_Test.cxx
   BRepClass3d_SolidClassifier_Test.cxx
+  BRepClass3d_SolidMeshClassifier_Test.cxx
+  BRepExtrema_BatchDistShapeShape_Test.cxx
   BRepExtrema_DistShapeShape_Test.cxx
   BRepGProp_Test.cxx
   BRepLib_MakeWire_Test.cxx
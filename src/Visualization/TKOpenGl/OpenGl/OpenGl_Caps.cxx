@@ -30,6 +30,7 @@ OpenGl_Caps::OpenGl_Caps()
       useSystemBuffer(false),
       swapInterval(1),
       useZeroToOneDepth(false),
+      vboMemoryBudget(0),
       buffersNoSwap(false),
       buffersOpaqueAlpha(true),
       buffersDeepColor(false),
@@ -68,6 +69,7 @@ OpenGl_Caps& OpenGl_Caps::operator=(const OpenGl_Caps& theCopy)
   useSystemBuffer           = theCopy.useSystemBuffer;
   swapInterval              = theCopy.swapInterval;
   useZeroToOneDepth         = theCopy.useZeroToOneDepth;
+  vboMemoryBudget           = theCopy.vboMemoryBudget;
   buffersNoSwap             = theCopy.buffersNoSwap;
   buffersOpaqueAlpha        = theCopy.buffersOpaqueAlpha;
   buffersDeepColor          = theCopy.buffersDeepColor;
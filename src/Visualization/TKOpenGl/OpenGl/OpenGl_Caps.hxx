@@ -41,6 +41,21 @@ public
   bool useZeroToOneDepth; //!< use [0, 1] depth range instead of [-1, 1] range, when possible (OFF by default)
   // clang-format on
 
+public: //! @name GPU memory management
+  /**
+   * Maximal size in bytes of vertex buffers to be kept in GPU memory; 0 means unlimited.
+   *
+   * When defined, primitive arrays keep their data in CPU memory after uploading it to GPU,
+   * and buffers of least recently drawn structures are released once the budget is exceeded;
+   * released buffers are uploaded again when the structure becomes visible.
+   * Arrays, which CPU data has been released by OpenGl_Structure::ReleaseCpuData(),
+   * remain in GPU memory.
+   * Textures are not considered by the budget.
+   *
+   * 0 by default.
+   */
+  size_t vboMemoryBudget;
+
 public: //! @name context creation parameters
   /**
    * Specify that driver should not swap back/front buffers at the end of frame.
@@ -328,6 +328,12 @@ OpenGl_Context::~OpenGl_Context()
     myDefaultFbo.Nullify();
   }
 
+  // release timer queries of frame statistics (only if created by this context)
+  if (!myFrameStats.IsNull())
+  {
+    myFrameStats->ReleaseTimerQueries(this);
+  }
+
   // release shared resources if any
   if (mySharedResources->GetRefCount() <= 1)
   {
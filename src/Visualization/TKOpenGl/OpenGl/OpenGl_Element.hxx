@@ -76,6 +76,19 @@ public:
   //! Update parameters of the drawable elements.
   virtual void SynchronizeAspects() {}
 
+public: //! @name GPU memory management
+  //! Releases GPU buffers, which can be uploaded again from data retained in CPU memory
+  //! on the next rendering, and returns their estimated size; does nothing by default.
+  virtual size_t EvictGpuBuffers(OpenGl_Context* theContext)
+  {
+    (void)theContext;
+    return 0;
+  }
+
+  //! Releases CPU copy of data already uploaded into GPU buffers,
+  //! so that buffers cannot be evicted anymore; does nothing by default.
+  virtual void ReleaseCpuData(OpenGl_Context* theContext) { (void)theContext; }
+
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
 
@@ -15,6 +15,7 @@
 
 #include <OpenGl_View.hxx>
 #include <OpenGl_DepthPeeling.hxx>
+#include <OpenGl_GlCore33.hxx>
 #include <OpenGl_ShadowMap.hxx>
 #include <OpenGl_TextureBuffer.hxx>
 #include <OpenGl_Window.hxx>
@@ -32,7 +33,12 @@ static size_t estimatedDataSize(const occ::handle<OpenGl_Resource>& theRes)
 
 //=================================================================================================
 
-OpenGl_FrameStats::OpenGl_FrameStats() = default;
+OpenGl_FrameStats::OpenGl_FrameStats()
+    : myQueriesCtx(nullptr),
+      myNbUsedQueries(0)
+{
+  myItemTimer.Start();
+}
 
 //=================================================================================================
 
@@ -75,6 +81,143 @@ bool OpenGl_FrameStats::IsFrameUpdated(occ::handle<OpenGl_FrameStats>& thePrev)
 
 //=================================================================================================
 
+int OpenGl_FrameStats::queryTimestamp(const occ::handle<OpenGl_Context>& theCtx)
+{
+  // query objects are not shared between OpenGL contexts,
+  // so that GPU times are measured only within the context created the pool
+  if (theCtx->core33 == nullptr || (myQueriesCtx != nullptr && myQueriesCtx != theCtx.get()))
+  {
+    return -1;
+  }
+
+  myQueriesCtx = theCtx.get();
+  if (myNbUsedQueries >= (int)myTimerQueries.Size())
+  {
+    GLuint aQuery = 0;
+    theCtx->core15fwd->glGenQueries(1, &aQuery);
+    if (aQuery == 0)
+    {
+      return -1;
+    }
+    myTimerQueries.Append(aQuery);
+  }
+
+  theCtx->core33->glQueryCounter(myTimerQueries.Value(myNbUsedQueries), GL_TIMESTAMP);
+  return myNbUsedQueries++;
+}
+
+//=================================================================================================
+
+int OpenGl_FrameStats::BeginItemTiming(const occ::handle<OpenGl_Context>& theCtx)
+{
+  PendingTiming aTiming;
+  aTiming.QueryBegin = queryTimestamp(theCtx);
+  aTiming.QueryEnd   = -1;
+  aTiming.ItemIndex  = -1;
+  aTiming.IsLayer    = false;
+  aTiming.CpuStart   = myItemTimer.ElapsedTime();
+  myPendingTimings.Append(aTiming);
+  return (int)myPendingTimings.Size() - 1;
+}
+
+//=================================================================================================
+
+void OpenGl_FrameStats::EndItemTiming(const occ::handle<OpenGl_Context>& theCtx,
+                                      const int                          theToken,
+                                      const bool                         theIsLayer,
+                                      const int                          theId,
+                                      const int                          theLayerId)
+{
+  if (theToken < 0 || theToken >= (int)myPendingTimings.Size())
+  {
+    return;
+  }
+
+  PendingTiming& aTiming = myPendingTimings.ChangeValue(theToken);
+  ItemTiming     anItem;
+  anItem.Id       = theId;
+  anItem.LayerId  = theLayerId;
+  anItem.CpuTime  = myItemTimer.ElapsedTime() - aTiming.CpuStart;
+  aTiming.QueryEnd = aTiming.QueryBegin >= 0 ? queryTimestamp(theCtx) : -1;
+
+  NCollection_DynamicArray<ItemTiming>& aList =
+    theIsLayer ? ChangeActiveLayerTimings() : ChangeActiveStructureTimings();
+  aList.Append(anItem);
+  aTiming.ItemIndex = (int)aList.Size() - 1;
+  aTiming.IsLayer   = theIsLayer;
+}
+
+//=================================================================================================
+
+void OpenGl_FrameStats::FrameEnd(const occ::handle<Graphic3d_CView>& theView,
+                                 bool                                theIsImmediateOnly)
+{
+  const OpenGl_View* aView = dynamic_cast<const OpenGl_View*>(theView.get());
+  if (aView != nullptr && !myPendingTimings.IsEmpty())
+  {
+    // fetching query results waits for GPU to finish the frame
+    const occ::handle<OpenGl_Context>& aCtx = aView->GlWindow()->GetGlContext();
+    for (NCollection_DynamicArray<PendingTiming>::Iterator aTimingIter(myPendingTimings);
+         aTimingIter.More();
+         aTimingIter.Next())
+    {
+      const PendingTiming& aTiming = aTimingIter.Value();
+      if (aTiming.QueryBegin < 0 || aTiming.QueryEnd < 0 || aTiming.ItemIndex < 0
+          || aCtx.get() != myQueriesCtx || aCtx->core33 == nullptr)
+      {
+        continue;
+      }
+
+      GLuint64 aTimeBegin = 0, aTimeEnd = 0;
+      aCtx->core33->glGetQueryObjectui64v(myTimerQueries.Value(aTiming.QueryBegin),
+                                          GL_QUERY_RESULT,
+                                          &aTimeBegin);
+      aCtx->core33->glGetQueryObjectui64v(myTimerQueries.Value(aTiming.QueryEnd),
+                                          GL_QUERY_RESULT,
+                                          &aTimeEnd);
+      NCollection_DynamicArray<ItemTiming>& aList =
+        aTiming.IsLayer ? ChangeActiveLayerTimings() : ChangeActiveStructureTimings();
+      if (aTiming.ItemIndex < (int)aList.Size())
+      {
+        aList.ChangeValue(aTiming.ItemIndex).GpuTime =
+          aTimeEnd > aTimeBegin ? double(aTimeEnd - aTimeBegin) * 1.0e-9 : 0.0;
+      }
+    }
+  }
+  myPendingTimings.Clear();
+  myNbUsedQueries = 0;
+
+  Graphic3d_FrameStats::FrameEnd(theView, theIsImmediateOnly);
+}
+
+//=================================================================================================
+
+void OpenGl_FrameStats::ReleaseTimerQueries(OpenGl_Context* theCtx)
+{
+  if (theCtx != myQueriesCtx)
+  {
+    // frame statistics might be shared by several contexts, queries belong to another one
+    return;
+  }
+
+  if (theCtx != nullptr && theCtx->IsValid() && theCtx->core15fwd != nullptr)
+  {
+    for (NCollection_DynamicArray<unsigned int>::Iterator aQueryIter(myTimerQueries);
+         aQueryIter.More();
+         aQueryIter.Next())
+    {
+      GLuint aQuery = aQueryIter.Value();
+      theCtx->core15fwd->glDeleteQueries(1, &aQuery);
+    }
+  }
+  myTimerQueries.Clear();
+  myPendingTimings.Clear();
+  myNbUsedQueries = 0;
+  myQueriesCtx    = nullptr;
+}
+
+//=================================================================================================
+
 void OpenGl_FrameStats::updateStatistics(const occ::handle<Graphic3d_CView>& theView,
                                          bool                                theIsImmediateOnly)
 {
@@ -98,9 +241,10 @@ void OpenGl_FrameStats::updateStatistics(const occ::handle<Graphic3d_CView>& the
   const bool toCountStructs = (aBits & Graphic3d_RenderingParams::PerfCounters_Structures) != 0
                               || (aBits & Graphic3d_RenderingParams::PerfCounters_Layers) != 0
                               || toCountGroups;
+  const bool toCountCulling = (aBits & Graphic3d_RenderingParams::PerfCounters_Culling) != 0;
 
   myCountersTmp[Graphic3d_FrameStatsCounter_NbLayers] = aView->LayerList().Layers().Size();
-  if (toCountStructs || (aBits & Graphic3d_RenderingParams::PerfCounters_Layers) != 0)
+  if (toCountStructs || toCountCulling)
   {
     const int aViewId = aView->Identification();
     for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(
@@ -119,6 +263,14 @@ void OpenGl_FrameStats::updateStatistics(const occ::handle<Graphic3d_CView>& the
       {
         ++myCountersTmp[Graphic3d_FrameStatsCounter_NbLayersNotCulled];
       }
+      if (toCountCulling)
+      {
+        const Graphic3d_CullingTool::CullingStats& aCulling = aLayer->CullingStatistics();
+        myCountersTmp[Graphic3d_FrameStatsCounter_NbCullingTests] += aCulling.NbTests;
+        myCountersTmp[Graphic3d_FrameStatsCounter_NbCulledFrustum] += aCulling.NbOutFrustum;
+        myCountersTmp[Graphic3d_FrameStatsCounter_NbCulledDistance] += aCulling.NbTooDistant;
+        myCountersTmp[Graphic3d_FrameStatsCounter_NbCulledSize] += aCulling.NbTooSmall;
+      }
       myCountersTmp[Graphic3d_FrameStatsCounter_NbStructsNotCulled] +=
         aLayer->NbStructuresNotCulled();
       if (toCountGroups)
@@ -18,6 +18,7 @@
 #include <NCollection_IndexedMap.hxx>
 
 class Graphic3d_CStructure;
+class OpenGl_Context;
 
 //! Class storing the frame statistics.
 class OpenGl_FrameStats : public Graphic3d_FrameStats
@@ -37,6 +38,33 @@ public:
   //! @return TRUE if frame data has been changed so that the presentation should be updated
   Standard_EXPORT virtual bool IsFrameUpdated(occ::handle<OpenGl_FrameStats>& thePrev) const;
 
+  //! Frame redraw finished; fetches GPU times of items measured within the frame.
+  Standard_EXPORT void FrameEnd(const occ::handle<Graphic3d_CView>& theView,
+                                bool                                theIsImmediateOnly) override;
+
+public:
+  //! Starts measuring rendering time of a layer or a structure;
+  //! should be called between ::FrameStart() and ::FrameEnd() calls.
+  //! GPU time is measured by timestamp queries, if supported by OpenGL context (3.3+).
+  //! @return token to be passed to EndItemTiming()
+  Standard_EXPORT int BeginItemTiming(const occ::handle<OpenGl_Context>& theCtx);
+
+  //! Stops measuring rendering time and appends the item to layer or structure timings.
+  //! @param[in] theCtx      OpenGL context
+  //! @param[in] theToken    token returned by BeginItemTiming()
+  //! @param[in] theIsLayer  flag indicating that item is a layer
+  //! @param[in] theId       item identifier
+  //! @param[in] theLayerId  Z-layer of the item
+  Standard_EXPORT void EndItemTiming(const occ::handle<OpenGl_Context>& theCtx,
+                                     const int                          theToken,
+                                     const bool                         theIsLayer,
+                                     const int                          theId,
+                                     const int                          theLayerId);
+
+  //! Releases OpenGL timer queries, if they have been created within specified context;
+  //! does nothing for another context sharing the same frame statistics.
+  Standard_EXPORT void ReleaseTimerQueries(OpenGl_Context* theCtx);
+
 protected:
   //! Method to collect statistics from the View; called by FrameEnd().
   Standard_EXPORT void updateStatistics(const occ::handle<Graphic3d_CView>& theView,
@@ -49,6 +77,27 @@ protected:
     bool                                                       theToCountElems,
     bool                                                       theToCountTris,
     bool                                                       theToCountMem);
+
+  //! Issues the timestamp query and returns its index within the pool or -1 if unsupported.
+  Standard_EXPORT int queryTimestamp(const occ::handle<OpenGl_Context>& theCtx);
+
+protected:
+  //! Item being measured within the frame.
+  struct PendingTiming
+  {
+    double CpuStart;   //!< start time
+    int    QueryBegin; //!< index of the timestamp query at the beginning
+    int    QueryEnd;   //!< index of the timestamp query at the end
+    int    ItemIndex;  //!< index of the item within layer or structure timings
+    bool   IsLayer;    //!< flag indicating that item is a layer
+  };
+
+protected:
+  OSD_Timer                               myItemTimer;      //!< timer for measuring CPU times
+  NCollection_DynamicArray<PendingTiming> myPendingTimings; //!< items measured within the frame
+  NCollection_DynamicArray<unsigned int>  myTimerQueries;   //!< pool of timestamp queries
+  const OpenGl_Context*                   myQueriesCtx;     //!< context owning timestamp queries
+  int                                     myNbUsedQueries;  //!< number of queries used by frame
 };
 
 #endif // _OpenGl_FrameStats_HeaderFile
@@ -28,6 +28,8 @@
 #include <OSD_Environment.hxx>
 #include <Standard_NotImplemented.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(OpenGl_GraphicDriver, Graphic3d_GraphicDriver)
 
 #if defined(_WIN32)
@@ -185,7 +187,10 @@ OpenGl_GraphicDriver::OpenGl_GraphicDriver(const occ::handle<Aspect_DisplayConne
       myEglConfig(nullptr),
       myCaps(new OpenGl_Caps()),
       myMapOfView(1, NCollection_BaseAllocator::CommonBaseAllocator()),
-      myMapOfStructure(1, NCollection_BaseAllocator::CommonBaseAllocator())
+      myMapOfStructure(1, NCollection_BaseAllocator::CommonBaseAllocator()),
+      myFrameStamp(0),
+      myNbEvicted(0),
+      myNbReuploaded(0)
 {
 #if defined(HAVE_EGL)
   myEglDisplay = (Aspect_Display)EGL_NO_DISPLAY;
@@ -910,3 +915,74 @@ void OpenGl_GraphicDriver::setDeviceLost()
     }
   }
 }
+
+//=================================================================================================
+
+size_t OpenGl_GraphicDriver::EvictGpuBuffers(const occ::handle<OpenGl_Context>& theGlCtx)
+{
+  // structures drawn within the last frame of any view are not candidates for eviction;
+  // the stamp is advanced by each view, so that a single driver-wide stamp
+  // would consider structures shown only by another view as unused
+  size_t aMinViewStamp = myFrameStamp;
+  for (NCollection_Map<occ::handle<OpenGl_View>>::Iterator aViewIter(myMapOfView); aViewIter.More();
+       aViewIter.Next())
+  {
+    const size_t aViewStamp = aViewIter.Value()->myFrameStamp;
+    if (aViewStamp != 0)
+    {
+      aMinViewStamp = std::min(aMinViewStamp, aViewStamp);
+    }
+  }
+
+  NCollection_Array1<OpenGl_Structure*> aCandidates(0, std::max(myMapOfStructure.Extent(), 1) - 1);
+  int                                   aNbCandidates = 0;
+  size_t                                aTotalSize    = 0;
+  for (NCollection_DataMap<int, OpenGl_Structure*>::Iterator aStructIt(myMapOfStructure);
+       aStructIt.More();
+       aStructIt.Next())
+  {
+    OpenGl_Structure* aStruct = aStructIt.ChangeValue();
+    const size_t      aSize   = aStruct->EstimatedDataSize();
+    aTotalSize += aSize;
+    if (aSize != 0 && aStruct->RenderStamp() < aMinViewStamp)
+    {
+      aCandidates.SetValue(aNbCandidates++, aStruct);
+    }
+  }
+
+  const size_t aBudget = myCaps->vboMemoryBudget;
+  if (aBudget == 0 || aTotalSize <= aBudget || aNbCandidates == 0)
+  {
+    return aTotalSize;
+  }
+
+  // evict least recently drawn structures first
+  OpenGl_Structure** aCandidatesBegin = &aCandidates.ChangeFirst();
+  std::sort(aCandidatesBegin,
+            aCandidatesBegin + aNbCandidates,
+            [](const OpenGl_Structure* theLeft, const OpenGl_Structure* theRight) {
+              return theLeft->RenderStamp() < theRight->RenderStamp();
+            });
+  for (int aCandIter = 0; aCandIter < aNbCandidates && aTotalSize > aBudget; ++aCandIter)
+  {
+    const size_t anEvicted = aCandidates.Value(aCandIter)->EvictGpuBuffers(theGlCtx);
+    if (anEvicted != 0)
+    {
+      aTotalSize -= anEvicted;
+      ++myNbEvicted;
+    }
+  }
+  return aTotalSize;
+}
+
+//=================================================================================================
+
+void OpenGl_GraphicDriver::ReleaseCpuData(const occ::handle<OpenGl_Context>& theGlCtx)
+{
+  for (NCollection_DataMap<int, OpenGl_Structure*>::Iterator aStructIt(myMapOfStructure);
+       aStructIt.More();
+       aStructIt.Next())
+  {
+    aStructIt.ChangeValue()->ReleaseCpuData(theGlCtx);
+  }
+}
@@ -187,6 +187,43 @@ public:
   //! Returns unique ID for primitive arrays.
   size_t GetNextPrimitiveArrayUID() const { return myUIDGenerator.Increment(); }
 
+public: //! @name GPU memory management
+  //! Returns the counter of frames redrawn by views of this driver,
+  //! which is used to find least recently drawn structures.
+  size_t FrameStamp() const { return myFrameStamp; }
+
+  //! Increments the frame counter; should be called at the beginning of view redraw.
+  //! Each view remembers the stamp of its last redraw.
+  void NextFrameStamp() { ++myFrameStamp; }
+
+  //! Releases GPU buffers of least recently drawn structures to fit into
+  //! OpenGl_Caps::vboMemoryBudget.
+  //! Structures drawn within the last frame of any view are kept,
+  //! so that views showing different structures do not evict buffers of each other.
+  //! Textures are not considered by the budget.
+  //! @return estimated GPU memory used by structures after eviction
+  Standard_EXPORT size_t EvictGpuBuffers(const occ::handle<OpenGl_Context>& theGlCtx);
+
+  //! Returns the number of structures, which GPU buffers have been released to fit the budget.
+  size_t NbEvictedStructures() const { return myNbEvicted; }
+
+  //! Returns the number of evicted structures, which buffers have been uploaded again.
+  size_t NbReuploadedStructures() const { return myNbReuploaded; }
+
+  //! Increments the counter of re-uploaded structures; called by OpenGl_Structure.
+  void IncrementReuploadedStructures() { ++myNbReuploaded; }
+
+  //! Resets counters of evicted and re-uploaded structures.
+  void ResetEvictionCounters()
+  {
+    myNbEvicted    = 0;
+    myNbReuploaded = 0;
+  }
+
+  //! Releases CPU copies of data already uploaded into GPU buffers for all structures
+  //! (see OpenGl_Structure::ReleaseCpuData()).
+  Standard_EXPORT void ReleaseCpuData(const occ::handle<OpenGl_Context>& theGlCtx);
+
 protected:
   //! Choose default visual for new windows created by Aspect_DisplayConnection.
   Standard_EXPORT void chooseVisualInfo();
@@ -206,6 +243,9 @@ protected:
 
   mutable OpenGl_StateCounter myStateCounter; //!< State counter for OpenGl structures.
   mutable OpenGl_StateCounter myUIDGenerator; //!< Unique ID counter for primitive arrays.
+  size_t                      myFrameStamp;   //!< counter of redrawn frames
+  size_t                      myNbEvicted;    //!< counter of evicted structures
+  size_t                      myNbReuploaded; //!< counter of re-uploaded evicted structures
 };
 
 #endif //_OpenGl_GraphicDriver_HeaderFile
@@ -171,6 +171,39 @@ void OpenGl_Group::AddPrimitiveArray(const Graphic3d_TypeOfPrimitiveArray      t
 
 //=================================================================================================
 
+void OpenGl_Group::AddInstancedPrimitiveArray(
+  const Graphic3d_TypeOfPrimitiveArray         theType,
+  const occ::handle<Graphic3d_IndexBuffer>&    theIndices,
+  const occ::handle<Graphic3d_Buffer>&         theAttribs,
+  const occ::handle<Graphic3d_BoundBuffer>&    theBounds,
+  const occ::handle<Graphic3d_InstanceBuffer>& theInstances,
+  const bool                                   theToEvalMinMax)
+{
+  if (IsDeleted() || theAttribs.IsNull() || theInstances.IsNull() || theInstances->IsEmpty())
+  {
+    return;
+  }
+
+  OpenGl_Structure*           aStruct = GlStruct();
+  const OpenGl_GraphicDriver* aDriver = aStruct->GlDriver();
+
+  // instances should be assigned before adding element to the group,
+  // so that instanced array is not considered as ray-tracing geometry
+  OpenGl_PrimitiveArray* anArray =
+    new OpenGl_PrimitiveArray(aDriver, theType, theIndices, theAttribs, theBounds);
+  anArray->SetInstances(theInstances);
+  AddElement(anArray);
+
+  Graphic3d_Group::AddInstancedPrimitiveArray(theType,
+                                              theIndices,
+                                              theAttribs,
+                                              theBounds,
+                                              theInstances,
+                                              theToEvalMinMax);
+}
+
+//=================================================================================================
+
 void OpenGl_Group::AddText(const occ::handle<Graphic3d_Text>& theTextParams,
                            const bool                         theToEvalMinMax)
 {
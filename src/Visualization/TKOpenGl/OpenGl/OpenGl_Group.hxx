@@ -77,6 +77,15 @@ public:
                                          const occ::handle<Graphic3d_BoundBuffer>& theBounds,
                                          const bool theToEvalMinMax) override;
 
+  //! Add primitive array element drawn at several locations
+  Standard_EXPORT void AddInstancedPrimitiveArray(
+    const Graphic3d_TypeOfPrimitiveArray         theType,
+    const occ::handle<Graphic3d_IndexBuffer>&    theIndices,
+    const occ::handle<Graphic3d_Buffer>&         theAttribs,
+    const occ::handle<Graphic3d_BoundBuffer>&    theBounds,
+    const occ::handle<Graphic3d_InstanceBuffer>& theInstances,
+    const bool                                   theToEvalMinMax) override;
+
   //! Adds a text for display
   Standard_EXPORT void AddText(const occ::handle<Graphic3d_Text>& theTextParams,
                                const bool                         theToEvalMinMax) override;
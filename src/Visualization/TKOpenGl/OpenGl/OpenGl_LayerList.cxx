@@ -18,6 +18,7 @@
 #include <BVH_LinearBuilder.hxx>
 #include <OpenGl_DepthPeeling.hxx>
 #include <OpenGl_FrameBuffer.hxx>
+#include <OpenGl_FrameStats.hxx>
 #include <OpenGl_LayerList.hxx>
 #include <OpenGl_RenderFilter.hxx>
 #include <OpenGl_ShaderManager.hxx>
@@ -666,7 +667,12 @@ void OpenGl_LayerList::renderLayer(const occ::handle<OpenGl_Workspace>& theWorks
   }
 
   // render priority list
-  const int aViewId = theWorkspace->View()->Identification();
+  const int                             aViewId = theWorkspace->View()->Identification();
+  const occ::handle<OpenGl_FrameStats>& aStats  = aCtx->FrameStats();
+  const bool toTimeItems = (theWorkspace->View()->RenderingParams().CollectedStats
+                            & Graphic3d_RenderingParams::PerfCounters_ItemTimers)
+                           != 0;
+  const int aLayerTiming = toTimeItems ? aStats->BeginItemTiming(aCtx) : -1;
   for (int aPriorityIter = Graphic3d_DisplayPriority_Bottom;
        aPriorityIter <= Graphic3d_DisplayPriority_Topmost;
        ++aPriorityIter)
@@ -682,9 +688,25 @@ void OpenGl_LayerList::renderLayer(const occ::handle<OpenGl_Workspace>& theWorks
         continue;
       }
 
+      if (!toTimeItems)
+      {
+        aStruct->Render(theWorkspace);
+        continue;
+      }
+
+      const int aStructTiming = aStats->BeginItemTiming(aCtx);
       aStruct->Render(theWorkspace);
+      aStats->EndItemTiming(aCtx,
+                            aStructTiming,
+                            false,
+                            aStruct->Identification(),
+                            theLayer.LayerId());
     }
   }
+  if (toTimeItems)
+  {
+    aStats->EndItemTiming(aCtx, aLayerTiming, true, theLayer.LayerId(), theLayer.LayerId());
+  }
 
   if (hasOwnLights)
   {
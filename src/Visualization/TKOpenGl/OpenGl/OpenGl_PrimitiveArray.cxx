@@ -14,6 +14,7 @@
 // commercial license or contractual agreement.
 
 #include <OpenGl_PrimitiveArray.hxx>
+#include <OpenGl_ArbIns.hxx>
 
 #include <OpenGl_PointSprite.hxx>
 #include <OpenGl_Sampler.hxx>
@@ -183,6 +184,11 @@ void OpenGl_PrimitiveArray::clearMemoryGL(const occ::handle<OpenGl_Context>& the
     myVboAttribs->Release(theGlCtx.operator->());
     myVboAttribs.Nullify();
   }
+  if (!myVboInstances.IsNull())
+  {
+    myVboInstances->Release(theGlCtx.operator->());
+    myVboInstances.Nullify();
+  }
 }
 
 //=================================================================================================
@@ -327,7 +333,9 @@ bool OpenGl_PrimitiveArray::buildVBO(const occ::handle<OpenGl_Context>& theCtx,
 
   if (isNormalMode && initNormalVbo(theCtx))
   {
-    if (!theCtx->caps->keepArrayData && !theToKeepData && !myAttribs->IsMutable())
+    // keep data for uploading buffers again after eviction, when memory budget is defined
+    if (!theCtx->caps->keepArrayData && theCtx->caps->vboMemoryBudget == 0 && !theToKeepData
+        && !myAttribs->IsMutable())
     {
       myIndices.Nullify();
       myAttribs.Nullify();
@@ -449,7 +457,8 @@ void OpenGl_PrimitiveArray::drawArray(const occ::handle<OpenGl_Workspace>& theWo
                                       const NCollection_Vec4<float>*       theFaceColors,
                                       const NCollection_Vec4<float>&       theBackColor,
                                       const bool                           theHasVertColor,
-                                      const bool theToUseVertexColorForBackFaces) const
+                                      const bool theToUseVertexColorForBackFaces,
+                                      const bool theToUseInstanceColors) const
 {
   const occ::handle<OpenGl_Context>& aGlContext = theWorkspace->GetGlContext();
   if (myVboAttribs.IsNull())
@@ -479,6 +488,63 @@ void OpenGl_PrimitiveArray::drawArray(const occ::handle<OpenGl_Workspace>& theWo
     // disable per-vertex color
     OpenGl_VertexBuffer::unbindAttribute(aGlContext, Graphic3d_TOA_COLOR);
   }
+  if (HasInstances())
+  {
+    drawInstances(theWorkspace,
+                  aDrawMode,
+                  theFaceColors,
+                  theBackColor,
+                  theToUseInstanceColors && !toHilight);
+  }
+  else
+  {
+    drawPrimitives(theWorkspace, aDrawMode, theFaceColors, theBackColor);
+  }
+
+  // bind with 0
+  myVboAttribs->UnbindAllAttributes(aGlContext);
+}
+
+//=================================================================================================
+
+void OpenGl_PrimitiveArray::drawPrimitives(const occ::handle<OpenGl_Workspace>& theWorkspace,
+                                           const unsigned int                   theDrawMode,
+                                           const NCollection_Vec4<float>*       theFaceColors,
+                                           const NCollection_Vec4<float>&       theBackColor,
+                                           const int                            theNbInstances) const
+{
+  const occ::handle<OpenGl_Context>& aGlContext = theWorkspace->GetGlContext();
+  const auto drawElements = [&](const GLint theNbElems, const GLubyte* theOffset) {
+    if (theNbInstances > 0)
+    {
+      aGlContext->arbIns->glDrawElementsInstanced(theDrawMode,
+                                                  theNbElems,
+                                                  myVboIndices->GetDataType(),
+                                                  theOffset,
+                                                  theNbInstances);
+    }
+    else
+    {
+      aGlContext->core11fwd->glDrawElements(theDrawMode,
+                                            theNbElems,
+                                            myVboIndices->GetDataType(),
+                                            theOffset);
+    }
+  };
+  const auto drawArrays = [&](const GLint theFirstElem, const GLint theNbElems) {
+    if (theNbInstances > 0)
+    {
+      aGlContext->arbIns->glDrawArraysInstanced(theDrawMode,
+                                                theFirstElem,
+                                                theNbElems,
+                                                theNbInstances);
+    }
+    else
+    {
+      aGlContext->core11fwd->glDrawArrays(theDrawMode, theFirstElem, theNbElems);
+    }
+  };
+
   if (!myVboIndices.IsNull())
   {
     myVboIndices->Bind(aGlContext);
@@ -496,20 +562,14 @@ void OpenGl_PrimitiveArray::drawArray(const occ::handle<OpenGl_Workspace>& theWo
         {
           aGlContext->SetColor4fv(theFaceColors[aGroupIter], theBackColor);
         }
-        aGlContext->core11fwd->glDrawElements(aDrawMode,
-                                              aNbElemsInGroup,
-                                              myVboIndices->GetDataType(),
-                                              anOffset);
+        drawElements(aNbElemsInGroup, anOffset);
         anOffset += aStride * aNbElemsInGroup;
       }
     }
     else
     {
       // draw one (or sequential) primitive by the indices
-      aGlContext->core11fwd->glDrawElements(aDrawMode,
-                                            myVboIndices->GetElemsNb(),
-                                            myVboIndices->GetDataType(),
-                                            anOffset);
+      drawElements(myVboIndices->GetElemsNb(), anOffset);
     }
     myVboIndices->Unbind(aGlContext);
   }
@@ -523,7 +583,7 @@ void OpenGl_PrimitiveArray::drawArray(const occ::handle<OpenGl_Workspace>& theWo
       {
         aGlContext->SetColor4fv(theFaceColors[aGroupIter], theBackColor);
       }
-      aGlContext->core11fwd->glDrawArrays(aDrawMode, aFirstElem, aNbElemsInGroup);
+      drawArrays(aFirstElem, aNbElemsInGroup);
       aFirstElem += aNbElemsInGroup;
     }
   }
@@ -535,12 +595,179 @@ void OpenGl_PrimitiveArray::drawArray(const occ::handle<OpenGl_Workspace>& theWo
     }
     else
     {
-      aGlContext->core11fwd->glDrawArrays(aDrawMode, 0, myVboAttribs->GetElemsNb());
+      drawArrays(0, myVboAttribs->GetElemsNb());
     }
   }
+}
 
-  // bind with 0
-  myVboAttribs->UnbindAllAttributes(aGlContext);
+//=================================================================================================
+
+bool OpenGl_PrimitiveArray::canDrawInstanced(const occ::handle<OpenGl_Context>& theCtx,
+                                             const bool theHasColorAttrib) const
+{
+  // per-vertex colors of the array are combined with instance colors only by fallback path
+  return HasInstances() && !myInstances->IsEmpty() && myDrawMode != GL_POINTS
+         && theCtx->arbIns != nullptr && theCtx->core20fwd != nullptr
+         && theCtx->Functions()->glVertexAttribDivisor != nullptr
+         && (!theHasColorAttrib || !myInstances->HasColors());
+}
+
+//=================================================================================================
+
+bool OpenGl_PrimitiveArray::updateInstancesVbo(const occ::handle<OpenGl_Context>& theCtx) const
+{
+  if (!myVboInstances.IsNull() && myVboInstances->IsValid()
+      && myInstancesRevision == myInstances->Revision())
+  {
+    return true;
+  }
+
+  // column-major 4x4 matrix followed by optional RGBA color
+  const int                aNbVec4 = myInstances->HasColors() ? 5 : 4;
+  NCollection_Array1<float> aData(0, myInstances->NbInstances() * aNbVec4 * 4 - 1);
+  float*                   aDataIter = &aData.ChangeFirst();
+  for (int anInstIter = 1; anInstIter <= myInstances->NbInstances(); ++anInstIter)
+  {
+    const NCollection_Mat4<float>& aMat = myInstances->Matrix(anInstIter);
+    memcpy(aDataIter, aMat.GetData(), sizeof(float) * 16);
+    aDataIter += 16;
+    if (myInstances->HasColors())
+    {
+      const NCollection_Vec4<float> aColor =
+        theCtx->Vec4FromQuantityColor(myInstances->Color(anInstIter));
+      memcpy(aDataIter, aColor.GetData(), sizeof(float) * 4);
+      aDataIter += 4;
+    }
+  }
+
+  if (myVboInstances.IsNull())
+  {
+    myVboInstances = new OpenGl_VertexBuffer();
+  }
+  if (!myVboInstances->Init(theCtx, 4, myInstances->NbInstances() * aNbVec4, &aData.First()))
+  {
+    myVboInstances->Release(theCtx.get());
+    myVboInstances.Nullify();
+    return false;
+  }
+  myInstancesRevision = myInstances->Revision();
+  return true;
+}
+
+//=================================================================================================
+
+void OpenGl_PrimitiveArray::drawInstances(const occ::handle<OpenGl_Workspace>& theWorkspace,
+                                          const unsigned int                   theDrawMode,
+                                          const NCollection_Vec4<float>*       theFaceColors,
+                                          const NCollection_Vec4<float>&       theBackColor,
+                                          const bool theToUseInstanceColors) const
+{
+  const occ::handle<OpenGl_Context>&       aCtx       = theWorkspace->GetGlContext();
+  const occ::handle<OpenGl_ShaderManager>& aShaderMgr = aCtx->ShaderManager();
+
+  const bool                    toApplyColors = theToUseInstanceColors && myInstances->HasColors();
+  const OpenGl_Material         aBaseMaterial = aShaderMgr->MaterialState().Material();
+  const float                   anAlphaCutoff = aShaderMgr->MaterialState().AlphaCutoff();
+  const bool                    toDistinguish = aShaderMgr->MaterialState().ToDistinguish();
+  const bool                    toMapTexture  = aShaderMgr->MaterialState().ToMapTexture();
+  const occ::handle<OpenGl_ShaderProgram>& aProgram = aCtx->ActiveProgram();
+  if (!aProgram.IsNull() && !aProgram->Proxy().IsNull() && aProgram->Proxy()->IsInstanced()
+      && updateInstancesVbo(aCtx))
+  {
+    // single instanced draw call with per-instance transformation (and color) attributes
+    const int aStride = int(sizeof(float)) * (myInstances->HasColors() ? 20 : 16);
+    myVboInstances->Bind(aCtx);
+    for (int aColIter = 0; aColIter < 4; ++aColIter)
+    {
+      const int aLoc = Graphic3d_ShaderProgram::THE_INSTANCE_MATRIX_LOCATION + aColIter;
+      OpenGl_VertexBuffer::bindAttribute(aCtx,
+                                         Graphic3d_TypeOfAttribute(aLoc),
+                                         4,
+                                         GL_FLOAT,
+                                         aStride,
+                                         (const void*)(sizeof(float) * 4 * aColIter));
+      aCtx->Functions()->glVertexAttribDivisor(aLoc, 1);
+    }
+    if (toApplyColors)
+    {
+      // program has been bound with per-vertex color, which replaces material color
+      OpenGl_Material aMaterial = aBaseMaterial;
+      aMaterial.SetColor(NCollection_Vec3<float>(1.0f, 1.0f, 1.0f));
+      aShaderMgr->UpdateMaterialStateTo(aMaterial, anAlphaCutoff, toDistinguish, toMapTexture);
+      aShaderMgr->PushState(aProgram);
+      OpenGl_VertexBuffer::bindAttribute(aCtx,
+                                         Graphic3d_TOA_COLOR,
+                                         4,
+                                         GL_FLOAT,
+                                         aStride,
+                                         (const void*)(sizeof(float) * 16));
+      aCtx->Functions()->glVertexAttribDivisor(Graphic3d_TOA_COLOR, 1);
+    }
+    myVboInstances->Unbind(aCtx);
+
+    drawPrimitives(theWorkspace,
+                   theDrawMode,
+                   theFaceColors,
+                   theBackColor,
+                   myInstances->NbInstances());
+
+    for (int aColIter = 0; aColIter < 4; ++aColIter)
+    {
+      const int aLoc = Graphic3d_ShaderProgram::THE_INSTANCE_MATRIX_LOCATION + aColIter;
+      aCtx->Functions()->glVertexAttribDivisor(aLoc, 0);
+      OpenGl_VertexBuffer::unbindAttribute(aCtx, Graphic3d_TypeOfAttribute(aLoc));
+    }
+    if (toApplyColors)
+    {
+      aCtx->Functions()->glVertexAttribDivisor(Graphic3d_TOA_COLOR, 0);
+      OpenGl_VertexBuffer::unbindAttribute(aCtx, Graphic3d_TOA_COLOR);
+      aShaderMgr->UpdateMaterialStateTo(aBaseMaterial, anAlphaCutoff, toDistinguish, toMapTexture);
+      aShaderMgr->PushState(aProgram);
+    }
+    return;
+  }
+
+  if (!aProgram.IsNull() && !aProgram->Proxy().IsNull() && aProgram->Proxy()->IsInstanced())
+  {
+    // instances VBO is unavailable - set identity to per-instance transformation attribute
+    for (int aColIter = 0; aColIter < 4; ++aColIter)
+    {
+      aCtx->core20fwd->glVertexAttrib4f(Graphic3d_ShaderProgram::THE_INSTANCE_MATRIX_LOCATION
+                                          + aColIter,
+                                        aColIter == 0 ? 1.0f : 0.0f,
+                                        aColIter == 1 ? 1.0f : 0.0f,
+                                        aColIter == 2 ? 1.0f : 0.0f,
+                                        aColIter == 3 ? 1.0f : 0.0f);
+    }
+  }
+
+  // fallback - vertex data is bound once,
+  // only transformation (and color) is changed between draw calls
+  const NCollection_Mat4<float> aModelWorld   = aCtx->ModelWorldState.Current();
+  aCtx->ModelWorldState.Push();
+  for (int anInstIter = 1; anInstIter <= myInstances->NbInstances(); ++anInstIter)
+  {
+    aCtx->ModelWorldState.SetCurrent(aModelWorld * myInstances->Matrix(anInstIter));
+    aCtx->ApplyModelViewMatrix();
+    if (toApplyColors)
+    {
+      const NCollection_Vec4<float> aColor =
+        aCtx->Vec4FromQuantityColor(myInstances->Color(anInstIter));
+      OpenGl_Material aMaterial = aBaseMaterial;
+      aMaterial.SetColor(aColor.rgb());
+      aShaderMgr->UpdateMaterialStateTo(aMaterial, anAlphaCutoff, toDistinguish, toMapTexture);
+      aCtx->SetColor4fv(aColor);
+    }
+    aShaderMgr->PushState(aCtx->ActiveProgram());
+    drawPrimitives(theWorkspace, theDrawMode, theFaceColors, theBackColor);
+  }
+  aCtx->ModelWorldState.Pop();
+  aCtx->ApplyModelViewMatrix();
+  if (toApplyColors)
+  {
+    aShaderMgr->UpdateMaterialStateTo(aBaseMaterial, anAlphaCutoff, toDistinguish, toMapTexture);
+  }
+  aShaderMgr->PushState(aCtx->ActiveProgram());
 }
 
 //=================================================================================================
@@ -582,60 +809,21 @@ void OpenGl_PrimitiveArray::drawEdges(const occ::handle<OpenGl_Workspace>& theWo
   /// 3) draw primitive's edges by vertexes if no edges and bounds array is specified
   myVboAttribs->BindPositionAttribute(aGlContext);
 
-  aGlContext->SetColor4fv(theWorkspace->EdgeColor().a() >= 0.1f
-                            ? theWorkspace->EdgeColor()
-                            : theWorkspace->View()->BackgroundColor());
+  const NCollection_Vec4<float> anEdgeColor = theWorkspace->EdgeColor().a() >= 0.1f
+                                                ? theWorkspace->EdgeColor()
+                                                : theWorkspace->View()->BackgroundColor();
+  aGlContext->SetColor4fv(anEdgeColor);
   aGlContext->SetLineStipple((float)anAspect->Aspect()->LineStippleFactor(),
                              anAspect->Aspect()->LinePattern());
   aGlContext->SetLineWidth(anAspect->Aspect()->EdgeWidth());
 
-  if (!myVboIndices.IsNull())
+  if (HasInstances())
   {
-    myVboIndices->Bind(aGlContext);
-    GLubyte* anOffset = myVboIndices->GetDataOffset();
-
-    // draw primitives by vertex count with the indices
-    if (!myBounds.IsNull())
-    {
-      const size_t aStride = myVboIndices->GetDataType() == GL_UNSIGNED_SHORT
-                               ? sizeof(unsigned short)
-                               : sizeof(unsigned int);
-      for (int aGroupIter = 0; aGroupIter < myBounds->NbBounds; ++aGroupIter)
-      {
-        const GLint aNbElemsInGroup = myBounds->Bounds[aGroupIter];
-        aGlContext->core11fwd->glDrawElements(aDrawMode,
-                                              aNbElemsInGroup,
-                                              myVboIndices->GetDataType(),
-                                              anOffset);
-        anOffset += aStride * aNbElemsInGroup;
-      }
-    }
-    // draw one (or sequential) primitive by the indices
-    else
-    {
-      aGlContext->core11fwd->glDrawElements(aDrawMode,
-                                            myVboIndices->GetElemsNb(),
-                                            myVboIndices->GetDataType(),
-                                            anOffset);
-    }
-    myVboIndices->Unbind(aGlContext);
-  }
-  else if (!myBounds.IsNull())
-  {
-    GLint aFirstElem = 0;
-    for (int aGroupIter = 0; aGroupIter < myBounds->NbBounds; ++aGroupIter)
-    {
-      const GLint aNbElemsInGroup = myBounds->Bounds[aGroupIter];
-      aGlContext->core11fwd->glDrawArrays(aDrawMode, aFirstElem, aNbElemsInGroup);
-      aFirstElem += aNbElemsInGroup;
-    }
+    drawInstances(theWorkspace, aDrawMode, nullptr, anEdgeColor, false);
   }
   else
   {
-    aGlContext->core11fwd->glDrawArrays(aDrawMode,
-                                        0,
-                                        !myVboAttribs.IsNull() ? myVboAttribs->GetElemsNb()
-                                                               : myAttribs->NbElements);
+    drawPrimitives(theWorkspace, aDrawMode, nullptr, anEdgeColor);
   }
 
   // unbind buffers
@@ -716,7 +904,8 @@ void OpenGl_PrimitiveArray::drawMarkers(const occ::handle<OpenGl_Workspace>& the
 
 OpenGl_PrimitiveArray::OpenGl_PrimitiveArray(const OpenGl_GraphicDriver* theDriver)
 
-    : myDrawMode(DRAW_MODE_NONE),
+    : myInstancesRevision(0),
+      myDrawMode(DRAW_MODE_NONE),
       myIsFillType(false),
       myIsVboInit(false)
 {
@@ -737,6 +926,7 @@ OpenGl_PrimitiveArray::OpenGl_PrimitiveArray(const OpenGl_GraphicDriver*
     : myIndices(theIndices),
       myAttribs(theAttribs),
       myBounds(theBounds),
+      myInstancesRevision(0),
       myDrawMode(DRAW_MODE_NONE),
       myIsFillType(false),
       myIsVboInit(false)
@@ -785,6 +975,48 @@ void OpenGl_PrimitiveArray::Release(OpenGl_Context* theContext)
     }
     myVboAttribs.Nullify();
   }
+  if (!myVboInstances.IsNull())
+  {
+    if (theContext)
+    {
+      theContext->DelayedRelease(myVboInstances);
+    }
+    myVboInstances.Nullify();
+  }
+}
+
+//=================================================================================================
+
+size_t OpenGl_PrimitiveArray::EvictGpuBuffers(OpenGl_Context* theContext)
+{
+  if (!myIsVboInit || myAttribs.IsNull() || myVboAttribs.IsNull() || myVboAttribs->IsVirtual())
+  {
+    return 0;
+  }
+
+  // buffers will be built again by the next Render()
+  const size_t aSize = EstimatedDataSize();
+  Release(theContext);
+  return aSize;
+}
+
+//=================================================================================================
+
+void OpenGl_PrimitiveArray::ReleaseCpuData(OpenGl_Context* theContext)
+{
+  if (!myIsVboInit || myAttribs.IsNull() || myVboAttribs.IsNull() || myVboAttribs->IsVirtual()
+      || myAttribs->IsMutable() || (!myIndices.IsNull() && myIndices->IsMutable()))
+  {
+    return;
+  }
+  // data might be required by ray-tracing or to draw markers using display lists
+  if (myDrawMode == GL_POINTS || (theContext != nullptr && theContext->caps->keepArrayData))
+  {
+    return;
+  }
+
+  myIndices.Nullify();
+  myAttribs.Nullify();
 }
 
 //=================================================================================================
@@ -800,6 +1032,10 @@ size_t OpenGl_PrimitiveArray::EstimatedDataSize() const
   {
     aSize += myVboIndices->EstimatedDataSize();
   }
+  if (!myVboInstances.IsNull())
+  {
+    aSize += myVboInstances->EstimatedDataSize();
+  }
   return aSize;
 }
 
@@ -827,9 +1063,12 @@ void OpenGl_PrimitiveArray::UpdateDrawStats(Graphic3d_FrameStatsDataTmp& theStat
     return;
   }
 
-  const int aNbIndices =
-    !myVboIndices.IsNull() ? myVboIndices->GetElemsNb() : myVboAttribs->GetElemsNb();
-  const int aNbBounds = !myBounds.IsNull() ? myBounds->NbBounds : 1;
+  // instanced array is drawn once per instance
+  const size_t aNbInstances = HasInstances() ? (size_t)myInstances->NbInstances() : 1;
+  const size_t aNbIndices =
+    (!myVboIndices.IsNull() ? myVboIndices->GetElemsNb() : myVboAttribs->GetElemsNb())
+    * aNbInstances;
+  const size_t aNbBounds = (!myBounds.IsNull() ? myBounds->NbBounds : 1) * aNbInstances;
   switch (myDrawMode)
   {
     case GL_POINTS: {
@@ -965,12 +1204,19 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
   const occ::handle<OpenGl_TextureSet>& aTextureSet = theWorkspace->TextureSet();
   const bool                            toEnableEnvMap =
     !aTextureSet.IsNull() && aTextureSet == theWorkspace->EnvironmentTexture();
+  const bool hasColorAttrib  = !myVboAttribs.IsNull() && myVboAttribs->HasColorAttribute();
+  const bool toDrawInstanced = canDrawInstanced(aCtx, hasColorAttrib);
+  // standard programs (including edges and outline) should be bound in instancing variant
+  aCtx->ShaderManager()->SetInstancedDraw(toDrawInstanced);
   if (toDrawArray)
   {
-    const bool hasColorAttrib = !myVboAttribs.IsNull() && myVboAttribs->HasColorAttribute();
-    const bool toHilight      = theWorkspace->ToHighlight();
-    const bool hasVertColor   = hasColorAttrib && !toHilight;
-    const bool hasVertNorm    = !myVboAttribs.IsNull() && myVboAttribs->HasNormalAttribute();
+    const bool toHilight = theWorkspace->ToHighlight();
+    // instance colors are passed to the program as per-vertex color attribute
+    const bool hasInstColor = toDrawInstanced && myInstances->HasColors() && !toHilight;
+    const bool hasVertColor = (hasColorAttrib && !toHilight) || hasInstColor;
+    const bool hasVertNorm  = !myVboAttribs.IsNull() && myVboAttribs->HasNormalAttribute();
+    const bool toUseVertColorForBackFaces =
+      anAspectFace->Aspect()->ToUseVertexColorForBackFaces() || hasInstColor;
     switch (myDrawMode)
     {
       case GL_POINTS: {
@@ -1006,7 +1252,7 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
                                                                   : Graphic3d_AlphaMode_Opaque,
           toDrawInteriorEdges == 1 ? anAspectFace->Aspect()->InteriorStyle() : Aspect_IS_SOLID,
           hasVertColor,
-          anAspectFace->Aspect()->ToUseVertexColorForBackFaces(),
+          toUseVertColorForBackFaces,
           toEnableEnvMap,
           toDrawInteriorEdges == 1,
           anAspectFace->ShaderProgramRes(aCtx));
@@ -1062,11 +1308,13 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
                 aFaceColors,
                 aBackInteriorColor,
                 hasColorAttrib,
-                anAspectFace->Aspect()->ToUseVertexColorForBackFaces());
+                anAspectFace->Aspect()->ToUseVertexColorForBackFaces(),
+                true);
       if (isForcedBlend)
       {
         aCtx->core11fwd->glDisable(GL_BLEND);
       }
+      aCtx->ShaderManager()->SetInstancedDraw(false);
       return;
     }
 
@@ -1074,7 +1322,8 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
               aFaceColors,
               aBackInteriorColor,
               hasColorAttrib,
-              anAspectFace->Aspect()->ToUseVertexColorForBackFaces());
+              anAspectFace->Aspect()->ToUseVertexColorForBackFaces(),
+              true);
 
     // draw outline - only closed triangulation with defined vertex normals can be drawn in this way
     if (anAspectFace->Aspect()->ToDrawSilhouette() && aCtx->ToCullBackFaces()
@@ -1098,7 +1347,7 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
       aCtx->SetColor4fv(anAspectFace->Aspect()->EdgeColorRGBA());
 
       aCtx->SetFaceCulling(Graphic3d_TypeOfBackfacingModel_FrontCulled);
-      drawArray(theWorkspace, nullptr, aBackInteriorColor, false, true);
+      drawArray(theWorkspace, nullptr, aBackInteriorColor, false, true, false);
       aCtx->SetFaceCulling(Graphic3d_TypeOfBackfacingModel_BackCulled);
     }
 
@@ -1121,6 +1370,7 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
       drawEdges(theWorkspace);
     }
   }
+  aCtx->ShaderManager()->SetInstancedDraw(false);
 }
 
 //=================================================================================================
@@ -19,6 +19,7 @@
 #include <Graphic3d_TypeOfPrimitiveArray.hxx>
 #include <Graphic3d_IndexBuffer.hxx>
 #include <Graphic3d_BoundBuffer.hxx>
+#include <Graphic3d_InstanceBuffer.hxx>
 
 #include <OpenGl_Element.hxx>
 
@@ -65,6 +66,12 @@ public:
   Standard_EXPORT void UpdateDrawStats(Graphic3d_FrameStatsDataTmp& theStats,
                                        bool                         theIsDetailed) const override;
 
+  //! Releases VBOs, when attributes are retained in CPU memory to build them again.
+  Standard_EXPORT size_t EvictGpuBuffers(OpenGl_Context* theContext) override;
+
+  //! Releases attributes and indices retained in CPU memory, when VBOs have been built.
+  Standard_EXPORT void ReleaseCpuData(OpenGl_Context* theContext) override;
+
   //! Return true if VBOs initialization has been performed.
   //! VBO initialization is performed during first Render() call.
   //! Notice that this flag does not indicate VBOs validity.
@@ -91,6 +98,21 @@ public:
   //! Returns unique ID of primitive array.
   size_t GetUID() const { return myUID; }
 
+  //! Returns per-instance data for instanced array, or NULL.
+  const occ::handle<Graphic3d_InstanceBuffer>& Instances() const { return myInstances; }
+
+  //! Sets per-instance data; the array is drawn at each instance location using the same VBOs.
+  //! Per-instance transformations and colors are uploaded into a dedicated VBO
+  //! and drawn by a single instanced draw call, when supported by OpenGL context.
+  void SetInstances(const occ::handle<Graphic3d_InstanceBuffer>& theInstances)
+  {
+    myInstances         = theInstances;
+    myInstancesRevision = 0;
+  }
+
+  //! Return TRUE if array is drawn at several instance locations.
+  bool HasInstances() const { return !myInstances.IsNull(); }
+
   //! Initialize indices, attributes and bounds with new data.
   Standard_EXPORT void InitBuffers(const occ::handle<OpenGl_Context>&        theContext,
                                    const Graphic3d_TypeOfPrimitiveArray      theType,
@@ -130,7 +152,36 @@ private:
                  const NCollection_Vec4<float>*       theFaceColors,
                  const NCollection_Vec4<float>&       theBackColor,
                  const bool                           theHasVertColor,
-                 const bool                           theToUseVertexColorForBackFaces) const;
+                 const bool                           theToUseVertexColorForBackFaces,
+                 const bool                           theToUseInstanceColors) const;
+
+  //! Issues draw calls for the bound VBOs.
+  //! @param[in] theNbInstances  number of instances to draw with instanced draw calls,
+  //!                            or 0 to issue regular draw calls
+  void drawPrimitives(const occ::handle<OpenGl_Workspace>& theWorkspace,
+                      const unsigned int                   theDrawMode,
+                      const NCollection_Vec4<float>*       theFaceColors,
+                      const NCollection_Vec4<float>&       theBackColor,
+                      const int                            theNbInstances = 0) const;
+
+  //! Return TRUE if instances can be drawn by instanced draw calls within specified context,
+  //! so that standard GLSL programs should be bound in variant applying per-instance attributes.
+  bool canDrawInstanced(const occ::handle<OpenGl_Context>& theCtx,
+                        const bool                         theHasColorAttrib) const;
+
+  //! Uploads per-instance transformations and colors into instances VBO, if modified.
+  bool updateInstancesVbo(const occ::handle<OpenGl_Context>& theCtx) const;
+
+  //! Draws the bound VBOs at each instance location applying instance transformation
+  //! and (optionally) instance color.
+  //! Issues a single instanced draw call when active GLSL program has been bound
+  //! in variant for hardware instancing (see canDrawInstanced());
+  //! otherwise falls back to one draw call per instance.
+  void drawInstances(const occ::handle<OpenGl_Workspace>& theWorkspace,
+                     const unsigned int                   theDrawMode,
+                     const NCollection_Vec4<float>*       theFaceColors,
+                     const NCollection_Vec4<float>&       theBackColor,
+                     const bool                           theToUseInstanceColors) const;
 
   //! Auxiliary procedures
   void drawEdges(const occ::handle<OpenGl_Workspace>& theWorkspace) const;
@@ -148,10 +199,13 @@ private:
 protected:
   mutable occ::handle<OpenGl_IndexBuffer>  myVboIndices;
   mutable occ::handle<OpenGl_VertexBuffer> myVboAttribs;
+  mutable occ::handle<OpenGl_VertexBuffer> myVboInstances; //!< per-instance attributes
 
   mutable occ::handle<Graphic3d_IndexBuffer> myIndices;
   mutable occ::handle<Graphic3d_Buffer>      myAttribs;
   mutable occ::handle<Graphic3d_BoundBuffer> myBounds;
+  occ::handle<Graphic3d_InstanceBuffer>      myInstances;
+  mutable size_t                             myInstancesRevision;
   short                                      myDrawMode;
   mutable bool                               myIsFillType;
   mutable bool                               myIsVboInit;
@@ -560,7 +560,7 @@ namespace OpenGl_Raytrace
 bool IsRaytracedElement(const OpenGl_ElementNode* theNode)
 {
   OpenGl_PrimitiveArray* anArray = dynamic_cast<OpenGl_PrimitiveArray*>(theNode->elem);
-  return anArray != nullptr && anArray->DrawMode() >= GL_TRIANGLES;
+  return anArray != nullptr && anArray->DrawMode() >= GL_TRIANGLES && !anArray->HasInstances();
 }
 
 // =======================================================================
@@ -570,7 +570,7 @@ bool IsRaytracedElement(const OpenGl_ElementNode* theNode)
 bool IsRaytracedElement(const OpenGl_Element* theElement)
 {
   const OpenGl_PrimitiveArray* anArray = dynamic_cast<const OpenGl_PrimitiveArray*>(theElement);
-  return anArray != nullptr && anArray->DrawMode() >= GL_TRIANGLES;
+  return anArray != nullptr && anArray->DrawMode() >= GL_TRIANGLES && !anArray->HasInstances();
 }
 
 // =======================================================================
@@ -30,14 +30,25 @@ public:
   //! Empty constructor
   OpenGl_SetOfPrograms() = default;
 
-  //! Access program by index
+  //! Access program by index;
+  //! programs with Graphic3d_ShaderFlags_Instancing bit are stored within nested set allocated on
+  //! first use.
   occ::handle<OpenGl_ShaderProgram>& ChangeValue(int theProgramBits)
   {
+    if ((theProgramBits & Graphic3d_ShaderFlags_Instancing) != 0)
+    {
+      if (myInstancedPrograms.IsNull())
+      {
+        myInstancedPrograms = new OpenGl_SetOfPrograms();
+      }
+      return myInstancedPrograms->ChangeValue(theProgramBits & ~Graphic3d_ShaderFlags_Instancing);
+    }
     return myPrograms[theProgramBits];
   }
 
 protected:
   occ::handle<OpenGl_ShaderProgram> myPrograms[Graphic3d_ShaderFlags_NB]; //!< programs array
+  occ::handle<OpenGl_SetOfPrograms> myInstancedPrograms; //!< programs with per-instance transformation
 };
 
 //! Alias to 2D programs array of predefined length
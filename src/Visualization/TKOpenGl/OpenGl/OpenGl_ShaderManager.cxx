@@ -142,7 +142,8 @@ OpenGl_ShaderManager::OpenGl_ShaderManager(OpenGl_Context* theContext)
       myShadingModel(Graphic3d_TypeOfShadingModel_Gouraud),
       myUnlitPrograms(new OpenGl_SetOfPrograms()),
       myContext(theContext),
-      myHasLocalOrigin(false)
+      myHasLocalOrigin(false),
+      myIsInstancedDraw(false)
 {
   mySRgbState = theContext->ToRenderSRGB();
 }
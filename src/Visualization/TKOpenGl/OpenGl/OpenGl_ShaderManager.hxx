@@ -60,6 +60,14 @@ public:
     myHasLocalOrigin = !theOrigin.IsEqual(gp_XYZ(0.0, 0.0, 0.0), gp::Resolution());
   }
 
+  //! Return TRUE if standard programs should be bound in variant applying per-instance
+  //! transformation from vertex attribute (hardware instancing).
+  bool IsInstancedDraw() const { return myIsInstancedDraw; }
+
+  //! Set if standard programs should be bound in variant for hardware instancing.
+  //! Should be reset by caller after drawing instanced primitive array.
+  void SetInstancedDraw(bool theIsInstanced) { myIsInstancedDraw = theIsInstanced; }
+
   //! Return clipping plane W equation value moved considering local camera transformation.
   double LocalClippingPlaneW(const Graphic3d_ClipPlane& thePlane) const
   {
@@ -659,6 +667,10 @@ protected:
     {
       aBits |= Graphic3d_ShaderFlags_OitDepthPeeling;
     }
+    if (myIsInstancedDraw)
+    {
+      aBits |= Graphic3d_ShaderFlags_Instancing;
+    }
     return aBits;
   }
 
@@ -843,6 +855,7 @@ protected:
 
   gp_XYZ                             myLocalOrigin;        //!< local camera transformation
   bool                   myHasLocalOrigin;     //!< flag indicating that local camera transformation has been set
+  bool                   myIsInstancedDraw;    //!< flag indicating that hardware instancing variant of standard programs should be bound
                         // clang-format on
 
   mutable NCollection_Array1<int>                          myLightTypeArray;
@@ -514,6 +514,10 @@ bool OpenGl_ShaderProgram::Initialize(
       {
         aHeaderConstants += "#define THE_IS_PBR\n";
       }
+      if (myProxy->IsInstanced())
+      {
+        aHeaderConstants += "#define THE_HAS_INSTANCING\n";
+      }
       if ((myProxy->TextureSetBits() & Graphic3d_TextureSetBits_BaseColor) != 0)
       {
         aHeaderConstants += "#define THE_HAS_TEXTURE_COLOR\n";
@@ -578,6 +582,12 @@ bool OpenGl_ShaderProgram::Initialize(
   SetAttributeName(theCtx, Graphic3d_TOA_NORM, "occNormal");
   SetAttributeName(theCtx, Graphic3d_TOA_UV, "occTexCoord");
   SetAttributeName(theCtx, Graphic3d_TOA_COLOR, "occVertColor");
+  if (!myProxy.IsNull() && myProxy->IsInstanced())
+  {
+    SetAttributeName(theCtx,
+                     Graphic3d_ShaderProgram::THE_INSTANCE_MATRIX_LOCATION,
+                     "occInstanceMatrix");
+  }
 
   // bind custom Vertex Attributes
   if (!myProxy.IsNull())
@@ -109,7 +109,9 @@ OpenGl_Structure::OpenGl_Structure(const occ::handle<Graphic3d_StructureManager>
       myInstancedStructure(nullptr),
       myIsRaytracable(false),
       myModificationState(0),
-      myIsMirrored(false)
+      myIsMirrored(false),
+      myRenderStamp(0),
+      myIsEvicted(false)
 {
   updateLayerTransformation();
 }
@@ -365,12 +367,31 @@ void OpenGl_Structure::renderGeometry(const occ::handle<OpenGl_Workspace>& theWo
   {
     myInstancedStructure->renderGeometry(theWorkspace, theHasClosed);
   }
+  myRenderStamp = GlDriver()->FrameStamp();
+  if (myIsEvicted)
+  {
+    // buffers are uploaded again by rendering elements
+    myIsEvicted = false;
+    GlDriver()->IncrementReuploadedStructures();
+  }
 
   bool                               anOldCastShadows = false;
   const occ::handle<OpenGl_Context>& aCtx             = theWorkspace->GetGlContext();
+  double                             aLodSize         = -1.0;
   for (OpenGl_Structure::GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
   {
     const OpenGl_Group* aGroup = aGroupIter.Value();
+    if (aGroup->HasLodRange())
+    {
+      if (aLodSize < 0.0)
+      {
+        aLodSize = lodSize(theWorkspace);
+      }
+      if (!aGroup->IsInLodRange(aLodSize))
+      {
+        continue;
+      }
+    }
 
     const gp_Trsf& aTrsf = aGroup->Transformation();
     if (aTrsf.Form() != gp_Identity)
@@ -403,6 +424,48 @@ void OpenGl_Structure::renderGeometry(const occ::handle<OpenGl_Workspace>& theWo
 
 //=================================================================================================
 
+double OpenGl_Structure::lodSize(const occ::handle<OpenGl_Workspace>& theWorkspace) const
+{
+  // the finest level is used for structures with transformation persistence
+  if (!myTrsfPers.IsNull() || theWorkspace->View() == nullptr)
+  {
+    return RealLast();
+  }
+
+  // groups define bounds in local coordinates, which are transformed by the current model-world
+  // matrix (relative to the origin of Z-layer); this is the transformation of the structure
+  // being rendered, which differs from this one for instanced structure
+  Graphic3d_BndBox4f aLocalBox;
+  for (OpenGl_Structure::GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
+  {
+    aLocalBox.Combine(aGroupIter.Value()->BoundingBox());
+  }
+  if (!aLocalBox.IsValid())
+  {
+    return RealLast();
+  }
+
+  // rotation keeps the size of the box, while scale is taken along the most stretched axis
+  const NCollection_Mat4<float>& aModelWorld =
+    theWorkspace->GetGlContext()->ModelWorldState.Current();
+  const NCollection_Vec3<float> aLocalCenter =
+    (aLocalBox.CornerMin().xyz() + aLocalBox.CornerMax().xyz()) * 0.5f;
+  const NCollection_Vec4<float> aCenter = aModelWorld * NCollection_Vec4<float>(aLocalCenter, 1.0f);
+  const float                   aScale  = std::max(aModelWorld.GetColumn(0).xyz().Modulus(),
+                                     std::max(aModelWorld.GetColumn(1).xyz().Modulus(),
+                                              aModelWorld.GetColumn(2).xyz().Modulus()));
+  const NCollection_Vec3<double> aHalfDiag(
+    (aLocalBox.CornerMax().xyz() - aLocalBox.CornerMin().xyz()) * (0.5f * aScale));
+  const gp_XYZ& anOrigin = theWorkspace->GetGlContext()->ShaderManager()->LocalOrigin();
+  const NCollection_Vec3<double> aWorldCenter =
+    NCollection_Vec3<double>(aCenter.xyz())
+    + NCollection_Vec3<double>(anOrigin.X(), anOrigin.Y(), anOrigin.Z());
+  return theWorkspace->View()->BVHTreeSelector().ProjectedSize(aWorldCenter - aHalfDiag,
+                                                               aWorldCenter + aHalfDiag);
+}
+
+//=================================================================================================
+
 void OpenGl_Structure::applyTransformation(const occ::handle<OpenGl_Context>& theContext,
                                            const gp_Trsf&                     theTrsf,
                                            const bool                         toEnable) const
@@ -652,6 +715,56 @@ void OpenGl_Structure::ReleaseGlResources(const occ::handle<OpenGl_Context>& the
 
 //=================================================================================================
 
+size_t OpenGl_Structure::EstimatedDataSize() const
+{
+  size_t aSize = 0;
+  for (OpenGl_Structure::GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
+  {
+    for (const OpenGl_ElementNode* aNode = aGroupIter.Value()->FirstNode(); aNode != nullptr;
+         aNode                           = aNode->next)
+    {
+      aSize += aNode->elem->EstimatedDataSize();
+    }
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
+size_t OpenGl_Structure::EvictGpuBuffers(const occ::handle<OpenGl_Context>& theGlCtx)
+{
+  size_t aSize = 0;
+  for (OpenGl_Structure::GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
+  {
+    for (const OpenGl_ElementNode* aNode = aGroupIter.Value()->FirstNode(); aNode != nullptr;
+         aNode                           = aNode->next)
+    {
+      aSize += aNode->elem->EvictGpuBuffers(theGlCtx.get());
+    }
+  }
+  if (aSize != 0)
+  {
+    myIsEvicted = true;
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
+void OpenGl_Structure::ReleaseCpuData(const occ::handle<OpenGl_Context>& theGlCtx)
+{
+  for (OpenGl_Structure::GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
+  {
+    for (const OpenGl_ElementNode* aNode = aGroupIter.Value()->FirstNode(); aNode != nullptr;
+         aNode                           = aNode->next)
+    {
+      aNode->elem->ReleaseCpuData(theGlCtx.get());
+    }
+  }
+}
+
+//=================================================================================================
+
 occ::handle<Graphic3d_CStructure> OpenGl_Structure::ShadowLink(
   const occ::handle<Graphic3d_StructureManager>& theManager) const
 {
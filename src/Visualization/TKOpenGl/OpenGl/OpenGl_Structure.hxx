@@ -107,6 +107,24 @@ public:
   //! Returns instanced OpenGL structure.
   const OpenGl_Structure* InstancedStructure() const { return myInstancedStructure; }
 
+public: //! @name GPU memory management
+  //! Returns the frame stamp (see OpenGl_GraphicDriver::FrameStamp()),
+  //! at which geometry of the structure has been rendered for the last time.
+  size_t RenderStamp() const { return myRenderStamp; }
+
+  //! Returns estimated GPU memory used by elements of the structure.
+  Standard_EXPORT size_t EstimatedDataSize() const;
+
+  //! Releases GPU buffers of the structure, which will be uploaded again on the next rendering
+  //! (see OpenGl_Element::EvictGpuBuffers()).
+  //! @return estimated size of released buffers
+  Standard_EXPORT size_t EvictGpuBuffers(const occ::handle<OpenGl_Context>& theGlCtx);
+
+  //! Releases CPU copies of data already uploaded into GPU buffers
+  //! (see OpenGl_Element::ReleaseCpuData()), so that buffers will be kept in GPU memory.
+  Standard_EXPORT void ReleaseCpuData(const occ::handle<OpenGl_Context>& theGlCtx);
+
+public:
   //! Returns structure modification state (for ray-tracing).
   size_t ModificationState() const { return myModificationState; }
 
@@ -135,6 +153,10 @@ protected:
   Standard_EXPORT void renderGeometry(const occ::handle<OpenGl_Workspace>& theWorkspace,
                                       bool&                                theHasClosed) const;
 
+  //! Returns the projected size of the structure (in pixels) used to select groups
+  //! within level-of-detail range; bounds of groups are transformed by current model-world matrix.
+  Standard_EXPORT double lodSize(const occ::handle<OpenGl_Workspace>& theWorkspace) const;
+
   //! Render the bounding box.
   Standard_EXPORT void renderBoundingBox(const occ::handle<OpenGl_Workspace>& theWorkspace) const;
 
@@ -181,6 +203,8 @@ protected:
 
   bool           myIsMirrored; //!< Used to tell OpenGl to interpret polygons in clockwise order.
   // clang-format on
+  mutable size_t myRenderStamp; //!< frame stamp of the last rendering
+  mutable bool   myIsEvicted;   //!< flag indicating that GPU buffers have been evicted
 };
 
 #endif // OpenGl_Structure_Header
@@ -32,6 +32,7 @@
 #include <OpenGl_Context.hxx>
 #include <OpenGl_DepthPeeling.hxx>
 #include <OpenGl_FrameBuffer.hxx>
+#include <OpenGl_FrameStats.hxx>
 #include <OpenGl_GlCore11.hxx>
 #include <OpenGl_GlCore32.hxx>
 #include <OpenGl_GraduatedTrihedron.hxx>
@@ -131,6 +132,7 @@ OpenGl_View::OpenGl_View(const occ::handle<Graphic3d_StructureManager>& theMgr,
       myToFlipOutput(false),
       //
       myFrameCounter(0),
+      myFrameStamp(0),
       myHasFboBlit(true),
       myToDisableOIT(false),
       myToDisableOITMSAA(false),
@@ -1084,6 +1086,17 @@ TCollection_AsciiString OpenGl_View::StatisticInformation() const
 
 //=================================================================================================
 
+occ::handle<Graphic3d_FrameStats> OpenGl_View::FrameStats() const
+{
+  if (const occ::handle<OpenGl_Context>& aCtx = myWorkspace->GetGlContext())
+  {
+    return occ::handle<Graphic3d_FrameStats>(aCtx->FrameStats().get());
+  }
+  return occ::handle<Graphic3d_FrameStats>();
+}
+
+//=================================================================================================
+
 void OpenGl_View::drawBackground(const occ::handle<OpenGl_Workspace>& theWorkspace,
                                  Graphic3d_Camera::Projection         theProjection)
 {
@@ -1740,6 +1753,8 @@ void OpenGl_View::Redraw()
   myWindow->SetSwapInterval(IsActiveXR());
 
   ++myFrameCounter;
+  myDriver->NextFrameStamp();
+  myFrameStamp = myDriver->FrameStamp();
   const occ::handle<OpenGl_Context>& aCtx = myWorkspace->GetGlContext();
   aCtx->FrameStats()->FrameStart(myWorkspace->View(), false);
   aCtx->SetLineFeather(myRenderParams.LineFeather);
@@ -2021,6 +2036,12 @@ void OpenGl_View::Redraw()
     aCtx->core11fwd->glFlush();
   }
 
+  // release buffers of least recently drawn structures exceeding memory budget
+  if (myCaps->vboMemoryBudget != 0)
+  {
+    myDriver->EvictGpuBuffers(aCtx);
+  }
+
   // reset render mode state
   aCtx->FetchState();
   aCtx->FrameStats()->FrameEnd(myWorkspace->View(), false);
@@ -299,6 +299,9 @@ public:
     NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>& theDict)
     const override;
 
+  //! Returns frame statistics of the OpenGL context.
+  Standard_EXPORT occ::handle<Graphic3d_FrameStats> FrameStats() const override;
+
 public:
   //! Returns background color.
   const Quantity_ColorRGBA& BackgroundColor() const { return myBgColor; }
@@ -545,6 +548,7 @@ protected: //! @name Rendering properties
   OpenGl_VertexBuffer        myFullScreenQuadFlip;
   bool           myToFlipOutput;          //!< Flag to draw result image upside-down
   unsigned int               myFrameCounter;          //!< redraw counter, for debugging
+  size_t                     myFrameStamp;            //!< driver frame stamp of the last redraw (see OpenGl_GraphicDriver::FrameStamp())
   bool           myHasFboBlit;            //!< disable FBOs on failure
   bool           myToDisableOIT;          //!< disable OIT on failure
   bool           myToDisableOITMSAA;      //!< disable OIT with MSAA on failure
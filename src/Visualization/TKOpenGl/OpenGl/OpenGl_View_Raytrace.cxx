@@ -517,6 +517,12 @@ bool OpenGl_View::addRaytraceGroups(const OpenGl_Structure*            theStruct
   for (OpenGl_Structure::GroupIterator aGroupIter(theStructure->Groups()); aGroupIter.More();
        aGroupIter.Next())
   {
+    // only the finest level of detail is ray-traced
+    if (aGroupIter.Value()->LodRange().y() < RealLast())
+    {
+      continue;
+    }
+
     // Get group material
     OpenGl_RaytraceMaterial aGroupMaterial;
     if (aGroupIter.Value()->GlAspects() != nullptr)
@@ -6,7 +6,9 @@ set(OCCT_TKService_GTests_FILES
   Aspect_Grid_Bounds_Test.cxx
   Graphic3d_Aspects_Test.cxx
   Graphic3d_BndBox_Test.cxx
+  Graphic3d_CullingTool_Test.cxx
   Graphic3d_Flipper_Test.cxx
+  Graphic3d_InstanceBuffer_Test.cxx
   Graphic3d_ShaderManager_Test.cxx
   Image_VideoRecorder_Test.cxx
 )
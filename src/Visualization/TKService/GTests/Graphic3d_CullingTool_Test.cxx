@@ -0,0 +1,71 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+#include <Graphic3d_Camera.hxx>
+#include <Graphic3d_CullingTool.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(Graphic3d_CullingToolTest, ProjectedSize_Orthographic)
+{
+  occ::handle<Graphic3d_Camera> aCamera = new Graphic3d_Camera();
+  aCamera->SetProjectionType(Graphic3d_Camera::Projection_Orthographic);
+  aCamera->SetEye(gp_Pnt(0.0, 0.0, 100.0));
+  aCamera->SetCenter(gp_Pnt(0.0, 0.0, 0.0));
+  aCamera->SetUp(gp_Dir(0.0, 1.0, 0.0));
+  aCamera->SetScale(100.0);
+  aCamera->SetAspect(1.0);
+
+  // 100 world units are mapped onto 100 pixels
+  Graphic3d_CullingTool aTool;
+  aTool.SetViewVolume(aCamera);
+  aTool.SetViewportSize(100, 100, 1.0);
+
+  const NCollection_Vec3<double> aMin(0.0, 0.0, 0.0), aMax(30.0, 40.0, 0.0);
+  EXPECT_NEAR(aTool.ProjectedSize(aMin, aMax), 50.0, 1.0e-6);
+
+  // projected size does not depend on distance for orthographic camera
+  const NCollection_Vec3<double> aShift(0.0, 0.0, -500.0);
+  EXPECT_NEAR(aTool.ProjectedSize(aMin + aShift, aMax + aShift), 50.0, 1.0e-6);
+
+  aCamera->SetScale(200.0);
+  aTool.SetViewVolume(aCamera);
+  EXPECT_NEAR(aTool.ProjectedSize(aMin, aMax), 25.0, 1.0e-6);
+}
+
+TEST(Graphic3d_CullingToolTest, ProjectedSize_Perspective)
+{
+  occ::handle<Graphic3d_Camera> aCamera = new Graphic3d_Camera();
+  aCamera->SetProjectionType(Graphic3d_Camera::Projection_Perspective);
+  aCamera->SetEye(gp_Pnt(0.0, 0.0, 100.0));
+  aCamera->SetCenter(gp_Pnt(0.0, 0.0, 0.0));
+  aCamera->SetUp(gp_Dir(0.0, 1.0, 0.0));
+  aCamera->SetAspect(1.0);
+
+  Graphic3d_CullingTool aTool;
+  aTool.SetViewVolume(aCamera);
+  aTool.SetViewportSize(100, 100, 1.0);
+
+  // the farther the box, the smaller its projection
+  const NCollection_Vec3<double> aMin(-5.0, -5.0, -5.0), aMax(5.0, 5.0, 5.0);
+  const NCollection_Vec3<double> aShift(0.0, 0.0, -100.0);
+  const double                   aNearSize = aTool.ProjectedSize(aMin, aMax);
+  const double                   aFarSize  = aTool.ProjectedSize(aMin + aShift, aMax + aShift);
+  EXPECT_GT(aNearSize, 0.0);
+  EXPECT_NEAR(aFarSize, aNearSize * 0.5, 1.0e-6);
+
+  // box behind the eye
+  const NCollection_Vec3<double> aBehind(0.0, 0.0, 200.0);
+  EXPECT_EQ(aTool.ProjectedSize(aMin + aBehind, aMax + aBehind), RealLast());
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+#include <Graphic3d_InstanceBuffer.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(Graphic3d_InstanceBufferTest, AddInstances)
+{
+  occ::handle<Graphic3d_InstanceBuffer> anInstances = new Graphic3d_InstanceBuffer();
+  EXPECT_TRUE(anInstances->IsEmpty());
+  EXPECT_FALSE(anInstances->HasColors());
+
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+  EXPECT_EQ(anInstances->AddInstance(gp_Trsf()), 1);
+  EXPECT_EQ(anInstances->AddInstance(aTrsf), 2);
+  EXPECT_EQ(anInstances->NbInstances(), 2);
+
+  const NCollection_Mat4<float>& aMat = anInstances->Matrix(2);
+  EXPECT_FLOAT_EQ(aMat.GetValue(0, 3), 10.0f);
+  EXPECT_FLOAT_EQ(aMat.GetValue(1, 3), 0.0f);
+  EXPECT_FLOAT_EQ(aMat.GetValue(0, 0), 1.0f);
+
+  aTrsf.SetTranslation(gp_Vec(0.0, 5.0, 0.0));
+  anInstances->SetTransformation(1, aTrsf);
+  EXPECT_FLOAT_EQ(anInstances->Matrix(1).GetValue(1, 3), 5.0f);
+
+  anInstances->Clear();
+  EXPECT_TRUE(anInstances->IsEmpty());
+}
+
+TEST(Graphic3d_InstanceBufferTest, Colors)
+{
+  occ::handle<Graphic3d_InstanceBuffer> anInstances = new Graphic3d_InstanceBuffer(true);
+  EXPECT_TRUE(anInstances->HasColors());
+
+  anInstances->AddInstance(gp_Trsf(), Quantity_ColorRGBA(Quantity_NOC_RED));
+  anInstances->AddInstance(gp_Trsf(), Quantity_ColorRGBA(Quantity_NOC_GREEN));
+  EXPECT_TRUE(anInstances->Color(1).GetRGB().IsEqual(Quantity_NOC_RED));
+  EXPECT_TRUE(anInstances->Color(2).GetRGB().IsEqual(Quantity_NOC_GREEN));
+
+  anInstances->SetColor(2, Quantity_ColorRGBA(Quantity_NOC_BLUE));
+  EXPECT_TRUE(anInstances->Color(2).GetRGB().IsEqual(Quantity_NOC_BLUE));
+}
+
+TEST(Graphic3d_InstanceBufferTest, InstancesBox)
+{
+  occ::handle<Graphic3d_InstanceBuffer> anInstances = new Graphic3d_InstanceBuffer();
+  const Graphic3d_BndBox4f anArrayBox(NCollection_Vec4<float>(0.0f, 0.0f, 0.0f, 1.0f),
+                                      NCollection_Vec4<float>(1.0f, 1.0f, 1.0f, 1.0f));
+  EXPECT_FALSE(anInstances->InstancesBox(anArrayBox).IsValid());
+
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+  anInstances->AddInstance(gp_Trsf());
+  anInstances->AddInstance(aTrsf);
+
+  gp_Trsf aRot;
+  aRot.SetRotation(gp_Ax1(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, 0.0, 1.0)), M_PI);
+  anInstances->AddInstance(aRot);
+
+  const Graphic3d_BndBox4f aBox = anInstances->InstancesBox(anArrayBox);
+  ASSERT_TRUE(aBox.IsValid());
+  EXPECT_NEAR(aBox.CornerMin().x(), -1.0f, 1.0e-5f);
+  EXPECT_NEAR(aBox.CornerMin().y(), -1.0f, 1.0e-5f);
+  EXPECT_NEAR(aBox.CornerMin().z(), 0.0f, 1.0e-5f);
+  EXPECT_NEAR(aBox.CornerMax().x(), 11.0f, 1.0e-5f);
+  EXPECT_NEAR(aBox.CornerMax().y(), 1.0f, 1.0e-5f);
+  EXPECT_NEAR(aBox.CornerMax().z(), 1.0f, 1.0e-5f);
+}
@@ -92,6 +92,8 @@ set(OCCT_Graphic3d_FILES
   Graphic3d_PresentationAttributes.cxx
   Graphic3d_HorizontalTextAlignment.hxx
   Graphic3d_IndexBuffer.hxx
+  Graphic3d_InstanceBuffer.cxx
+  Graphic3d_InstanceBuffer.hxx
   Graphic3d_MutableIndexBuffer.hxx
   Graphic3d_LevelOfTextureAnisotropy.hxx
   Graphic3d_LightSet.cxx
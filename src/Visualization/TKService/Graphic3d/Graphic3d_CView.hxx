@@ -23,6 +23,7 @@
 #include <Graphic3d_CubeMap.hxx>
 #include <Graphic3d_DataStructureManager.hxx>
 #include <Graphic3d_DiagnosticInfo.hxx>
+#include <Graphic3d_FrameStats.hxx>
 #include <Graphic3d_GraduatedTrihedron.hxx>
 #include <Graphic3d_Vertex.hxx>
 #include <Standard_Transient.hxx>
@@ -537,6 +538,12 @@ public:
     NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>& theDict)
     const = 0;
 
+  //! Returns frame statistics collected by the view or NULL if not supported.
+  virtual occ::handle<Graphic3d_FrameStats> FrameStats() const
+  {
+    return occ::handle<Graphic3d_FrameStats>();
+  }
+
 public:
   //! Return unit scale factor defined as scale factor for m (meters); 1.0 by default.
   //! Normally, view definition is unitless, however some operations like VR input requires proper
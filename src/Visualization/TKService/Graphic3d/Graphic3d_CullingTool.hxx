@@ -41,6 +41,38 @@ public:
     }
   };
 
+  //! Auxiliary structure accumulating culling efficiency counters.
+  //! Counters refer to tested BVH nodes, not to structures: a culled inner node
+  //! discards the whole subtree, while a structure within a visible node is not tested at all.
+  struct CullingStats
+  {
+    size_t NbTests;      //!< number of tested BVH nodes
+    size_t NbOutFrustum; //!< number of BVH nodes culled by view frustum
+    size_t NbTooDistant; //!< number of BVH nodes culled by distance
+    size_t NbTooSmall;   //!< number of BVH nodes culled by size
+
+    //! Empty constructor.
+    CullingStats() { Reset(); }
+
+    //! Resets counters.
+    void Reset()
+    {
+      NbTests      = 0;
+      NbOutFrustum = 0;
+      NbTooDistant = 0;
+      NbTooSmall   = 0;
+    }
+
+    //! Appends counters of another instance.
+    void Add(const CullingStats& theOther)
+    {
+      NbTests += theOther.NbTests;
+      NbOutFrustum += theOther.NbOutFrustum;
+      NbTooDistant += theOther.NbTooDistant;
+      NbTooSmall += theOther.NbTooSmall;
+    }
+  };
+
   //! Auxiliary structure representing 3D plane.
   struct Plane
   {
@@ -242,6 +274,47 @@ public:
     return false;
   }
 
+  //! Same as IsCulled(), but also accumulates the culling efficiency counters.
+  bool IsCulled(const CullingContext&           theCtx,
+                const NCollection_Vec3<double>& theMinPnt,
+                const NCollection_Vec3<double>& theMaxPnt,
+                bool*                           theIsInside,
+                CullingStats&                   theStats) const
+  {
+    ++theStats.NbTests;
+    if (IsOutFrustum(theMinPnt, theMaxPnt, theIsInside))
+    {
+      ++theStats.NbOutFrustum;
+      return true;
+    }
+    else if (IsTooDistant(theCtx, theMinPnt, theMaxPnt, theIsInside))
+    {
+      ++theStats.NbTooDistant;
+      return true;
+    }
+    else if (IsTooSmall(theCtx, theMinPnt, theMaxPnt))
+    {
+      ++theStats.NbTooSmall;
+      return true;
+    }
+    return false;
+  }
+
+  //! Same as IsTooSmall(), but also accumulates the culling efficiency counters.
+  bool IsTooSmall(const CullingContext&           theCtx,
+                  const NCollection_Vec3<double>& theMinPnt,
+                  const NCollection_Vec3<double>& theMaxPnt,
+                  CullingStats&                   theStats) const
+  {
+    ++theStats.NbTests;
+    if (IsTooSmall(theCtx, theMinPnt, theMaxPnt))
+    {
+      ++theStats.NbTooSmall;
+      return true;
+    }
+    return false;
+  }
+
   //! Returns TRUE if given AABB should be discarded by size culling criterion.
   bool IsTooSmall(const CullingContext&           theCtx,
                   const NCollection_Vec3<double>& theMinPnt,
@@ -265,6 +338,27 @@ public:
     return aBoxDiag2 < theCtx.SizeCull2 * aBndDist * aBndDist;
   }
 
+  //! Returns the projected size (in pixels) of the diagonal of given AABB;
+  //! RealLast() is returned for AABB placed behind the camera eye.
+  //! Can be used to select the level of detail of the presentation.
+  double ProjectedSize(const NCollection_Vec3<double>& theMinPnt,
+                       const NCollection_Vec3<double>& theMaxPnt) const
+  {
+    const double aBoxDiag  = (theMaxPnt - theMinPnt).Modulus();
+    double       aPixelLen = myPixelSize * myCamScale;
+    if (!myIsProjectionParallel)
+    {
+      const NCollection_Vec3<double> aBndCenter = (theMinPnt + theMaxPnt) * 0.5;
+      const double                   aBndDist   = (aBndCenter - myCamEye).Dot(myCamDir);
+      if (aBndDist <= 0.0)
+      {
+        return RealLast();
+      }
+      aPixelLen *= aBndDist;
+    }
+    return aPixelLen > 0.0 ? aBoxDiag / aPixelLen : RealLast();
+  }
+
 protected:
   //! Enumerates planes of view volume.
   enum
@@ -15,6 +15,8 @@
 
 #include <Graphic3d_CView.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_FrameStats, Standard_Transient)
 
 namespace
@@ -174,6 +176,88 @@ static std::ostream& formatTime(std::ostream& theStream,
   return theStream;
 }
 
+//! Return the counter name for the frame capture.
+static const char* counterName(const int theCounter)
+{
+  static const char* THE_NAMES[Graphic3d_FrameStatsCounter_NB] = {
+    "NbLayers",
+    "NbStructs",
+    "EstimatedBytesGeom",
+    "EstimatedBytesFbos",
+    "EstimatedBytesTextures",
+    "NbLayersNotCulled",
+    "NbStructsNotCulled",
+    "NbGroupsNotCulled",
+    "NbElemsNotCulled",
+    "NbElemsFillNotCulled",
+    "NbElemsLineNotCulled",
+    "NbElemsPointNotCulled",
+    "NbElemsTextNotCulled",
+    "NbTrianglesNotCulled",
+    "NbLinesNotCulled",
+    "NbPointsNotCulled",
+    "NbLayersImmediate",
+    "NbStructsImmediate",
+    "NbGroupsImmediate",
+    "NbElemsImmediate",
+    "NbElemsFillImmediate",
+    "NbElemsLineImmediate",
+    "NbElemsPointImmediate",
+    "NbElemsTextImmediate",
+    "NbTrianglesImmediate",
+    "NbLinesImmediate",
+    "NbPointsImmediate",
+    "NbCullingTests",
+    "NbCulledFrustum",
+    "NbCulledDistance",
+    "NbCulledSize"};
+  return THE_NAMES[theCounter];
+}
+
+//! Return the timer name for the frame capture.
+static const char* timerName(const int theTimer)
+{
+  static const char* THE_NAMES[Graphic3d_FrameStatsTimer_NB] =
+    {"ElapsedFrame", "CpuFrame", "CpuCulling", "CpuPicking", "CpuDynamics"};
+  return THE_NAMES[theTimer];
+}
+
+//! Return indexes of items sorted by descending duration.
+static NCollection_Array1<int> sortedTimings(
+  const NCollection_DynamicArray<Graphic3d_FrameStats::ItemTiming>& theTimings)
+{
+  NCollection_Array1<int> anIndexes(0, std::max((int)theTimings.Size(), 1) - 1);
+  for (int anIter = 0; anIter < (int)theTimings.Size(); ++anIter)
+  {
+    anIndexes.SetValue(anIter, anIter);
+  }
+  if (!theTimings.IsEmpty())
+  {
+    std::stable_sort(anIndexes.begin(),
+                     anIndexes.end(),
+                     [&](const int theLeft, const int theRight) {
+                       return theTimings.Value(theLeft).Duration()
+                              > theTimings.Value(theRight).Duration();
+                     });
+  }
+  return anIndexes;
+}
+
+//! Write the list of timings into the stream in JSON format.
+static void dumpTimings(Standard_OStream&                                                 theStream,
+                        const NCollection_DynamicArray<Graphic3d_FrameStats::ItemTiming>& theList)
+{
+  theStream << "[";
+  for (int anIter = 0; anIter < (int)theList.Size(); ++anIter)
+  {
+    const Graphic3d_FrameStats::ItemTiming& anItem = theList.Value(anIter);
+    theStream << (anIter != 0 ? ",\n    " : "\n    ") << "{\"Id\": " << anItem.Id
+              << ", \"LayerId\": " << anItem.LayerId << ", \"CpuTime\": " << anItem.CpuTime
+              << ", \"GpuTime\": " << anItem.GpuTime << "}";
+  }
+  theStream << (theList.IsEmpty() ? "]" : "\n  ]");
+}
+
 //! Add key-value pair to the dictionary.
 static void addInfo(
   NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>& theDict,
@@ -480,6 +564,47 @@ TCollection_AsciiString Graphic3d_FrameStats::FormatStats(
                 "\n");
   }
 
+  if ((theFlags & Graphic3d_RenderingParams::PerfCounters_Culling) != 0)
+  {
+    aBuf << "Culling [BVH nodes]\n";
+    formatCounter(aBuf,
+                  aValWidth,
+                  "     Tests: ",
+                  aStats[Graphic3d_FrameStatsCounter_NbCullingTests],
+                  "\n");
+    formatCounter(aBuf,
+                  aValWidth,
+                  "   Frustum: ",
+                  aStats[Graphic3d_FrameStatsCounter_NbCulledFrustum],
+                  "\n");
+    formatCounter(aBuf,
+                  aValWidth,
+                  "  Distance: ",
+                  aStats[Graphic3d_FrameStatsCounter_NbCulledDistance],
+                  "\n");
+    formatCounter(aBuf,
+                  aValWidth,
+                  "      Size: ",
+                  aStats[Graphic3d_FrameStatsCounter_NbCulledSize],
+                  "\n");
+  }
+  if ((theFlags & Graphic3d_RenderingParams::PerfCounters_ItemTimers) != 0
+      && !myStructTimings.IsEmpty())
+  {
+    aBuf << "Slowest Structs\n";
+    const NCollection_Array1<int> aSorted = sortedTimings(myStructTimings);
+    for (int anIter = 0; anIter < std::min(3, (int)myStructTimings.Size()); ++anIter)
+    {
+      const ItemTiming& anItem = myStructTimings.Value(aSorted.Value(anIter));
+      aBuf << std::setfill(' ') << std::setw(8) << anItem.Id << ": ";
+      formatTime(aBuf, aValWidth, "", anItem.CpuTime, anItem.GpuTime >= 0.0 ? " / " : "\n");
+      if (anItem.GpuTime >= 0.0)
+      {
+        formatTime(aBuf, aValWidth, "", anItem.GpuTime, " GPU\n");
+      }
+    }
+  }
+
   if ((theFlags & Graphic3d_RenderingParams::PerfCounters_FrameTime) != 0)
   {
     aBuf << "Timers Average\n";
@@ -631,6 +756,29 @@ void Graphic3d_FrameStats::FormatStats(
     addInfo(theDict, "GPU Memory [frames]", aStats[Graphic3d_FrameStatsCounter_EstimatedBytesFbos]);
   }
 
+  if ((theFlags & Graphic3d_RenderingParams::PerfCounters_Culling) != 0)
+  {
+    addInfo(theDict, "Culling tests", aStats[Graphic3d_FrameStatsCounter_NbCullingTests]);
+    addInfo(theDict, "Culled [frustum]", aStats[Graphic3d_FrameStatsCounter_NbCulledFrustum]);
+    addInfo(theDict, "Culled [distance]", aStats[Graphic3d_FrameStatsCounter_NbCulledDistance]);
+    addInfo(theDict, "Culled [size]", aStats[Graphic3d_FrameStatsCounter_NbCulledSize]);
+  }
+  if ((theFlags & Graphic3d_RenderingParams::PerfCounters_ItemTimers) != 0)
+  {
+    const NCollection_Array1<int> aSorted = sortedTimings(myStructTimings);
+    for (int anIter = 0; anIter < std::min(3, (int)myStructTimings.Size()); ++anIter)
+    {
+      const ItemTiming&       anItem = myStructTimings.Value(aSorted.Value(anIter));
+      TCollection_AsciiString aKey   = TCollection_AsciiString("Slowest struct #") + (anIter + 1);
+      addInfo(theDict, aKey + " [id]", (size_t)anItem.Id);
+      addTimeInfo(theDict, aKey + " [CPU]", anItem.CpuTime);
+      if (anItem.GpuTime >= 0.0)
+      {
+        addTimeInfo(theDict, aKey + " [GPU]", anItem.GpuTime);
+      }
+    }
+  }
+
   if ((theFlags & Graphic3d_RenderingParams::PerfCounters_FrameTime) != 0)
   {
     addTimeInfo(theDict, "Elapsed Frame (average)", aStats[Graphic3d_FrameStatsTimer_ElapsedFrame]);
@@ -685,6 +833,9 @@ void Graphic3d_FrameStats::FrameStart(const occ::handle<Graphic3d_CView>& theVie
     return;
   }
 
+  myLayerTimingsTmp.Clear();
+  myStructTimingsTmp.Clear();
+
   const int aNbFrames =
     std::max(!theView.IsNull() ? theView->RenderingParams().StatsNbFrames : 1, 1);
   if (myCounters.Length() != aNbFrames)
@@ -720,6 +871,15 @@ void Graphic3d_FrameStats::FrameEnd(const occ::handle<Graphic3d_CView>& theView,
     return;
   }
 
+  if (!theIsImmediateOnly)
+  {
+    // keep timings of the last frame redrawing entire view content
+    myLayerTimings  = myLayerTimingsTmp;
+    myStructTimings = myStructTimingsTmp;
+  }
+  myLayerTimingsTmp.Clear();
+  myStructTimingsTmp.Clear();
+
   const double aTime = myFpsTimer.ElapsedTime();
   myFrameDuration    = aTime - myFrameStartTime;
   ++myFpsFrameCount;
@@ -808,7 +968,42 @@ void Graphic3d_FrameStats::FrameEnd(const occ::handle<Graphic3d_CView>& theView,
     }
     myCountersTmp.ChangeCounterValue(Graphic3d_FrameStatsCounter_EstimatedBytesGeom) =
       aPrevFrame.CounterValue(Graphic3d_FrameStatsCounter_EstimatedBytesGeom);
+
+    // copy culling counters from previous non-immediate frame
+    for (int aCntIter = Graphic3d_FrameStatsCounter_CULLING_LOWER;
+         aCntIter <= Graphic3d_FrameStatsCounter_CULLING_UPPER;
+         ++aCntIter)
+    {
+      myCountersTmp.ChangeCounterValue((Graphic3d_FrameStatsCounter)aCntIter) =
+        aPrevFrame.CounterValue((Graphic3d_FrameStatsCounter)aCntIter);
+    }
   }
   myCounters.SetValue(myLastFrameIndex, myCountersTmp);
   myCountersTmp.Reset();
 }
+
+//=================================================================================================
+
+void Graphic3d_FrameStats::DumpFrameCapture(Standard_OStream& theStream) const
+{
+  const Graphic3d_FrameStatsData& aStats = LastDataFrame();
+  theStream << "{\n  \"FrameDuration\": " << myFrameDuration
+            << ",\n  \"FrameRate\": " << aStats.FrameRate()
+            << ",\n  \"FrameRateCpu\": " << aStats.FrameRateCpu() << ",\n  \"Counters\": {";
+  for (int aCntIter = 0; aCntIter < Graphic3d_FrameStatsCounter_NB; ++aCntIter)
+  {
+    theStream << (aCntIter != 0 ? ", " : "") << "\"" << counterName(aCntIter)
+              << "\": " << aStats.CounterValue((Graphic3d_FrameStatsCounter)aCntIter);
+  }
+  theStream << "},\n  \"Timers\": {";
+  for (int aTimerIter = 0; aTimerIter < Graphic3d_FrameStatsTimer_NB; ++aTimerIter)
+  {
+    theStream << (aTimerIter != 0 ? ", " : "") << "\"" << timerName(aTimerIter)
+              << "\": " << aStats.TimerValue((Graphic3d_FrameStatsTimer)aTimerIter);
+  }
+  theStream << "},\n  \"Layers\": ";
+  dumpTimings(theStream, myLayerTimings);
+  theStream << ",\n  \"Structures\": ";
+  dumpTimings(theStream, myStructTimings);
+  theStream << "\n}\n";
+}
@@ -16,6 +16,8 @@
 
 #include <Graphic3d_FrameStatsData.hxx>
 #include <Graphic3d_RenderingParams.hxx>
+#include <Graphic3d_ZLayerId.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <Standard_Type.hxx>
 #include <Standard_Transient.hxx>
 #include <TCollection_AsciiString.hxx>
@@ -27,6 +29,27 @@ class Graphic3d_CView;
 class Graphic3d_FrameStats : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Graphic3d_FrameStats, Standard_Transient)
+public:
+  //! Rendering time of a layer or a structure within the frame.
+  struct ItemTiming
+  {
+    int    Id;      //!< structure identification (Graphic3d_CStructure::Identification()) or layer
+    int    LayerId; //!< Z-layer of the item
+    double CpuTime; //!< CPU time spent on submitting rendering commands, in seconds
+    double GpuTime; //!< GPU time spent on executing rendering commands, in seconds; -1 if unknown
+
+    ItemTiming()
+        : Id(-1),
+          LayerId(Graphic3d_ZLayerId_UNKNOWN),
+          CpuTime(0.0),
+          GpuTime(-1.0)
+    {
+    }
+
+    //! Returns the maximum of CPU and GPU times.
+    double Duration() const { return CpuTime > GpuTime ? CpuTime : GpuTime; }
+  };
+
 public:
   //! Default constructor.
   Standard_EXPORT Graphic3d_FrameStats();
@@ -122,6 +145,21 @@ public:
   //! Returns data frames.
   NCollection_Array1<Graphic3d_FrameStatsData>& ChangeDataFrames() { return myCounters; }
 
+  //! Returns rendering times of layers within the last rendered frame,
+  //! one item per layer rendering pass (e.g. shadow map, main and transparency passes).
+  //! Filled only when Graphic3d_RenderingParams::PerfCounters_ItemTimers is set.
+  const NCollection_DynamicArray<ItemTiming>& LayerTimings() const { return myLayerTimings; }
+
+  //! Returns rendering times of structures within the last rendered frame,
+  //! one item per structure rendering pass.
+  //! Filled only when Graphic3d_RenderingParams::PerfCounters_ItemTimers is set.
+  const NCollection_DynamicArray<ItemTiming>& StructureTimings() const { return myStructTimings; }
+
+  //! Writes the capture of the last frame into the stream in JSON format:
+  //! counters and timers of the last data frame, layer and structure timings.
+  //! Should NOT be called between ::FrameStart() and ::FrameEnd() calls.
+  Standard_EXPORT virtual void DumpFrameCapture(Standard_OStream& theStream) const;
+
 public:
   //! Returns value of specified counter for modification, should be called between ::FrameStart()
   //! and ::FrameEnd() calls.
@@ -138,6 +176,17 @@ public:
   //! and ::FrameEnd() calls.
   Graphic3d_FrameStatsDataTmp& ActiveDataFrame() { return myCountersTmp; }
 
+  //! Returns layer timings for modification, should be called between ::FrameStart()
+  //! and ::FrameEnd() calls.
+  NCollection_DynamicArray<ItemTiming>& ChangeActiveLayerTimings() { return myLayerTimingsTmp; }
+
+  //! Returns structure timings for modification, should be called between ::FrameStart()
+  //! and ::FrameEnd() calls.
+  NCollection_DynamicArray<ItemTiming>& ChangeActiveStructureTimings()
+  {
+    return myStructTimingsTmp;
+  }
+
 protected:
   //! Method to collect statistics from the View; called by FrameEnd().
   virtual void updateStatistics(const occ::handle<Graphic3d_CView>& theView,
@@ -156,6 +205,10 @@ protected:
   int myLastFrameIndex;          //!< last data frame index
   bool myIsLongLineFormat;        //!< prefer longer lines over greater number of lines
   // clang-format on
+  NCollection_DynamicArray<ItemTiming> myLayerTimings;     //!< layer timings of the last frame
+  NCollection_DynamicArray<ItemTiming> myStructTimings;    //!< structure timings of the last frame
+  NCollection_DynamicArray<ItemTiming> myLayerTimingsTmp;  //!< layer timings being filled
+  NCollection_DynamicArray<ItemTiming> myStructTimingsTmp; //!< structure timings being filled
 };
 
 #endif // _Graphic3d_FrameStats_HeaderFile
@@ -59,17 +59,25 @@ enum Graphic3d_FrameStatsCounter
   Graphic3d_FrameStatsCounter_NbTrianglesImmediate,  //!< number of triangles in immediate layer
   Graphic3d_FrameStatsCounter_NbLinesImmediate,      //!< number of line segments in immediate layer
   Graphic3d_FrameStatsCounter_NbPointsImmediate,     //!< number of points in immediate layer
+
+  // culling efficiency counters (numbers of BVH nodes of layers, not structures)
+  Graphic3d_FrameStatsCounter_NbCullingTests,   //!< number of BVH nodes tested for culling
+  Graphic3d_FrameStatsCounter_NbCulledFrustum,  //!< number of BVH nodes culled by frustum
+  Graphic3d_FrameStatsCounter_NbCulledDistance, //!< number of BVH nodes culled by distance
+  Graphic3d_FrameStatsCounter_NbCulledSize,     //!< number of BVH nodes culled by size
 };
 
 enum
 {
-  Graphic3d_FrameStatsCounter_NB              = Graphic3d_FrameStatsCounter_NbPointsImmediate + 1,
+  Graphic3d_FrameStatsCounter_NB              = Graphic3d_FrameStatsCounter_NbCulledSize + 1,
   Graphic3d_FrameStatsCounter_SCENE_LOWER     = Graphic3d_FrameStatsCounter_NbLayers,
   Graphic3d_FrameStatsCounter_SCENE_UPPER     = Graphic3d_FrameStatsCounter_EstimatedBytesTextures,
   Graphic3d_FrameStatsCounter_RENDERED_LOWER  = Graphic3d_FrameStatsCounter_NbLayersNotCulled,
   Graphic3d_FrameStatsCounter_RENDERED_UPPER  = Graphic3d_FrameStatsCounter_NbPointsNotCulled,
   Graphic3d_FrameStatsCounter_IMMEDIATE_LOWER = Graphic3d_FrameStatsCounter_NbLayersImmediate,
   Graphic3d_FrameStatsCounter_IMMEDIATE_UPPER = Graphic3d_FrameStatsCounter_NbPointsImmediate,
+  Graphic3d_FrameStatsCounter_CULLING_LOWER   = Graphic3d_FrameStatsCounter_NbCullingTests,
+  Graphic3d_FrameStatsCounter_CULLING_UPPER   = Graphic3d_FrameStatsCounter_NbCulledSize,
 };
 
 #endif // _Graphic3d_FrameStatsCounter_HeaderFile
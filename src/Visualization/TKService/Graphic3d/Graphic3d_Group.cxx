@@ -34,6 +34,7 @@ IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_Group, Standard_Transient)
 
 Graphic3d_Group::Graphic3d_Group(const occ::handle<Graphic3d_Structure>& theStruct)
     : myStructure(theStruct.operator->()),
+      myLodRange(0.0, RealLast()),
       myIsClosed(false)
 {
 }
@@ -265,6 +266,59 @@ void Graphic3d_Group::AddPrimitiveArray(const Graphic3d_TypeOfPrimitiveArray the
 
 //=================================================================================================
 
+void Graphic3d_Group::AddInstancedPrimitiveArray(
+  const occ::handle<Graphic3d_ArrayOfPrimitives>& thePrim,
+  const occ::handle<Graphic3d_InstanceBuffer>&    theInstances,
+  const bool                                      theToEvalMinMax)
+{
+  if (IsDeleted() || !thePrim->IsValid())
+  {
+    return;
+  }
+
+  AddInstancedPrimitiveArray(thePrim->Type(),
+                             thePrim->Indices(),
+                             thePrim->Attributes(),
+                             thePrim->Bounds(),
+                             theInstances,
+                             theToEvalMinMax);
+}
+
+//=================================================================================================
+
+void Graphic3d_Group::AddInstancedPrimitiveArray(
+  const Graphic3d_TypeOfPrimitiveArray         theType,
+  const occ::handle<Graphic3d_IndexBuffer>&    theIndices,
+  const occ::handle<Graphic3d_Buffer>&         theAttribs,
+  const occ::handle<Graphic3d_BoundBuffer>&    theBounds,
+  const occ::handle<Graphic3d_InstanceBuffer>& theInstances,
+  const bool                                   theToEvalMinMax)
+{
+  if (IsDeleted() || theAttribs.IsNull() || theInstances.IsNull() || theInstances->IsEmpty())
+  {
+    return;
+  }
+  if (!theToEvalMinMax)
+  {
+    Update();
+    return;
+  }
+
+  // evaluate box of the array itself and then transform it to each instance location
+  const Graphic3d_BndBox4f aGroupBox = myBounds;
+  myBounds.Clear();
+  Graphic3d_Group::AddPrimitiveArray(theType, theIndices, theAttribs, theBounds, true);
+  const Graphic3d_BndBox4f anArrayBox = myBounds;
+  myBounds                            = aGroupBox;
+  if (anArrayBox.IsValid())
+  {
+    myBounds.Combine(theInstances->InstancesBox(anArrayBox));
+  }
+  Update();
+}
+
+//=================================================================================================
+
 void Graphic3d_Group::Marker(const Graphic3d_Vertex& thePoint, const bool theToEvalMinMax)
 {
   occ::handle<Graphic3d_ArrayOfPoints> aPoints = new Graphic3d_ArrayOfPoints(1);
@@ -415,5 +469,6 @@ void Graphic3d_Group::DumpJson(Standard_OStream& theOStream, int theDepth) const
   OCCT_DUMP_FIELD_VALUE_POINTER(theOStream, myStructure)
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myBounds)
 
+  OCCT_DUMP_FIELD_VALUES_NUMERICAL(theOStream, "LodRange", 2, myLodRange.x(), myLodRange.y())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsClosed)
 }
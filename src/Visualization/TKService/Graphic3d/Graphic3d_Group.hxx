@@ -21,6 +21,7 @@
 #include <Graphic3d_AspectFillArea3d.hxx>
 #include <Graphic3d_Flipper.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vec2.hxx>
 #include <Standard_CString.hxx>
 #include <Graphic3d_Vertex.hxx>
 #include <Graphic3d_TextPath.hxx>
@@ -30,6 +31,7 @@
 #include <Graphic3d_IndexBuffer.hxx>
 #include <Graphic3d_Buffer.hxx>
 #include <Graphic3d_BoundBuffer.hxx>
+#include <Graphic3d_InstanceBuffer.hxx>
 #include <gp_Ax2.hxx>
 #include <TCollection_ExtendedString.hxx>
 class Graphic3d_Aspects;
@@ -127,6 +129,25 @@ public:
   Standard_EXPORT void AddPrimitiveArray(const occ::handle<Graphic3d_ArrayOfPrimitives>& thePrim,
                                          const bool theToEvalMinMax = true);
 
+  //! Adds an array of primitives to be displayed at several locations.
+  //! Vertex data is shared by all instances; each instance defines its own transformation
+  //! (applied on top of group and structure transformations) and optionally its own color.
+  //! Bounding box of the group is computed from the box of the array and instance locations.
+  //! Notice that instanced arrays are not handled by ray-tracing.
+  Standard_EXPORT virtual void AddInstancedPrimitiveArray(
+    const Graphic3d_TypeOfPrimitiveArray         theType,
+    const occ::handle<Graphic3d_IndexBuffer>&    theIndices,
+    const occ::handle<Graphic3d_Buffer>&         theAttribs,
+    const occ::handle<Graphic3d_BoundBuffer>&    theBounds,
+    const occ::handle<Graphic3d_InstanceBuffer>& theInstances,
+    const bool                                   theToEvalMinMax = true);
+
+  //! Adds an array of primitives to be displayed at several locations.
+  Standard_EXPORT void AddInstancedPrimitiveArray(
+    const occ::handle<Graphic3d_ArrayOfPrimitives>& thePrim,
+    const occ::handle<Graphic3d_InstanceBuffer>&    theInstances,
+    const bool                                      theToEvalMinMax = true);
+
 public:
   //! sets the stencil test to theIsEnabled state;
   Standard_EXPORT virtual void SetStencilTestOptions(const bool theIsEnabled) = 0;
@@ -192,6 +213,29 @@ public:
   //! open shells).
   bool IsClosed() const { return myIsClosed; }
 
+  //! Returns the range of projected size of the structure (in pixels) within which the group is
+  //! displayed; [0, RealLast()] by default meaning that the group is always displayed.
+  const NCollection_Vec2<double>& LodRange() const { return myLodRange; }
+
+  //! Sets the range of projected size of the structure (in pixels) within which the group is
+  //! displayed. Groups of the same structure with adjacent ranges define levels of detail,
+  //! so that only one of them is drawn depending on the distance to the camera.
+  //! @param[in] theMinSize  minimal projected size (inclusive)
+  //! @param[in] theMaxSize  maximal projected size (exclusive), RealLast() for unbounded range
+  void SetLodRange(const double theMinSize, const double theMaxSize)
+  {
+    myLodRange.SetValues(theMinSize, theMaxSize);
+  }
+
+  //! Returns TRUE if the group is displayed only within a limited range of projected sizes.
+  bool HasLodRange() const { return myLodRange.x() > 0.0 || myLodRange.y() < RealLast(); }
+
+  //! Returns TRUE if the group should be displayed for the given projected size of the structure.
+  bool IsInLodRange(const double theSize) const
+  {
+    return theSize >= myLodRange.x() && (theSize < myLodRange.y() || myLodRange.y() >= RealLast());
+  }
+
   //! @name obsolete methods
 public:
   Standard_DEPRECATED(
@@ -323,6 +367,7 @@ protected:
   Graphic3d_Structure*                 myStructure; //!< pointer to the parent structure
   Graphic3d_BndBox4f                   myBounds;    //!< bounding box
   gp_Trsf                              myTrsf;      //!< group transformation
+  NCollection_Vec2<double>             myLodRange;  //!< range of projected sizes to display
   bool                                 myIsClosed;  //!< flag indicating closed volume
 };
 
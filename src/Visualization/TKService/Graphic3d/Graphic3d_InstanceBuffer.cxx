@@ -0,0 +1,100 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Graphic3d_InstanceBuffer.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_InstanceBuffer, Standard_Transient)
+
+//=================================================================================================
+
+Graphic3d_InstanceBuffer::Graphic3d_InstanceBuffer(const bool theHasColors)
+    : myRevision(0),
+      myHasColors(theHasColors)
+{
+}
+
+//=================================================================================================
+
+int Graphic3d_InstanceBuffer::AddInstance(const gp_Trsf& theTrsf)
+{
+  NCollection_Mat4<float> aMat;
+  theTrsf.GetMat4(aMat);
+  myTrsfs.Append(theTrsf);
+  myMatrices.Append(aMat);
+  if (myHasColors)
+  {
+    myColors.Append(Quantity_ColorRGBA(Quantity_NOC_WHITE));
+  }
+  ++myRevision;
+  return myTrsfs.Length();
+}
+
+//=================================================================================================
+
+int Graphic3d_InstanceBuffer::AddInstance(const gp_Trsf&            theTrsf,
+                                          const Quantity_ColorRGBA& theColor)
+{
+  const int anIndex = AddInstance(theTrsf);
+  if (myHasColors)
+  {
+    myColors.ChangeValue(anIndex - 1) = theColor;
+  }
+  return anIndex;
+}
+
+//=================================================================================================
+
+void Graphic3d_InstanceBuffer::SetTransformation(const int theIndex, const gp_Trsf& theTrsf)
+{
+  myTrsfs.ChangeValue(theIndex - 1) = theTrsf;
+  theTrsf.GetMat4(myMatrices.ChangeValue(theIndex - 1));
+  ++myRevision;
+}
+
+//=================================================================================================
+
+void Graphic3d_InstanceBuffer::Clear()
+{
+  myTrsfs.Clear();
+  myMatrices.Clear();
+  myColors.Clear();
+  ++myRevision;
+}
+
+//=================================================================================================
+
+Graphic3d_BndBox4f Graphic3d_InstanceBuffer::InstancesBox(
+  const Graphic3d_BndBox4f& theArrayBox) const
+{
+  Graphic3d_BndBox4f aBox;
+  if (!theArrayBox.IsValid())
+  {
+    return aBox;
+  }
+
+  const NCollection_Vec4<float>& aMin = theArrayBox.CornerMin();
+  const NCollection_Vec4<float>& aMax = theArrayBox.CornerMax();
+  for (int anInstIter = 0; anInstIter < myMatrices.Length(); ++anInstIter)
+  {
+    const NCollection_Mat4<float>& aMat = myMatrices.Value(anInstIter);
+    for (int aCornerIter = 0; aCornerIter < 8; ++aCornerIter)
+    {
+      const NCollection_Vec4<float> aCorner((aCornerIter & 1) != 0 ? aMax.x() : aMin.x(),
+                                            (aCornerIter & 2) != 0 ? aMax.y() : aMin.y(),
+                                            (aCornerIter & 4) != 0 ? aMax.z() : aMin.z(),
+                                            1.0f);
+      aBox.Add(aMat * aCorner);
+    }
+  }
+  return aBox;
+}
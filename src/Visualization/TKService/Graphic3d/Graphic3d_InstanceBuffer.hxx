@@ -0,0 +1,103 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Graphic3d_InstanceBuffer_HeaderFile
+#define _Graphic3d_InstanceBuffer_HeaderFile
+
+#include <gp_Trsf.hxx>
+#include <Graphic3d_BndBox4f.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <NCollection_Mat4.hxx>
+#include <Quantity_ColorRGBA.hxx>
+#include <Standard_Transient.hxx>
+
+//! Per-instance data of an instanced primitive array:
+//! the transformation of each instance and optional per-instance color.
+//!
+//! The same primitive array (e.g. triangulation of a fastener) is displayed
+//! at each instance location, while its vertex data is stored (and uploaded to GPU) only once.
+//! See Graphic3d_Group::AddInstancedPrimitiveArray().
+//! Instances are numbered starting from 1.
+class Graphic3d_InstanceBuffer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Graphic3d_InstanceBuffer, Standard_Transient)
+public:
+  //! Creates empty buffer.
+  //! @param[in] theHasColors  when TRUE, each instance defines its own color
+  //!                          overriding color of the primitive aspect
+  Standard_EXPORT Graphic3d_InstanceBuffer(const bool theHasColors = false);
+
+  //! Returns number of instances.
+  int NbInstances() const { return myTrsfs.Length(); }
+
+  //! Returns TRUE if buffer has no instances.
+  bool IsEmpty() const { return myTrsfs.IsEmpty(); }
+
+  //! Returns TRUE if instances define colors.
+  bool HasColors() const { return myHasColors; }
+
+  //! Adds a new instance and returns its index.
+  Standard_EXPORT int AddInstance(const gp_Trsf& theTrsf);
+
+  //! Adds a new instance with color and returns its index.
+  //! Color is ignored if buffer has been created without colors.
+  Standard_EXPORT int AddInstance(const gp_Trsf& theTrsf, const Quantity_ColorRGBA& theColor);
+
+  //! Returns transformation of the instance.
+  const gp_Trsf& Transformation(const int theIndex) const { return myTrsfs.Value(theIndex - 1); }
+
+  //! Returns transformation of the instance as a matrix in single precision.
+  const NCollection_Mat4<float>& Matrix(const int theIndex) const
+  {
+    return myMatrices.Value(theIndex - 1);
+  }
+
+  //! Changes transformation of the instance.
+  //! Notice that bounding box of the group is not updated automatically.
+  Standard_EXPORT void SetTransformation(const int theIndex, const gp_Trsf& theTrsf);
+
+  //! Returns color of the instance; should be called only if HasColors() is TRUE.
+  const Quantity_ColorRGBA& Color(const int theIndex) const
+  {
+    return myColors.Value(theIndex - 1);
+  }
+
+  //! Changes color of the instance; should be called only if HasColors() is TRUE.
+  void SetColor(const int theIndex, const Quantity_ColorRGBA& theColor)
+  {
+    myColors.ChangeValue(theIndex - 1) = theColor;
+    ++myRevision;
+  }
+
+  //! Removes all instances.
+  Standard_EXPORT void Clear();
+
+  //! Returns modification counter, incremented on each change of instances;
+  //! used by graphic driver to detect that uploaded per-instance data is outdated.
+  size_t Revision() const { return myRevision; }
+
+  //! Marks instances as modified, so that per-instance data will be uploaded again.
+  void UpdateRevision() { ++myRevision; }
+
+  //! Computes the box of all instances from the box of the primitive array.
+  Standard_EXPORT Graphic3d_BndBox4f InstancesBox(const Graphic3d_BndBox4f& theArrayBox) const;
+
+private:
+  NCollection_DynamicArray<gp_Trsf>                 myTrsfs;
+  NCollection_DynamicArray<NCollection_Mat4<float>> myMatrices;
+  NCollection_DynamicArray<Quantity_ColorRGBA>      myColors;
+  size_t                                            myRevision;
+  bool                                              myHasColors;
+};
+
+#endif // _Graphic3d_InstanceBuffer_HeaderFile
@@ -531,6 +531,7 @@ void Graphic3d_Layer::UpdateCulling(
 {
   updateBVH();
 
+  myCullingStats.Reset();
   myNbStructuresNotCulled = myNbStructures;
   if (theFrustumCullingState != Graphic3d_RenderingParams::FrustumCulling_NoUpdate)
   {
@@ -605,7 +606,8 @@ void Graphic3d_Layer::UpdateCulling(
     if (theSelector.IsCulled(aCullCtx,
                              aBVHTree->MinPoint(0),
                              aBVHTree->MaxPoint(0),
-                             toCheckFullInside ? &aNode.IsFullInside : nullptr))
+                             toCheckFullInside ? &aNode.IsFullInside : nullptr,
+                             myCullingStats))
     {
       continue;
     }
@@ -624,17 +626,20 @@ void Graphic3d_Layer::UpdateCulling(
           // small size should be always checked
           isLeftChildIn  = !theSelector.IsTooSmall(aCullCtx,
                                                   aBVHTree->MinPoint(aLeft.Id),
-                                                  aBVHTree->MaxPoint(aLeft.Id));
+                                                  aBVHTree->MaxPoint(aLeft.Id),
+                                                  myCullingStats);
           isRightChildIn = !theSelector.IsTooSmall(aCullCtx,
                                                    aBVHTree->MinPoint(aRight.Id),
-                                                   aBVHTree->MaxPoint(aRight.Id));
+                                                   aBVHTree->MaxPoint(aRight.Id),
+                                                   myCullingStats);
         }
         else
         {
           isLeftChildIn = !theSelector.IsCulled(aCullCtx,
                                                 aBVHTree->MinPoint(aLeft.Id),
                                                 aBVHTree->MaxPoint(aLeft.Id),
-                                                toCheckFullInside ? &aLeft.IsFullInside : nullptr);
+                                                toCheckFullInside ? &aLeft.IsFullInside : nullptr,
+                                                myCullingStats);
           if (!isLeftChildIn)
           {
             aLeft.IsFullInside = false;
@@ -644,7 +649,8 @@ void Graphic3d_Layer::UpdateCulling(
             !theSelector.IsCulled(aCullCtx,
                                   aBVHTree->MinPoint(aRight.Id),
                                   aBVHTree->MaxPoint(aRight.Id),
-                                  toCheckFullInside ? &aRight.IsFullInside : nullptr);
+                                  toCheckFullInside ? &aRight.IsFullInside : nullptr,
+                                  myCullingStats);
           if (!isRightChildIn)
           {
             aRight.IsFullInside = false;
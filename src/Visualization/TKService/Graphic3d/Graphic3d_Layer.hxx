@@ -16,6 +16,7 @@
 
 #include <Graphic3d_BvhCStructureSet.hxx>
 #include <Graphic3d_BvhCStructureSetTrsfPers.hxx>
+#include <Graphic3d_CullingTool.hxx>
 #include <Graphic3d_DisplayPriority.hxx>
 #include <Graphic3d_ZLayerId.hxx>
 #include <Graphic3d_ZLayerSettings.hxx>
@@ -32,8 +33,6 @@ typedef std::array<NCollection_IndexedMap<const Graphic3d_CStructure*>,
                    Graphic3d_DisplayPriority_NB>
   Graphic3d_ArrayOfIndexedMapOfStructure;
 
-class Graphic3d_CullingTool;
-
 //! Presentations list sorted within priorities.
 class Graphic3d_Layer : public Standard_Transient
 {
@@ -144,6 +143,10 @@ public:
   //! Returns TRUE if layer is empty or has been discarded entirely by culling test.
   bool IsCulled() const { return myNbStructuresNotCulled == 0; }
 
+  //! Returns culling efficiency counters (tested and culled BVH nodes)
+  //! of the last UpdateCulling() call.
+  const Graphic3d_CullingTool::CullingStats& CullingStatistics() const { return myCullingStats; }
+
   //! Returns number of transform persistence objects.
   int NbOfTransformPersistenceObjects() const { return myBVHPrimitivesTrsfPers.Size(); }
 
@@ -180,6 +183,9 @@ private:
   //! Number of NOT culled structures in the layer.
   int myNbStructuresNotCulled;
 
+  //! Culling efficiency counters of the last culling traverse.
+  Graphic3d_CullingTool::CullingStats myCullingStats;
+
   //! Layer setting flags.
   Graphic3d_ZLayerSettings myLayerSettings;
 
@@ -79,6 +79,12 @@ public:
     //
     PerfCounters_SkipImmediate = 0x1000, //!< do not include immediate viewer updates (e.g. lazy
                                          //!< updates without redrawing entire view content)
+    //
+    PerfCounters_Culling =
+      0x2000, //!< culling efficiency (numbers of tested and culled BVH nodes)
+    PerfCounters_ItemTimers =
+      0x4000, //!< per-layer and per-structure rendering times of the last frame (CPU and GPU);
+              //!< @sa Graphic3d_FrameStats::StructureTimings()
     //! show basic statistics
     PerfCounters_Basic =
       PerfCounters_FrameRate | PerfCounters_CPU | PerfCounters_Layers | PerfCounters_Structures,
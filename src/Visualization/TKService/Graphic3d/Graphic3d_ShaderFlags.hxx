@@ -47,6 +47,9 @@ enum Graphic3d_ShaderFlags
     0x2000, //!< apply per-vertex color only to front-facing fragments
   //
   Graphic3d_ShaderFlags_NB      = 0x4000, //!< overall number of combinations
+  Graphic3d_ShaderFlags_Instancing =
+    0x4000, //!< apply per-instance transformation from vertex attribute (hardware instancing);
+            //!  not counted by Graphic3d_ShaderFlags_NB, programs are kept in a separate table
   Graphic3d_ShaderFlags_IsPoint = Graphic3d_ShaderFlags_PointSimple
                                   | Graphic3d_ShaderFlags_PointSprite
                                   | Graphic3d_ShaderFlags_PointSpriteA,
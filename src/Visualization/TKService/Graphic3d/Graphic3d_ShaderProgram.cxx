@@ -85,7 +85,8 @@ Graphic3d_ShaderProgram::Graphic3d_ShaderProgram()
       myOitOutput(Graphic3d_RTM_BLEND_UNORDERED),
       myHasDefSampler(true),
       myHasAlphaTest(false),
-      myIsPBR(false)
+      myIsPBR(false),
+      myIsInstanced(false)
 {
   myID = TCollection_AsciiString("Graphic3d_ShaderProgram_")
          + TCollection_AsciiString(++THE_PROGRAM_OBJECT_COUNTER);
@@ -43,6 +43,10 @@ public:
   //! Default value of THE_NB_FRAG_OUTPUTS macros within GLSL program (see Declarations.glsl).
   static const int THE_NB_FRAG_OUTPUTS = 1;
 
+  //! Location of per-instance transformation vertex attribute occInstanceMatrix,
+  //! occupying 4 consecutive locations (see Declarations.glsl).
+  static const int THE_INSTANCE_MATRIX_LOCATION = 12;
+
 public:
   //! Creates new empty program object.
   Standard_EXPORT Graphic3d_ShaderProgram();
@@ -175,6 +179,15 @@ public:
   //! pipeline.
   void SetPBR(bool theIsPBR) { myIsPBR = theIsPBR; }
 
+  //! Return TRUE if standard program header should declare per-instance transformation
+  //! vertex attribute occInstanceMatrix applied on top of model-world matrix
+  //! within Vertex Shader (hardware instancing). FALSE by default.
+  bool IsInstanced() const { return myIsInstanced; }
+
+  //! Sets whether standard program header should declare per-instance transformation
+  //! vertex attribute occInstanceMatrix.
+  void SetInstanced(bool theIsInstanced) { myIsInstanced = theIsInstanced; }
+
   //! Return texture units declared within the program, @sa Graphic3d_TextureSetBits.
   int TextureSetBits() const { return myTextureSetBits; }
 
@@ -283,6 +296,7 @@ private:
   bool              myHasDefSampler; //!< flag indicating that program defines default texture sampler occSampler0
   bool              myHasAlphaTest;       //!< flag indicating that Fragment Shader performs alpha test
   bool              myIsPBR;         //!< flag indicating that program defines functions and variables used in PBR pipeline
+  bool              myIsInstanced;   //!< flag indicating that program declares per-instance transformation attribute
   // clang-format on
 };
 
@@ -26,6 +26,7 @@
 #include <Graphic3d_ArrayOfSegments.hxx>
 #include <Graphic3d_Group.hxx>
 #include <Graphic3d_StructureManager.hxx>
+#include <Message_ProgressScope.hxx>
 #include <Precision.hxx>
 #include <Prs3d_Presentation.hxx>
 #include <Prs3d_ShadingAspect.hxx>
@@ -356,6 +357,14 @@ void AIS_ColoredShape::Compute(const occ::handle<PrsMgr_PresentationManager>& th
         {
           SetToUpdate(AIS_WireFrame);
         }
+        if (wasRecomputed)
+        {
+          clearPreparedTriangles();
+        }
+      }
+      if (!myPreparedShape.IsEqual(myshape))
+      {
+        clearPreparedTriangles();
       }
       break;
     }
@@ -389,6 +398,99 @@ void AIS_ColoredShape::Compute(const occ::handle<PrsMgr_PresentationManager>& th
                  aDispatchedOpened,
                  theMode == AIS_Shaded ? aDispatchedClosed : aDispatchedOpened[TopAbs_FACE]);
   addShapesWithCustomProps(thePrs, aDispatchedOpened, aDispatchedClosed, theMode);
+  if (theMode == AIS_Shaded)
+  {
+    clearPreparedTriangles();
+  }
+}
+
+//=================================================================================================
+
+void AIS_ColoredShape::PrepareCompute(const int theMode, const Message_ProgressRange& theRange)
+{
+  clearPreparedTriangles();
+  Message_ProgressScope aPS(theRange, "Preparing shape", 2);
+  PrepareTriangulation(theMode, aPS.Next());
+  if (!aPS.More())
+  {
+    return;
+  }
+
+  PrepareTriangles(theMode, aPS.Next());
+}
+
+//=================================================================================================
+
+void AIS_ColoredShape::PrepareTriangles(const int theMode, const Message_ProgressRange& theRange)
+{
+  clearPreparedTriangles();
+  if (theMode != AIS_Shaded || myshape.IsNull() || IsInfinite() || theRange.UserBreak())
+  {
+    return;
+  }
+
+  NCollection_DataMap<TopoDS_Shape, occ::handle<AIS_ColoredDrawer>, TopTools_ShapeMapHasher>
+    aSubshapeDrawerMap;
+  fillSubshapeDrawerMap(aSubshapeDrawerMap);
+
+  occ::handle<AIS_ColoredDrawer> aBaseDrawer;
+  myShapeColors.Find(myshape, aBaseDrawer);
+
+  // dispatch sub-shapes in the same way as Compute() does
+  DataMapOfDrawerCompd aDispatchedOpened[(size_t)TopAbs_SHAPE];
+  DataMapOfDrawerCompd aDispatchedClosed;
+  dispatchColors(aBaseDrawer,
+                 myshape,
+                 aSubshapeDrawerMap,
+                 TopAbs_COMPOUND,
+                 false,
+                 aDispatchedOpened,
+                 aDispatchedClosed);
+  for (size_t aShType = 0; aShType <= (size_t)TopAbs_SHAPE; ++aShType)
+  {
+    const DataMapOfDrawerCompd& aDrawerShapeMap =
+      aShType == TopAbs_SHAPE ? aDispatchedClosed : aDispatchedOpened[aShType];
+    for (DataMapOfDrawerCompd::Iterator aMapIter(aDrawerShapeMap); aMapIter.More(); aMapIter.Next())
+    {
+      const occ::handle<AIS_ColoredDrawer>& aCustomDrawer = aMapIter.Key();
+      if (aCustomDrawer.IsNull())
+      {
+        myPreparedTriangles[aShType].Bind(aCustomDrawer, fillTriangles(aMapIter.Value(), myDrawer));
+      }
+      else if (!aCustomDrawer->IsHidden())
+      {
+        myPreparedTriangles[aShType].Bind(aCustomDrawer,
+                                          fillTriangles(aMapIter.Value(), aCustomDrawer));
+      }
+    }
+  }
+  myPreparedShape = myshape;
+}
+
+//=================================================================================================
+
+occ::handle<Graphic3d_ArrayOfTriangles> AIS_ColoredShape::fillTriangles(
+  const TopoDS_Shape&              theShape,
+  const occ::handle<Prs3d_Drawer>& theDrawer) const
+{
+  return StdPrs_ShadedShape::FillTriangles(
+    theShape,
+    theDrawer->ShadingAspect()->Aspect()->ToMapTexture()
+      && !theDrawer->ShadingAspect()->Aspect()->TextureMap().IsNull(),
+    myUVOrigin,
+    myUVRepeat,
+    myUVScale);
+}
+
+//=================================================================================================
+
+void AIS_ColoredShape::clearPreparedTriangles()
+{
+  for (size_t aShType = 0; aShType <= (size_t)TopAbs_SHAPE; ++aShType)
+  {
+    myPreparedTriangles[aShType].Clear();
+  }
+  myPreparedShape.Nullify();
 }
 
 //=================================================================================================
@@ -619,13 +721,12 @@ void AIS_ColoredShape::addShapesWithCustomProps(
         // add special wireframe presentation for faces without triangulation
         StdPrs_ShadedShape::AddWireframeForFacesWithoutTriangles(thePrs, aShapeDraw, aDrawer);
 
-        occ::handle<Graphic3d_ArrayOfTriangles> aTriangles = StdPrs_ShadedShape::FillTriangles(
-          aShapeDraw,
-          aDrawer->ShadingAspect()->Aspect()->ToMapTexture()
-            && !aDrawer->ShadingAspect()->Aspect()->TextureMap().IsNull(),
-          myUVOrigin,
-          myUVRepeat,
-          myUVScale);
+        // take triangles filled by PrepareCompute(), if any
+        occ::handle<Graphic3d_ArrayOfTriangles> aTriangles;
+        if (!myPreparedTriangles[aShType].Find(aCustomDrawer, aTriangles))
+        {
+          aTriangles = fillTriangles(aShapeDraw, aDrawer);
+        }
         if (!aTriangles.IsNull())
         {
           if (aShadedGroup.IsNull())
@@ -20,6 +20,7 @@
 #include <NCollection_DataMap.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <AIS_Shape.hxx>
+#include <Graphic3d_ArrayOfTriangles.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
@@ -95,6 +96,23 @@ public:
   //! Setup line width of entire shape.
   Standard_EXPORT void UnsetWidth() override;
 
+public: //! @name preparation of presentation data within background thread
+  //! Triangulates the shape and, for shaded display mode, fills triangles of each group
+  //! of sub-shapes sharing the same aspects, which will be reused by the following Compute().
+  //! Calls PrepareTriangulation() and PrepareTriangles().
+  Standard_EXPORT void PrepareCompute(const int                    theMode,
+                                      const Message_ProgressRange& theRange) override;
+
+  //! Fills triangles of each group of sub-shapes sharing the same aspects for shaded display mode,
+  //! which will be reused by the following Compute().
+  //! The shape is expected to be triangulated by PrepareTriangulation() beforehand;
+  //! triangulation is only read, so that the method can be called concurrently
+  //! for objects sharing sub-shapes.
+  //! @param[in] theMode   display mode to be computed
+  //! @param[in] theRange  progress range
+  Standard_EXPORT void PrepareTriangles(const int                    theMode,
+                                        const Message_ProgressRange& theRange);
+
 protected: //! @name override presentation computation
   //! Compute presentation considering sub-shape color map.
   Standard_EXPORT void Compute(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
@@ -148,6 +166,14 @@ protected:
     const DataMapOfDrawerCompd&            theDrawerClosedFaces,
     const int                              theMode);
 
+  //! Fills triangles of shaded presentation for the group of sub-shapes.
+  Standard_EXPORT occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(
+    const TopoDS_Shape&              theShape,
+    const occ::handle<Prs3d_Drawer>& theDrawer) const;
+
+  //! Releases triangles filled by PrepareCompute().
+  Standard_EXPORT void clearPreparedTriangles();
+
   //! Check all shapes from myShapeColorsfor visibility
   Standard_EXPORT bool isShapeEntirelyVisible() const;
 
@@ -190,6 +216,11 @@ protected:
   NCollection_DataMap<TopoDS_Shape, occ::handle<AIS_ColoredDrawer>, TopTools_ShapeMapHasher>
     myShapeColors;
 
+  //! triangles filled by PrepareCompute() per sub-shape type (TopAbs_SHAPE for closed volumes)
+  NCollection_DataMap<occ::handle<AIS_ColoredDrawer>, occ::handle<Graphic3d_ArrayOfTriangles>>
+    myPreparedTriangles[(size_t)TopAbs_SHAPE + 1];
+  TopoDS_Shape myPreparedShape; //!< shape, for which myPreparedTriangles have been filled
+
 public:
   DEFINE_STANDARD_RTTIEXT(AIS_ColoredShape, AIS_Shape)
 };
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <AIS_ComputeTask.hxx>
+
+#include <Message.hxx>
+#include <Standard_ErrorHandler.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(AIS_ComputeTask, Message_ProgressIndicator)
+
+//=================================================================================================
+
+AIS_ComputeTask::AIS_ComputeTask(const occ::handle<AIS_InteractiveObject>& theObject,
+                                 const int                                 theDispMode,
+                                 const int                                 theSelMode)
+    : myObject(theObject),
+      myDispMode(theDispMode),
+      mySelMode(theSelMode),
+      myDoneEvent(false),
+      myPriority(0.0),
+      myHasBndBox(false),
+      myIsDone(false),
+      myToCancel(false)
+{
+}
+
+//=================================================================================================
+
+void AIS_ComputeTask::PerformPreview()
+{
+  if (myHasBndBox || myToCancel)
+  {
+    return;
+  }
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    myObject->PreviewBoundingBox(myBndBox);
+  }
+  catch (Standard_Failure const& anException)
+  {
+    Message::SendFail(
+      TCollection_AsciiString("Error: AIS_ComputeTask::PerformPreview() has failed (")
+      + anException.what() + ")");
+    myBndBox.SetVoid();
+  }
+  myHasBndBox = true;
+}
+
+//=================================================================================================
+
+void AIS_ComputeTask::Perform()
+{
+  PerformPreview();
+  try
+  {
+    OCC_CATCH_SIGNALS
+    if (!myToCancel)
+    {
+      myObject->PrepareCompute(myDispMode, Start());
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    Message::SendFail(TCollection_AsciiString("Error: AIS_ComputeTask::Perform() has failed (")
+                      + anException.what() + ")");
+  }
+  myIsDone = true;
+  myDoneEvent.Set();
+}
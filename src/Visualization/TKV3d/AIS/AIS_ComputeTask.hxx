@@ -0,0 +1,114 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _AIS_ComputeTask_HeaderFile
+#define _AIS_ComputeTask_HeaderFile
+
+#include <AIS_InteractiveObject.hxx>
+#include <Graphic3d_Structure.hxx>
+#include <Message_ProgressIndicator.hxx>
+#include <Standard_Condition.hxx>
+
+#include <atomic>
+
+//! Task preparing presentation data of the interactive object within the background thread
+//! (see AIS_InteractiveContext::DisplayAsync()).
+//! The task computes the preview bounding box of the object first, and then calls
+//! AIS_InteractiveObject::PrepareCompute().
+//! The task is a progress indicator, so that it reports the progress of computation
+//! and can be cancelled.
+class AIS_ComputeTask : public Message_ProgressIndicator
+{
+  DEFINE_STANDARD_RTTIEXT(AIS_ComputeTask, Message_ProgressIndicator)
+public:
+  //! Creates the task.
+  //! @param[in] theObject    the object to prepare
+  //! @param[in] theDispMode  the display mode to prepare
+  //! @param[in] theSelMode   the selection mode to activate once the object is displayed
+  Standard_EXPORT AIS_ComputeTask(const occ::handle<AIS_InteractiveObject>& theObject,
+                                  const int                                 theDispMode,
+                                  const int                                 theSelMode);
+
+  //! Returns the object.
+  const occ::handle<AIS_InteractiveObject>& Object() const { return myObject; }
+
+  //! Returns the display mode.
+  int DisplayMode() const { return myDispMode; }
+
+  //! Returns the selection mode.
+  int SelectionMode() const { return mySelMode; }
+
+  //! Returns TRUE if the preview bounding box has been computed.
+  bool HasBoundingBox() const { return myHasBndBox; }
+
+  //! Returns the preview bounding box; should be used only when HasBoundingBox() is TRUE.
+  const Bnd_Box& BoundingBox() const { return myBndBox; }
+
+  //! Returns the priority of the task; tasks with higher priority are performed first.
+  double Priority() const { return myPriority; }
+
+  //! Sets the priority of the task, e.g. projected size of the preview bounding box.
+  void SetPriority(const double thePriority) { myPriority = thePriority; }
+
+  //! Returns TRUE if the task has been finished (or cancelled).
+  bool IsDone() const { return myIsDone; }
+
+  //! Requests interruption of the task.
+  void Cancel() { myToCancel = true; }
+
+  //! Returns TRUE if the task has been cancelled.
+  bool IsCancelled() const { return myToCancel; }
+
+  //! Waits for the task to be finished (or cancelled); the task should be queued.
+  void Wait() { myDoneEvent.Wait(); }
+
+  //! Computes the preview bounding box; does nothing if it has been already computed.
+  Standard_EXPORT void PerformPreview();
+
+  //! Performs the task (computes the preview bounding box if not yet done);
+  //! should be called only once.
+  Standard_EXPORT void Perform();
+
+public:
+  //! Returns the placeholder presentation displayed while the task is in progress.
+  //! Should be accessed only by the context within the main thread.
+  const occ::handle<Graphic3d_Structure>& Placeholder() const { return myPlaceholder; }
+
+  //! Sets the placeholder presentation.
+  void SetPlaceholder(const occ::handle<Graphic3d_Structure>& thePrs) { myPlaceholder = thePrs; }
+
+protected:
+  //! Returns TRUE if the task has been cancelled.
+  bool UserBreak() override { return myToCancel; }
+
+  //! Does nothing; progress can be retrieved by GetPosition().
+  void Show(const Message_ProgressScope& theScope, const bool isForce) override
+  {
+    (void)theScope;
+    (void)isForce;
+  }
+
+private:
+  occ::handle<AIS_InteractiveObject> myObject;
+  occ::handle<Graphic3d_Structure>   myPlaceholder;
+  Bnd_Box                            myBndBox;
+  int                                myDispMode;
+  int                                mySelMode;
+  Standard_Condition                 myDoneEvent;
+  std::atomic<double>                myPriority;
+  std::atomic<bool>                  myHasBndBox;
+  std::atomic<bool>                  myIsDone;
+  std::atomic<bool>                  myToCancel;
+};
+
+#endif // _AIS_ComputeTask_HeaderFile
@@ -0,0 +1,262 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <AIS_ComputeThreadPool.hxx>
+
+#include <OSD.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(AIS_ComputeThreadPool, Standard_Transient)
+
+//=================================================================================================
+
+AIS_ComputeThreadPool::AIS_ComputeThreadPool(const int theNbThreads)
+    : myThreads(1, std::max(1, theNbThreads)),
+      myWakeEvent(false),
+      myIdleEvent(true),
+      myToStop(false),
+      myIsStarted(false),
+      myToCatchFpe(OSD::ToCatchFloatingSignals())
+{
+  for (NCollection_Array1<OSD_Thread>::Iterator aThreadIter(myThreads); aThreadIter.More();
+       aThreadIter.Next())
+  {
+    aThreadIter.ChangeValue().SetFunction(&AIS_ComputeThreadPool::runThread);
+  }
+}
+
+//=================================================================================================
+
+AIS_ComputeThreadPool::~AIS_ComputeThreadPool()
+{
+  StopThreads();
+}
+
+//=================================================================================================
+
+void AIS_ComputeThreadPool::AddTask(const occ::handle<AIS_ComputeTask>& theTask)
+{
+  if (theTask.IsNull())
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myTasks.Append(theTask);
+    myIdleEvent.Reset();
+    myWakeEvent.Set();
+  }
+
+  if (!myIsStarted)
+  {
+    myIsStarted = true;
+    for (NCollection_Array1<OSD_Thread>::Iterator aThreadIter(myThreads); aThreadIter.More();
+         aThreadIter.Next())
+    {
+      aThreadIter.ChangeValue().Run(this);
+    }
+  }
+}
+
+//=================================================================================================
+
+void AIS_ComputeThreadPool::CancelTask(const occ::handle<AIS_ComputeTask>& theTask)
+{
+  if (theTask.IsNull() || theTask->IsDone())
+  {
+    return;
+  }
+
+  theTask->Cancel();
+  bool isQueued = false;
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    for (NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myTasks);
+         aTaskIter.More();
+         aTaskIter.Next())
+    {
+      if (aTaskIter.Value() == theTask)
+      {
+        myTasks.Remove(aTaskIter);
+        isQueued = true;
+        break;
+      }
+    }
+    if (isQueued && myTasks.IsEmpty() && myRunning.IsEmpty())
+    {
+      myIdleEvent.Set();
+    }
+  }
+
+  if (isQueued)
+  {
+    // cancelled task only marks itself as done
+    theTask->Perform();
+  }
+  else
+  {
+    theTask->Wait();
+  }
+}
+
+//=================================================================================================
+
+void AIS_ComputeThreadPool::CancelTasks()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myTasks);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    aTaskIter.Value()->Cancel();
+  }
+  for (NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myRunning);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    aTaskIter.Value()->Cancel();
+  }
+}
+
+//=================================================================================================
+
+void AIS_ComputeThreadPool::WaitThreads()
+{
+  myIdleEvent.Wait();
+}
+
+//=================================================================================================
+
+void AIS_ComputeThreadPool::StopThreads()
+{
+  if (!myIsStarted)
+  {
+    return;
+  }
+
+  // cancelled tasks are still passed through threads to be marked as done
+  CancelTasks();
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myToStop = true;
+    myWakeEvent.Set();
+  }
+  for (NCollection_Array1<OSD_Thread>::Iterator aThreadIter(myThreads); aThreadIter.More();
+       aThreadIter.Next())
+  {
+    aThreadIter.ChangeValue().Wait();
+  }
+  myToStop    = false;
+  myIsStarted = false;
+}
+
+//=================================================================================================
+
+void AIS_ComputeThreadPool::performThread()
+{
+  OSD::SetThreadLocalSignal(OSD::SignalMode(), myToCatchFpe);
+  for (;;)
+  {
+    myWakeEvent.Wait();
+
+    occ::handle<AIS_ComputeTask> aTask;
+    bool                         isPreview = false;
+    {
+      std::lock_guard<std::mutex> aLock(myMutex);
+      if (myTasks.IsEmpty())
+      {
+        if (myToStop)
+        {
+          return;
+        }
+        myWakeEvent.Reset();
+        continue;
+      }
+      aTask = takeTask(isPreview);
+      myRunning.Append(aTask);
+    }
+
+    if (isPreview)
+    {
+      aTask->PerformPreview();
+    }
+    else
+    {
+      aTask->Perform();
+    }
+
+    {
+      std::lock_guard<std::mutex> aLock(myMutex);
+      for (NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myRunning);
+           aTaskIter.More();
+           aTaskIter.Next())
+      {
+        if (aTaskIter.Value() == aTask)
+        {
+          myRunning.Remove(aTaskIter);
+          break;
+        }
+      }
+      if (isPreview && aTask->IsCancelled())
+      {
+        // the task has been cancelled while computing preview - just mark it as done
+        aTask->Perform();
+      }
+      else if (isPreview)
+      {
+        // return the task to the queue to be prepared according to its priority
+        myTasks.Append(aTask);
+      }
+      if (myTasks.IsEmpty() && myRunning.IsEmpty())
+      {
+        myIdleEvent.Set();
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
+occ::handle<AIS_ComputeTask> AIS_ComputeThreadPool::takeTask(bool& theIsPreview)
+{
+  // compute previews first in the order of queuing
+  NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aBestIter;
+  for (NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myTasks);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    const occ::handle<AIS_ComputeTask>& aTask = aTaskIter.Value();
+    if (!aTask->HasBoundingBox() && !aTask->IsCancelled())
+    {
+      theIsPreview = true;
+      aBestIter    = aTaskIter;
+      break;
+    }
+    else if (!aBestIter.More() || aTask->Priority() > aBestIter.Value()->Priority())
+    {
+      aBestIter = aTaskIter;
+    }
+  }
+
+  occ::handle<AIS_ComputeTask> aTask = aBestIter.Value();
+  myTasks.Remove(aBestIter);
+  return aTask;
+}
+
+//=================================================================================================
+
+void* AIS_ComputeThreadPool::runThread(void* thePool)
+{
+  static_cast<AIS_ComputeThreadPool*>(thePool)->performThread();
+  return nullptr;
+}
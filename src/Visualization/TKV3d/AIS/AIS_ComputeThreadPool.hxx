@@ -0,0 +1,87 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _AIS_ComputeThreadPool_HeaderFile
+#define _AIS_ComputeThreadPool_HeaderFile
+
+#include <AIS_ComputeTask.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_List.hxx>
+#include <OSD_Thread.hxx>
+#include <Standard_Condition.hxx>
+
+#include <mutex>
+
+//! Class defining a pool of background threads performing queued AIS_ComputeTask
+//! (see AIS_InteractiveContext::DisplayAsync()).
+//! Threads are started on the first queued task and live until StopThreads().
+//! Preview bounding boxes of all queued tasks are computed before preparing any object,
+//! so that placeholders are shown as early as possible;
+//! objects are then prepared in order of decreasing AIS_ComputeTask::Priority().
+class AIS_ComputeThreadPool : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(AIS_ComputeThreadPool, Standard_Transient)
+public:
+  //! Main constructor.
+  //! Several threads should be used only when queued objects do not share sub-shapes,
+  //! as triangulation is stored within the shared shape.
+  //! @param[in] theNbThreads  number of background threads
+  Standard_EXPORT AIS_ComputeThreadPool(const int theNbThreads = 1);
+
+  //! Destructor, stops threads.
+  Standard_EXPORT ~AIS_ComputeThreadPool() override;
+
+  //! Returns the number of threads.
+  int NbThreads() const { return myThreads.Length(); }
+
+  //! Queues the task.
+  Standard_EXPORT void AddTask(const occ::handle<AIS_ComputeTask>& theTask);
+
+  //! Cancels the task; the queued task is removed from the queue,
+  //! while the running task is waited for to be finished.
+  //! The task is marked as done on return.
+  Standard_EXPORT void CancelTask(const occ::handle<AIS_ComputeTask>& theTask);
+
+  //! Cancels all queued and running tasks.
+  Standard_EXPORT void CancelTasks();
+
+  //! Waits for all queued tasks to be finished.
+  Standard_EXPORT void WaitThreads();
+
+  //! Cancels all tasks and stops threads.
+  Standard_EXPORT void StopThreads();
+
+private:
+  //! Method is executed in the context of thread.
+  void performThread();
+
+  //! Takes the next task from the queue; should be called under lock.
+  //! @param[out] theIsPreview  set to TRUE if only preview of the task should be computed
+  occ::handle<AIS_ComputeTask> takeTask(bool& theIsPreview);
+
+  //! Thread function.
+  static void* runThread(void* thePool);
+
+private:
+  NCollection_List<occ::handle<AIS_ComputeTask>> myTasks;      //!< queued tasks
+  NCollection_List<occ::handle<AIS_ComputeTask>> myRunning;    //!< tasks being performed
+  NCollection_Array1<OSD_Thread>                 myThreads;    //!< background threads
+  std::mutex                                     myMutex;      //!< mutex for task lists
+  Standard_Condition                             myWakeEvent;  //!< raises when task is queued
+  Standard_Condition                             myIdleEvent;  //!< raises when all tasks are done
+  bool                                           myToStop;     //!< flag to stop threads
+  bool                                           myIsStarted;  //!< threads are running
+  bool                                           myToCatchFpe; //!< floating point signals mode
+};
+
+#endif // _AIS_ComputeThreadPool_HeaderFile
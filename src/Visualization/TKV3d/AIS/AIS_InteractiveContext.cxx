@@ -24,6 +24,7 @@
 #include <AIS_ConnectedInteractive.hxx>
 #include <AIS_MultipleConnectedInteractive.hxx>
 #include <Precision.hxx>
+#include <Prs3d_BndBox.hxx>
 #include <Prs3d_DatumAspect.hxx>
 #include <Prs3d_IsoAspect.hxx>
 #include <Prs3d_LineAspect.hxx>
@@ -108,6 +109,36 @@ static void initDefaultHilightAttributes(const occ::handle<Prs3d_Drawer>& theDra
   // and should not be overridden by highlighting
   theDrawer->SetAutoTriangulation(false);
 }
+
+//! Removes the preview presentation of the background task.
+static bool removePlaceholder(const occ::handle<AIS_ComputeTask>& theTask)
+{
+  const occ::handle<Graphic3d_Structure>& aPrs = theTask->Placeholder();
+  if (aPrs.IsNull())
+  {
+    return false;
+  }
+
+  aPrs->Erase();
+  aPrs->Clear();
+  aPrs->Remove();
+  theTask->SetPlaceholder(occ::handle<Graphic3d_Structure>());
+  return true;
+}
+
+//! Returns the measure of the box size projected by the camera,
+//! used to prepare objects looking larger on the screen first.
+static double projectedSize(const occ::handle<Graphic3d_Camera>& theCamera, const Bnd_Box& theBox)
+{
+  const double aSize = std::sqrt(theBox.SquareExtent());
+  if (theCamera->IsOrthographic())
+  {
+    return aSize / theCamera->Scale();
+  }
+
+  const gp_Pnt aCenter = (theBox.CornerMin().XYZ() + theBox.CornerMax().XYZ()) * 0.5;
+  return aSize / std::max(aCenter.Distance(theCamera->Eye()), theCamera->ZNear());
+}
 } // namespace
 
 //=================================================================================================
@@ -175,6 +206,17 @@ AIS_InteractiveContext::AIS_InteractiveContext(const occ::handle<V3d_Viewer>& Ma
 
 AIS_InteractiveContext::~AIS_InteractiveContext()
 {
+  // cancel background computations
+  for (NCollection_DataMap<occ::handle<AIS_InteractiveObject>,
+                           occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myComputeTasks);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    ComputeThreadPool()->CancelTask(aTaskIter.Value());
+    removePlaceholder(aTaskIter.Value());
+  }
+  myComputeTasks.Clear();
+
   // clear the current selection
   mySelection->Clear();
   mgrSelector.Nullify();
@@ -224,6 +266,10 @@ occ::handle<V3d_View> AIS_InteractiveContext::LastActiveView() const
 
 void AIS_InteractiveContext::UpdateCurrentViewer()
 {
+  if (!myComputeTasks.IsEmpty())
+  {
+    UpdateAsync(false);
+  }
   if (!myMainVwr.IsNull())
   {
     myMainVwr->Update();
@@ -405,6 +451,164 @@ void AIS_InteractiveContext::Display(const occ::handle<AIS_InteractiveObject>& t
 
 //=================================================================================================
 
+occ::handle<AIS_ComputeTask> AIS_InteractiveContext::DisplayAsync(
+  const occ::handle<AIS_InteractiveObject>& theIObj,
+  const bool                                theToUpdateViewer)
+{
+  if (theIObj.IsNull())
+  {
+    return occ::handle<AIS_ComputeTask>();
+  }
+  else if (myObjects.IsBound(theIObj))
+  {
+    Display(theIObj, theToUpdateViewer);
+    return occ::handle<AIS_ComputeTask>();
+  }
+  else if (const occ::handle<AIS_ComputeTask>* aTask = myComputeTasks.Seek(theIObj))
+  {
+    return *aTask;
+  }
+  else if (theIObj->HasInteractiveContext() && theIObj->myCTXPtr != this)
+  {
+    throw Standard_ProgramError(
+      "AIS_InteractiveContext - object has been already displayed in another context!");
+  }
+
+  int aDispMode = 0, aHiMod = -1, aSelMode = -1;
+  GetDefModes(theIObj, aDispMode, aHiMod, aSelMode);
+  occ::handle<AIS_ComputeTask> aTask =
+    new AIS_ComputeTask(theIObj, aDispMode, myIsAutoActivateSelMode ? aSelMode : -1);
+  myComputeTasks.Bind(theIObj, aTask);
+  ComputeThreadPool()->AddTask(aTask);
+  if (theToUpdateViewer)
+  {
+    UpdateCurrentViewer();
+  }
+  return aTask;
+}
+
+//=================================================================================================
+
+occ::handle<AIS_ComputeTask> AIS_InteractiveContext::AsyncTask(
+  const occ::handle<AIS_InteractiveObject>& theIObj) const
+{
+  const occ::handle<AIS_ComputeTask>* aTask = myComputeTasks.Seek(theIObj);
+  return aTask != nullptr ? *aTask : occ::handle<AIS_ComputeTask>();
+}
+
+//=================================================================================================
+
+void AIS_InteractiveContext::CancelAsync(
+  const occ::handle<AIS_InteractiveObject>& theIObj,
+  const bool                                theToUpdateViewer)
+{
+  occ::handle<AIS_ComputeTask> aTask;
+  if (theIObj.IsNull() || !myComputeTasks.Find(theIObj, aTask))
+  {
+    return;
+  }
+
+  myComputeTasks.UnBind(theIObj);
+  ComputeThreadPool()->CancelTask(aTask);
+  if (removePlaceholder(aTask) && theToUpdateViewer)
+  {
+    UpdateCurrentViewer();
+  }
+}
+
+//=================================================================================================
+
+bool AIS_InteractiveContext::UpdateAsync(const bool theToUpdateViewer)
+{
+  bool                                           isChanged = false;
+  NCollection_List<occ::handle<AIS_ComputeTask>> aDoneTasks;
+  occ::handle<Graphic3d_Camera>                  aCamera;
+  if (!myMainVwr.IsNull() && myMainVwr->ActiveViewIterator().More())
+  {
+    aCamera = myMainVwr->ActiveViewIterator().Value()->Camera();
+  }
+  for (NCollection_DataMap<occ::handle<AIS_InteractiveObject>,
+                           occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myComputeTasks);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    const occ::handle<AIS_ComputeTask>& aTask = aTaskIter.Value();
+    if (aTask->IsDone())
+    {
+      aDoneTasks.Append(aTask);
+      continue;
+    }
+    else if (!aTask->HasBoundingBox() || aTask->BoundingBox().IsVoid()
+             || aTask->BoundingBox().IsOpen())
+    {
+      continue;
+    }
+
+    if (!aCamera.IsNull())
+    {
+      const Bnd_Box aBox = aTask->BoundingBox().Transformed(aTask->Object()->Transformation());
+      aTask->SetPriority(projectedSize(aCamera, aBox));
+    }
+    if (!aTask->Placeholder().IsNull())
+    {
+      continue;
+    }
+
+    // show preview box to be considered by FitAll() and culling
+    occ::handle<Graphic3d_Structure> aPrs = new Graphic3d_Structure(myMainPM->StructureManager());
+    Prs3d_BndBox::Add(aPrs, aTask->BoundingBox(), myDefaultDrawer);
+    aPrs->SetTransformation(aTask->Object()->TransformationGeom());
+    aPrs->SetZLayer(aTask->Object()->ZLayer());
+    aPrs->Display();
+    aTask->SetPlaceholder(aPrs);
+    isChanged = true;
+  }
+
+  // swap preview boxes with actual presentations
+  for (NCollection_List<occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(aDoneTasks);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    const occ::handle<AIS_ComputeTask>& aTask = aTaskIter.Value();
+    myComputeTasks.UnBind(aTask->Object());
+    isChanged = removePlaceholder(aTask) || isChanged;
+    if (!aTask->IsCancelled())
+    {
+      Display(aTask->Object(), aTask->DisplayMode(), aTask->SelectionMode(), false);
+      isChanged = true;
+    }
+  }
+
+  if (isChanged && theToUpdateViewer && !myMainVwr.IsNull())
+  {
+    myMainVwr->Update();
+  }
+  return isChanged;
+}
+
+//=================================================================================================
+
+void AIS_InteractiveContext::WaitAsync()
+{
+  if (!myComputePool.IsNull() && !myComputeTasks.IsEmpty())
+  {
+    myComputePool->WaitThreads();
+  }
+}
+
+//=================================================================================================
+
+const occ::handle<AIS_ComputeThreadPool>& AIS_InteractiveContext::ComputeThreadPool()
+{
+  if (myComputePool.IsNull())
+  {
+    myComputePool = new AIS_ComputeThreadPool(1);
+  }
+  return myComputePool;
+}
+
+//=================================================================================================
+
 void AIS_InteractiveContext::SetViewAffinity(const occ::handle<AIS_InteractiveObject>& theIObj,
                                              const occ::handle<V3d_View>&              theView,
                                              const bool                                theIsVisible)
@@ -431,6 +635,11 @@ void AIS_InteractiveContext::Display(const occ::handle<AIS_InteractiveObject>& t
   {
     return;
   }
+  else if (myComputeTasks.IsBound(theIObj))
+  {
+    // display the object right now instead of waiting for background computation
+    CancelAsync(theIObj, false);
+  }
 
   if (theDispStatus == PrsMgr_DisplayStatus_Erased)
   {
@@ -546,6 +755,11 @@ void AIS_InteractiveContext::Erase(const occ::handle<AIS_InteractiveObject>& the
   {
     return;
   }
+  else if (myComputeTasks.IsBound(theIObj))
+  {
+    CancelAsync(theIObj, theToUpdateViewer);
+    return;
+  }
 
   if (!theIObj->IsAutoHilight())
   {
@@ -666,6 +880,11 @@ void AIS_InteractiveContext::Remove(const occ::handle<AIS_InteractiveObject>& th
   {
     return;
   }
+  else if (myComputeTasks.IsBound(theIObj))
+  {
+    CancelAsync(theIObj, theToUpdateViewer);
+    return;
+  }
 
   if (theIObj->HasInteractiveContext())
   {
@@ -685,6 +904,21 @@ void AIS_InteractiveContext::RemoveAll(const bool theToUpdateViewer)
 {
   ClearDetected();
 
+  NCollection_List<occ::handle<AIS_InteractiveObject>> aPending;
+  for (NCollection_DataMap<occ::handle<AIS_InteractiveObject>,
+                           occ::handle<AIS_ComputeTask>>::Iterator aTaskIter(myComputeTasks);
+       aTaskIter.More();
+       aTaskIter.Next())
+  {
+    aPending.Append(aTaskIter.Key());
+  }
+  for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator aPendingIter(aPending);
+       aPendingIter.More();
+       aPendingIter.Next())
+  {
+    CancelAsync(aPendingIter.Value(), false);
+  }
+
   NCollection_List<occ::handle<AIS_InteractiveObject>> aList;
   ObjectsInside(aList);
   for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator aListIterator(aList);
@@ -931,6 +1165,14 @@ void AIS_InteractiveContext::Redisplay(const occ::handle<AIS_InteractiveObject>&
                                        const bool                                theToUpdateViewer,
                                        const bool                                theAllModes)
 {
+  if (!theIObj.IsNull() && myComputeTasks.IsBound(theIObj))
+  {
+    // restart background computation of the modified object
+    CancelAsync(theIObj, false);
+    DisplayAsync(theIObj, theToUpdateViewer);
+    return;
+  }
+
   RecomputePrsOnly(theIObj, theToUpdateViewer, theAllModes);
   RecomputeSelectionOnly(theIObj);
 }
@@ -17,6 +17,7 @@
 #ifndef _AIS_InteractiveContext_HeaderFile
 #define _AIS_InteractiveContext_HeaderFile
 
+#include <AIS_ComputeThreadPool.hxx>
 #include <AIS_InteractiveObject.hxx>
 #include <AIS_GlobalStatus.hxx>
 #include <NCollection_DataMap.hxx>
@@ -338,6 +339,60 @@ public: //! @name object presence management (View affinity, Layer, Priority)
                                        const occ::handle<V3d_View>&              theView,
                                        const bool                                theIsVisible);
 
+public: //! @name asynchronous display
+  //! Displays the object once its presentation data (e.g. shape triangulation) is prepared
+  //! by AIS_InteractiveObject::PrepareCompute() within the background thread.
+  //! Meanwhile, the preview bounding box of the object is displayed instead,
+  //! so that FitAll() and frustum culling take the object into account.
+  //! The object is displayed by UpdateAsync() (called by UpdateCurrentViewer()) once prepared.
+  //! The object should not be modified until it is displayed; Redisplay() restarts computation.
+  //! Display() of the object shows it synchronously, while Erase() and Remove() cancel computation.
+  //! Shapes read with deferred triangulation (e.g. glTF file read with
+  //! RWGltf_CafReader::SetToSkipLateDataLoading()) load their mesh data in the background,
+  //! so that the assembly skeleton is shown by preview boxes while meshes arrive progressively.
+  //! The object already displayed in this context is redisplayed synchronously.
+  //! @param[in] theIObj            the object to display
+  //! @param[in] theToUpdateViewer  update the viewer to show the preview box, if available
+  //! @return the task which can be used to track progress or to cancel computation,
+  //!         NULL if object has been displayed synchronously
+  Standard_EXPORT occ::handle<AIS_ComputeTask> DisplayAsync(
+    const occ::handle<AIS_InteractiveObject>& theIObj,
+    const bool                                theToUpdateViewer);
+
+  //! Returns the background task of the object scheduled by DisplayAsync() or NULL.
+  Standard_EXPORT occ::handle<AIS_ComputeTask> AsyncTask(
+    const occ::handle<AIS_InteractiveObject>& theIObj) const;
+
+  //! Returns the number of objects waiting to be displayed by UpdateAsync().
+  int NbAsyncTasks() const { return myComputeTasks.Extent(); }
+
+  //! Cancels background computation of the object scheduled by DisplayAsync()
+  //! and removes its preview bounding box; the object is not displayed.
+  //! Waits for the computation to be interrupted, if it is already in progress.
+  Standard_EXPORT void CancelAsync(const occ::handle<AIS_InteractiveObject>& theIObj,
+                                   const bool                                theToUpdateViewer);
+
+  //! Displays objects which presentation data has been prepared in the background
+  //! and shows preview boxes of objects in progress.
+  //! Objects in progress are prioritized by the projected size of their preview boxes
+  //! within the first active view, so that larger objects on the screen are prepared first.
+  //! Should be called within the main thread; called automatically by UpdateCurrentViewer().
+  //! @return TRUE if the viewer content has been changed
+  Standard_EXPORT bool UpdateAsync(const bool theToUpdateViewer);
+
+  //! Waits for all background tasks to be finished; UpdateAsync() should be called afterwards.
+  Standard_EXPORT void WaitAsync();
+
+  //! Returns the pool of background threads used by DisplayAsync();
+  //! pool with a single thread is created on first use.
+  Standard_EXPORT const occ::handle<AIS_ComputeThreadPool>& ComputeThreadPool();
+
+  //! Sets the pool of background threads used by DisplayAsync().
+  void SetComputeThreadPool(const occ::handle<AIS_ComputeThreadPool>& thePool)
+  {
+    myComputePool = thePool;
+  }
+
 public: //! @name Display Mode management
   //! Returns the Display Mode setting to be used by default.
   int DisplayMode() const { return myDefaultDrawer->DisplayMode(); }
@@ -1672,6 +1727,10 @@ protected: //! @name internal fields
   SelectMgr_PickingStrategy myPickingStrategy; //!< picking strategy to be applied within MoveTo()
   bool                      myAutoHilight;
   bool                      myIsAutoActivateSelMode;
+
+  NCollection_DataMap<occ::handle<AIS_InteractiveObject>, occ::handle<AIS_ComputeTask>>
+    myComputeTasks; //!< objects scheduled by DisplayAsync()
+  occ::handle<AIS_ComputeThreadPool> myComputePool; //!< background threads for DisplayAsync()
 };
 
 #endif // _AIS_InteractiveContext_HeaderFile
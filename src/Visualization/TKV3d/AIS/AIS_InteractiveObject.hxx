@@ -19,6 +19,8 @@
 
 #include <AIS_KindOfInteractive.hxx>
 #include <AIS_DragAction.hxx>
+#include <Bnd_Box.hxx>
+#include <Message_ProgressRange.hxx>
 #include <SelectMgr_SelectableObject.hxx>
 
 class AIS_InteractiveContext;
@@ -124,6 +126,26 @@ public:
                                                const NCollection_Vec2<int>& theDragTo,
                                                const AIS_DragAction         theAction);
 
+public: //! @name preparation of presentation data within background thread
+  //! Computes the bounding box of the object without computing its presentations.
+  //! The box is displayed in place of the object while AIS_InteractiveContext::DisplayAsync()
+  //! prepares presentation data; void box is returned by default.
+  //! The method is called from the background thread.
+  virtual void PreviewBoundingBox(Bnd_Box& theBndBox) { theBndBox.SetVoid(); }
+
+  //! Prepares data used by Compute() for specified display mode, which is expensive to compute
+  //! and which can be computed without access to the presentations (e.g. shape triangulation).
+  //! The method is called from the background thread by AIS_InteractiveContext::DisplayAsync(),
+  //! so that it should not modify presentations or access the context;
+  //! does nothing by default.
+  //! @param[in] theMode   display mode to be computed
+  //! @param[in] theRange  progress range, which should be checked for user break
+  virtual void PrepareCompute(const int theMode, const Message_ProgressRange& theRange)
+  {
+    (void)theMode;
+    (void)theRange;
+  }
+
 public:
   //! Returns the context pointer to the interactive context.
   Standard_EXPORT occ::handle<AIS_InteractiveContext> GetContext() const;
@@ -18,6 +18,7 @@
 
 #include <AIS_GraphicTool.hxx>
 #include <AIS_InteractiveContext.hxx>
+#include <BRep_Tool.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepTools.hxx>
 #include <BRepTools_ShapeSet.hxx>
@@ -28,6 +29,7 @@
 #include <Graphic3d_Structure.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
+#include <Message_ProgressScope.hxx>
 #include <HLRBRep.hxx>
 #include <OSD_Timer.hxx>
 #include <Prs3d_Drawer.hxx>
@@ -46,6 +48,8 @@
 #include <StdPrs_WFShape.hxx>
 #include <StdSelect.hxx>
 #include <StdSelect_BRepSelectionTool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(AIS_Shape, AIS_InteractiveObject)
 
@@ -155,6 +159,7 @@ void AIS_Shape::Compute(const occ::handle<PrsMgr_PresentationManager>&,
           try
           {
             OCC_CATCH_SIGNALS
+            const int aFirstGroup = thePrs->NumberOfGroups() + 1;
             StdPrs_ShadedShape::Add(
               thePrs,
               myshape,
@@ -164,6 +169,17 @@ void AIS_Shape::Compute(const occ::handle<PrsMgr_PresentationManager>&,
               myUVOrigin,
               myUVRepeat,
               myUVScale);
+            if (!myLods.IsNull())
+            {
+              if (myLods->IsDone())
+              {
+                StdPrs_ShadedShape::AddLods(thePrs, myDrawer, myLods, aFirstGroup);
+              }
+              else if (!myLods->IsRunning())
+              {
+                myLods->PerformAsync();
+              }
+            }
           }
           catch (Standard_Failure const& anException)
           {
@@ -744,6 +760,58 @@ const Bnd_Box& AIS_Shape::BoundingBox()
   return myBB;
 }
 
+//=================================================================================================
+
+void AIS_Shape::PrepareCompute(const int theMode, const Message_ProgressRange& theRange)
+{
+  PrepareTriangulation(theMode, theRange);
+}
+
+//=================================================================================================
+
+void AIS_Shape::PrepareTriangulation(const int theMode, const Message_ProgressRange& theRange)
+{
+  if (myshape.IsNull() || (myshape.ShapeType() == TopAbs_COMPOUND && myshape.NbChildren() == 0)
+      || (theMode != AIS_WireFrame && theMode != AIS_Shaded))
+  {
+    return;
+  }
+
+  Message_ProgressScope aPS(theRange, "Preparing shape", 2);
+  try
+  {
+    OCC_CATCH_SIGNALS
+    // fill in triangulation left in deferred storage by the reader
+    StdPrs_ToolTriangulatedShape::LoadDeferredTriangulation(myshape, aPS.Next());
+    if (myDrawer->IsAutoTriangulation() && aPS.More())
+    {
+      // same preparation as within Compute(), which will find the shape already triangulated
+      StdPrs_ToolTriangulatedShape::ClearOnOwnDeflectionChange(myshape, myDrawer, true);
+      StdPrs_ToolTriangulatedShape::Tessellate(myshape, myDrawer, aPS.Next());
+    }
+    if (theMode != AIS_Shaded || !aPS.More())
+    {
+      return;
+    }
+
+    // normals are otherwise computed while filling triangles,
+    // which thus would modify triangulation as well
+    TopLoc_Location aLoc;
+    for (TopExp_Explorer aFaceIter(myshape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+    {
+      const TopoDS_Face&                     aFace = TopoDS::Face(aFaceIter.Current());
+      const occ::handle<Poly_Triangulation>& aTris = BRep_Tool::Triangulation(aFace, aLoc);
+      StdPrs_ToolTriangulatedShape::ComputeNormals(aFace, aTris);
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    Message::SendFail(
+      TCollection_AsciiString("Error: AIS_Shape::PrepareTriangulation() has failed (")
+      + anException.what() + ")");
+  }
+}
+
 //*****
 //***** Reset
 //=======================================================================
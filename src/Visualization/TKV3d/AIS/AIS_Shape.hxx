@@ -23,6 +23,7 @@
 #include <TopoDS_Shape.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <Prs3d_TypeOfHLR.hxx>
+#include <StdPrs_ShadedShapeLods.hxx>
 
 //! A framework to manage presentation and selection of shapes.
 //! AIS_Shape is the interactive object which is used the
@@ -175,6 +176,22 @@ public:
   //! which is not the same as above; keep it visible.
   using AIS_InteractiveObject::BoundingBox;
 
+  //! Returns the bounding box of the shape.
+  void PreviewBoundingBox(Bnd_Box& theBndBox) override { theBndBox = BoundingBox(); }
+
+  //! Loads deferred triangulation and triangulates the shape for shaded and wireframe modes.
+  Standard_EXPORT void PrepareCompute(const int                    theMode,
+                                      const Message_ProgressRange& theRange) override;
+
+  //! Loads deferred triangulation, triangulates the shape and, for shaded mode, computes normals
+  //! of the triangulation; called by PrepareCompute().
+  //! Triangulation is stored within the shape, so that the method should not be called
+  //! concurrently for objects sharing sub-shapes.
+  //! @param[in] theMode   display mode to be computed
+  //! @param[in] theRange  progress range
+  Standard_EXPORT void PrepareTriangulation(const int                    theMode,
+                                            const Message_ProgressRange& theRange);
+
   //! Returns the Color attributes of the shape accordingly to
   //! the current facing model;
   Standard_EXPORT void Color(Quantity_Color& aColor) const override;
@@ -266,6 +283,15 @@ public: //! @name methods to alter texture mapping properties
   //!          the texture will appear twice on the face in each direction.
   void SetTextureScaleUV(const gp_Pnt2d& theScaleUV) { myUVScale = theScaleUV; }
 
+public: //! @name methods to manage levels of detail of shaded presentation
+  //! Return builder of levels of detail; NULL by default.
+  const occ::handle<StdPrs_ShadedShapeLods>& Lods() const { return myLods; }
+
+  //! Sets builder of levels of detail for shaded presentation.
+  //! Levels not yet computed are started in the background thread on the next Compute(),
+  //! so that the presentation should be recomputed once StdPrs_ShadedShapeLods::IsDone().
+  void SetLods(const occ::handle<StdPrs_ShadedShapeLods>& theLods) { myLods = theLods; }
+
 protected:
   //! Compute normal presentation.
   Standard_EXPORT void Compute(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
@@ -333,6 +359,8 @@ protected:
   gp_Pnt2d     myUVScale;  //!< UV scale  vector for generating texture coordinates
   double       myInitAng;
   bool         myCompBB; //!< if TRUE, then bounding box should be recomputed
+
+  occ::handle<StdPrs_ShadedShapeLods> myLods; //!< levels of detail of shaded presentation
 };
 
 #endif // _AIS_Shape_HeaderFile
@@ -0,0 +1,201 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <AIS_ThumbnailRenderer.hxx>
+
+#include <AIS_ComputeTask.hxx>
+#include <AIS_DisplayMode.hxx>
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <V3d_ImageDumpOptions.hxx>
+
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(AIS_ThumbnailRenderer, Standard_Transient)
+
+//=================================================================================================
+
+AIS_ThumbnailRenderer::AIS_ThumbnailRenderer(const occ::handle<AIS_InteractiveContext>& theContext,
+                                             const occ::handle<V3d_View>&               theView)
+    : myContext(theContext),
+      myView(theView),
+      myPool(new AIS_ComputeThreadPool(1)),
+      myWidth(256),
+      myHeight(256),
+      myDispMode(AIS_Shaded),
+      myFitMargin(0.01)
+{
+}
+
+//=================================================================================================
+
+bool AIS_ThumbnailRenderer::Perform(
+  const NCollection_Array1<occ::handle<AIS_InteractiveObject>>& theObjects,
+  NCollection_Array1<occ::handle<Image_PixMap>>&                theImages,
+  const Message_ProgressRange&                                  theRange)
+{
+  theImages.Resize(theObjects.Lower(), theObjects.Upper(), false);
+  theImages.Init(occ::handle<Image_PixMap>());
+  return perform(theObjects, &theImages, nullptr, 0, theRange);
+}
+
+//=================================================================================================
+
+bool AIS_ThumbnailRenderer::PerformTiled(
+  const NCollection_Array1<occ::handle<AIS_InteractiveObject>>& theObjects,
+  Image_PixMap&                                                 theImage,
+  const int                                                     theNbColumns,
+  const Message_ProgressRange&                                  theRange)
+{
+  if (theNbColumns <= 0 || myWidth <= 0 || myHeight <= 0)
+  {
+    return false;
+  }
+
+  const int aNbRows = (theObjects.Length() + theNbColumns - 1) / theNbColumns;
+  if (!theImage.InitZero(Image_Format_RGB,
+                         size_t(myWidth) * size_t(theNbColumns),
+                         size_t(myHeight) * size_t(std::max(aNbRows, 1))))
+  {
+    Message::SendFail("Error: AIS_ThumbnailRenderer, unable to allocate tiled image");
+    return false;
+  }
+  return perform(theObjects, nullptr, &theImage, theNbColumns, theRange);
+}
+
+//=================================================================================================
+
+bool AIS_ThumbnailRenderer::perform(
+  const NCollection_Array1<occ::handle<AIS_InteractiveObject>>& theObjects,
+  NCollection_Array1<occ::handle<Image_PixMap>>*                theImages,
+  Image_PixMap*                                                 theTiledImage,
+  const int                                                     theNbColumns,
+  const Message_ProgressRange&                                  theRange)
+{
+  if (myContext.IsNull() || myView.IsNull() || myWidth <= 0 || myHeight <= 0)
+  {
+    return false;
+  }
+  else if (theObjects.IsEmpty())
+  {
+    return true;
+  }
+
+  // allocate offscreen buffer once for the whole batch;
+  // V3d_View::ToPixMap() reuses the view buffer when it is large enough
+  const occ::handle<Graphic3d_CView>& aView    = myView->View();
+  occ::handle<Standard_Transient>     aPrevFbo = aView->FBO();
+  occ::handle<Standard_Transient>     aFbo     = aView->FBOCreate(myWidth, myHeight);
+  if (!aFbo.IsNull())
+  {
+    aView->SetFBO(aFbo);
+  }
+
+  if (!theObjects.First().IsNull())
+  {
+    myPool->AddTask(new AIS_ComputeTask(theObjects.First(), myDispMode, -1));
+  }
+
+  bool                  isDone = true;
+  Image_PixMap          aTile;
+  Message_ProgressScope aPS(theRange, "Rendering thumbnails", theObjects.Length());
+  for (int anObjIter = theObjects.Lower(); anObjIter <= theObjects.Upper() && aPS.More();
+       ++anObjIter, aPS.Next())
+  {
+    // prepare the next object while the current one is being rendered
+    myPool->WaitThreads();
+    if (anObjIter < theObjects.Upper() && !theObjects.Value(anObjIter + 1).IsNull())
+    {
+      myPool->AddTask(new AIS_ComputeTask(theObjects.Value(anObjIter + 1), myDispMode, -1));
+    }
+
+    const occ::handle<AIS_InteractiveObject>& anObject = theObjects.Value(anObjIter);
+    if (anObject.IsNull())
+    {
+      isDone = false;
+      continue;
+    }
+
+    occ::handle<Image_PixMap> anImage = theImages != nullptr ? new Image_PixMap() : nullptr;
+    Image_PixMap&             aTarget = theImages != nullptr ? *anImage : aTile;
+    if (!renderObject(anObject, aTarget))
+    {
+      isDone = false;
+      continue;
+    }
+
+    if (theImages != nullptr)
+    {
+      theImages->SetValue(anObjIter, anImage);
+      continue;
+    }
+
+    // copy the tile row by row
+    const int    anIndex    = anObjIter - theObjects.Lower();
+    const size_t aTileCol   = size_t(anIndex % theNbColumns);
+    const size_t aTileRow   = size_t(anIndex / theNbColumns);
+    const size_t aRowBytes  = size_t(myWidth) * theTiledImage->SizePixelBytes();
+    const size_t aColOffset = aTileCol * aRowBytes;
+    for (size_t aRow = 0; aRow < size_t(myHeight); ++aRow)
+    {
+      std::memcpy(theTiledImage->ChangeRow(aTileRow * size_t(myHeight) + aRow) + aColOffset,
+                  aTile.Row(aRow),
+                  aRowBytes);
+    }
+  }
+
+  if (!aPS.More())
+  {
+    isDone = false;
+    myPool->CancelTasks();
+  }
+  myPool->WaitThreads();
+
+  aView->SetFBO(aPrevFbo);
+  if (!aFbo.IsNull())
+  {
+    aView->FBORelease(aFbo);
+  }
+  return isDone;
+}
+
+//=================================================================================================
+
+bool AIS_ThumbnailRenderer::renderObject(const occ::handle<AIS_InteractiveObject>& theObject,
+                                         Image_PixMap&                             theImage)
+{
+  myContext->Display(theObject, myDispMode, -1, false);
+
+  // frame only the thumbnail object, with aspect ratio of the thumbnail
+  Bnd_Box aBox;
+  theObject->BoundingBox(aBox);
+  myView->Camera()->SetAspect(double(myWidth) / double(myHeight));
+  if (!aBox.IsVoid())
+  {
+    myView->FitAll(aBox, myFitMargin, false);
+  }
+
+  V3d_ImageDumpOptions aParams;
+  aParams.Width          = myWidth;
+  aParams.Height         = myHeight;
+  aParams.BufferType     = Graphic3d_BT_RGB;
+  aParams.ToAdjustAspect = true;
+  if (theImage.Format() != Image_Format_RGB)
+  {
+    theImage.Clear();
+  }
+  const bool isDone = myView->ToPixMap(theImage, aParams);
+
+  myContext->Remove(theObject, false);
+  return isDone;
+}
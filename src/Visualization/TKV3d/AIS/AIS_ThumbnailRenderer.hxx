@@ -0,0 +1,127 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _AIS_ThumbnailRenderer_HeaderFile
+#define _AIS_ThumbnailRenderer_HeaderFile
+
+#include <AIS_ComputeThreadPool.hxx>
+#include <AIS_InteractiveContext.hxx>
+#include <Image_PixMap.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Array1.hxx>
+#include <V3d_View.hxx>
+
+//! Tool rendering thumbnails of many objects one after another
+//! within the same view, graphic context and offscreen buffer.
+//!
+//! Each object is displayed in the context without selection, framed by the camera,
+//! dumped into the image and removed from the context.
+//! Presentation data of the next object (e.g. shape triangulation) is prepared
+//! within the background thread (see AIS_InteractiveObject::PrepareCompute())
+//! while the current object is being rendered.
+//! The offscreen buffer of the thumbnail size is allocated once for the whole batch,
+//! and GLSL programs, textures and fonts stay in the same graphic context,
+//! so that per-thumbnail overhead is limited to the presentation itself.
+//!
+//! The view is expected to be dedicated to thumbnails; in headless environment
+//! it can be created for a virtual (offscreen) window.
+//! Objects already displayed in the context are rendered on every thumbnail,
+//! though the camera frames only the thumbnail object.
+class AIS_ThumbnailRenderer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(AIS_ThumbnailRenderer, Standard_Transient)
+public:
+  //! Creates the renderer.
+  //! @param[in] theContext  the context to display objects
+  //! @param[in] theView     the view of the context viewer to render thumbnails
+  Standard_EXPORT AIS_ThumbnailRenderer(const occ::handle<AIS_InteractiveContext>& theContext,
+                                        const occ::handle<V3d_View>&               theView);
+
+  //! Returns the context.
+  const occ::handle<AIS_InteractiveContext>& Context() const { return myContext; }
+
+  //! Returns the view.
+  const occ::handle<V3d_View>& View() const { return myView; }
+
+  //! Returns the thumbnail width; 256 by default.
+  int ThumbnailWidth() const { return myWidth; }
+
+  //! Returns the thumbnail height; 256 by default.
+  int ThumbnailHeight() const { return myHeight; }
+
+  //! Sets the thumbnail size.
+  void SetThumbnailSize(const int theWidth, const int theHeight)
+  {
+    myWidth  = theWidth;
+    myHeight = theHeight;
+  }
+
+  //! Returns the display mode of objects; AIS_Shaded by default.
+  int DisplayMode() const { return myDispMode; }
+
+  //! Sets the display mode of objects.
+  void SetDisplayMode(const int theMode) { myDispMode = theMode; }
+
+  //! Returns the margin for framing the object; 0.01 by default.
+  double FitMargin() const { return myFitMargin; }
+
+  //! Sets the margin for framing the object.
+  void SetFitMargin(const double theMargin) { myFitMargin = theMargin; }
+
+  //! Renders the thumbnail of each object into a separate image.
+  //! @param[in] theObjects  objects to render, should not be displayed in the context
+  //! @param[out] theImages  images of the same range as theObjects,
+  //!                        NULL for objects which have not been rendered
+  //! @param[in] theRange    the progress range, which can be used to interrupt rendering
+  //! @return FALSE if some thumbnail has not been rendered
+  Standard_EXPORT bool Perform(
+    const NCollection_Array1<occ::handle<AIS_InteractiveObject>>& theObjects,
+    NCollection_Array1<occ::handle<Image_PixMap>>&                theImages,
+    const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Renders thumbnails of objects into tiles of a single image (row by row, from top to bottom).
+  //! @param[in] theObjects    objects to render, should not be displayed in the context
+  //! @param[out] theImage     RGB image to be allocated for all tiles
+  //! @param[in] theNbColumns  number of tiles in a row
+  //! @param[in] theRange      the progress range, which can be used to interrupt rendering
+  //! @return FALSE if some thumbnail has not been rendered
+  Standard_EXPORT bool PerformTiled(
+    const NCollection_Array1<occ::handle<AIS_InteractiveObject>>& theObjects,
+    Image_PixMap&                                                 theImage,
+    const int                                                     theNbColumns,
+    const Message_ProgressRange& theRange = Message_ProgressRange());
+
+protected:
+  //! Renders thumbnails and passes them either into the array of images or into the tiled image.
+  Standard_EXPORT bool perform(
+    const NCollection_Array1<occ::handle<AIS_InteractiveObject>>& theObjects,
+    NCollection_Array1<occ::handle<Image_PixMap>>*                theImages,
+    Image_PixMap*                                                 theTiledImage,
+    const int                                                     theNbColumns,
+    const Message_ProgressRange&                                  theRange);
+
+  //! Renders the thumbnail of the single object.
+  Standard_EXPORT bool renderObject(const occ::handle<AIS_InteractiveObject>& theObject,
+                                    Image_PixMap&                             theImage);
+
+protected:
+  occ::handle<AIS_InteractiveContext> myContext;
+  occ::handle<V3d_View>               myView;
+  occ::handle<AIS_ComputeThreadPool>  myPool;
+  int                                 myWidth;
+  int                                 myHeight;
+  int                                 myDispMode;
+  double                              myFitMargin;
+};
+
+#endif // _AIS_ThumbnailRenderer_HeaderFile
@@ -32,6 +32,10 @@ set(OCCT_AIS_FILES
 
   AIS_ColorScale.cxx
   AIS_ColorScale.hxx
+  AIS_ComputeTask.cxx
+  AIS_ComputeTask.hxx
+  AIS_ComputeThreadPool.cxx
+  AIS_ComputeThreadPool.hxx
   AIS_ConnectedInteractive.cxx
   AIS_ConnectedInteractive.hxx
 
@@ -92,6 +96,8 @@ set(OCCT_AIS_FILES
   AIS_TextLabel.hxx
   AIS_TexturedShape.cxx
   AIS_TexturedShape.hxx
+  AIS_ThumbnailRenderer.cxx
+  AIS_ThumbnailRenderer.hxx
   AIS_Triangulation.cxx
   AIS_Triangulation.hxx
   AIS_Trihedron.cxx
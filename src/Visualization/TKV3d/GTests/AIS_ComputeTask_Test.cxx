@@ -0,0 +1,526 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <AIS_ComputeTask.hxx>
+#include <AIS_ComputeThreadPool.hxx>
+#include <AIS_InteractiveContext.hxx>
+#include <AIS_Shape.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <Graphic3d_CStructure.hxx>
+#include <Graphic3d_GraphicDriver.hxx>
+#include <Graphic3d_Group.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD.hxx>
+#include <Standard_Condition.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <V3d_Viewer.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+//! Returns TRUE if all faces of the shape have triangulation.
+bool isTriangulated(const TopoDS_Shape& theShape)
+{
+  TopLoc_Location aLoc;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    if (BRep_Tool::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc).IsNull())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! Triangulation copying nodes and triangles of another triangulation on deferred loading.
+class DeferredTriangulation : public Poly_Triangulation
+{
+public:
+  DeferredTriangulation(const occ::handle<Poly_Triangulation>& theSource)
+      : mySource(theSource)
+  {
+    Bnd_Box aBox;
+    theSource->MinMax(aBox, gp_Trsf());
+    SetCachedMinMax(aBox);
+  }
+
+  int NbDeferredNodes() const override { return mySource->NbNodes(); }
+
+  int NbDeferredTriangles() const override { return mySource->NbTriangles(); }
+
+protected:
+  bool loadDeferredData(const occ::handle<OSD_FileSystem>&     theFileSystem,
+                        const occ::handle<Poly_Triangulation>& theDestTriangulation) const override
+  {
+    (void)theFileSystem;
+    theDestTriangulation->ResizeNodes(mySource->NbNodes(), false);
+    for (int aNodeIter = 1; aNodeIter <= mySource->NbNodes(); ++aNodeIter)
+    {
+      theDestTriangulation->SetNode(aNodeIter, mySource->Node(aNodeIter));
+    }
+    theDestTriangulation->ResizeTriangles(mySource->NbTriangles(), false);
+    for (int aTriIter = 1; aTriIter <= mySource->NbTriangles(); ++aTriIter)
+    {
+      theDestTriangulation->SetTriangle(aTriIter, mySource->Triangle(aTriIter));
+    }
+    return true;
+  }
+
+private:
+  occ::handle<Poly_Triangulation> mySource;
+};
+
+//! Object recording the order of preview and preparation calls.
+class RecordingObject : public AIS_InteractiveObject
+{
+public:
+  RecordingObject(const TCollection_AsciiString&                     theName,
+                  NCollection_DynamicArray<TCollection_AsciiString>& theLog,
+                  std::mutex&                                        theMutex,
+                  Standard_Condition*                                theGate = nullptr)
+      : myName(theName),
+        myLog(&theLog),
+        myMutex(&theMutex),
+        myGate(theGate)
+  {
+  }
+
+  void PreviewBoundingBox(Bnd_Box& theBndBox) override
+  {
+    if (myGate != nullptr)
+    {
+      myGate->Wait();
+    }
+    theBndBox.Update(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+    std::lock_guard<std::mutex> aLock(*myMutex);
+    myLog->Append(TCollection_AsciiString("box ") + myName);
+  }
+
+  void PrepareCompute(const int theMode, const Message_ProgressRange& theRange) override
+  {
+    (void)theMode;
+    (void)theRange;
+    std::lock_guard<std::mutex> aLock(*myMutex);
+    myLog->Append(TCollection_AsciiString("prs ") + myName);
+  }
+
+  void Compute(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
+               const occ::handle<Prs3d_Presentation>&         thePrs,
+               const int                                      theMode) override
+  {
+    (void)thePrsMgr;
+    (void)thePrs;
+    (void)theMode;
+  }
+
+  void ComputeSelection(const occ::handle<SelectMgr_Selection>& theSel,
+                        const int                               theMode) override
+  {
+    (void)theSel;
+    (void)theMode;
+  }
+
+private:
+  TCollection_AsciiString                            myName;
+  NCollection_DynamicArray<TCollection_AsciiString>* myLog;
+  std::mutex*                                        myMutex;
+  Standard_Condition*                                myGate;
+};
+
+//! Object which preparation runs until it is cancelled.
+class BlockingObject : public RecordingObject
+{
+public:
+  BlockingObject(NCollection_DynamicArray<TCollection_AsciiString>& theLog, std::mutex& theMutex)
+      : RecordingObject("blocking", theLog, theMutex),
+        myStarted(false),
+        myIsInterrupted(false)
+  {
+  }
+
+  //! Waits for preparation to be started within the background thread.
+  void WaitStarted() { myStarted.Wait(); }
+
+  //! Returns TRUE if preparation has been interrupted by cancellation.
+  bool IsInterrupted() const { return myIsInterrupted; }
+
+  void PrepareCompute(const int theMode, const Message_ProgressRange& theRange) override
+  {
+    (void)theMode;
+    myStarted.Set();
+    while (!theRange.UserBreak())
+    {
+      OSD::MilliSecSleep(1);
+    }
+    myIsInterrupted = true;
+  }
+
+private:
+  Standard_Condition myStarted;
+  std::atomic<bool>  myIsInterrupted;
+};
+
+//! Group keeping no graphic resources.
+class DummyGroup : public Graphic3d_Group
+{
+public:
+  DummyGroup(const occ::handle<Graphic3d_Structure>& theStruct)
+      : Graphic3d_Group(theStruct)
+  {
+  }
+
+  occ::handle<Graphic3d_Aspects> Aspects() const override { return myAspects; }
+
+  void SetGroupPrimitivesAspect(const occ::handle<Graphic3d_Aspects>& theAspect) override
+  {
+    myAspects = theAspect;
+  }
+
+  void SetPrimitivesAspect(const occ::handle<Graphic3d_Aspects>& theAspect) override
+  {
+    myAspects = theAspect;
+  }
+
+  void SynchronizeAspects() override {}
+
+  void ReplaceAspects(
+    const NCollection_DataMap<occ::handle<Graphic3d_Aspects>, occ::handle<Graphic3d_Aspects>>&)
+    override
+  {
+  }
+
+  void SetStencilTestOptions(const bool) override {}
+
+  void SetFlippingOptions(const bool, const gp_Ax2&) override {}
+
+private:
+  occ::handle<Graphic3d_Aspects> myAspects;
+};
+
+//! Structure keeping no graphic resources.
+class DummyStructure : public Graphic3d_CStructure
+{
+public:
+  DummyStructure(const occ::handle<Graphic3d_StructureManager>& theManager)
+      : Graphic3d_CStructure(theManager)
+  {
+  }
+
+  void OnVisibilityChanged() override {}
+
+  void Clear() override { myGroups.Clear(); }
+
+  void Connect(Graphic3d_CStructure&) override {}
+
+  void Disconnect(Graphic3d_CStructure&) override {}
+
+  void GraphicHighlight(const occ::handle<Graphic3d_PresentationAttributes>&) override {}
+
+  void GraphicUnhighlight() override {}
+
+  occ::handle<Graphic3d_CStructure> ShadowLink(
+    const occ::handle<Graphic3d_StructureManager>& theManager) const override
+  {
+    return new DummyStructure(theManager);
+  }
+
+  occ::handle<Graphic3d_Group> NewGroup(const occ::handle<Graphic3d_Structure>& theStruct) override
+  {
+    occ::handle<Graphic3d_Group> aGroup = new DummyGroup(theStruct);
+    myGroups.Append(aGroup);
+    return aGroup;
+  }
+
+  void RemoveGroup(const occ::handle<Graphic3d_Group>& theGroup) override
+  {
+    for (NCollection_Sequence<occ::handle<Graphic3d_Group>>::Iterator aGroupIter(myGroups);
+         aGroupIter.More();
+         aGroupIter.Next())
+    {
+      if (aGroupIter.Value() == theGroup)
+      {
+        myGroups.Remove(aGroupIter);
+        return;
+      }
+    }
+  }
+};
+
+//! Graphic driver without views, allowing to display objects in the context without window.
+class DummyDriver : public Graphic3d_GraphicDriver
+{
+public:
+  DummyDriver()
+      : Graphic3d_GraphicDriver(occ::handle<Aspect_DisplayConnection>())
+  {
+  }
+
+  int InquireLimit(const Graphic3d_TypeOfLimit) const override { return 8; }
+
+  occ::handle<Graphic3d_CStructure> CreateStructure(
+    const occ::handle<Graphic3d_StructureManager>& theManager) override
+  {
+    return new DummyStructure(theManager);
+  }
+
+  void RemoveStructure(occ::handle<Graphic3d_CStructure>& theCStructure) override
+  {
+    theCStructure.Nullify();
+  }
+
+  occ::handle<Graphic3d_CView> CreateView(const occ::handle<Graphic3d_StructureManager>&) override
+  {
+    return occ::handle<Graphic3d_CView>();
+  }
+
+  void RemoveView(const occ::handle<Graphic3d_CView>&) override {}
+
+  void EnableVBO(const bool) override {}
+
+  bool IsVerticalSync() const override { return false; }
+
+  void SetVerticalSync(bool) override {}
+
+  bool MemoryInfo(size_t&, TCollection_AsciiString&) const override { return false; }
+
+  float DefaultTextHeight() const override { return 16.0f; }
+
+  void TextSize(const occ::handle<Graphic3d_CView>&,
+                const char* const,
+                const float theHeight,
+                float&      theWidth,
+                float&      theAscent,
+                float&      theDescent) const override
+  {
+    theWidth   = theHeight;
+    theAscent  = theHeight;
+    theDescent = 0.0f;
+  }
+
+  void InsertLayerBefore(const Graphic3d_ZLayerId,
+                         const Graphic3d_ZLayerSettings&,
+                         const Graphic3d_ZLayerId) override
+  {
+  }
+
+  void InsertLayerAfter(const Graphic3d_ZLayerId,
+                        const Graphic3d_ZLayerSettings&,
+                        const Graphic3d_ZLayerId) override
+  {
+  }
+
+  void RemoveZLayer(const Graphic3d_ZLayerId) override {}
+
+  void SetZLayerSettings(const Graphic3d_ZLayerId, const Graphic3d_ZLayerSettings&) override {}
+
+  bool ViewExists(const occ::handle<Aspect_Window>&, occ::handle<Graphic3d_CView>&) override
+  {
+    return false;
+  }
+};
+
+//! Creates the context displaying objects without views.
+occ::handle<AIS_InteractiveContext> createContext()
+{
+  occ::handle<V3d_Viewer> aViewer = new V3d_Viewer(new DummyDriver());
+  return new AIS_InteractiveContext(aViewer);
+}
+} // namespace
+
+TEST(AIS_ComputeTaskTest, PrepareShadedShape)
+{
+  const TopoDS_Shape           aSphere = BRepPrimAPI_MakeSphere(10.0).Shape();
+  occ::handle<AIS_Shape>       aPrs    = new AIS_Shape(aSphere);
+  occ::handle<AIS_ComputeTask> aTask   = new AIS_ComputeTask(aPrs, AIS_Shaded, 0);
+
+  occ::handle<AIS_ComputeThreadPool> aPool = new AIS_ComputeThreadPool(1);
+  aPool->AddTask(aTask);
+  aPool->WaitThreads();
+
+  EXPECT_TRUE(aTask->IsDone());
+  EXPECT_FALSE(aTask->IsCancelled());
+  ASSERT_TRUE(aTask->HasBoundingBox());
+  EXPECT_FALSE(aTask->BoundingBox().IsVoid());
+  EXPECT_TRUE(isTriangulated(aSphere));
+}
+
+TEST(AIS_ComputeTaskTest, CancelledTask)
+{
+  const TopoDS_Shape           aSphere = BRepPrimAPI_MakeSphere(10.0).Shape();
+  occ::handle<AIS_Shape>       aPrs    = new AIS_Shape(aSphere);
+  occ::handle<AIS_ComputeTask> aTask   = new AIS_ComputeTask(aPrs, AIS_Shaded, 0);
+  aTask->Cancel();
+
+  occ::handle<AIS_ComputeThreadPool> aPool = new AIS_ComputeThreadPool(1);
+  aPool->AddTask(aTask);
+  aPool->WaitThreads();
+
+  EXPECT_TRUE(aTask->IsDone());
+  EXPECT_TRUE(aTask->IsCancelled());
+  EXPECT_FALSE(isTriangulated(aSphere));
+}
+
+TEST(AIS_ComputeTaskTest, PreviewsFirstThenByPriority)
+{
+  NCollection_DynamicArray<TCollection_AsciiString> aLog;
+  std::mutex                                        aMutex;
+  Standard_Condition                                aGate(false);
+
+  // the first task holds the thread until all other tasks are queued
+  occ::handle<AIS_ComputeThreadPool> aPool = new AIS_ComputeThreadPool(1);
+  aPool->AddTask(new AIS_ComputeTask(new RecordingObject("0", aLog, aMutex, &aGate), 0, -1));
+
+  const char*  aNames[3]      = {"1", "2", "3"};
+  const double aPriorities[3] = {1.0, 3.0, 2.0};
+  for (int anIter = 0; anIter < 3; ++anIter)
+  {
+    occ::handle<AIS_ComputeTask> aTask =
+      new AIS_ComputeTask(new RecordingObject(aNames[anIter], aLog, aMutex), 0, -1);
+    aTask->SetPriority(aPriorities[anIter]);
+    aPool->AddTask(aTask);
+  }
+  aGate.Set();
+  aPool->WaitThreads();
+
+  const char* anExpected[8] =
+    {"box 0", "box 1", "box 2", "box 3", "prs 2", "prs 3", "prs 1", "prs 0"};
+  ASSERT_EQ(aLog.Length(), 8);
+  for (int anIter = 0; anIter < 8; ++anIter)
+  {
+    EXPECT_STREQ(aLog.Value(anIter).ToCString(), anExpected[anIter]) << "Step " << anIter;
+  }
+}
+
+TEST(AIS_ComputeTaskTest, LoadDeferredTriangulation)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  BRepMesh_IncrementalMesh(aBox, 0.1);
+  TopLoc_Location                        aLoc;
+  const occ::handle<Poly_Triangulation>& aSource =
+    BRep_Tool::Triangulation(TopoDS::Face(TopExp_Explorer(aBox, TopAbs_FACE).Current()), aLoc);
+  ASSERT_FALSE(aSource.IsNull());
+
+  // face without surface, which mesh should be loaded from deferred storage
+  occ::handle<Poly_Triangulation> aDeferred = new DeferredTriangulation(aSource);
+  TopoDS_Face                     aFace;
+  BRep_Builder().MakeFace(aFace, aDeferred);
+  EXPECT_TRUE(aDeferred->HasDeferredData());
+  EXPECT_EQ(aDeferred->NbNodes(), 0);
+
+  occ::handle<AIS_Shape>       aPrs  = new AIS_Shape(aFace);
+  occ::handle<AIS_ComputeTask> aTask = new AIS_ComputeTask(aPrs, AIS_Shaded, 0);
+
+  occ::handle<AIS_ComputeThreadPool> aPool = new AIS_ComputeThreadPool(1);
+  aPool->AddTask(aTask);
+  aPool->WaitThreads();
+
+  ASSERT_TRUE(aTask->IsDone());
+  ASSERT_TRUE(aTask->HasBoundingBox());
+  EXPECT_FALSE(aTask->BoundingBox().IsVoid());
+  EXPECT_EQ(aDeferred->NbNodes(), aSource->NbNodes());
+  EXPECT_EQ(aDeferred->NbTriangles(), aSource->NbTriangles());
+}
+
+TEST(AIS_ComputeTaskTest, DisplayAsyncThenUpdate)
+{
+  NCollection_DynamicArray<TCollection_AsciiString> aLog;
+  std::mutex                                        aMutex;
+  occ::handle<AIS_InteractiveContext>               aCtx = createContext();
+  occ::handle<RecordingObject>                      anObj = new RecordingObject("1", aLog, aMutex);
+
+  occ::handle<AIS_ComputeTask> aTask = aCtx->DisplayAsync(anObj, false);
+  ASSERT_FALSE(aTask.IsNull());
+  EXPECT_EQ(aCtx->AsyncTask(anObj), aTask);
+  EXPECT_EQ(aCtx->NbAsyncTasks(), 1);
+  EXPECT_FALSE(aCtx->IsDisplayed(anObj));
+
+  // the same task is returned for the object in progress
+  EXPECT_EQ(aCtx->DisplayAsync(anObj, false), aTask);
+
+  aCtx->WaitAsync();
+  EXPECT_TRUE(aTask->IsDone());
+  EXPECT_TRUE(aCtx->UpdateAsync(false));
+  EXPECT_EQ(aCtx->NbAsyncTasks(), 0);
+  EXPECT_TRUE(aCtx->AsyncTask(anObj).IsNull());
+  EXPECT_TRUE(aCtx->IsDisplayed(anObj));
+  EXPECT_FALSE(aCtx->UpdateAsync(false));
+
+  ASSERT_EQ(aLog.Length(), 2);
+  EXPECT_STREQ(aLog.Value(0).ToCString(), "box 1");
+  EXPECT_STREQ(aLog.Value(1).ToCString(), "prs 1");
+}
+
+TEST(AIS_ComputeTaskTest, CancelAsyncWaitsRunningTask)
+{
+  NCollection_DynamicArray<TCollection_AsciiString> aLog;
+  std::mutex                                        aMutex;
+  occ::handle<AIS_InteractiveContext>               aCtx  = createContext();
+  occ::handle<BlockingObject>                       anObj = new BlockingObject(aLog, aMutex);
+
+  occ::handle<AIS_ComputeTask> aTask = aCtx->DisplayAsync(anObj, false);
+  ASSERT_FALSE(aTask.IsNull());
+  anObj->WaitStarted();
+
+  aCtx->CancelAsync(anObj, false);
+  EXPECT_TRUE(aTask->IsCancelled());
+  EXPECT_TRUE(aTask->IsDone());
+  EXPECT_TRUE(anObj->IsInterrupted());
+  EXPECT_EQ(aCtx->NbAsyncTasks(), 0);
+  EXPECT_FALSE(aCtx->UpdateAsync(false));
+  EXPECT_FALSE(aCtx->IsDisplayed(anObj));
+}
+
+TEST(AIS_ComputeTaskTest, SyncCallsOnPendingObject)
+{
+  NCollection_DynamicArray<TCollection_AsciiString> aLog;
+  std::mutex                                        aMutex;
+  occ::handle<AIS_InteractiveContext>               aCtx = createContext();
+
+  // Remove() cancels the running task before returning
+  occ::handle<BlockingObject>  aRemoved     = new BlockingObject(aLog, aMutex);
+  occ::handle<AIS_ComputeTask> aRemovedTask = aCtx->DisplayAsync(aRemoved, false);
+  aRemoved->WaitStarted();
+  aCtx->Remove(aRemoved, false);
+  EXPECT_TRUE(aRemovedTask->IsDone());
+  EXPECT_EQ(aCtx->NbAsyncTasks(), 0);
+  EXPECT_FALSE(aCtx->IsDisplayed(aRemoved));
+
+  // Display() shows the pending object synchronously
+  occ::handle<BlockingObject>  aDisplayed     = new BlockingObject(aLog, aMutex);
+  occ::handle<AIS_ComputeTask> aDisplayedTask = aCtx->DisplayAsync(aDisplayed, false);
+  aDisplayed->WaitStarted();
+  aCtx->Display(aDisplayed, false);
+  EXPECT_TRUE(aDisplayedTask->IsDone());
+  EXPECT_EQ(aCtx->NbAsyncTasks(), 0);
+  EXPECT_TRUE(aCtx->IsDisplayed(aDisplayed));
+
+  // Erase() of the pending object cancels its display
+  occ::handle<BlockingObject>  anErased     = new BlockingObject(aLog, aMutex);
+  occ::handle<AIS_ComputeTask> anErasedTask = aCtx->DisplayAsync(anErased, false);
+  anErased->WaitStarted();
+  aCtx->Erase(anErased, false);
+  EXPECT_TRUE(anErasedTask->IsDone());
+  EXPECT_EQ(aCtx->NbAsyncTasks(), 0);
+  EXPECT_FALSE(aCtx->UpdateAsync(false));
+  EXPECT_FALSE(aCtx->IsDisplayed(anErased));
+}
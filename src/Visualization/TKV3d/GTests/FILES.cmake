@@ -3,5 +3,10 @@ set(OCCT_TKV3d_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKV3d_GTests_FILES
   AIS_ColoredShape_Test.cxx
+  AIS_ComputeTask_Test.cxx
+  Prs3d_WireframeCache_Test.cxx
+  Select3D_SensitiveInstances_Test.cxx
   Select3D_SensitivePrimitiveArray_Test.cxx
+  SelectMgr_ViewerSelector_Test.cxx
+  StdPrs_ShadedShapeLods_Test.cxx
 )
@@ -0,0 +1,137 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Graphic3d_ArrayOfPrimitives.hxx>
+#include <Prs3d_Drawer.hxx>
+#include <Prs3d_WireframeCache.hxx>
+#include <StdPrs_ToolTriangulatedShape.hxx>
+#include <StdPrs_WFShape.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the number of edges in the shape.
+int nbEdges(const TopoDS_Shape& theShape)
+{
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> anEdges;
+  TopExp::MapShapes(theShape, TopAbs_EDGE, anEdges);
+  return anEdges.Extent();
+}
+
+//! Returns the first edge polyline cached for the shape.
+occ::handle<NCollection_HSequence<gp_Pnt>> cachedPolyline(
+  const occ::handle<Prs3d_WireframeCache>& theCache,
+  const TopoDS_Shape&                      theEdge,
+  const Prs3d_WireframeCache::Parameters&  theParams)
+{
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines, anUnused;
+  if (!theCache->Find(theEdge, theParams, aPolylines, anUnused) || aPolylines.IsEmpty())
+  {
+    return occ::handle<NCollection_HSequence<gp_Pnt>>();
+  }
+  return aPolylines.First();
+}
+} // namespace
+
+TEST(Prs3d_WireframeCacheTest, FindRequiresSameParameters)
+{
+  const TopoDS_Shape aCyl = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+  TopExp_Explorer    anEdgeIter(aCyl, TopAbs_EDGE);
+
+  occ::handle<NCollection_HSequence<gp_Pnt>> aPoints = new NCollection_HSequence<gp_Pnt>();
+  aPoints->Append(gp_Pnt(0.0, 0.0, 0.0));
+  aPoints->Append(gp_Pnt(1.0, 0.0, 0.0));
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines, anEmpty;
+  aPolylines.Append(aPoints);
+
+  occ::handle<Prs3d_WireframeCache> aCache = new Prs3d_WireframeCache();
+  Prs3d_WireframeCache::Parameters  aParams;
+  aParams.Deflection = 0.1;
+  aCache->Bind(anEdgeIter.Current(), aParams, aPolylines, anEmpty);
+  EXPECT_EQ(aCache->Extent(), 1);
+
+  // location and orientation of the sub-shape are ignored
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(0.0, 0.0, 10.0));
+  const TopoDS_Shape aMoved = anEdgeIter.Current().Moved(TopLoc_Location(aTrsf)).Reversed();
+  EXPECT_EQ(cachedPolyline(aCache, aMoved, aParams), aPoints);
+
+  Prs3d_WireframeCache::Parameters anOtherParams = aParams;
+  anOtherParams.Deflection = 0.2;
+  EXPECT_TRUE(cachedPolyline(aCache, anEdgeIter.Current(), anOtherParams).IsNull());
+
+  anOtherParams                      = aParams;
+  anOtherParams.DeviationCoefficient = 0.01;
+  EXPECT_TRUE(cachedPolyline(aCache, anEdgeIter.Current(), anOtherParams).IsNull());
+
+  aCache->Remove(aMoved);
+  EXPECT_EQ(aCache->Extent(), 0);
+}
+
+TEST(Prs3d_WireframeCacheTest, EdgesReusedAcrossRecomputeAndInstances)
+{
+  const TopoDS_Shape aCyl = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+
+  occ::handle<Prs3d_Drawer>         aDrawer = new Prs3d_Drawer();
+  occ::handle<Prs3d_WireframeCache> aCache  = new Prs3d_WireframeCache();
+  aDrawer->SetWireframeCache(aCache);
+
+  const occ::handle<Graphic3d_ArrayOfPrimitives> aRef =
+    StdPrs_WFShape::AddAllEdges(aCyl, aDrawer);
+  ASSERT_FALSE(aRef.IsNull());
+  EXPECT_EQ(aCache->Extent(), nbEdges(aCyl));
+
+  // the drawer without cache produces the same result
+  occ::handle<Prs3d_Drawer>                      aPlainDrawer = new Prs3d_Drawer();
+  const occ::handle<Graphic3d_ArrayOfPrimitives> aPlain =
+    StdPrs_WFShape::AddAllEdges(aCyl, aPlainDrawer);
+  ASSERT_FALSE(aPlain.IsNull());
+  EXPECT_EQ(aRef->VertexNumber(), aPlain->VertexNumber());
+
+  // recomputation reuses the same polylines
+  Prs3d_WireframeCache::Parameters aParams;
+  aParams.Deflection            = StdPrs_ToolTriangulatedShape::GetDeflection(aCyl, aDrawer);
+  aParams.DeviationCoefficient  = aDrawer->DeviationCoefficient();
+  aParams.DeviationAngle        = aDrawer->DeviationAngle();
+  aParams.MaximalParameterValue = aDrawer->MaximalParameterValue();
+  const TopoDS_Shape anEdge     = TopExp_Explorer(aCyl, TopAbs_EDGE).Current();
+  const occ::handle<NCollection_HSequence<gp_Pnt>> aCached =
+    cachedPolyline(aCache, anEdge, aParams);
+  ASSERT_FALSE(aCached.IsNull());
+
+  const occ::handle<Graphic3d_ArrayOfPrimitives> aSecond =
+    StdPrs_WFShape::AddAllEdges(aCyl, aDrawer);
+  EXPECT_EQ(aCache->Extent(), nbEdges(aCyl));
+  EXPECT_EQ(aSecond->VertexNumber(), aRef->VertexNumber());
+  EXPECT_EQ(cachedPolyline(aCache, anEdge, aParams), aCached);
+
+  // located instance shares the cache and gets transformed polylines
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(100.0, 0.0, 0.0));
+  const TopoDS_Shape                             aMoved = aCyl.Moved(TopLoc_Location(aTrsf));
+  const occ::handle<Graphic3d_ArrayOfPrimitives> aMovedArr =
+    StdPrs_WFShape::AddAllEdges(aMoved, aDrawer);
+  EXPECT_EQ(aCache->Extent(), nbEdges(aCyl));
+  ASSERT_EQ(aMovedArr->VertexNumber(), aRef->VertexNumber());
+  // vertices are stored in single precision
+  for (int aVertIter = 1; aVertIter <= aRef->VertexNumber(); ++aVertIter)
+  {
+    EXPECT_TRUE(aRef->Vertice(aVertIter).Transformed(aTrsf).IsEqual(aMovedArr->Vertice(aVertIter),
+                                                                    1.0e-4));
+  }
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+#include <Graphic3d_InstanceBuffer.hxx>
+#include <Select3D_SensitiveBox.hxx>
+#include <Select3D_SensitiveInstances.hxx>
+#include <SelectMgr_EntityOwner.hxx>
+#include <SelectMgr_SelectingVolumeManager.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Creates instances of unit box translated along X axis with step 10.
+occ::handle<Select3D_SensitiveInstances> createInstances(const int theNbInstances)
+{
+  occ::handle<SelectMgr_EntityOwner> anOwner = new SelectMgr_EntityOwner();
+  occ::handle<Select3D_SensitiveBox> aBox =
+    new Select3D_SensitiveBox(anOwner, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+
+  occ::handle<Graphic3d_InstanceBuffer> anInstances = new Graphic3d_InstanceBuffer();
+  for (int anInstIter = 0; anInstIter < theNbInstances; ++anInstIter)
+  {
+    gp_Trsf aTrsf;
+    aTrsf.SetTranslation(gp_Vec(10.0 * anInstIter, 0.0, 0.0));
+    anInstances->AddInstance(aTrsf);
+  }
+
+  occ::handle<Select3D_SensitiveInstances> aSens =
+    new Select3D_SensitiveInstances(anOwner, aBox, anInstances);
+  aSens->BVH();
+  return aSens;
+}
+
+//! Picks the entity by axis parallel to Z going through the given point.
+bool pickByAxis(const occ::handle<Select3D_SensitiveInstances>& theSens,
+                const double                                    theX,
+                const double                                    theY,
+                SelectBasics_PickResult&                        thePickResult)
+{
+  SelectMgr_SelectingVolumeManager aMgr;
+  aMgr.InitAxisSelectingVolume(gp_Ax1(gp_Pnt(theX, theY, 10.0), gp_Dir(0.0, 0.0, -1.0)));
+  aMgr.BuildSelectingVolume();
+  return theSens->Matches(aMgr, thePickResult);
+}
+} // namespace
+
+TEST(Select3D_SensitiveInstancesTest, BoundingBox)
+{
+  occ::handle<Select3D_SensitiveInstances> aSens = createInstances(3);
+  EXPECT_EQ(aSens->NbInstances(), 3);
+  EXPECT_EQ(aSens->NbSubElements(), 3 * aSens->BaseEntity()->NbSubElements());
+
+  const Select3D_BndBox3d aBox = aSens->BoundingBox();
+  ASSERT_TRUE(aBox.IsValid());
+  EXPECT_NEAR(aBox.CornerMin().x(), 0.0, 1.0e-12);
+  EXPECT_NEAR(aBox.CornerMax().x(), 21.0, 1.0e-12);
+  EXPECT_NEAR(aBox.CornerMax().y(), 1.0, 1.0e-12);
+
+  const gp_Pnt aCenter = aSens->CenterOfGeometry();
+  EXPECT_NEAR(aCenter.X(), 10.5, 1.0e-12);
+  EXPECT_NEAR(aCenter.Y(), 0.5, 1.0e-12);
+}
+
+TEST(Select3D_SensitiveInstancesTest, PickInstance)
+{
+  occ::handle<Select3D_SensitiveInstances> aSens = createInstances(3);
+
+  SelectBasics_PickResult aPickResult;
+  ASSERT_TRUE(pickByAxis(aSens, 20.5, 0.5, aPickResult));
+  EXPECT_EQ(aSens->LastDetectedInstance(), 3);
+  ASSERT_TRUE(aPickResult.HasPickedPoint());
+  EXPECT_NEAR(aPickResult.PickedPoint().X(), 20.5, 1.0e-7);
+  EXPECT_NEAR(aPickResult.PickedPoint().Y(), 0.5, 1.0e-7);
+  EXPECT_NEAR(aPickResult.PickedPoint().Z(), 1.0, 1.0e-7);
+
+  SelectBasics_PickResult aPickResult2;
+  ASSERT_TRUE(pickByAxis(aSens, 0.5, 0.5, aPickResult2));
+  EXPECT_EQ(aSens->LastDetectedInstance(), 1);
+
+  // gap between instances
+  SelectBasics_PickResult aPickResult3;
+  EXPECT_FALSE(pickByAxis(aSens, 5.0, 0.5, aPickResult3));
+}
+
+TEST(Select3D_SensitiveInstancesTest, PickScaledInstance)
+{
+  occ::handle<SelectMgr_EntityOwner> anOwner = new SelectMgr_EntityOwner();
+  occ::handle<Select3D_SensitiveBox> aBox =
+    new Select3D_SensitiveBox(anOwner, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+
+  gp_Trsf aTrsf;
+  aTrsf.SetScale(gp_Pnt(0.0, 0.0, 0.0), 2.0);
+  occ::handle<Select3D_SensitiveInstances> aSens =
+    new Select3D_SensitiveInstances(anOwner, aBox);
+  aSens->AddInstance(aTrsf);
+  aSens->BVH();
+
+  // depth should be measured in coordinate system of the set, not of the instance
+  SelectBasics_PickResult aPickResult;
+  ASSERT_TRUE(pickByAxis(aSens, 1.5, 1.5, aPickResult));
+  ASSERT_TRUE(aPickResult.HasPickedPoint());
+  EXPECT_NEAR(aPickResult.PickedPoint().Z(), 2.0, 1.0e-7);
+  EXPECT_NEAR(aPickResult.Depth(), 8.0, 1.0e-7);
+}
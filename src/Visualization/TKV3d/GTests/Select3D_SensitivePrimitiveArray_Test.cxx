@@ -12,9 +12,12 @@
 // commercial license or contractual agreement.
 
 #include <Graphic3d_ArrayOfTriangles.hxx>
+#include <Graphic3d_Camera.hxx>
 #include <Precision.hxx>
 #include <Select3D_SensitivePrimitiveArray.hxx>
+#include <SelectBasics_PickResult.hxx>
 #include <SelectMgr_EntityOwner.hxx>
+#include <SelectMgr_SelectingVolumeManager.hxx>
 #include <TopLoc_Location.hxx>
 
 #include <gtest/gtest.h>
@@ -42,3 +45,70 @@ TEST(Select3D_SensitivePrimitiveArrayTest, GetVertex_ReturnsTriangleVertices)
   EXPECT_NEAR(aVertices[2].y(), 1.0f, float(Precision::Confusion()));
   EXPECT_NEAR(aVertices[2].z(), 0.0f, float(Precision::Confusion()));
 }
+
+TEST(Select3D_SensitivePrimitiveArrayTest, Matches_GroupsParallelOnlyWhenAllowed)
+{
+  // grid of 20x20 quads within [-40, 40] range of XY plane
+  const int                               aNbCells = 20;
+  occ::handle<Graphic3d_ArrayOfTriangles> aTris =
+    new Graphic3d_ArrayOfTriangles((aNbCells + 1) * (aNbCells + 1), aNbCells * aNbCells * 6);
+  for (int aRow = 0; aRow <= aNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= aNbCells; ++aCol)
+    {
+      aTris->AddVertex(-40.0 + aCol * 4.0, -40.0 + aRow * 4.0, 0.0);
+    }
+  }
+  for (int aRow = 0; aRow < aNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < aNbCells; ++aCol)
+    {
+      const int aNode = aRow * (aNbCells + 1) + aCol + 1;
+      aTris->AddEdges(aNode, aNode + 1, aNode + aNbCells + 2);
+      aTris->AddEdges(aNode, aNode + aNbCells + 2, aNode + aNbCells + 1);
+    }
+  }
+
+  occ::handle<SelectMgr_EntityOwner>            anOwner = new SelectMgr_EntityOwner();
+  occ::handle<Select3D_SensitivePrimitiveArray> aSens =
+    new Select3D_SensitivePrimitiveArray(anOwner);
+  ASSERT_TRUE(aSens->InitTriangulation(aTris->Attributes(),
+                                       aTris->Indices(),
+                                       TopLoc_Location(),
+                                       true,
+                                       8));
+  aSens->SetDetectElementMap(true);
+
+  // rectangle covering the left half of the grid within 100x100 window showing [-50, 50] range
+  occ::handle<Graphic3d_Camera> aCamera = new Graphic3d_Camera();
+  aCamera->SetProjectionType(Graphic3d_Camera::Projection_Orthographic);
+  aCamera->SetEye(gp_Pnt(0.0, 0.0, 100.0));
+  aCamera->SetCenter(gp_Pnt(0.0, 0.0, 0.0));
+  aCamera->SetUp(gp_Dir(0.0, 1.0, 0.0));
+  aCamera->SetScale(100.0);
+  aCamera->SetAspect(1.0);
+
+  SelectMgr_SelectingVolumeManager aMgr;
+  aMgr.InitBoxSelectingVolume(gp_Pnt2d(5.0, 5.0), gp_Pnt2d(50.5, 95.0));
+  aMgr.SetCamera(aCamera);
+  aMgr.SetWindowSize(100, 100);
+  aMgr.BuildSelectingVolume();
+  EXPECT_FALSE(aMgr.ToTraverseParallel());
+
+  SelectBasics_PickResult aSeqResult;
+  ASSERT_TRUE(aSens->Matches(aMgr, aSeqResult));
+  const TColStd_PackedMapOfInteger aSeqElems = aSens->LastDetectedElementMap()->Map();
+  EXPECT_EQ(aSeqElems.Extent(), aNbCells * aNbCells);
+
+  aMgr.SetToTraverseParallel(true);
+  SelectBasics_PickResult aParResult;
+  ASSERT_TRUE(aSens->Matches(aMgr, aParResult));
+  const TColStd_PackedMapOfInteger& aParElems = aSens->LastDetectedElementMap()->Map();
+  EXPECT_EQ(aParElems.Extent(), aSeqElems.Extent());
+  for (TColStd_PackedMapOfInteger::Iterator anElemIter(aSeqElems); anElemIter.More();
+       anElemIter.Next())
+  {
+    EXPECT_TRUE(aParElems.Contains(anElemIter.Key())) << "Element " << anElemIter.Key();
+  }
+  EXPECT_EQ(aParResult.Depth(), aSeqResult.Depth());
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <AIS_Shape.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <Graphic3d_Camera.hxx>
+#include <SelectMgr_SelectionManager.hxx>
+#include <SelectMgr_ViewerSelector.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Shape reporting its bounding box without computed presentation,
+//! so that it can be picked without being displayed.
+class TestShape : public AIS_Shape
+{
+public:
+  TestShape(const TopoDS_Shape& theShape)
+      : AIS_Shape(theShape)
+  {
+  }
+
+  void BoundingBox(Bnd_Box& theBndBox) override { theBndBox = AIS_Shape::BoundingBox(); }
+};
+
+//! Selector performing rubber-band selection without a view.
+class TestViewerSelector : public SelectMgr_ViewerSelector
+{
+public:
+  //! Selects objects within the rectangle defined in pixels
+  //! of 100x100 window showing [-50, 50] range of XY plane.
+  void PickBox(const gp_Pnt2d& theMinPt, const gp_Pnt2d& theMaxPt)
+  {
+    occ::handle<Graphic3d_Camera> aCamera = new Graphic3d_Camera();
+    aCamera->SetProjectionType(Graphic3d_Camera::Projection_Orthographic);
+    aCamera->SetEye(gp_Pnt(0.0, 0.0, 100.0));
+    aCamera->SetCenter(gp_Pnt(0.0, 0.0, 0.0));
+    aCamera->SetUp(gp_Dir(0.0, 1.0, 0.0));
+    aCamera->SetScale(100.0);
+    aCamera->SetAspect(1.0);
+
+    mySelectingVolumeMgr.InitBoxSelectingVolume(theMinPt, theMaxPt);
+    mySelectingVolumeMgr.SetCamera(aCamera);
+    mySelectingVolumeMgr.SetWindowSize(100, 100);
+    mySelectingVolumeMgr.BuildSelectingVolume();
+    TraverseSensitives();
+  }
+};
+
+//! Collects picked owners in the order of picking ranks.
+NCollection_Sequence<occ::handle<SelectMgr_EntityOwner>> pickedOwners(
+  const occ::handle<TestViewerSelector>& theSelector)
+{
+  NCollection_Sequence<occ::handle<SelectMgr_EntityOwner>> anOwners;
+  for (int aRank = 1; aRank <= theSelector->NbPicked(); ++aRank)
+  {
+    anOwners.Append(theSelector->Picked(aRank));
+  }
+  return anOwners;
+}
+} // namespace
+
+TEST(SelectMgr_ViewerSelectorTest, TraverseParallel_MatchesSequential)
+{
+  occ::handle<TestViewerSelector>         aSelector = new TestViewerSelector();
+  occ::handle<SelectMgr_SelectionManager> aSelMgr   = new SelectMgr_SelectionManager(aSelector);
+
+  // row of boxes 1x1x1 placed along X axis within [-40, 40] range
+  NCollection_Sequence<occ::handle<AIS_Shape>> aShapes;
+  for (int aBoxIter = 0; aBoxIter < 40; ++aBoxIter)
+  {
+    const double           aX = -40.0 + aBoxIter * 2.0;
+    occ::handle<AIS_Shape> aShape =
+      new TestShape(BRepPrimAPI_MakeBox(gp_Pnt(aX, 0.0, 0.0), 1.0, 1.0, 1.0).Shape());
+    aSelMgr->Load(aShape);
+    aSelMgr->Activate(aShape, 0);
+    aShapes.Append(aShape);
+  }
+
+  // rectangle covering boxes within [-40, 0) range, i.e. half of them
+  const gp_Pnt2d aMinPt(5.0, 40.0), aMaxPt(49.5, 60.0);
+  aSelector->SetToTraverseParallel(false);
+  aSelector->PickBox(aMinPt, aMaxPt);
+  const NCollection_Sequence<occ::handle<SelectMgr_EntityOwner>> aSeqOwners =
+    pickedOwners(aSelector);
+  EXPECT_EQ(aSeqOwners.Length(), 20);
+
+  aSelector->SetToTraverseParallel(true);
+  EXPECT_TRUE(aSelector->ToTraverseParallel());
+  aSelector->PickBox(aMinPt, aMaxPt);
+  const NCollection_Sequence<occ::handle<SelectMgr_EntityOwner>> aParOwners =
+    pickedOwners(aSelector);
+  ASSERT_EQ(aParOwners.Length(), aSeqOwners.Length());
+  for (int aRank = 1; aRank <= aSeqOwners.Length(); ++aRank)
+  {
+    EXPECT_EQ(aParOwners.Value(aRank), aSeqOwners.Value(aRank)) << "Rank " << aRank;
+  }
+
+  // selection of all boxes
+  aSelector->PickBox(gp_Pnt2d(0.0, 0.0), gp_Pnt2d(100.0, 100.0));
+  EXPECT_EQ(aSelector->NbPicked(), 40);
+}
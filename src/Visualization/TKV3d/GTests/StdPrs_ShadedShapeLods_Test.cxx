@@ -0,0 +1,94 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <StdPrs_ShadedShapeLods.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the number of triangles within the shape triangulation.
+int nbTriangles(const TopoDS_Shape& theShape)
+{
+  int aNbTris = 0;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& aTris =
+      BRep_Tool::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc);
+    if (!aTris.IsNull())
+    {
+      aNbTris += aTris->NbTriangles();
+    }
+  }
+  return aNbTris;
+}
+
+//! Creates a finely meshed sphere.
+TopoDS_Shape createSphere()
+{
+  const TopoDS_Shape aSphere = BRepPrimAPI_MakeSphere(10.0).Shape();
+  BRepMesh_IncrementalMesh(aSphere, 0.01);
+  return aSphere;
+}
+} // namespace
+
+TEST(StdPrs_ShadedShapeLodsTest, Perform_DecimatesTriangulation)
+{
+  const TopoDS_Shape aSphere = createSphere();
+  const int          aNbTris = nbTriangles(aSphere);
+  ASSERT_GT(aNbTris, 0);
+
+  occ::handle<StdPrs_ShadedShapeLods> aLods = new StdPrs_ShadedShapeLods(aSphere);
+  EXPECT_EQ(aLods->AddLevel(0.02, 200.0), 1);
+  EXPECT_EQ(aLods->AddLevel(0.1, 50.0), 2);
+  EXPECT_FALSE(aLods->IsDone());
+  aLods->Perform();
+  ASSERT_TRUE(aLods->IsDone());
+  ASSERT_EQ(aLods->NbLevels(), 2);
+
+  const StdPrs_ShadedShapeLods::Level& aFine   = aLods->Value(1);
+  const StdPrs_ShadedShapeLods::Level& aCoarse = aLods->Value(2);
+  ASSERT_FALSE(aFine.Closed.IsNull());
+  ASSERT_FALSE(aCoarse.Closed.IsNull());
+  EXPECT_TRUE(aFine.Opened.IsNull());
+  EXPECT_GT(aCoarse.Closed->ItemNumber(), 0);
+  EXPECT_LT(aFine.Closed->ItemNumber(), aNbTris);
+  EXPECT_LT(aCoarse.Closed->ItemNumber(), aFine.Closed->ItemNumber());
+  EXPECT_TRUE(aCoarse.Closed->HasVertexNormals());
+}
+
+TEST(StdPrs_ShadedShapeLodsTest, PerformAsync_MatchesSequential)
+{
+  const TopoDS_Shape aSphere = createSphere();
+
+  occ::handle<StdPrs_ShadedShapeLods> aSeqLods = new StdPrs_ShadedShapeLods(aSphere);
+  aSeqLods->SetRunParallel(false);
+  aSeqLods->AddLevel(0.05, 100.0);
+  aSeqLods->Perform();
+  ASSERT_TRUE(aSeqLods->IsDone());
+
+  occ::handle<StdPrs_ShadedShapeLods> anAsyncLods = new StdPrs_ShadedShapeLods(aSphere);
+  anAsyncLods->AddLevel(0.05, 100.0);
+  anAsyncLods->PerformAsync();
+  anAsyncLods->Wait();
+  ASSERT_TRUE(anAsyncLods->IsDone());
+  EXPECT_FALSE(anAsyncLods->IsRunning());
+  EXPECT_EQ(anAsyncLods->Value(1).Closed->ItemNumber(), aSeqLods->Value(1).Closed->ItemNumber());
+}
@@ -64,4 +64,6 @@ set(OCCT_Prs3d_FILES
   Prs3d_TypeOfHLR.hxx
   Prs3d_TypeOfLinePicking.hxx
   Prs3d_VertexDrawMode.hxx
+  Prs3d_WireframeCache.cxx
+  Prs3d_WireframeCache.hxx
 )
@@ -38,6 +38,7 @@ class Prs3d_PlaneAspect;
 class Prs3d_ArrowAspect;
 class Prs3d_DatumAspect;
 class Prs3d_DimensionAspect;
+class Prs3d_WireframeCache;
 class TCollection_AsciiString;
 
 //! A graphic attribute manager which governs how
@@ -169,6 +170,23 @@ public:
   //! false.
   Standard_EXPORT void SetIsoOnTriangulation(const bool theToEnable);
 
+  //! Returns the cache of wireframe polylines used by StdPrs_WFShape, or NULL if not defined.
+  const occ::handle<Prs3d_WireframeCache>& WireframeCache() const
+  {
+    return !myWireframeCache.IsNull() || myLink.IsNull() ? myWireframeCache
+                                                         : myLink->WireframeCache();
+  }
+
+  //! Returns true if the drawer has its own wireframe cache.
+  bool HasOwnWireframeCache() const { return !myWireframeCache.IsNull(); }
+
+  //! Sets the cache of wireframe polylines; NULL (default) means the cache of the link.
+  //! The same cache can be assigned to several drawers to share polylines of the same shapes.
+  void SetWireframeCache(const occ::handle<Prs3d_WireframeCache>& theCache)
+  {
+    myWireframeCache = theCache;
+  }
+
   //! Sets the discretisation parameter theValue.
   void SetDiscretisation(const int theValue) { myNbPoints = theValue; }
 
@@ -923,6 +941,8 @@ protected:
   bool                    myIsAutoTriangulated;
   bool                    myHasOwnIsAutoTriangulated;
 
+  occ::handle<Prs3d_WireframeCache> myWireframeCache;
+
   occ::handle<Prs3d_IsoAspect>     myUIsoAspect;
   occ::handle<Prs3d_IsoAspect>     myVIsoAspect;
   occ::handle<Prs3d_LineAspect>    myWireAspect;
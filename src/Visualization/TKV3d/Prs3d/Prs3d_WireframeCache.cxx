@@ -0,0 +1,89 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Prs3d_WireframeCache.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Prs3d_WireframeCache, Standard_Transient)
+
+//=================================================================================================
+
+int Prs3d_WireframeCache::Extent() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myEntries.Extent();
+}
+
+//=================================================================================================
+
+bool Prs3d_WireframeCache::Find(
+  const TopoDS_Shape&                                           theShape,
+  const Parameters&                                             theParams,
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theUPolylines,
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theVPolylines) const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  const Entry*                anEntry = myEntries.Seek(entryKey(theShape));
+  if (anEntry == nullptr || !anEntry->Params.IsEqual(theParams))
+  {
+    return false;
+  }
+
+  for (NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>::Iterator aPolyIter(
+         anEntry->UPolylines);
+       aPolyIter.More();
+       aPolyIter.Next())
+  {
+    theUPolylines.Append(aPolyIter.Value());
+  }
+  for (NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>::Iterator aPolyIter(
+         anEntry->VPolylines);
+       aPolyIter.More();
+       aPolyIter.Next())
+  {
+    theVPolylines.Append(aPolyIter.Value());
+  }
+  return true;
+}
+
+//=================================================================================================
+
+void Prs3d_WireframeCache::Bind(
+  const TopoDS_Shape&                                                 theShape,
+  const Parameters&                                                   theParams,
+  const NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theUPolylines,
+  const NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theVPolylines)
+{
+  Entry anEntry;
+  anEntry.Params     = theParams;
+  anEntry.UPolylines = theUPolylines;
+  anEntry.VPolylines = theVPolylines;
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myEntries.Bind(entryKey(theShape), anEntry);
+}
+
+//=================================================================================================
+
+void Prs3d_WireframeCache::Remove(const TopoDS_Shape& theShape)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myEntries.UnBind(entryKey(theShape));
+}
+
+//=================================================================================================
+
+void Prs3d_WireframeCache::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myEntries.Clear();
+}
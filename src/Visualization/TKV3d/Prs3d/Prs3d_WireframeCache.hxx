@@ -0,0 +1,119 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Prs3d_WireframeCache_HeaderFile
+#define _Prs3d_WireframeCache_HeaderFile
+
+#include <gp_Pnt.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_HSequence.hxx>
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <mutex>
+
+//! Cache of wireframe presentation data computed by StdPrs_WFShape:
+//! isolines of faces and polylines of edges.
+//!
+//! Polylines are stored per sub-shape in the coordinate system of its TopoDS_TShape
+//! (the location and orientation of the sub-shape are ignored),
+//! so that they are reused on recomputation of presentation with unchanged parameters
+//! and by presentations of several instances of the same shape.
+//! Each entry keeps the parameters it has been computed with and is recomputed on their change.
+//!
+//! The cache is enabled by assigning it to the drawer (Prs3d_Drawer::SetWireframeCache());
+//! it can be shared by several drawers and is safe to be used from several threads.
+//! Entries are never released automatically, see Remove() and Clear().
+class Prs3d_WireframeCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Prs3d_WireframeCache, Standard_Transient)
+public:
+  //! Parameters of the cached polylines.
+  struct Parameters
+  {
+    //! discrete data polylines are built from (triangulation or polygon), NULL for exact geometry
+    occ::handle<Standard_Transient> Source;
+    double                          Deflection            = 0.0;
+    double                          DeviationCoefficient  = 0.0;
+    double                          DeviationAngle        = 0.0;
+    double                          MaximalParameterValue = 0.0;
+    int                             NbUIsos               = 0;
+    int                             NbVIsos               = 0;
+
+    //! Returns TRUE if parameters are equal.
+    bool IsEqual(const Parameters& theOther) const
+    {
+      return Source == theOther.Source && Deflection == theOther.Deflection
+             && DeviationCoefficient == theOther.DeviationCoefficient
+             && DeviationAngle == theOther.DeviationAngle
+             && MaximalParameterValue == theOther.MaximalParameterValue
+             && NbUIsos == theOther.NbUIsos && NbVIsos == theOther.NbVIsos;
+    }
+  };
+
+public:
+  //! Empty constructor.
+  Prs3d_WireframeCache() {}
+
+  //! Returns the number of cached sub-shapes.
+  Standard_EXPORT int Extent() const;
+
+  //! Finds polylines of the sub-shape computed with the same parameters.
+  //! @param[in] theShape       face or edge (location and orientation are ignored)
+  //! @param[in] theParams      parameters to match
+  //! @param[out] theUPolylines  U isolines of the face or polylines of the edge to be appended
+  //! @param[out] theVPolylines  V isolines of the face to be appended
+  //! @return FALSE if the sub-shape is not cached or has been computed with other parameters
+  Standard_EXPORT bool Find(
+    const TopoDS_Shape&                                           theShape,
+    const Parameters&                                             theParams,
+    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theUPolylines,
+    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theVPolylines) const;
+
+  //! Stores polylines of the sub-shape, replacing the previous entry.
+  //! Polylines should be defined in the coordinate system of the sub-shape TopoDS_TShape
+  //! and should not be modified afterwards.
+  Standard_EXPORT void Bind(
+    const TopoDS_Shape&                                                 theShape,
+    const Parameters&                                                   theParams,
+    const NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theUPolylines,
+    const NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theVPolylines);
+
+  //! Removes the entry of the sub-shape.
+  Standard_EXPORT void Remove(const TopoDS_Shape& theShape);
+
+  //! Removes all entries.
+  Standard_EXPORT void Clear();
+
+private:
+  //! Cached polylines of the sub-shape.
+  struct Entry
+  {
+    Parameters                                                   Params;
+    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> UPolylines;
+    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> VPolylines;
+  };
+
+  //! Returns the sub-shape without location and orientation.
+  static TopoDS_Shape entryKey(const TopoDS_Shape& theShape)
+  {
+    return theShape.Located(TopLoc_Location()).Oriented(TopAbs_FORWARD);
+  }
+
+private:
+  NCollection_DataMap<TopoDS_Shape, Entry, TopTools_ShapeMapHasher> myEntries;
+  mutable std::mutex                                                myMutex;
+};
+
+#endif // _Prs3d_WireframeCache_HeaderFile
@@ -23,6 +23,8 @@ set(OCCT_Select3D_FILES
   Select3D_SensitiveFace.hxx
   Select3D_SensitiveGroup.cxx
   Select3D_SensitiveGroup.hxx
+  Select3D_SensitiveInstances.cxx
+  Select3D_SensitiveInstances.hxx
   Select3D_SensitivePoint.cxx
   Select3D_SensitivePoint.hxx
   Select3D_SensitivePoly.cxx
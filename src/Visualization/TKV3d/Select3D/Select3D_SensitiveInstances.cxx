@@ -0,0 +1,278 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Select3D_SensitiveInstances.hxx>
+
+#include <gp_GTrsf.hxx>
+#include <SelectMgr_FrustumBuilder.hxx>
+#include <SelectMgr_SelectingVolumeManager.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Select3D_SensitiveInstances, Select3D_SensitiveSet)
+
+//=================================================================================================
+
+Select3D_SensitiveInstances::Select3D_SensitiveInstances(
+  const occ::handle<SelectMgr_EntityOwner>&    theOwnerId,
+  const occ::handle<Select3D_SensitiveEntity>& theEntity)
+    : Select3D_SensitiveSet(theOwnerId),
+      myEntity(theEntity),
+      myEntityBox(theEntity->BoundingBox()),
+      myEntityCenter(theEntity->CenterOfGeometry()),
+      myCentersSum(0.0, 0.0, 0.0)
+{
+}
+
+//=================================================================================================
+
+Select3D_SensitiveInstances::Select3D_SensitiveInstances(
+  const occ::handle<SelectMgr_EntityOwner>&    theOwnerId,
+  const occ::handle<Select3D_SensitiveEntity>& theEntity,
+  const occ::handle<Graphic3d_InstanceBuffer>& theInstances)
+    : Select3D_SensitiveSet(theOwnerId),
+      myEntity(theEntity),
+      myEntityBox(theEntity->BoundingBox()),
+      myEntityCenter(theEntity->CenterOfGeometry()),
+      myCentersSum(0.0, 0.0, 0.0)
+{
+  if (theInstances.IsNull())
+  {
+    return;
+  }
+
+  for (int anInstIter = 1; anInstIter <= theInstances->NbInstances(); ++anInstIter)
+  {
+    AddInstance(theInstances->Transformation(anInstIter));
+  }
+}
+
+//=================================================================================================
+
+int Select3D_SensitiveInstances::AddInstance(const gp_Trsf& theTrsf)
+{
+  myBVHPrimIndexes.Append(myTrsfs.Length());
+  myTrsfs.Append(theTrsf);
+  myCentersSum += myEntityCenter.Transformed(theTrsf).XYZ();
+  if (myBndBox.IsValid())
+  {
+    myBndBox.Combine(instanceBox(theTrsf));
+  }
+  MarkDirty();
+  return myTrsfs.Length();
+}
+
+//=================================================================================================
+
+void Select3D_SensitiveInstances::Clear()
+{
+  myTrsfs.Clear();
+  myBVHPrimIndexes.Clear();
+  myBndBox.Clear();
+  myCentersSum = gp_XYZ(0.0, 0.0, 0.0);
+  MarkDirty();
+}
+
+//=================================================================================================
+
+int Select3D_SensitiveInstances::NbSubElements() const
+{
+  return myEntity->NbSubElements() * myTrsfs.Length();
+}
+
+//=================================================================================================
+
+occ::handle<Select3D_SensitiveEntity> Select3D_SensitiveInstances::GetConnected()
+{
+  occ::handle<Select3D_SensitiveInstances> aNewEntity =
+    new Select3D_SensitiveInstances(myOwnerId, myEntity->GetConnected());
+  for (int anInstIter = 0; anInstIter < myTrsfs.Length(); ++anInstIter)
+  {
+    aNewEntity->AddInstance(myTrsfs.Value(anInstIter));
+  }
+  return aNewEntity;
+}
+
+//=================================================================================================
+
+void Select3D_SensitiveInstances::Set(const occ::handle<SelectMgr_EntityOwner>& theOwnerId)
+{
+  Select3D_SensitiveEntity::Set(theOwnerId);
+  myEntity->Set(theOwnerId);
+}
+
+//=================================================================================================
+
+Select3D_BndBox3d Select3D_SensitiveInstances::instanceBox(const gp_Trsf& theTrsf) const
+{
+  Select3D_BndBox3d aBox;
+  if (!myEntityBox.IsValid())
+  {
+    return aBox;
+  }
+
+  const NCollection_Vec3<double>& aMin = myEntityBox.CornerMin();
+  const NCollection_Vec3<double>& aMax = myEntityBox.CornerMax();
+  for (int aCornerIter = 0; aCornerIter < 8; ++aCornerIter)
+  {
+    gp_XYZ aCorner((aCornerIter & 1) != 0 ? aMax.x() : aMin.x(),
+                   (aCornerIter & 2) != 0 ? aMax.y() : aMin.y(),
+                   (aCornerIter & 4) != 0 ? aMax.z() : aMin.z());
+    theTrsf.Transforms(aCorner);
+    aBox.Add(NCollection_Vec3<double>(aCorner.X(), aCorner.Y(), aCorner.Z()));
+  }
+  return aBox;
+}
+
+//=================================================================================================
+
+Select3D_BndBox3d Select3D_SensitiveInstances::BoundingBox()
+{
+  if (myBndBox.IsValid())
+  {
+    return myBndBox;
+  }
+
+  for (int anInstIter = 0; anInstIter < myTrsfs.Length(); ++anInstIter)
+  {
+    myBndBox.Combine(instanceBox(myTrsfs.Value(anInstIter)));
+  }
+  return myBndBox;
+}
+
+//=================================================================================================
+
+gp_Pnt Select3D_SensitiveInstances::CenterOfGeometry() const
+{
+  return myTrsfs.IsEmpty() ? myEntityCenter
+                           : gp_Pnt(myCentersSum / static_cast<double>(myTrsfs.Length()));
+}
+
+//=================================================================================================
+
+Select3D_BndBox3d Select3D_SensitiveInstances::Box(const int theIdx) const
+{
+  return instanceBox(myTrsfs.Value(myBVHPrimIndexes.Value(theIdx)));
+}
+
+//=================================================================================================
+
+double Select3D_SensitiveInstances::Center(const int theIdx, const int theAxis) const
+{
+  const gp_Pnt aCenter =
+    myEntityCenter.Transformed(myTrsfs.Value(myBVHPrimIndexes.Value(theIdx)));
+  return theAxis == 0 ? aCenter.X() : (theAxis == 1 ? aCenter.Y() : aCenter.Z());
+}
+
+//=================================================================================================
+
+void Select3D_SensitiveInstances::Swap(const int theIdx1, const int theIdx2)
+{
+  const int anInstIdx1 = myBVHPrimIndexes.Value(theIdx1);
+  const int anInstIdx2 = myBVHPrimIndexes.Value(theIdx2);
+
+  myBVHPrimIndexes.ChangeValue(theIdx1) = anInstIdx2;
+  myBVHPrimIndexes.ChangeValue(theIdx2) = anInstIdx1;
+}
+
+//=================================================================================================
+
+int Select3D_SensitiveInstances::Size() const
+{
+  return myBVHPrimIndexes.Length();
+}
+
+//=================================================================================================
+
+bool Select3D_SensitiveInstances::overlapsElement(
+  SelectBasics_PickResult&             thePickResult,
+  SelectBasics_SelectingVolumeManager& theMgr,
+  int                                  theElemIdx,
+  bool)
+{
+  const gp_Trsf& aTrsf = myTrsfs.Value(myBVHPrimIndexes.Value(theElemIdx));
+  if (aTrsf.Form() == gp_Identity)
+  {
+    return myEntity->Matches(theMgr, thePickResult);
+  }
+
+  const SelectMgr_SelectingVolumeManager* aMgr =
+    dynamic_cast<const SelectMgr_SelectingVolumeManager*>(&theMgr);
+  if (aMgr == nullptr)
+  {
+    return false;
+  }
+
+  // transform selecting volume into coordinate system of the instance
+  SelectMgr_SelectingVolumeManager aLocalMgr =
+    aMgr->ScaleAndTransform(1, gp_GTrsf(aTrsf.Inverted()), nullptr);
+  SelectBasics_PickResult aPickResult;
+  if (!myEntity->Matches(aLocalMgr, aPickResult))
+  {
+    return false;
+  }
+
+  // bring detected point and normal back into coordinate system of the set
+  if (aLocalMgr.GetActiveSelectionType() == SelectMgr_SelectionType_Point)
+  {
+    gp_Pnt aPnt = aPickResult.HasPickedPoint() ? aPickResult.PickedPoint()
+                                               : aLocalMgr.DetectedPoint(aPickResult.Depth());
+    aPnt.Transform(aTrsf);
+    aPickResult.SetPickedPoint(aPnt);
+
+    // the depth is measured by the volume of the set, as the scale of transformed volume
+    // does not take into account the scale of the volume it has been built from
+    aPickResult.SetDepth(theMgr.DistToGeometryCenter(aPnt));
+
+    const NCollection_Vec3<float>& aNorm = aPickResult.SurfaceNormal();
+    if (aNorm.SquareModulus() > ShortRealEpsilon())
+    {
+      gp_Vec aVec(aNorm.x(), aNorm.y(), aNorm.z());
+      aVec.Transform(aTrsf);
+      aPickResult.SetSurfaceNormal(aVec);
+    }
+  }
+  thePickResult = aPickResult;
+  return true;
+}
+
+//=================================================================================================
+
+bool Select3D_SensitiveInstances::elementIsInside(SelectBasics_SelectingVolumeManager& theMgr,
+                                                  int                                  theElemIdx,
+                                                  bool theIsFullInside)
+{
+  if (theIsFullInside)
+  {
+    return true;
+  }
+
+  SelectBasics_PickResult aDummy;
+  return overlapsElement(aDummy, theMgr, theElemIdx, theIsFullInside);
+}
+
+//=================================================================================================
+
+double Select3D_SensitiveInstances::distanceToCOG(SelectBasics_SelectingVolumeManager& theMgr)
+{
+  return theMgr.DistToGeometryCenter(CenterOfGeometry());
+}
+
+//=================================================================================================
+
+void Select3D_SensitiveInstances::DumpJson(Standard_OStream& theOStream, int theDepth) const
+{
+  OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
+  OCCT_DUMP_BASE_CLASS(theOStream, theDepth, Select3D_SensitiveSet)
+
+  OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myEntity.get())
+  OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myBndBox)
+}
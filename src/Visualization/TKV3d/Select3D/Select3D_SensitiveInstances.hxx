@@ -0,0 +1,123 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Select3D_SensitiveInstances_HeaderFile
+#define _Select3D_SensitiveInstances_HeaderFile
+
+#include <gp_Trsf.hxx>
+#include <Graphic3d_InstanceBuffer.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <Select3D_SensitiveSet.hxx>
+
+//! Sensitive entity representing the same sensitive entity placed at several locations,
+//! complementing instanced primitive arrays (Graphic3d_Group::AddInstancedPrimitiveArray()).
+//! The base entity (and its BVH tree) is shared by all instances;
+//! the selecting volume is transformed into local coordinate system of each instance
+//! instead of duplicating sensitive geometry.
+class Select3D_SensitiveInstances : public Select3D_SensitiveSet
+{
+  DEFINE_STANDARD_RTTIEXT(Select3D_SensitiveInstances, Select3D_SensitiveSet)
+public:
+  //! Constructs an empty set of instances of the given entity.
+  Standard_EXPORT Select3D_SensitiveInstances(
+    const occ::handle<SelectMgr_EntityOwner>&    theOwnerId,
+    const occ::handle<Select3D_SensitiveEntity>& theEntity);
+
+  //! Constructs the set of instances of the given entity from instance buffer.
+  Standard_EXPORT Select3D_SensitiveInstances(
+    const occ::handle<SelectMgr_EntityOwner>&    theOwnerId,
+    const occ::handle<Select3D_SensitiveEntity>& theEntity,
+    const occ::handle<Graphic3d_InstanceBuffer>& theInstances);
+
+  //! Returns the shared base entity.
+  const occ::handle<Select3D_SensitiveEntity>& BaseEntity() const { return myEntity; }
+
+  //! Returns the number of instances.
+  int NbInstances() const { return myTrsfs.Length(); }
+
+  //! Returns transformation of the instance within [1, NbInstances()] range.
+  const gp_Trsf& Instance(const int theIndex) const { return myTrsfs.Value(theIndex - 1); }
+
+  //! Appends a new instance and returns its index.
+  Standard_EXPORT int AddInstance(const gp_Trsf& theTrsf);
+
+  //! Return index of last detected instance within [1, NbInstances()] range or -1.
+  int LastDetectedInstance() const
+  {
+    return myDetectedIdx != -1 ? myBVHPrimIndexes.Value(myDetectedIdx) + 1 : -1;
+  }
+
+  //! Removes all instances.
+  Standard_EXPORT void Clear() override;
+
+  //! Returns the amount of sub-entities of all instances.
+  Standard_EXPORT int NbSubElements() const override;
+
+  Standard_EXPORT occ::handle<Select3D_SensitiveEntity> GetConnected() override;
+
+  //! Sets the owner for the set and the base entity.
+  Standard_EXPORT void Set(const occ::handle<SelectMgr_EntityOwner>& theOwnerId) override;
+
+  //! Returns bounding box of all instances.
+  Standard_EXPORT Select3D_BndBox3d BoundingBox() override;
+
+  //! Returns center of all instances.
+  Standard_EXPORT gp_Pnt CenterOfGeometry() const override;
+
+  //! Returns bounding box of the instance with index theIdx.
+  Standard_EXPORT Select3D_BndBox3d Box(const int theIdx) const override;
+
+  //! Returns geometry center of the instance with index theIdx along the given axis theAxis.
+  Standard_EXPORT double Center(const int theIdx, const int theAxis) const override;
+
+  //! Swaps items with indexes theIdx1 and theIdx2.
+  Standard_EXPORT void Swap(const int theIdx1, const int theIdx2) override;
+
+  //! Returns the number of instances.
+  Standard_EXPORT int Size() const override;
+
+  //! Dumps the content of me into the stream
+  Standard_EXPORT void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const override;
+
+protected:
+  //! Checks whether the instance with index theElemIdx overlaps the current selecting volume;
+  //! the volume is transformed into the instance coordinate system.
+  Standard_EXPORT bool overlapsElement(SelectBasics_PickResult&             thePickResult,
+                                       SelectBasics_SelectingVolumeManager& theMgr,
+                                       int                                  theElemIdx,
+                                       bool theIsFullInside) override;
+
+  //! Checks whether the instance with index theElemIdx is inside the current selecting volume.
+  Standard_EXPORT bool elementIsInside(SelectBasics_SelectingVolumeManager& theMgr,
+                                       int                                  theElemIdx,
+                                       bool theIsFullInside) override;
+
+  //! Calculates distance from the 3d projection of used-picked screen point to center of the
+  //! geometry
+  Standard_EXPORT double distanceToCOG(SelectBasics_SelectingVolumeManager& theMgr) override;
+
+private:
+  //! Returns bounding box of the base entity transformed to the instance location.
+  Select3D_BndBox3d instanceBox(const gp_Trsf& theTrsf) const;
+
+private:
+  occ::handle<Select3D_SensitiveEntity> myEntity;         //!< shared base entity
+  Select3D_BndBox3d                     myEntityBox;      //!< bounding box of the base entity
+  gp_Pnt                                myEntityCenter;   //!< center of the base entity
+  NCollection_DynamicArray<gp_Trsf>     myTrsfs;          //!< instances transformations
+  gp_XYZ                                myCentersSum;     //!< sum of instances centers
+  NCollection_DynamicArray<int>         myBVHPrimIndexes; //!< instances indexes for BVH tree
+  mutable Select3D_BndBox3d             myBndBox;         //!< bounding box of all instances
+};
+
+#endif // _Select3D_SensitiveInstances_HeaderFile
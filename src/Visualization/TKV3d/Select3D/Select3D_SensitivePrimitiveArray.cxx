@@ -906,15 +906,31 @@ bool Select3D_SensitivePrimitiveArray::Matches(SelectBasics_SelectingVolumeManag
     return true;
   }
 
-  SelectBasics_PickResult aPickResult;
-  bool                    hasResults = false;
-  for (int aGroupIter = 0; aGroupIter < myBvhIndices.NbElements; ++aGroupIter)
+  // sub-groups keep their own detection state and are independent from each other,
+  // so that they might be tested concurrently and results are merged in the same order
+  const int                                   aNbGroups = myBvhIndices.NbElements;
+  NCollection_Array1<SelectBasics_PickResult> aPickResults(0, std::max(aNbGroups - 1, 0));
+  NCollection_Array1<bool>                    aMatches(0, std::max(aNbGroups - 1, 0));
+  OSD_Parallel::For(
+    0,
+    aNbGroups,
+    [&](const int theGroupIter) {
+      const occ::handle<Select3D_SensitivePrimitiveArray>& aChild =
+        myGroups->Value(myBvhIndices.Index(theGroupIter));
+      SelectBasics_PickResult& aPickResult = aPickResults.ChangeValue(theGroupIter);
+      aMatches.SetValue(theGroupIter, aChild->Matches(theMgr, aPickResult));
+    },
+    aNbGroups <= 1 || !theMgr.ToTraverseParallel());
+
+  bool hasResults = false;
+  for (int aGroupIter = 0; aGroupIter < aNbGroups; ++aGroupIter)
   {
     const int                                      anElemIdx = myBvhIndices.Index(aGroupIter);
     occ::handle<Select3D_SensitivePrimitiveArray>& aChild    = myGroups->ChangeValue(anElemIdx);
-    if (aChild->Matches(theMgr, aPickResult))
+    if (aMatches.Value(aGroupIter))
     {
-      hasResults = true;
+      const SelectBasics_PickResult& aPickResult = aPickResults.Value(aGroupIter);
+      hasResults                                 = true;
       if (!myDetectedElemMap.IsNull())
       {
         NCollection_PackedMapAlgo::Unite(myDetectedElemMap->ChangeMap(),
@@ -144,6 +144,10 @@ public:
   //! Returns flag indicating if partial overlapping of entities is allowed or should be rejected.
   virtual bool IsOverlapAllowed() const = 0;
 
+  //! Returns TRUE if sensitive entities are allowed to test their sub-elements in parallel threads
+  //! (see SelectMgr_ViewerSelector::SetToTraverseParallel()); FALSE by default.
+  virtual bool ToTraverseParallel() const { return false; }
+
   //! Valid only for point and rectangular selection.
   //! Returns projection of 2d mouse picked point or projection
   //! of center of 2d rectangle (for point and rectangular selection
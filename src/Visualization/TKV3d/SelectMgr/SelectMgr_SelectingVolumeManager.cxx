@@ -29,7 +29,8 @@
 //=======================================================================
 SelectMgr_SelectingVolumeManager::SelectMgr_SelectingVolumeManager()
     : myActiveSelectingVolume(nullptr),
-      myToAllowOverlap(false)
+      myToAllowOverlap(false),
+      myToTraverseParallel(false)
 {
 }
 
@@ -61,10 +62,11 @@ SelectMgr_SelectingVolumeManager SelectMgr_SelectingVolumeManager::ScaleAndTrans
 
   aMgr.myActiveSelectingVolume =
     myActiveSelectingVolume->ScaleAndTransform(theScaleFactor, theTrsf, theBuilder);
-  aMgr.myToAllowOverlap   = myToAllowOverlap;
-  aMgr.myViewClipPlanes   = myViewClipPlanes;
-  aMgr.myObjectClipPlanes = myObjectClipPlanes;
-  aMgr.myViewClipRange    = myViewClipRange;
+  aMgr.myToAllowOverlap     = myToAllowOverlap;
+  aMgr.myToTraverseParallel = myToTraverseParallel;
+  aMgr.myViewClipPlanes     = myViewClipPlanes;
+  aMgr.myObjectClipPlanes   = myObjectClipPlanes;
+  aMgr.myViewClipRange      = myViewClipRange;
 
   return aMgr;
 }
@@ -80,10 +82,11 @@ SelectMgr_SelectingVolumeManager SelectMgr_SelectingVolumeManager::CopyWithBuild
   const occ::handle<SelectMgr_FrustumBuilder>& theBuilder) const
 {
   SelectMgr_SelectingVolumeManager aMgr;
-  aMgr.myToAllowOverlap   = myToAllowOverlap;
-  aMgr.myViewClipPlanes   = myViewClipPlanes;
-  aMgr.myObjectClipPlanes = myObjectClipPlanes;
-  aMgr.myViewClipRange    = myViewClipRange;
+  aMgr.myToAllowOverlap     = myToAllowOverlap;
+  aMgr.myToTraverseParallel = myToTraverseParallel;
+  aMgr.myViewClipPlanes     = myViewClipPlanes;
+  aMgr.myObjectClipPlanes   = myObjectClipPlanes;
+  aMgr.myViewClipRange      = myViewClipRange;
   if (!myActiveSelectingVolume.IsNull())
   {
     aMgr.myActiveSelectingVolume = myActiveSelectingVolume->CopyWithBuilder(theBuilder);
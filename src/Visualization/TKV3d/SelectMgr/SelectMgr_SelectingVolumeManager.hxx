@@ -221,6 +221,12 @@ public:
 
   Standard_EXPORT bool IsOverlapAllowed() const override;
 
+  //! Returns TRUE if sensitive entities are allowed to test their sub-elements in parallel threads.
+  bool ToTraverseParallel() const override { return myToTraverseParallel; }
+
+  //! Allows sensitive entities to test their sub-elements in parallel threads.
+  void SetToTraverseParallel(const bool theToTraverse) { myToTraverseParallel = theToTraverse; }
+
   //! Return view clipping planes.
   const occ::handle<Graphic3d_SequenceOfHClipPlane>& ViewClipping() const
   {
@@ -307,6 +313,7 @@ private:
   occ::handle<Graphic3d_SequenceOfHClipPlane> myObjectClipPlanes;                //!< object clipping planes
   SelectMgr_ViewClipRange                myViewClipRange;
   bool                       myToAllowOverlap;                  //!< Defines if partially overlapped entities will me detected or not
+  bool                       myToTraverseParallel;              //!< Defines if sensitive entities may test sub-elements in parallel threads
   // clang-format on
 };
 
@@ -23,6 +23,7 @@
 #include <Graphic3d_Flipper.hxx>
 #include <Graphic3d_TransformUtils.hxx>
 #include <OSD_Environment.hxx>
+#include <OSD_Parallel.hxx>
 #include <Select3D_SensitiveEntity.hxx>
 #include <SelectBasics_PickResult.hxx>
 #include <SelectMgr.hxx>
@@ -171,6 +172,7 @@ SelectMgr_ViewerSelector::SelectMgr_ViewerSelector()
       myToPreferClosest(true),
       myCameraScale(1.0),
       myToPrebuildBVH(false),
+      myToTraverseParallel(false),
       myIsSorted(false),
       myIsLeftChildQueuedFirst(false)
 {
@@ -269,6 +271,16 @@ int SelectMgr_ViewerSelector::sensitivity(
 void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
                                             const gp_GTrsf&                   theInversedTrsf,
                                             SelectMgr_SelectingVolumeManager& theMgr)
+{
+  checkOverlap(theEntity, theInversedTrsf, theMgr, mystored);
+}
+
+//=================================================================================================
+
+void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
+                                            const gp_GTrsf&                   theInversedTrsf,
+                                            SelectMgr_SelectingVolumeManager& theMgr,
+                                            MapOfOwnerCriterion&              theStored)
 {
   const occ::handle<SelectMgr_EntityOwner>& anOwner = theEntity->OwnerId();
   occ::handle<SelectMgr_SelectableObject>   aSelectable =
@@ -307,7 +319,7 @@ void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_Sensitive
     }
   }
 
-  if (SelectMgr_SortCriterion* aPrevCriterion = mystored.ChangeSeek(anOwner))
+  if (SelectMgr_SortCriterion* aPrevCriterion = theStored.ChangeSeek(anOwner))
   {
     ++aPrevCriterion->NbOwnerMatches;
     aCriterion.NbOwnerMatches = aPrevCriterion->NbOwnerMatches;
@@ -324,7 +336,7 @@ void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_Sensitive
   {
     aCriterion.NbOwnerMatches = 1;
     updatePoint3d(aCriterion, aPickResult, theEntity, theInversedTrsf, theMgr);
-    mystored.Add(anOwner, aCriterion);
+    theStored.Add(anOwner, aCriterion);
   }
 }
 
@@ -404,8 +416,28 @@ void SelectMgr_ViewerSelector::traverseObject(
   const NCollection_Mat4<double>&                theWorldViewMat,
   const NCollection_Vec2<int>&                   theWinSize)
 {
-  occ::handle<SelectMgr_SensitiveEntitySet>& anEntitySet =
-    myMapOfObjectSensitives.ChangeFind(theObject);
+  traverseObject(theObject,
+                 theMgr,
+                 theCamera,
+                 theProjectionMat,
+                 theWorldViewMat,
+                 theWinSize,
+                 mystored);
+}
+
+//=================================================================================================
+
+void SelectMgr_ViewerSelector::traverseObject(
+  const occ::handle<SelectMgr_SelectableObject>& theObject,
+  const SelectMgr_SelectingVolumeManager&        theMgr,
+  const occ::handle<Graphic3d_Camera>&           theCamera,
+  const NCollection_Mat4<double>&                theProjectionMat,
+  const NCollection_Mat4<double>&                theWorldViewMat,
+  const NCollection_Vec2<int>&                   theWinSize,
+  MapOfOwnerCriterion&                           theStored)
+{
+  const occ::handle<SelectMgr_SensitiveEntitySet>& anEntitySet =
+    myMapOfObjectSensitives.Find(theObject);
   if (anEntitySet->Size() == 0)
   {
     return;
@@ -518,7 +550,7 @@ void SelectMgr_ViewerSelector::traverseObject(
     }
   }
 
-  const int aFirstStored = mystored.Extent() + 1;
+  const int aFirstStored = theStored.Extent() + 1;
 
   int                                                        aStack[BVH_Constants_MaxTreeDepth];
   int                                                        aHead = -1;
@@ -654,7 +686,7 @@ void SelectMgr_ViewerSelector::traverseObject(
 
           gp_GTrsf aInvFlippingAndPers = aFlippingTrsf * aInvSensTrsf;
           computeFrustum(anEnt, theMgr, aMgr, aInvFlippingAndPers, aScaledTrnsfFrustums, aTmpMgr);
-          checkOverlap(anEnt, aInvFlippingAndPers, aTmpMgr);
+          checkOverlap(anEnt, aInvFlippingAndPers, aTmpMgr, theStored);
         }
       }
       if (aHead < 0)
@@ -675,15 +707,15 @@ void SelectMgr_ViewerSelector::traverseObject(
     return;
   }
 
-  for (int aStoredIter = mystored.Extent(); aStoredIter >= aFirstStored; --aStoredIter)
+  for (int aStoredIter = theStored.Extent(); aStoredIter >= aFirstStored; --aStoredIter)
   {
-    const SelectMgr_SortCriterion&            aCriterion = mystored.FindFromIndex(aStoredIter);
+    const SelectMgr_SortCriterion&            aCriterion = theStored.FindFromIndex(aStoredIter);
     const occ::handle<SelectMgr_EntityOwner>& anOwner    = aCriterion.Entity->OwnerId();
     int                                       aNbOwnerEntities = 0;
     anEntitySet->Owners().Find(anOwner, aNbOwnerEntities);
     if (aNbOwnerEntities > aCriterion.NbOwnerMatches)
     {
-      mystored.RemoveFromIndex(aStoredIter);
+      theStored.RemoveFromIndex(aStoredIter);
     }
   }
 }
@@ -699,6 +731,7 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
 
   mystored.Clear();
   myIsSorted = false;
+  mySelectingVolumeMgr.SetToTraverseParallel(myToTraverseParallel);
 
   NCollection_Vec2<int> aWinSize;
   mySelectingVolumeMgr.WindowSize(aWinSize.x(), aWinSize.y());
@@ -719,6 +752,14 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
   }
   mySelectableObjects.UpdateBVH(aCamera, aWinSize);
 
+  // box and polyline selection might detect a lot of entities within many objects;
+  // objects are collected first and traversed concurrently into separate result maps,
+  // which are then merged in the same order as within sequential traversal
+  const bool toTraverseParallel =
+    myToTraverseParallel
+    && (mySelectingVolumeMgr.GetActiveSelectionType() == SelectMgr_SelectionType_Box
+        || mySelectingVolumeMgr.GetActiveSelectionType() == SelectMgr_SelectionType_Polyline);
+  NCollection_DynamicArray<occ::handle<SelectMgr_SelectableObject>> aCandidates;
   for (int aBVHSetIt = 0; aBVHSetIt < SelectMgr_SelectableObjectSet::BVHSubsetNb; ++aBVHSetIt)
   {
     const SelectMgr_SelectableObjectSet::BVHSubset aBVHSubset =
@@ -844,7 +885,16 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
           const occ::handle<SelectMgr_SelectableObject>& aSelObj =
             mySelectableObjects.GetObjectById(aBVHSubset, anIdx);
           const occ::handle<Graphic3d_ViewAffinity>& aViewAffinity = aSelObj->ViewAffinity();
-          if (theViewId == -1 || aViewAffinity->IsVisible(theViewId))
+          if (theViewId != -1 && !aViewAffinity->IsVisible(theViewId))
+          {
+            continue;
+          }
+
+          if (toTraverseParallel)
+          {
+            aCandidates.Append(aSelObj);
+          }
+          else
           {
             traverseObject(aSelObj, aMgr, aCamera, aProjectionMat, aWorldViewMat, aWinSize);
           }
@@ -858,6 +908,12 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
         --aHead;
       }
     }
+
+    if (!aCandidates.IsEmpty())
+    {
+      traverseObjects(aCandidates, aMgr, aCamera, aProjectionMat, aWorldViewMat, aWinSize);
+      aCandidates.Clear();
+    }
   }
 
   SortResult();
@@ -865,6 +921,58 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
 
 //=================================================================================================
 
+void SelectMgr_ViewerSelector::traverseObjects(
+  const NCollection_DynamicArray<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+  const SelectMgr_SelectingVolumeManager&                                  theMgr,
+  const occ::handle<Graphic3d_Camera>&                                     theCamera,
+  const NCollection_Mat4<double>&                                          theProjectionMat,
+  const NCollection_Mat4<double>&                                          theWorldViewMat,
+  const NCollection_Vec2<int>&                                             theWinSize)
+{
+  const int                               aNbObjects = (int)theObjects.Length();
+  NCollection_Array1<MapOfOwnerCriterion> aResults(0, aNbObjects - 1);
+  OSD_Parallel::For(
+    0,
+    aNbObjects,
+    [&](const int theIndex) {
+      traverseObject(theObjects.Value(theIndex),
+                     theMgr,
+                     theCamera,
+                     theProjectionMat,
+                     theWorldViewMat,
+                     theWinSize,
+                     aResults.ChangeValue(theIndex));
+    },
+    aNbObjects <= 1);
+
+  const bool isBoxSelection = theMgr.GetActiveSelectionType() == SelectMgr_SelectionType_Box;
+  for (int anObjIter = 0; anObjIter < aNbObjects; ++anObjIter)
+  {
+    const MapOfOwnerCriterion& aResult = aResults.Value(anObjIter);
+    for (int aResIter = 1; aResIter <= aResult.Extent(); ++aResIter)
+    {
+      const occ::handle<SelectMgr_EntityOwner>& anOwner    = aResult.FindKey(aResIter);
+      const SelectMgr_SortCriterion&            aCriterion = aResult.FindFromIndex(aResIter);
+      SelectMgr_SortCriterion*                  aPrevCriterion = mystored.ChangeSeek(anOwner);
+      if (aPrevCriterion == nullptr)
+      {
+        mystored.Add(anOwner, aCriterion);
+        continue;
+      }
+
+      // the same owner has been detected within another object
+      const int aNbOwnerMatches = aPrevCriterion->NbOwnerMatches + aCriterion.NbOwnerMatches;
+      if (!isBoxSelection && aCriterion.IsCloserDepth(*aPrevCriterion))
+      {
+        *aPrevCriterion = aCriterion;
+      }
+      aPrevCriterion->NbOwnerMatches = aNbOwnerMatches;
+    }
+  }
+}
+
+//=================================================================================================
+
 void SelectMgr_ViewerSelector::ClearPicked()
 {
   mystored.Clear();
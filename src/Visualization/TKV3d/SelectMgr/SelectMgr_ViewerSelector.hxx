@@ -34,6 +34,7 @@
 #include <StdSelect_TypeOfSelectionImage.hxx>
 #include <Standard_Integer.hxx>
 #include <NCollection_Array1.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <NCollection_HArray1.hxx>
 
 class SelectMgr_SensitiveEntitySet;
@@ -324,6 +325,20 @@ public:
   //! Returns TRUE if building BVH for sensitives in separate threads is enabled
   bool ToPrebuildBVH() const { return myToPrebuildBVH; }
 
+  //! Enables/disables traversal of sensitives of different selectable objects in parallel threads
+  //! for box and polyline selection; FALSE by default.
+  //! The flag also allows sensitive entities to test their sub-elements in parallel threads
+  //! (see SelectBasics_SelectingVolumeManager::ToTraverseParallel()).
+  //! Sensitive entities should not share mutable state between selectable objects.
+  void SetToTraverseParallel(bool theToTraverse) { myToTraverseParallel = theToTraverse; }
+
+  //! Returns TRUE if sensitives of selectable objects are traversed in parallel threads.
+  bool ToTraverseParallel() const { return myToTraverseParallel; }
+
+protected:
+  typedef NCollection_IndexedDataMap<occ::handle<SelectMgr_EntityOwner>, SelectMgr_SortCriterion>
+    MapOfOwnerCriterion;
+
 protected:
   //! Traverses BVH containing all added selectable objects and
   //! finds candidates for further search of overlap
@@ -345,12 +360,39 @@ protected:
                                       const NCollection_Mat4<double>& theWorldViewMat,
                                       const NCollection_Vec2<int>&    theWinSize);
 
+  //! Internal function that checks if there is possible overlap between some entity of selectable
+  //! object theObject and current selecting volume, and puts detected owners into theStored map.
+  Standard_EXPORT void traverseObject(const occ::handle<SelectMgr_SelectableObject>& theObject,
+                                      const SelectMgr_SelectingVolumeManager&        theMgr,
+                                      const occ::handle<Graphic3d_Camera>&           theCamera,
+                                      const NCollection_Mat4<double>& theProjectionMat,
+                                      const NCollection_Mat4<double>& theWorldViewMat,
+                                      const NCollection_Vec2<int>&    theWinSize,
+                                      MapOfOwnerCriterion&            theStored);
+
+  //! Traverses the list of selectable objects in parallel threads
+  //! and appends detected owners to the list of picked results in the order of objects.
+  Standard_EXPORT void traverseObjects(
+    const NCollection_DynamicArray<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+    const SelectMgr_SelectingVolumeManager&                                  theMgr,
+    const occ::handle<Graphic3d_Camera>&                                     theCamera,
+    const NCollection_Mat4<double>&                                          theProjectionMat,
+    const NCollection_Mat4<double>&                                          theWorldViewMat,
+    const NCollection_Vec2<int>&                                             theWinSize);
+
   //! Internal function that checks if a particular sensitive
   //! entity theEntity overlaps current selecting volume precisely
   Standard_EXPORT void checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
                                     const gp_GTrsf&                              theInversedTrsf,
                                     SelectMgr_SelectingVolumeManager&            theMgr);
 
+  //! Internal function that checks if a particular sensitive entity theEntity
+  //! overlaps current selecting volume precisely, and puts detected owner into theStored map.
+  Standard_EXPORT void checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
+                                    const gp_GTrsf&                              theInversedTrsf,
+                                    SelectMgr_SelectingVolumeManager&            theMgr,
+                                    MapOfOwnerCriterion&                         theStored);
+
   //! Update z-layers order map.
   Standard_EXPORT void updateZLayers(const occ::handle<V3d_View>& theView);
 
@@ -402,6 +444,7 @@ protected:
 
   bool                                 myToPrebuildBVH;
   occ::handle<SelectMgr_BVHThreadPool> myBVHThreadPool;
+  bool                                 myToTraverseParallel;
 
   mutable NCollection_Array1<int> myIndexes;
   mutable bool                    myIsSorted;
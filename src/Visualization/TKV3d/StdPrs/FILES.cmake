@@ -28,6 +28,8 @@ set(OCCT_StdPrs_FILES
   StdPrs_PoleCurve.hxx
   StdPrs_ShadedShape.cxx
   StdPrs_ShadedShape.hxx
+  StdPrs_ShadedShapeLods.cxx
+  StdPrs_ShadedShapeLods.hxx
   StdPrs_ShadedSurface.cxx
   StdPrs_ShadedSurface.hxx
   StdPrs_ShapeTool.cxx
@@ -36,6 +36,7 @@
 #include <Prs3d_ShadingAspect.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
+#include <StdPrs_ShadedShapeLods.hxx>
 #include <StdPrs_ToolTriangulatedShape.hxx>
 #include <StdPrs_WFShape.hxx>
 #include <TopExp.hxx>
@@ -48,6 +49,8 @@
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 
+#include <algorithm>
+
 namespace
 {
 
@@ -627,6 +630,65 @@ void StdPrs_ShadedShape::Add(const occ::handle<Prs3d_Presentation>& thePrs,
 
 //=================================================================================================
 
+void StdPrs_ShadedShape::AddLods(const occ::handle<Prs3d_Presentation>&     thePrs,
+                                 const occ::handle<Prs3d_Drawer>&           theDrawer,
+                                 const occ::handle<StdPrs_ShadedShapeLods>& theLods,
+                                 const int                                  theFirstGroup)
+{
+  if (theLods.IsNull() || !theLods->IsDone() || theLods->NbLevels() == 0)
+  {
+    return;
+  }
+
+  // sort levels from the finest to the coarsest one
+  NCollection_Array1<int> aLevels(1, theLods->NbLevels());
+  for (int aLevelIter = 1; aLevelIter <= theLods->NbLevels(); ++aLevelIter)
+  {
+    aLevels.SetValue(aLevelIter, aLevelIter);
+  }
+  std::sort(aLevels.begin(), aLevels.end(), [&](const int theLevel1, const int theLevel2) {
+    return theLods->Value(theLevel1).MaxSize > theLods->Value(theLevel2).MaxSize;
+  });
+
+  const double aFinestMin = theLods->Value(aLevels.First()).MaxSize;
+  const NCollection_Sequence<occ::handle<Graphic3d_Group>>& aGroups = thePrs->Groups();
+  const occ::handle<Graphic3d_Aspects>& aShadingAspect = theDrawer->ShadingAspect()->Aspect();
+  for (int aGroupIter = std::max(theFirstGroup, 1); aGroupIter <= aGroups.Length(); ++aGroupIter)
+  {
+    // only triangles are replaced by levels, edges and face boundaries remain always visible
+    const occ::handle<Graphic3d_Group>& aGroup = aGroups.Value(aGroupIter);
+    if (aGroup->Aspects() == aShadingAspect)
+    {
+      aGroup->SetLodRange(aFinestMin, RealLast());
+    }
+  }
+
+  for (int aLevelIter = aLevels.Lower(); aLevelIter <= aLevels.Upper(); ++aLevelIter)
+  {
+    const StdPrs_ShadedShapeLods::Level& aLevel = theLods->Value(aLevels.Value(aLevelIter));
+    const double                         aMinSize =
+      aLevelIter < aLevels.Upper() ? theLods->Value(aLevels.Value(aLevelIter + 1)).MaxSize : 0.0;
+    for (int aPartIter = 0; aPartIter < 2; ++aPartIter)
+    {
+      const bool                                     isClosed = aPartIter == 0;
+      const occ::handle<Graphic3d_ArrayOfTriangles>& aTris =
+        isClosed ? aLevel.Closed : aLevel.Opened;
+      if (aTris.IsNull())
+      {
+        continue;
+      }
+
+      occ::handle<Graphic3d_Group> aGroup = thePrs->NewGroup();
+      aGroup->SetLodRange(aMinSize, aLevel.MaxSize);
+      aGroup->SetClosed(isClosed);
+      aGroup->SetGroupPrimitivesAspect(theDrawer->ShadingAspect()->Aspect());
+      aGroup->AddPrimitiveArray(aTris);
+    }
+  }
+}
+
+//=================================================================================================
+
 occ::handle<Graphic3d_ArrayOfTriangles> StdPrs_ShadedShape::FillTriangles(
   const TopoDS_Shape& theShape,
   const bool          theHasTexels,
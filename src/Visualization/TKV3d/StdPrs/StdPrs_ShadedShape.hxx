@@ -23,6 +23,7 @@
 
 class Graphic3d_ArrayOfSegments;
 class Graphic3d_ArrayOfTriangles;
+class StdPrs_ShadedShapeLods;
 class TopoDS_Shape;
 class BRep_Builder;
 class TopoDS_Compound;
@@ -55,6 +56,20 @@ public:
                                   const StdPrs_Volume theVolume = StdPrs_Volume_Autodetection,
                                   const occ::handle<Graphic3d_Group>& theGroup = nullptr);
 
+  //! Adds coarse levels of detail to the shaded presentation.
+  //! Groups of the presentation starting from theFirstGroup (e.g. created by Add()) are displayed
+  //! when the projected size of the presentation is not less than the largest level threshold,
+  //! while coarse levels are displayed below their thresholds.
+  //! Does nothing if levels have not been computed yet.
+  //! @param[in] thePrs         the presentation
+  //! @param[in] theDrawer      the drawer defining shading aspect
+  //! @param[in] theLods        computed levels of detail
+  //! @param[in] theFirstGroup  index of the first presentation group displaying finest level
+  Standard_EXPORT static void AddLods(const occ::handle<Prs3d_Presentation>&     thePrs,
+                                      const occ::handle<Prs3d_Drawer>&           theDrawer,
+                                      const occ::handle<StdPrs_ShadedShapeLods>& theLods,
+                                      const int                                  theFirstGroup = 1);
+
   //! Searches closed and unclosed subshapes in shape structure and puts them
   //! into two compounds for separate processing of closed and unclosed sub-shapes
   Standard_EXPORT static void ExploreSolids(const TopoDS_Shape& theShape,
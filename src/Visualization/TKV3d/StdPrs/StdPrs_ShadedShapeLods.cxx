@@ -0,0 +1,361 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StdPrs_ShadedShapeLods.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_B3.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+#include <StdPrs_ShadedShape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(StdPrs_ShadedShapeLods, Standard_Transient)
+
+namespace
+{
+//! Number of bits per axis within the key of grid cell.
+constexpr int THE_CELL_BITS = 21;
+
+//! Maximal index of grid cell along axis.
+constexpr long long THE_CELL_MAX = (1LL << THE_CELL_BITS) - 1;
+
+//! Returns index of grid cell along axis.
+long long cellIndex(const double theCoord, const double theMin, const double theCellSize)
+{
+  const double anIndex = (theCoord - theMin) / theCellSize;
+  return std::min(std::max(static_cast<long long>(anIndex), 0LL), THE_CELL_MAX);
+}
+} // namespace
+
+//=================================================================================================
+
+StdPrs_ShadedShapeLods::StdPrs_ShadedShapeLods(const TopoDS_Shape& theShape,
+                                               const StdPrs_Volume theVolume)
+    : myShape(theShape),
+      myVolume(theVolume),
+      myMinCorner(0.0, 0.0, 0.0),
+      myShapeSize(0.0),
+      myThread(threadFunction),
+      myIsRunning(false),
+      myIsDone(false),
+      myIsRunParallel(true)
+{
+}
+
+//=================================================================================================
+
+StdPrs_ShadedShapeLods::~StdPrs_ShadedShapeLods()
+{
+  Wait();
+}
+
+//=================================================================================================
+
+int StdPrs_ShadedShapeLods::AddLevel(const double theCellRatio, const double theMaxSize)
+{
+  Wait();
+  Level aLevel;
+  aLevel.CellRatio = theCellRatio;
+  aLevel.MaxSize   = theMaxSize;
+  myLevels.Append(aLevel);
+  myIsDone = false;
+  return myLevels.Length();
+}
+
+//=================================================================================================
+
+void StdPrs_ShadedShapeLods::Perform()
+{
+  Wait();
+  collectParts();
+  computeLevels();
+}
+
+//=================================================================================================
+
+void StdPrs_ShadedShapeLods::PerformAsync()
+{
+  Wait();
+  collectParts();
+  myIsRunning = true;
+  if (!myThread.Run(this))
+  {
+    // fallback to synchronous computation
+    computeLevels();
+    myIsRunning = false;
+  }
+}
+
+//=================================================================================================
+
+void StdPrs_ShadedShapeLods::Wait()
+{
+  if (myIsRunning)
+  {
+    myThread.Wait();
+    myIsRunning = false;
+  }
+}
+
+//=================================================================================================
+
+void* StdPrs_ShadedShapeLods::threadFunction(void* theData)
+{
+  static_cast<StdPrs_ShadedShapeLods*>(theData)->computeLevels();
+  return nullptr;
+}
+
+//=================================================================================================
+
+void StdPrs_ShadedShapeLods::collectParts()
+{
+  myIsDone = false;
+  myParts.Clear();
+  myShapeSize = 0.0;
+  if (myShape.IsNull())
+  {
+    return;
+  }
+
+  // split the shape into closed and open parts in the same way as StdPrs_ShadedShape
+  NCollection_DynamicArray<TopoDS_Shape> aShapes;
+  NCollection_DynamicArray<bool>         aClosedFlags;
+  if ((myShape.ShapeType() == TopAbs_COMPOUND || myShape.ShapeType() == TopAbs_COMPSOLID
+       || myShape.ShapeType() == TopAbs_SOLID)
+      && myVolume == StdPrs_Volume_Autodetection)
+  {
+    TopoDS_Compound anOpened, aClosed;
+    BRep_Builder    aBuilder;
+    aBuilder.MakeCompound(aClosed);
+    aBuilder.MakeCompound(anOpened);
+    StdPrs_ShadedShape::ExploreSolids(myShape, aBuilder, aClosed, anOpened, true);
+    aShapes.Append(aClosed);
+    aClosedFlags.Append(true);
+    aShapes.Append(anOpened);
+    aClosedFlags.Append(false);
+  }
+  else
+  {
+    aShapes.Append(myShape);
+    aClosedFlags.Append(myVolume == StdPrs_Volume_Closed);
+  }
+
+  Bnd_B3d aBox;
+  for (int aShapeIter = 0; aShapeIter < aShapes.Length(); ++aShapeIter)
+  {
+    Part aPart;
+    aPart.IsClosed = aClosedFlags.Value(aShapeIter);
+    for (TopExp_Explorer aFaceIt(aShapes.Value(aShapeIter), TopAbs_FACE); aFaceIt.More();
+         aFaceIt.Next())
+    {
+      const TopoDS_Face&              aFace = TopoDS::Face(aFaceIt.Current());
+      TopLoc_Location                 aLoc;
+      occ::handle<Poly_Triangulation> aTris = BRep_Tool::Triangulation(aFace, aLoc);
+      if (aTris.IsNull() || !aTris->HasGeometry() || aTris->NbTriangles() <= 0)
+      {
+        continue;
+      }
+
+      const gp_Trsf& aTrsf = aLoc.Transformation();
+      for (int aNodeIter = 1; aNodeIter <= aTris->NbNodes(); ++aNodeIter)
+      {
+        aBox.Add(aTris->Node(aNodeIter).Transformed(aTrsf).XYZ());
+      }
+      aPart.Triangulations.Append(aTris);
+      aPart.Trsfs.Append(aTrsf);
+      aPart.IsReversed.Append(aFace.Orientation() == TopAbs_REVERSED);
+    }
+    if (!aPart.Triangulations.IsEmpty())
+    {
+      myParts.Append(aPart);
+    }
+  }
+
+  if (!aBox.IsVoid())
+  {
+    myMinCorner = aBox.CornerMin();
+    myShapeSize = (aBox.CornerMax() - aBox.CornerMin()).Modulus();
+  }
+}
+
+//=================================================================================================
+
+void StdPrs_ShadedShapeLods::computeLevels()
+{
+  const int aNbParts   = myParts.Length();
+  auto      aLevelFunc = [&](const int theIndex) {
+    Level&       aLevel    = myLevels.ChangeValue(theIndex);
+    const double aCellSize = std::max(aLevel.CellRatio * myShapeSize, Precision::Confusion());
+    aLevel.Closed.Nullify();
+    aLevel.Opened.Nullify();
+    for (int aPartIter = 0; aPartIter < aNbParts; ++aPartIter)
+    {
+      const Part& aPart = myParts.Value(aPartIter);
+      (aPart.IsClosed ? aLevel.Closed : aLevel.Opened) = decimate(aPart, aCellSize);
+    }
+  };
+  OSD_Parallel::For(0, myLevels.Length(), aLevelFunc, !myIsRunParallel || myLevels.Length() < 2);
+  myIsDone = true;
+}
+
+//=================================================================================================
+
+occ::handle<Graphic3d_ArrayOfTriangles> StdPrs_ShadedShapeLods::decimate(
+  const Part&  thePart,
+  const double theCellSize) const
+{
+  // cluster nodes of all faces on the same grid, so that shared face boundaries stay connected
+  int aNbNodes = 0;
+  for (int aFaceIter = 0; aFaceIter < thePart.Triangulations.Length(); ++aFaceIter)
+  {
+    aNbNodes += thePart.Triangulations.Value(aFaceIter)->NbNodes();
+  }
+  if (aNbNodes < 3)
+  {
+    return occ::handle<Graphic3d_ArrayOfTriangles>();
+  }
+
+  NCollection_DataMap<long long, int> aCellMap(aNbNodes / 4 + 1);
+  NCollection_DynamicArray<gp_XYZ>    aClusterSums;
+  NCollection_DynamicArray<int>       aClusterNbNodes;
+  NCollection_Array1<int>             aNodeClusters(0, aNbNodes - 1);
+  int                                 aNodeOffset = 0;
+  for (int aFaceIter = 0; aFaceIter < thePart.Triangulations.Length(); ++aFaceIter)
+  {
+    const occ::handle<Poly_Triangulation>& aTris = thePart.Triangulations.Value(aFaceIter);
+    const gp_Trsf&                         aTrsf = thePart.Trsfs.Value(aFaceIter);
+    for (int aNodeIter = 1; aNodeIter <= aTris->NbNodes(); ++aNodeIter)
+    {
+      const gp_Pnt    aPnt = aTris->Node(aNodeIter).Transformed(aTrsf);
+      const long long aKey =
+        (cellIndex(aPnt.X(), myMinCorner.X(), theCellSize) << (2 * THE_CELL_BITS))
+        | (cellIndex(aPnt.Y(), myMinCorner.Y(), theCellSize) << THE_CELL_BITS)
+        | cellIndex(aPnt.Z(), myMinCorner.Z(), theCellSize);
+      int aCluster = -1;
+      if (!aCellMap.Find(aKey, aCluster))
+      {
+        aCluster = aClusterSums.Length();
+        aCellMap.Bind(aKey, aCluster);
+        aClusterSums.Append(gp_XYZ(0.0, 0.0, 0.0));
+        aClusterNbNodes.Append(0);
+      }
+      aClusterSums.ChangeValue(aCluster) += aPnt.XYZ();
+      ++aClusterNbNodes.ChangeValue(aCluster);
+      aNodeClusters.SetValue(aNodeOffset + aNodeIter - 1, aCluster);
+    }
+    aNodeOffset += aTris->NbNodes();
+  }
+  for (int aClusterIter = 0; aClusterIter < aClusterSums.Length(); ++aClusterIter)
+  {
+    aClusterSums.ChangeValue(aClusterIter) /= double(aClusterNbNodes.Value(aClusterIter));
+  }
+
+  // remap triangles of each face onto clusters; vertices are not shared between faces
+  // to keep sharp edges along face boundaries
+  NCollection_Array1<int>          aClusterVertex(0, aClusterSums.Length() - 1);
+  NCollection_DynamicArray<int>    aFaceClusters;
+  NCollection_DynamicArray<gp_XYZ> aPositions;
+  NCollection_DynamicArray<gp_XYZ> aNormals;
+  NCollection_DynamicArray<int>    anIndices;
+  aClusterVertex.Init(-1);
+  aNodeOffset = 0;
+  for (int aFaceIter = 0; aFaceIter < thePart.Triangulations.Length(); ++aFaceIter)
+  {
+    const occ::handle<Poly_Triangulation>& aTris      = thePart.Triangulations.Value(aFaceIter);
+    const bool                             isReversed = thePart.IsReversed.Value(aFaceIter);
+    for (int aTriIter = 1; aTriIter <= aTris->NbTriangles(); ++aTriIter)
+    {
+      int aNodes[3];
+      if (isReversed)
+      {
+        aTris->Triangle(aTriIter).Get(aNodes[0], aNodes[2], aNodes[1]);
+      }
+      else
+      {
+        aTris->Triangle(aTriIter).Get(aNodes[0], aNodes[1], aNodes[2]);
+      }
+
+      int aClusters[3];
+      for (int aVertIter = 0; aVertIter < 3; ++aVertIter)
+      {
+        aClusters[aVertIter] = aNodeClusters.Value(aNodeOffset + aNodes[aVertIter] - 1);
+      }
+      if (aClusters[0] == aClusters[1] || aClusters[1] == aClusters[2]
+          || aClusters[0] == aClusters[2])
+      {
+        continue;
+      }
+
+      const gp_XYZ& aP1      = aClusterSums.Value(aClusters[0]);
+      const gp_XYZ  aTriNorm = (aClusterSums.Value(aClusters[1]) - aP1)
+                                .Crossed(aClusterSums.Value(aClusters[2]) - aP1);
+      if (aTriNorm.SquareModulus() <= Precision::SquareConfusion() * theCellSize * theCellSize)
+      {
+        continue;
+      }
+
+      for (int aVertIter = 0; aVertIter < 3; ++aVertIter)
+      {
+        int& aVertex = aClusterVertex.ChangeValue(aClusters[aVertIter]);
+        if (aVertex == -1)
+        {
+          aVertex = aPositions.Length();
+          aPositions.Append(aClusterSums.Value(aClusters[aVertIter]));
+          aNormals.Append(gp_XYZ(0.0, 0.0, 0.0));
+          aFaceClusters.Append(aClusters[aVertIter]);
+        }
+        aNormals.ChangeValue(aVertex) += aTriNorm;
+        anIndices.Append(aVertex + 1);
+      }
+    }
+
+    for (int aClusterIter = 0; aClusterIter < aFaceClusters.Length(); ++aClusterIter)
+    {
+      aClusterVertex.SetValue(aFaceClusters.Value(aClusterIter), -1);
+    }
+    aFaceClusters.Clear();
+    aNodeOffset += aTris->NbNodes();
+  }
+  if (anIndices.IsEmpty())
+  {
+    return occ::handle<Graphic3d_ArrayOfTriangles>();
+  }
+
+  occ::handle<Graphic3d_ArrayOfTriangles> anArray =
+    new Graphic3d_ArrayOfTriangles(aPositions.Length(),
+                                   anIndices.Length(),
+                                   Graphic3d_ArrayFlags_VertexNormal);
+  for (int aVertIter = 0; aVertIter < aPositions.Length(); ++aVertIter)
+  {
+    const gp_XYZ& aPos  = aPositions.Value(aVertIter);
+    gp_XYZ        aNorm = aNormals.Value(aVertIter);
+    const double  aLen  = aNorm.Modulus();
+    aNorm               = aLen > gp::Resolution() ? aNorm / aLen : gp_XYZ(0.0, 0.0, 1.0);
+    anArray->AddVertex(aPos.X(), aPos.Y(), aPos.Z(), aNorm.X(), aNorm.Y(), aNorm.Z());
+  }
+  for (int anIndexIter = 0; anIndexIter < anIndices.Length(); anIndexIter += 3)
+  {
+    anArray->AddEdges(anIndices.Value(anIndexIter),
+                      anIndices.Value(anIndexIter + 1),
+                      anIndices.Value(anIndexIter + 2));
+  }
+  return anArray;
+}
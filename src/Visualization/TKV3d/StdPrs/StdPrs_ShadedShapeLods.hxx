@@ -0,0 +1,147 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StdPrs_ShadedShapeLods_HeaderFile
+#define _StdPrs_ShadedShapeLods_HeaderFile
+
+#include <gp_Trsf.hxx>
+#include <Graphic3d_ArrayOfTriangles.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD_Thread.hxx>
+#include <Poly_Triangulation.hxx>
+#include <StdPrs_Volume.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <atomic>
+
+//! Builder of coarse levels of detail for shaded presentation of the shape.
+//!
+//! Each level is produced by decimating the existing triangulation of shape faces
+//! using vertex clustering on a regular grid shared by all faces,
+//! so that the simplified faces stay connected to each other.
+//! Levels are displayed instead of the original triangulation
+//! when projected size of the presentation falls below level threshold
+//! (see StdPrs_ShadedShape::AddLods() and Graphic3d_Group::SetLodRange()).
+//!
+//! Levels can be computed in the background thread (PerformAsync()),
+//! so that the presentation is displayed with original triangulation
+//! and recomputed with levels of detail once IsDone() returns TRUE.
+//! Texture coordinates are not generated for coarse levels.
+class StdPrs_ShadedShapeLods : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(StdPrs_ShadedShapeLods, Standard_Transient)
+public:
+  //! Triangles of a single level of detail.
+  struct Level
+  {
+    double                                  CellRatio; //!< relative size of clustering cell
+    double                                  MaxSize;   //!< maximal projected size in pixels
+    occ::handle<Graphic3d_ArrayOfTriangles> Closed;    //!< triangles of closed volumes
+    occ::handle<Graphic3d_ArrayOfTriangles> Opened;    //!< triangles of open shells
+
+    Level()
+        : CellRatio(0.0),
+          MaxSize(0.0)
+    {
+    }
+  };
+
+public:
+  //! Creates the builder for the shape.
+  //! @param[in] theShape   the shape to be triangulated before Perform()
+  //! @param[in] theVolume  the way to interpret closed and open volumes as in StdPrs_ShadedShape
+  Standard_EXPORT StdPrs_ShadedShapeLods(
+    const TopoDS_Shape& theShape,
+    const StdPrs_Volume theVolume = StdPrs_Volume_Autodetection);
+
+  //! Waits for the background computation.
+  Standard_EXPORT ~StdPrs_ShadedShapeLods() override;
+
+  //! Returns the shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Adds a level of detail; levels should be added before Perform().
+  //! Waits for completion of asynchronous computation, if any, and resets IsDone() state.
+  //! @param[in] theCellRatio  size of clustering cell relative to the diagonal of shape bounds
+  //! @param[in] theMaxSize    projected size of the presentation in pixels,
+  //!                          below which the level is displayed
+  //! @return index of the level
+  Standard_EXPORT int AddLevel(const double theCellRatio, const double theMaxSize);
+
+  //! Returns the number of levels.
+  int NbLevels() const { return myLevels.Length(); }
+
+  //! Returns the level within [1, NbLevels()] range.
+  //! Triangles are defined only when IsDone() returns TRUE.
+  const Level& Value(const int theIndex) const { return myLevels.Value(theIndex - 1); }
+
+  //! Sets the flag to compute levels in parallel threads; TRUE by default.
+  void SetRunParallel(const bool theToRunParallel) { myIsRunParallel = theToRunParallel; }
+
+  //! Returns TRUE if levels are computed in parallel threads.
+  bool IsRunParallel() const { return myIsRunParallel; }
+
+  //! Computes levels of detail from the current triangulation of the shape.
+  Standard_EXPORT void Perform();
+
+  //! Starts computation of levels of detail in the background thread.
+  //! Triangulation of the shape is collected within the calling thread,
+  //! so that the shape should be triangulated beforehand.
+  Standard_EXPORT void PerformAsync();
+
+  //! Waits for the background computation started by PerformAsync().
+  Standard_EXPORT void Wait();
+
+  //! Returns TRUE if the background computation is in progress.
+  bool IsRunning() const { return myIsRunning && !myIsDone; }
+
+  //! Returns TRUE if levels have been computed.
+  bool IsDone() const { return myIsDone; }
+
+private:
+  //! Triangulated faces of the shape sharing the same closed state.
+  struct Part
+  {
+    NCollection_DynamicArray<occ::handle<Poly_Triangulation>> Triangulations;
+    NCollection_DynamicArray<gp_Trsf>                         Trsfs;
+    NCollection_DynamicArray<bool>                            IsReversed;
+    bool                                                      IsClosed = false;
+  };
+
+  //! Collects face triangulations of the shape.
+  void collectParts();
+
+  //! Computes levels from collected triangulations.
+  void computeLevels();
+
+  //! Builds decimated triangles of the part.
+  occ::handle<Graphic3d_ArrayOfTriangles> decimate(const Part& thePart,
+                                                   const double theCellSize) const;
+
+  //! Thread function computing levels.
+  static void* threadFunction(void* theData);
+
+private:
+  TopoDS_Shape                    myShape;
+  StdPrs_Volume                   myVolume;
+  NCollection_DynamicArray<Level> myLevels;
+  NCollection_DynamicArray<Part>  myParts;
+  gp_XYZ                          myMinCorner;
+  double                          myShapeSize;
+  OSD_Thread                      myThread;
+  std::atomic<bool>               myIsRunning;
+  std::atomic<bool>               myIsDone;
+  bool                            myIsRunParallel;
+};
+
+#endif // _StdPrs_ShadedShapeLods_HeaderFile
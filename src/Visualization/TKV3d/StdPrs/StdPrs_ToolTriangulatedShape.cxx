@@ -20,6 +20,7 @@
 #include <BRepMesh_DiscretFactory.hxx>
 #include <BRepTools.hxx>
 #include <BRep_Tool.hxx>
+#include <Message_ProgressScope.hxx>
 #include <Prs3d.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <TopLoc_Location.hxx>
@@ -158,7 +159,8 @@ bool StdPrs_ToolTriangulatedShape::IsTessellated(const TopoDS_Shape&
 //=================================================================================================
 
 bool StdPrs_ToolTriangulatedShape::Tessellate(const TopoDS_Shape&              theShape,
-                                              const occ::handle<Prs3d_Drawer>& theDrawer)
+                                              const occ::handle<Prs3d_Drawer>& theDrawer,
+                                              const Message_ProgressRange&     theRange)
 {
   bool wasRecomputed = false;
   // Check if it is possible to avoid unnecessary recomputation of shape triangulation
@@ -174,7 +176,7 @@ bool StdPrs_ToolTriangulatedShape::Tessellate(const TopoDS_Shape&              t
     BRepMesh_DiscretFactory::Get().Discret(theShape, aDeflection, theDrawer->DeviationAngle());
   if (!aMeshAlgo.IsNull())
   {
-    aMeshAlgo->Perform();
+    aMeshAlgo->Perform(theRange);
     wasRecomputed = true;
   }
 
@@ -183,6 +185,33 @@ bool StdPrs_ToolTriangulatedShape::Tessellate(const TopoDS_Shape&              t
 
 //=================================================================================================
 
+bool StdPrs_ToolTriangulatedShape::LoadDeferredTriangulation(const TopoDS_Shape&          theShape,
+                                                             const Message_ProgressRange& theRange)
+{
+  int aNbFaces = 0;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    ++aNbFaces;
+  }
+
+  bool                  wasLoaded = false;
+  TopLoc_Location       aLocDummy;
+  Message_ProgressScope aPS(theRange, "Loading triangulation", aNbFaces);
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More() && aPS.More();
+       aFaceIter.Next(), aPS.Next())
+  {
+    const TopoDS_Face&                     aFace = TopoDS::Face(aFaceIter.Current());
+    const occ::handle<Poly_Triangulation>& aTri  = BRep_Tool::Triangulation(aFace, aLocDummy);
+    if (!aTri.IsNull() && aTri->HasDeferredData() && aTri->NbNodes() == 0)
+    {
+      wasLoaded = aTri->LoadDeferredData() || wasLoaded;
+    }
+  }
+  return wasLoaded;
+}
+
+//=================================================================================================
+
 void StdPrs_ToolTriangulatedShape::ClearOnOwnDeflectionChange(
   const TopoDS_Shape&              theShape,
   const occ::handle<Prs3d_Drawer>& theDrawer,
@@ -16,6 +16,7 @@
 
 #include <BRepLib_ToolTriangulatedShape.hxx>
 #include <gp_Dir.hxx>
+#include <Message_ProgressRange.hxx>
 #include <NCollection_Array1.hxx>
 
 class TopoDS_Shape;
@@ -56,9 +57,22 @@ public:
   //! Validates triangulation within the shape and performs tessellation if necessary.
   //! @param[in] theShape  the shape.
   //! @param[in] theDrawer  the display settings.
+  //! @param[in] theRange  the progress range, which can be used to interrupt meshing.
   //! @return true if tessellation was recomputed and false otherwise.
-  Standard_EXPORT static bool Tessellate(const TopoDS_Shape&              theShape,
-                                         const occ::handle<Prs3d_Drawer>& theDrawer);
+  Standard_EXPORT static bool Tessellate(
+    const TopoDS_Shape&              theShape,
+    const occ::handle<Prs3d_Drawer>& theDrawer,
+    const Message_ProgressRange&     theRange = Message_ProgressRange());
+
+  //! Loads active triangulations of the shape faces from deferred storage,
+  //! e.g. mesh data left in the glTF file read with RWGltf_CafReader::SetToSkipLateDataLoading().
+  //! Triangulations already holding nodes are not reloaded.
+  //! @param[in] theShape  the shape
+  //! @param[in] theRange  the progress range, which can be used to interrupt loading
+  //! @return true if at least one triangulation has been loaded
+  Standard_EXPORT static bool LoadDeferredTriangulation(
+    const TopoDS_Shape&          theShape,
+    const Message_ProgressRange& theRange = Message_ProgressRange());
 
   //! If presentation has own deviation coefficient and IsAutoTriangulation() is true,
   //! function will compare actual coefficients with previous values and will clear triangulation on
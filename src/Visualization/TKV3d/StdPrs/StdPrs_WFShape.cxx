@@ -23,6 +23,7 @@
 #include <StdPrs_ToolTriangulatedShape.hxx>
 #include <Prs3d_IsoAspect.hxx>
 #include <Prs3d.hxx>
+#include <Prs3d_WireframeCache.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Polygon3D.hxx>
 #include <Poly_Triangulation.hxx>
@@ -44,6 +45,196 @@
 
 #include <mutex>
 
+namespace
+{
+//! Appends polylines defined in the coordinate system of the sub-shape TShape.
+void appendPolylines(
+  const NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylines,
+  const TopLoc_Location&                                              theLocation,
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>&       theResult)
+{
+  const gp_Trsf& aTrsf = theLocation.Transformation();
+  for (NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>::Iterator aPolyIter(
+         thePolylines);
+       aPolyIter.More();
+       aPolyIter.Next())
+  {
+    if (theLocation.IsIdentity())
+    {
+      theResult.Append(aPolyIter.Value());
+      continue;
+    }
+
+    occ::handle<NCollection_HSequence<gp_Pnt>> aPoints = new NCollection_HSequence<gp_Pnt>();
+    for (NCollection_HSequence<gp_Pnt>::Iterator aPntIter(*aPolyIter.Value()); aPntIter.More();
+         aPntIter.Next())
+    {
+      aPoints->Append(aPntIter.Value().Transformed(aTrsf));
+    }
+    theResult.Append(aPoints);
+  }
+}
+
+//! Computes isolines of the face, or takes them from the wireframe cache of the drawer.
+void addIsolines(
+  const TopoDS_Face&                                            theFace,
+  const occ::handle<Prs3d_Drawer>&                              theDrawer,
+  const double                                                  theShapeDeflection,
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theUPolylines,
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& theVPolylines)
+{
+  const occ::handle<Prs3d_WireframeCache>& aCache = theDrawer->WireframeCache();
+  if (aCache.IsNull())
+  {
+    StdPrs_Isolines::Add(theFace, theDrawer, theShapeDeflection, theUPolylines, theVPolylines);
+    return;
+  }
+
+  const TopoDS_Face                aFace = TopoDS::Face(theFace.Located(TopLoc_Location()));
+  Prs3d_WireframeCache::Parameters aParams;
+  aParams.Deflection            = theShapeDeflection;
+  aParams.DeviationCoefficient  = theDrawer->DeviationCoefficient();
+  aParams.DeviationAngle        = theDrawer->DeviationAngle();
+  aParams.MaximalParameterValue = theDrawer->MaximalParameterValue();
+  aParams.NbUIsos               = theDrawer->UIsoAspect()->Number();
+  aParams.NbVIsos               = theDrawer->VIsoAspect()->Number();
+  if (theDrawer->IsoOnTriangulation())
+  {
+    TopLoc_Location aLocDummy;
+    aParams.Source = BRep_Tool::Triangulation(aFace, aLocDummy);
+  }
+
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aUPolylines, aVPolylines;
+  if (!aCache->Find(aFace, aParams, aUPolylines, aVPolylines))
+  {
+    StdPrs_Isolines::Add(aFace, theDrawer, theShapeDeflection, aUPolylines, aVPolylines);
+    aCache->Bind(aFace, aParams, aUPolylines, aVPolylines);
+  }
+  appendPolylines(aUPolylines, theFace.Location(), theUPolylines);
+  appendPolylines(aVPolylines, theFace.Location(), theVPolylines);
+}
+
+//! Computes the polyline of the edge.
+occ::handle<NCollection_HSequence<gp_Pnt>> edgePolyline(
+  const TopoDS_Edge&               theEdge,
+  const occ::handle<Prs3d_Drawer>& theDrawer,
+  const double                     theShapeDeflection)
+{
+  occ::handle<NCollection_HSequence<gp_Pnt>> aPoints = new NCollection_HSequence<gp_Pnt>;
+
+  TopLoc_Location                          aLocation;
+  occ::handle<Poly_Triangulation>          aTriangulation;
+  occ::handle<Poly_PolygonOnTriangulation> anEdgeIndicies;
+  BRep_Tool::PolygonOnTriangulation(theEdge, anEdgeIndicies, aTriangulation, aLocation);
+  occ::handle<Poly_Polygon3D> aPolygon;
+
+  if (!anEdgeIndicies.IsNull())
+  {
+    // Presentation based on triangulation of a face.
+    const NCollection_Array1<int>& anIndices = anEdgeIndicies->Nodes();
+
+    int anIndex = anIndices.Lower();
+    if (aLocation.IsIdentity())
+    {
+      for (; anIndex <= anIndices.Upper(); ++anIndex)
+      {
+        aPoints->Append(aTriangulation->Node(anIndices[anIndex]));
+      }
+    }
+    else
+    {
+      for (; anIndex <= anIndices.Upper(); ++anIndex)
+      {
+        aPoints->Append(aTriangulation->Node(anIndices[anIndex]).Transformed(aLocation));
+      }
+    }
+  }
+  else if (!(aPolygon = BRep_Tool::Polygon3D(theEdge, aLocation)).IsNull())
+  {
+    // Presentation based on triangulation of the free edge on a surface.
+    const NCollection_Array1<gp_Pnt>& aNodes  = aPolygon->Nodes();
+    int                               anIndex = aNodes.Lower();
+    if (aLocation.IsIdentity())
+    {
+      for (; anIndex <= aNodes.Upper(); ++anIndex)
+      {
+        aPoints->Append(aNodes.Value(anIndex));
+      }
+    }
+    else
+    {
+      for (; anIndex <= aNodes.Upper(); ++anIndex)
+      {
+        aPoints->Append(aNodes.Value(anIndex).Transformed(aLocation));
+      }
+    }
+  }
+  else if (BRep_Tool::IsGeometric(theEdge))
+  {
+    // Default presentation for edges without triangulation.
+    BRepAdaptor_Curve aCurve(theEdge);
+    StdPrs_DeflectionCurve::Add(occ::handle<Prs3d_Presentation>(),
+                                aCurve,
+                                theShapeDeflection,
+                                theDrawer,
+                                aPoints->ChangeSequence(),
+                                false);
+  }
+  return aPoints;
+}
+
+//! Computes the polyline of the edge, or takes it from the wireframe cache of the drawer.
+void addEdgePolyline(
+  const TopoDS_Edge&                                            theEdge,
+  const occ::handle<Prs3d_Drawer>&                              theDrawer,
+  const double                                                  theShapeDeflection,
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylines)
+{
+  const occ::handle<Prs3d_WireframeCache>& aCache = theDrawer->WireframeCache();
+  if (aCache.IsNull())
+  {
+    occ::handle<NCollection_HSequence<gp_Pnt>> aPoints =
+      edgePolyline(theEdge, theDrawer, theShapeDeflection);
+    if (!aPoints->IsEmpty())
+    {
+      thePolylines.Append(aPoints);
+    }
+    return;
+  }
+
+  const TopoDS_Edge                anEdge = TopoDS::Edge(theEdge.Located(TopLoc_Location()));
+  Prs3d_WireframeCache::Parameters aParams;
+  aParams.Deflection            = theShapeDeflection;
+  aParams.DeviationCoefficient  = theDrawer->DeviationCoefficient();
+  aParams.DeviationAngle        = theDrawer->DeviationAngle();
+  aParams.MaximalParameterValue = theDrawer->MaximalParameterValue();
+  {
+    TopLoc_Location                          aLocDummy;
+    occ::handle<Poly_Triangulation>          aTriangulation;
+    occ::handle<Poly_PolygonOnTriangulation> anEdgeIndicies;
+    BRep_Tool::PolygonOnTriangulation(anEdge, anEdgeIndicies, aTriangulation, aLocDummy);
+    aParams.Source = anEdgeIndicies;
+    if (anEdgeIndicies.IsNull())
+    {
+      aParams.Source = BRep_Tool::Polygon3D(anEdge, aLocDummy);
+    }
+  }
+
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines, anUnused;
+  if (!aCache->Find(anEdge, aParams, aPolylines, anUnused))
+  {
+    occ::handle<NCollection_HSequence<gp_Pnt>> aPoints =
+      edgePolyline(anEdge, theDrawer, theShapeDeflection);
+    if (!aPoints->IsEmpty())
+    {
+      aPolylines.Append(aPoints);
+    }
+    aCache->Bind(anEdge, aParams, aPolylines, anUnused);
+  }
+  appendPolylines(aPolylines, theEdge.Location(), thePolylines);
+}
+} // namespace
+
 //! Functor for executing StdPrs_Isolines in parallel threads.
 class StdPrs_WFShape_IsoFunctor
 {
@@ -67,7 +258,7 @@ public:
   {
     NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylinesU, aPolylinesV;
     const TopoDS_Face&                                           aFace = myFaces[theIndex];
-    StdPrs_Isolines::Add(aFace, myDrawer, myShapeDeflection, aPolylinesU, aPolylinesV);
+    addIsolines(aFace, myDrawer, myShapeDeflection, aPolylinesU, aPolylinesV);
     {
       std::lock_guard<std::mutex> aLock(myMutex);
       myPolylinesU.Append(aPolylinesU);
@@ -180,11 +371,7 @@ void StdPrs_WFShape::Add(const occ::handle<Prs3d_Presentation>& thePresentation,
         const TopoDS_Face& aFace = TopoDS::Face(aFaceExplorer.Current());
         if (theDrawer->IsoOnPlane() || !StdPrs_ShapeTool::IsPlanarFace(aFace))
         {
-          StdPrs_Isolines::Add(aFace,
-                               theDrawer,
-                               aShapeDeflection,
-                               *aUPolylinesPtr,
-                               *aVPolylinesPtr);
+          addIsolines(aFace, theDrawer, aShapeDeflection, *aUPolylinesPtr, *aVPolylinesPtr);
         }
       }
     }
@@ -327,75 +514,9 @@ void StdPrs_WFShape::addEdges(
   for (anEdgesIter.Initialize(theEdges); anEdgesIter.More(); anEdgesIter.Next())
   {
     const TopoDS_Edge& anEdge = TopoDS::Edge(anEdgesIter.Value());
-    if (BRep_Tool::Degenerated(anEdge))
+    if (!BRep_Tool::Degenerated(anEdge))
     {
-      continue;
-    }
-
-    occ::handle<NCollection_HSequence<gp_Pnt>> aPoints = new NCollection_HSequence<gp_Pnt>;
-
-    TopLoc_Location                          aLocation;
-    occ::handle<Poly_Triangulation>          aTriangulation;
-    occ::handle<Poly_PolygonOnTriangulation> anEdgeIndicies;
-    BRep_Tool::PolygonOnTriangulation(anEdge, anEdgeIndicies, aTriangulation, aLocation);
-    occ::handle<Poly_Polygon3D> aPolygon;
-
-    if (!anEdgeIndicies.IsNull())
-    {
-      // Presentation based on triangulation of a face.
-      const NCollection_Array1<int>& anIndices = anEdgeIndicies->Nodes();
-
-      int anIndex = anIndices.Lower();
-      if (aLocation.IsIdentity())
-      {
-        for (; anIndex <= anIndices.Upper(); ++anIndex)
-        {
-          aPoints->Append(aTriangulation->Node(anIndices[anIndex]));
-        }
-      }
-      else
-      {
-        for (; anIndex <= anIndices.Upper(); ++anIndex)
-        {
-          aPoints->Append(aTriangulation->Node(anIndices[anIndex]).Transformed(aLocation));
-        }
-      }
-    }
-    else if (!(aPolygon = BRep_Tool::Polygon3D(anEdge, aLocation)).IsNull())
-    {
-      // Presentation based on triangulation of the free edge on a surface.
-      const NCollection_Array1<gp_Pnt>& aNodes  = aPolygon->Nodes();
-      int                               anIndex = aNodes.Lower();
-      if (aLocation.IsIdentity())
-      {
-        for (; anIndex <= aNodes.Upper(); ++anIndex)
-        {
-          aPoints->Append(aNodes.Value(anIndex));
-        }
-      }
-      else
-      {
-        for (; anIndex <= aNodes.Upper(); ++anIndex)
-        {
-          aPoints->Append(aNodes.Value(anIndex).Transformed(aLocation));
-        }
-      }
-    }
-    else if (BRep_Tool::IsGeometric(anEdge))
-    {
-      // Default presentation for edges without triangulation.
-      BRepAdaptor_Curve aCurve(anEdge);
-      StdPrs_DeflectionCurve::Add(occ::handle<Prs3d_Presentation>(),
-                                  aCurve,
-                                  theShapeDeflection,
-                                  theDrawer,
-                                  aPoints->ChangeSequence(),
-                                  false);
-    }
-
-    if (!aPoints->IsEmpty())
-    {
-      thePolylines.Append(aPoints);
+      addEdgePolyline(anEdge, theDrawer, theShapeDeflection, thePolylines);
     }
   }
 }
@@ -32,6 +32,7 @@ class StdPrs_WFShape : public Prs3d_Root
 {
 public:
   //! Computes wireframe presentation of a shape.
+  //! Isolines and edge polylines are reused from Prs3d_Drawer::WireframeCache(), if defined.
   //! @param[in] thePresentation  the presentation.
   //! @param[in] theShape  the shape.
   //! @param[in] theDrawer  the draw settings.
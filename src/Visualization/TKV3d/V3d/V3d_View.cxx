@@ -3203,6 +3203,13 @@ TCollection_AsciiString V3d_View::StatisticInformation() const
 
 //=================================================================================================
 
+occ::handle<Graphic3d_FrameStats> V3d_View::FrameStats() const
+{
+  return myView->FrameStats();
+}
+
+//=================================================================================================
+
 const Graphic3d_RenderingParams& V3d_View::RenderingParams() const
 {
   return myView->RenderingParams();
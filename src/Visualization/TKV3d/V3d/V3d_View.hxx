@@ -1097,6 +1097,11 @@ public: //! @name Shader grid
   Standard_EXPORT void StatisticInformation(
     NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>& theDict) const;
 
+  //! Returns frame statistics collected by the view (NULL if not supported by graphic driver),
+  //! including per-layer and per-structure timings and the frame capture.
+  //! @sa Graphic3d_RenderingParams::CollectedStats
+  Standard_EXPORT occ::handle<Graphic3d_FrameStats> FrameStats() const;
+
   //! Returns the Objects number and the gravity center of ALL viewable points in the view
   Standard_EXPORT gp_Pnt GravityPoint() const;
 